@@ -11,6 +11,7 @@
 #include "dtype.hpp"
 #include "allocator.hpp"
 #include "../device/device.hpp"
+#include "../telemetry/runtime_metrics.hpp"
 
 #include <cstdlib>
 #include <cstring>
@@ -31,7 +32,9 @@ namespace zero {
  * @return Pointer to allocated memory, or nullptr on failure
  */
 inline void* mem_alloc(size_t size, size_t alignment, Device device) noexcept {
-    return get_allocator()->alloc(size, alignment, device);
+    void* ptr = get_allocator()->alloc(size, alignment, device);
+    ZERO_ALLOC_METRICS(size, ptr != nullptr);
+    return ptr;
 }
 
 /**
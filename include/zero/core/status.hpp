@@ -9,6 +9,8 @@
  */
 
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 
 namespace zero {
 
@@ -88,3 +90,29 @@ namespace status {
 }
 
 } // namespace zero
+
+// ─────────────────────────────────────────────────────────────────────
+// Unchecked-Path Preconditions (spec 004)
+// ─────────────────────────────────────────────────────────────────────
+
+/**
+ * @brief Assert that a validator returned ok() on an unchecked op path.
+ *
+ * `*_unchecked` ops skip validation in release builds. Debug builds (no
+ * NDEBUG), or builds defining ZERO_ASSERT_UNCHECKED, still run the same
+ * validator and abort with its message on failure.
+ */
+#if !defined(NDEBUG) || defined(ZERO_ASSERT_UNCHECKED)
+#define ZERO_UNCHECKED_PRECONDITION(expr)                                       \
+    do {                                                                        \
+        ::zero::Status zero_pre_s_ = (expr);                                    \
+        if (zero_pre_s_.is_error()) {                                           \
+            std::fprintf(stderr, "zero: unchecked precondition failed: %s (%s:%d)\n", \
+                         zero_pre_s_.msg ? zero_pre_s_.msg : "(no message)",    \
+                         __FILE__, __LINE__);                                   \
+            std::abort();                                                       \
+        }                                                                       \
+    } while (0)
+#else
+#define ZERO_UNCHECKED_PRECONDITION(expr) ((void)0)
+#endif
@@ -0,0 +1,68 @@
+#pragma once
+
+/**
+ * @file storage.hpp
+ * @brief Zero Core Runtime — Reference-Counted Tensor Storage
+ *
+ * Optional shared buffer behind a Tensor (see Tensor::alloc_shared).
+ * Tensors without a Storage keep the raw data / owns_data semantics.
+ */
+
+#include "memory.hpp"
+#include "../device/device.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace zero {
+
+/**
+ * @brief Heap buffer with an atomic reference count
+ *
+ * Every counted handle holds one reference; the last release() frees the
+ * buffer and the Storage itself. The header always lives in CPU memory,
+ * the buffer on `device`.
+ */
+struct Storage {
+    std::atomic<int64_t> refs;  ///< Counted handles alive
+    void* base;                 ///< Buffer start
+    size_t bytes;               ///< Buffer size
+    Device device;              ///< Buffer location
+
+    /**
+     * @brief Allocate a buffer with one reference, or nullptr on failure
+     */
+    static Storage* create(size_t bytes, size_t alignment, Device device) noexcept {
+        void* header = mem_alloc(sizeof(Storage), alignof(Storage), Device::CPU);
+        if (header == nullptr) return nullptr;
+        void* base = mem_alloc(bytes, alignment, device);
+        if (base == nullptr && bytes > 0) {
+            mem_free(header, Device::CPU);
+            return nullptr;
+        }
+        Storage* s = new (header) Storage;
+        s->refs.store(1, std::memory_order_relaxed);
+        s->base = base;
+        s->bytes = bytes;
+        s->device = device;
+        return s;
+    }
+
+    void retain() noexcept { refs.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief Drop one reference; frees everything on the last one
+     */
+    void release() noexcept {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        mem_free(base, device);
+        this->~Storage();
+        mem_free(this, Device::CPU);
+    }
+
+    int64_t use_count() const noexcept { return refs.load(std::memory_order_acquire); }
+};
+
+} // namespace zero
@@ -10,6 +10,8 @@
 
 #include "dtype.hpp"
 #include "memory.hpp"
+#include "status.hpp"
+#include "storage.hpp"
 #include "../device/device.hpp"
 
 #include <array>
@@ -31,6 +33,8 @@ constexpr int8_t MAX_DIMS = 8;
  * - No virtual methods, no inheritance
  * - Fixed-size arrays for shape/strides (no heap allocation for metadata)
  * - Views are O(1) metadata operations
+ * - Optional refcounted Storage (alloc_shared / share / make_writable);
+ *   a storage-backed tensor with owns_data holds one reference
  */
 struct Tensor {
     void* data;                              ///< Raw memory pointer
@@ -40,6 +44,7 @@ struct Tensor {
     std::array<int64_t, MAX_DIMS> shape;     ///< Size of each dimension
     std::array<int64_t, MAX_DIMS> strides;   ///< Byte stride for each dimension
     bool owns_data;                          ///< True if tensor owns its memory
+    Storage* storage;                        ///< Shared storage, or nullptr
     
     // ─────────────────────────────────────────────────────────────────
     // Factory Functions
@@ -57,6 +62,7 @@ struct Tensor {
         t.shape.fill(0);
         t.strides.fill(0);
         t.owns_data = false;
+        t.storage = nullptr;
         return t;
     }
     
@@ -87,6 +93,39 @@ struct Tensor {
         return t;
     }
     
+    /**
+     * @brief Allocate a tensor on refcounted storage (one reference)
+     * 
+     * Hand out further counted handles with share(); free() drops one
+     * reference and the last one frees the buffer.
+     */
+    static Tensor alloc_shared(
+        const int64_t* shape_ptr, 
+        int8_t ndim, 
+        DType dtype, 
+        Device device = Device::CPU
+    ) noexcept {
+        Tensor t = empty();
+        t.dtype = dtype;
+        t.device = device;
+        t.ndim = ndim;
+        
+        for (int8_t i = 0; i < ndim; ++i) {
+            t.shape[i] = shape_ptr[i];
+        }
+        
+        calc_contiguous_strides(shape_ptr, ndim, dtype, t.strides.data());
+        
+        size_t bytes = calc_tensor_bytes(shape_ptr, ndim, dtype);
+        t.storage = Storage::create(bytes, dtype_alignment(dtype), device);
+        if (t.storage != nullptr) {
+            t.data = t.storage->base;
+            t.owns_data = true;
+        }
+        
+        return t;
+    }
+    
     /**
      * @brief Create a tensor view (no copy, shared memory)
      */
@@ -211,11 +250,10 @@ struct Tensor {
     }
     
     /**
-     * @brief Check if reshape is valid
+     * @brief Check that new_shape is a valid shape with this tensor's numel
      */
-    bool can_reshape(const int64_t* new_shape, int8_t new_ndim) const noexcept {
+    bool same_numel(const int64_t* new_shape, int8_t new_ndim) const noexcept {
         if (new_ndim < 0 || new_ndim > MAX_DIMS) return false;
-        if (!is_contiguous()) return false;
         
         int64_t new_numel = 1;
         for (int8_t i = 0; i < new_ndim; ++i) {
@@ -225,6 +263,58 @@ struct Tensor {
         return new_numel == numel();
     }
     
+    /**
+     * @brief Check if reshape is valid as a view (no copy)
+     * 
+     * True when the element counts match and view_strides() finds
+     * strides for the new shape; any contiguous tensor qualifies.
+     */
+    bool can_reshape(const int64_t* new_shape, int8_t new_ndim) const noexcept {
+        std::array<int64_t, MAX_DIMS> unused;
+        return same_numel(new_shape, new_ndim) && view_strides(new_shape, new_ndim, unused.data());
+    }
+    
+    /**
+     * @brief Strides that view this tensor's elements as `new_shape`
+     * 
+     * Walks the dims from the innermost outwards, cutting them into
+     * chunks that are contiguous among themselves (stride[d - 1] ==
+     * shape[d] * stride[d]). Each chunk may be split or merged freely;
+     * the new dims must partition the chunks exactly, or the reshape
+     * needs a copy and this returns false. Size-1 dims never break a
+     * chunk. Sliced, permuted and broadcast (stride 0) views are handled
+     * alike. Element counts must already match.
+     */
+    bool view_strides(const int64_t* new_shape, int8_t new_ndim, int64_t* new_strides) const noexcept {
+        if (ndim == 0 || numel() == 0) {
+            calc_contiguous_strides(new_shape, new_ndim, dtype, new_strides);
+            return true;
+        }
+        
+        int8_t view_d = static_cast<int8_t>(new_ndim - 1);
+        int64_t chunk_stride = strides[ndim - 1];
+        int64_t tensor_numel = 1;
+        int64_t view_numel = 1;
+        for (int8_t d = ndim - 1; d >= 0; --d) {
+            tensor_numel *= shape[d];
+            // Chunk ends at the outermost dim or where the next one is not stacked on it
+            if (d == 0 || (shape[d - 1] != 1 && strides[d - 1] != tensor_numel * chunk_stride)) {
+                while (view_d >= 0 && (view_numel < tensor_numel || new_shape[view_d] == 1)) {
+                    new_strides[view_d] = view_numel * chunk_stride;
+                    view_numel *= new_shape[view_d];
+                    --view_d;
+                }
+                if (view_numel != tensor_numel) return false;
+                if (d > 0) {
+                    chunk_stride = strides[d - 1];
+                    tensor_numel = 1;
+                    view_numel = 1;
+                }
+            }
+        }
+        return view_d == -1;
+    }
+    
     /**
      * @brief Check if slice is valid
      */
@@ -345,9 +435,16 @@ struct Tensor {
     // ─────────────────────────────────────────────────────────────────
     
     /**
-     * @brief Reshape tensor (must have same numel)
+     * @brief Reshape tensor as a view (must have same numel)
+     * 
+     * Works whenever view_strides() can express the new shape, contiguous
+     * or not. Never allocates: returns empty() if the element counts
+     * differ or no strides fit (e.g. merging the dims of a transpose);
+     * use reshape_copy() for those.
      */
     Tensor reshape(const int64_t* new_shape, int8_t new_ndim) const noexcept {
+        if (!same_numel(new_shape, new_ndim)) return empty();
+        
         Tensor t = *this;
         t.ndim = new_ndim;
         t.owns_data = false; // View doesn't own data
@@ -356,14 +453,30 @@ struct Tensor {
             t.shape[i] = new_shape[i];
         }
         
-        // If contiguous, recalculate strides
-        if (is_contiguous()) {
-            calc_contiguous_strides(new_shape, new_ndim, dtype, t.strides.data());
+        if (!view_strides(new_shape, new_ndim, t.strides.data())) {
+            return empty();
         }
-        
         return t;
     }
     
+    /**
+     * @brief Gather the elements into a new contiguous tensor of `new_shape`
+     * 
+     * Always copies, in logical order; the result owns its data
+     * (storage-backed if this one is) and must be free()d. Returns
+     * empty() if the element counts differ, off CPU, or on allocation
+     * failure.
+     */
+    Tensor reshape_copy(const int64_t* new_shape, int8_t new_ndim) const noexcept {
+        if (!same_numel(new_shape, new_ndim) || device != Device::CPU) return empty();
+        Tensor out = storage != nullptr ? alloc_shared(new_shape, new_ndim, dtype, device)
+                                        : alloc(new_shape, new_ndim, dtype, device);
+        if (out.data != nullptr) {
+            copy_to_contiguous(out.data);
+        }
+        return out;
+    }
+    
     /**
      * @brief Transpose last two dimensions
      */
@@ -421,6 +534,96 @@ struct Tensor {
         return t;
     }
     
+    // ─────────────────────────────────────────────────────────────────
+    // Shared Storage (copy-on-write)
+    // ─────────────────────────────────────────────────────────────────
+    
+    /**
+     * @brief Counted handle to the same storage (O(1), no copy)
+     * 
+     * Works on any view of a storage-backed tensor, so a slice can outlive
+     * its base. Without storage this is view_like().
+     */
+    Tensor share() const noexcept {
+        Tensor t = *this;
+        if (storage == nullptr) {
+            t.owns_data = false;
+            return t;
+        }
+        storage->retain();
+        t.owns_data = true;
+        return t;
+    }
+    
+    /**
+     * @brief Counted handles alive on this storage (0 without storage)
+     */
+    int64_t use_count() const noexcept {
+        return storage != nullptr ? storage->use_count() : 0;
+    }
+    
+    bool is_shared() const noexcept {
+        return use_count() > 1;
+    }
+    
+    /**
+     * @brief Make this handle safe to write: copy only if storage is shared
+     * 
+     * With use_count() > 1 the viewed elements are copied into fresh
+     * contiguous storage and this handle's reference moves there (a
+     * borrowed view becomes the owner of the copy); other handles keep the
+     * old data. Sole owners and tensors without storage
+     * are left as is (O(1)).
+     */
+    Status make_writable() noexcept {
+        if (!is_shared()) return status::OK;
+        
+        size_t bytes = nbytes();
+        Storage* fresh = Storage::create(bytes, dtype_alignment(dtype), device);
+        if (fresh == nullptr) {
+            return status::allocation_failed("make_writable: storage allocation failed");
+        }
+        
+        std::array<int64_t, MAX_DIMS> dense;
+        calc_contiguous_strides(shape.data(), ndim, dtype, dense.data());
+        copy_to_contiguous(fresh->base);
+        
+        if (owns_data) storage->release();
+        storage = fresh;
+        data = fresh->base;
+        strides = dense;
+        owns_data = true;
+        return status::OK;
+    }
+    
+    /**
+     * @brief Copy the viewed elements, row-major, into dense CPU memory at dst
+     */
+    void copy_to_contiguous(void* dst) const noexcept {
+        size_t bytes = nbytes();
+        if (is_contiguous()) {
+            mem_copy_cpu(dst, data, bytes);
+            return;
+        }
+        if (bytes == 0) return;
+        
+        // Odometer over the view; byte-wise element copy for any dtype
+        size_t elem = dtype_size(dtype);
+        std::array<int64_t, MAX_DIMS> idx{};
+        const uint8_t* src = static_cast<const uint8_t*>(data);
+        uint8_t* out = static_cast<uint8_t*>(dst);
+        for (int64_t n = numel(); n > 0; --n) {
+            std::memcpy(out, src, elem);
+            out += elem;
+            for (int8_t d = ndim - 1; d >= 0; --d) {
+                src += strides[d];
+                if (++idx[d] < shape[d]) break;
+                src -= strides[d] * shape[d];
+                idx[d] = 0;
+            }
+        }
+    }
+    
     // ─────────────────────────────────────────────────────────────────
     // Memory Management
     // ─────────────────────────────────────────────────────────────────
@@ -434,9 +637,18 @@ struct Tensor {
     }
     
     /**
-     * @brief Free owned memory
+     * @brief Free owned memory (drops one reference if storage-backed)
      */
     void free() noexcept {
+        if (storage != nullptr) {
+            if (owns_data) {
+                storage->release();
+                storage = nullptr;
+                data = nullptr;
+                owns_data = false;
+            }
+            return;
+        }
         if (owns_data && data != nullptr) {
             mem_free(data, device);
             data = nullptr;
@@ -465,6 +677,7 @@ struct Tensor {
         }
         std::printf("]\n");
         std::printf("  owns_data: %s\n", owns_data ? "true" : "false");
+        std::printf("  use_count: %lld\n", static_cast<long long>(use_count()));
         std::printf("  valid: %s\n", valid() ? "true" : "false");
     }
 #else
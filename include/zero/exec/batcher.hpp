@@ -0,0 +1,343 @@
+#pragma once
+
+/**
+ * @file batcher.hpp
+ * @brief Zero Core Runtime — Dynamic Request Batching
+ *
+ * Collects single-sample requests from many threads into one batched
+ * step, bounded by a latency budget:
+ *
+ *   submit() ─lock-free push─▶ inbox ─drain─▶ FIFO ─pack─▶ [n, ...] step ─scatter─▶ outputs
+ *
+ * A batch closes when it reaches max_batch requests or when its oldest
+ * request has waited max_wait_us, whichever comes first. Inputs are packed
+ * into slice views of a buffer preallocated at init(), so steady state
+ * does no allocation.
+ */
+
+#include "completion.hpp"
+#include "../core/tensor.hpp"
+#include "../core/struct.hpp"
+#include "../core/status.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace zero {
+namespace exec {
+
+/**
+ * @brief One in-flight request. Caller-owned; must outlive its completion.
+ */
+struct BatchRequest {
+    Tensor input;       ///< One sample, contiguous, shape == config sample shape
+    Tensor output;      ///< One sample, caller-allocated, contiguous
+    Completion done;    ///< Completed with the step's Status
+
+    // Owned by the Batcher while queued
+    BatchRequest* next = nullptr;
+    int64_t enqueue_ns = 0;
+};
+
+/**
+ * @brief Batched step: batch_in is [n, in...], batch_out is [n, out...]
+ */
+using BatchStepFn = Status (*)(const Tensor& batch_in, Tensor& batch_out, void* user) noexcept;
+
+/**
+ * @brief Latency budget
+ */
+struct BatcherConfig {
+    int64_t max_batch = 8;       ///< Requests per step (>= 1)
+    int64_t max_wait_us = 1000;  ///< Max time the oldest request waits for company
+};
+
+/**
+ * @brief Dynamic batching scheduler
+ *
+ * Any number of threads may submit(). Exactly one thread drives batches,
+ * either the internal worker (start()/stop()) or the caller via run_once().
+ */
+struct Batcher {
+    Batcher() noexcept = default;
+    Batcher(const Batcher&) = delete;
+    Batcher& operator=(const Batcher&) = delete;
+    ~Batcher() { destroy(); }
+
+    /**
+     * @brief Preallocate the batch buffers
+     *
+     * @param config   Latency budget
+     * @param in_meta  Per-sample input rank/shape/dtype (rank < MAX_DIMS)
+     * @param out_meta Per-sample output rank/shape/dtype (rank < MAX_DIMS)
+     * @param step     Batched step, called on the driving thread
+     * @param user     Opaque pointer passed to step
+     */
+    Status init(const BatcherConfig& config, const TensorMeta& in_meta,
+                const TensorMeta& out_meta, BatchStepFn step, void* user) noexcept {
+        if (step_ != nullptr) return status::invalid_state("batcher already initialized");
+        if (step == nullptr) return status::invalid_argument("null step function");
+        if (config.max_batch < 1) return status::invalid_argument("max_batch must be >= 1");
+        if (config.max_wait_us < 0) return status::invalid_argument("max_wait_us must be >= 0");
+        if (in_meta.rank < 0 || in_meta.rank >= MAX_DIMS || in_meta.shape == nullptr ||
+            out_meta.rank < 0 || out_meta.rank >= MAX_DIMS || out_meta.shape == nullptr)
+            return status::invalid_argument("sample shapes must be static with rank < MAX_DIMS");
+
+        int64_t in_shape[MAX_DIMS];
+        int64_t out_shape[MAX_DIMS];
+        in_shape[0] = config.max_batch;
+        out_shape[0] = config.max_batch;
+        for (int8_t i = 0; i < in_meta.rank; ++i) in_shape[i + 1] = in_meta.shape[i];
+        for (int8_t i = 0; i < out_meta.rank; ++i) out_shape[i + 1] = out_meta.shape[i];
+
+        batch_in_ = Tensor::alloc(in_shape, static_cast<int8_t>(in_meta.rank + 1), in_meta.dtype);
+        batch_out_ = Tensor::alloc(out_shape, static_cast<int8_t>(out_meta.rank + 1), out_meta.dtype);
+        if (batch_in_.data == nullptr || batch_out_.data == nullptr) {
+            batch_in_.free();
+            batch_out_.free();
+            return status::allocation_failed("batch buffers");
+        }
+
+        config_ = config;
+        step_ = step;
+        user_ = user;
+        in_sample_bytes_ = static_cast<size_t>(batch_in_.strides[0]);
+        out_sample_bytes_ = static_cast<size_t>(batch_out_.strides[0]);
+        stopping_.store(false, std::memory_order_relaxed);
+        return status::OK;
+    }
+
+    /**
+     * @brief Enqueue a request (lock-free; locks only to wake a sleeping driver)
+     *
+     * Returns an error without enqueuing if the sample does not match the
+     * configured shape/dtype, or the batcher is stopping. Safe to call
+     * concurrently with stop(): the request is either rejected or served.
+     */
+    Status submit(BatchRequest* req) noexcept {
+        if (req == nullptr) return status::invalid_argument("null request");
+        if (step_ == nullptr) return status::invalid_state("batcher not initialized");
+        if (req->input.data == nullptr || req->output.data == nullptr)
+            return status::invalid_state("null data pointer");
+        if (req->input.dtype != batch_in_.dtype || req->output.dtype != batch_out_.dtype)
+            return status::type_mismatch("request dtype does not match batcher");
+        if (!req->input.is_contiguous() || !req->output.is_contiguous())
+            return status::invalid_argument("request tensors must be contiguous");
+        if (req->input.nbytes() != in_sample_bytes_ || req->output.nbytes() != out_sample_bytes_)
+            return status::invalid_argument("request sample size does not match batcher");
+
+        // Announce before checking stopping_: stop() either makes us see
+        // the flag or waits for this push before its final drain.
+        submitting_.fetch_add(1, std::memory_order_seq_cst);
+        if (stopping_.load(std::memory_order_seq_cst)) {
+            leave_submit();
+            return status::invalid_state("batcher stopping");
+        }
+
+        req->done.reset();
+        req->enqueue_ns = now_ns();
+        BatchRequest* head = inbox_.load(std::memory_order_relaxed);
+        do {
+            req->next = head;
+        } while (!inbox_.compare_exchange_weak(head, req, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed));
+        ZERO_QUEUE_METRICS(telemetry::RuntimeSite::BATCHER, 1);
+        if (sleeping_.load(std::memory_order_seq_cst)) wake_driver();
+        leave_submit();
+        return status::OK;
+    }
+
+    /**
+     * @brief Form and run one batch
+     *
+     * Blocks until at least one request is queued, then until the batch
+     * fills or the oldest request's deadline passes. Returns the number of
+     * requests served; 0 once stop has been requested and nothing is left.
+     */
+    int64_t run_once() noexcept {
+        for (;;) {
+            drain_inbox();
+            if (queued_ > 0) break;
+            if (stopping_.load(std::memory_order_acquire)) return 0;
+            sleep_until_arrival(nullptr);
+        }
+
+        int64_t deadline = head_->enqueue_ns + config_.max_wait_us * 1000;
+        for (;;) {
+            drain_inbox();
+            if (queued_ >= config_.max_batch || now_ns() >= deadline ||
+                stopping_.load(std::memory_order_acquire))
+                break;
+            sleep_until_arrival(&deadline);
+        }
+        return run_batch();
+    }
+
+    /**
+     * @brief Drive batches on an internal worker thread
+     */
+    Status start() noexcept {
+        if (step_ == nullptr) return status::invalid_state("batcher not initialized");
+        if (worker_.joinable()) return status::invalid_state("batcher already started");
+        stopping_.store(false, std::memory_order_release);
+        worker_ = std::thread([this] {
+            while (run_once() > 0) {}
+        });
+        return status::OK;
+    }
+
+    /**
+     * @brief Stop accepting requests, flush what is queued, join the worker
+     *
+     * Every submit() that returned OK is served. Submits racing stop() are
+     * either served or rejected with INVALID_STATE.
+     */
+    void stop() noexcept {
+        stopping_.store(true, std::memory_order_seq_cst);
+        for (uint32_t n = submitting_.load(std::memory_order_seq_cst); n != 0;
+             n = submitting_.load(std::memory_order_seq_cst))
+            submitting_.wait(n, std::memory_order_seq_cst);
+        wake_driver();
+        if (worker_.joinable()) worker_.join();
+        while (run_once() > 0) {}
+    }
+
+    /**
+     * @brief Stop and release the batch buffers
+     */
+    void destroy() noexcept {
+        if (step_ == nullptr) return;
+        stop();
+        batch_in_.free();
+        batch_out_.free();
+        step_ = nullptr;
+    }
+
+    uint64_t batches_run() const noexcept { return batches_run_.load(std::memory_order_relaxed); }
+    uint64_t requests_served() const noexcept { return requests_served_.load(std::memory_order_relaxed); }
+
+private:
+    static int64_t now_ns() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void leave_submit() noexcept {
+        if (submitting_.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+            stopping_.load(std::memory_order_seq_cst))
+            submitting_.notify_all();
+    }
+
+    void wake_driver() noexcept {
+        { std::lock_guard<std::mutex> lk(mu_); }
+        cv_.notify_one();
+    }
+
+    // Sleep until a submit, stop(), or *deadline_ns (nullptr: no deadline).
+    // Producers check sleeping_ after their push, so a push either lands
+    // before the predicate check or finds the flag set and wakes us.
+    void sleep_until_arrival(const int64_t* deadline_ns) noexcept {
+        ZERO_IDLE_METRICS_SCOPE(telemetry::RuntimeSite::BATCHER);
+        std::unique_lock<std::mutex> lk(mu_);
+        sleeping_.store(true, std::memory_order_seq_cst);
+        auto arrived = [this] {
+            return inbox_.load(std::memory_order_seq_cst) != nullptr ||
+                   stopping_.load(std::memory_order_seq_cst);
+        };
+        if (deadline_ns == nullptr) {
+            cv_.wait(lk, arrived);
+        } else {
+            auto until = std::chrono::steady_clock::time_point(
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::nanoseconds(*deadline_ns)));
+            cv_.wait_until(lk, until, arrived);
+        }
+        sleeping_.store(false, std::memory_order_relaxed);
+    }
+
+    // Move everything from the LIFO inbox onto the tail of the FIFO.
+    void drain_inbox() noexcept {
+        BatchRequest* lifo = inbox_.exchange(nullptr, std::memory_order_acquire);
+        if (lifo == nullptr) return;
+        BatchRequest* fifo = nullptr;
+        BatchRequest* last = lifo;
+        int64_t count = 0;
+        while (lifo != nullptr) {
+            BatchRequest* next = lifo->next;
+            lifo->next = fifo;
+            fifo = lifo;
+            lifo = next;
+            ++count;
+        }
+        if (tail_ != nullptr) tail_->next = fifo; else head_ = fifo;
+        tail_ = last;
+        queued_ += count;
+    }
+
+    int64_t run_batch() noexcept {
+        int64_t n = (queued_ < config_.max_batch) ? queued_ : config_.max_batch;
+        if (n == 0) return 0;
+
+        BatchRequest* first = head_;
+        BatchRequest* req = first;
+        for (int64_t i = 0; i < n; ++i) {
+            Tensor row = batch_in_.slice(0, i, i + 1);
+            mem_copy_cpu(row.data, req->input.data, in_sample_bytes_);
+            req = req->next;
+        }
+        head_ = req;
+        if (head_ == nullptr) tail_ = nullptr;
+        queued_ -= n;
+        ZERO_QUEUE_METRICS(telemetry::RuntimeSite::BATCHER, -n);
+
+        Tensor in_view = batch_in_.slice(0, 0, n);
+        Tensor out_view = batch_out_.slice(0, 0, n);
+        Status s = step_(in_view, out_view, user_);
+
+        req = first;
+        for (int64_t i = 0; i < n; ++i) {
+            BatchRequest* next = req->next;  // req may be freed once completed
+            if (s.is_ok()) {
+                Tensor row = batch_out_.slice(0, i, i + 1);
+                mem_copy_cpu(req->output.data, row.data, out_sample_bytes_);
+            }
+            req->done.complete(s);
+            req = next;
+        }
+
+        batches_run_.fetch_add(1, std::memory_order_relaxed);
+        requests_served_.fetch_add(static_cast<uint64_t>(n), std::memory_order_relaxed);
+        return n;
+    }
+
+    BatcherConfig config_{};
+    BatchStepFn step_ = nullptr;
+    void* user_ = nullptr;
+    Tensor batch_in_ = Tensor::empty();
+    Tensor batch_out_ = Tensor::empty();
+    size_t in_sample_bytes_ = 0;
+    size_t out_sample_bytes_ = 0;
+
+    std::atomic<BatchRequest*> inbox_{nullptr};   // Treiber stack, producers push
+    std::atomic<bool> stopping_{false};
+    std::atomic<uint32_t> submitting_{0};         // producers between announce and push
+    std::atomic<bool> sleeping_{false};           // driver is (about to be) in cv_ wait
+    std::mutex mu_;                               // guards only the sleep/wake handshake
+    std::condition_variable cv_;
+
+    BatchRequest* head_ = nullptr;                // Driver-private FIFO
+    BatchRequest* tail_ = nullptr;
+    int64_t queued_ = 0;
+
+    std::atomic<uint64_t> batches_run_{0};
+    std::atomic<uint64_t> requests_served_{0};
+    std::thread worker_;
+};
+
+} // namespace exec
+} // namespace zero
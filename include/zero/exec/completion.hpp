@@ -0,0 +1,144 @@
+#pragma once
+
+/**
+ * @file completion.hpp
+ * @brief Zero Core Runtime — Completion Futures
+ *
+ * One-shot completion flag carrying a Status. Caller-owned, no heap, no
+ * exceptions: a producer calls complete() once, any number of threads
+ * wait(). Reusable after reset().
+ *
+ * Besides blocking in wait(), a consumer can register a CompletionHook that
+ * complete() runs on the completing thread; coroutines resume this way
+ * without holding a thread (spec 027).
+ *
+ * A waiter may destroy the Completion as soon as wait() returns, which can
+ * be before complete() has finished waking the other waiters. Wakeups
+ * therefore go through a static wake word keyed by address, never through
+ * the Completion itself, and hooks are detached before DONE is stored:
+ * the DONE store is complete()'s last access.
+ */
+
+#include "../core/status.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace zero {
+namespace exec {
+
+namespace detail {
+
+constexpr uint32_t COMPLETION_WAKE_WORDS = 64;
+
+/**
+ * @brief Process-lifetime wake word shared by Completions hashing to it
+ *
+ * Sharing only costs spurious wakeups; waiters re-check their own state.
+ */
+inline std::atomic<uint32_t>& completion_wake_word(const void* p) noexcept {
+    static std::atomic<uint32_t> words[COMPLETION_WAKE_WORDS];
+    uintptr_t a = reinterpret_cast<uintptr_t>(p);
+    return words[(a >> 6) % COMPLETION_WAKE_WORDS];
+}
+
+} // namespace detail
+
+/**
+ * @brief Intrusive continuation run once by Completion::complete
+ *
+ * Owned by whoever registers it and must stay alive until fn runs. fn
+ * gets the result on the completing thread after the Completion is DONE,
+ * so it must not touch the Completion (it may already be destroyed).
+ */
+struct CompletionHook {
+    void (*fn)(CompletionHook* self, Status result) noexcept = nullptr;
+    CompletionHook* next = nullptr;
+};
+
+namespace detail {
+
+/// Sentinel in Completion::hooks once complete() has detached the list
+inline CompletionHook* completion_hooks_closed() noexcept {
+    static CompletionHook closed;
+    return &closed;
+}
+
+} // namespace detail
+
+/**
+ * @brief Caller-owned future for an asynchronous runtime operation
+ */
+struct Completion {
+    static constexpr uint32_t PENDING = 0;
+    static constexpr uint32_t DONE = 1;
+
+    std::atomic<uint32_t> state;
+    Status result;   ///< Valid once ready()
+    mutable std::atomic<CompletionHook*> hooks{nullptr};   ///< Pending hooks, or the closed sentinel
+
+    Completion() noexcept : state(PENDING), result() {}
+
+    Completion(const Completion&) = delete;
+    Completion& operator=(const Completion&) = delete;
+
+    /**
+     * @brief Re-arm for another use. Not safe while a producer holds it.
+     */
+    void reset() noexcept {
+        result = Status::ok();
+        hooks.store(nullptr, std::memory_order_relaxed);
+        state.store(PENDING, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Publish the result, wake all waiters, then run registered hooks
+     */
+    void complete(Status s) noexcept {
+        std::atomic<uint32_t>& wake = detail::completion_wake_word(this);
+        result = s;
+        CompletionHook* h = hooks.exchange(detail::completion_hooks_closed(), std::memory_order_acq_rel);
+        state.store(DONE, std::memory_order_seq_cst);  // last touch of *this
+        wake.fetch_add(1, std::memory_order_seq_cst);
+        wake.notify_all();
+        while (h != nullptr) {
+            CompletionHook* next = h->next;   // h may be gone once it has run
+            h->fn(h, s);
+            h = next;
+        }
+    }
+
+    /**
+     * @brief Run hook->fn from complete() instead of blocking
+     *
+     * Returns false, without registering, if complete() has already run;
+     * `result` is then valid. Any number of hooks may be registered.
+     */
+    bool on_complete(CompletionHook* hook) const noexcept {
+        CompletionHook* head = hooks.load(std::memory_order_acquire);
+        do {
+            if (head == detail::completion_hooks_closed()) return false;
+            hook->next = head;
+        } while (!hooks.compare_exchange_weak(head, hook, std::memory_order_release, std::memory_order_acquire));
+        return true;
+    }
+
+    bool ready() const noexcept {
+        return state.load(std::memory_order_acquire) == DONE;
+    }
+
+    /**
+     * @brief Block until complete() has been called, then return its Status
+     */
+    Status wait() const noexcept {
+        std::atomic<uint32_t>& wake = detail::completion_wake_word(this);
+        for (;;) {
+            uint32_t seen = wake.load(std::memory_order_seq_cst);
+            if (state.load(std::memory_order_seq_cst) == DONE) return result;
+            wake.wait(seen, std::memory_order_seq_cst);
+        }
+    }
+};
+
+} // namespace exec
+} // namespace zero
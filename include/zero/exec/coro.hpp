@@ -0,0 +1,652 @@
+#pragma once
+
+/**
+ * @file coro.hpp
+ * @brief Zero Core Runtime — C++20 Coroutine Interface
+ *
+ * Straight-line async request handlers over a few runtime threads:
+ *
+ *   Task handle(CoStream& s, io::AsyncReader& r, Event& weights_ready) {
+ *       co_await weights_ready;                      // Event
+ *       if (Status st = co_await read_async(r, &req, 1); st.is_error()) co_return st;
+ *       co_return co_await s.enqueue([&] { return ops::gemm(...); });
+ *   }
+ *   (void)executor.spawn(handle(...), &done);
+ *
+ * A suspended coroutine holds no thread. Whatever completes its await
+ * (an Event::set, the stream op, the reader's driver, Completion::complete)
+ * posts it back to its Executor, and a worker resumes it there.
+ * Thousands of in-flight handlers therefore share `threads` workers.
+ *
+ * Other work that blocks goes through offload(), which runs it on a
+ * separate blocking lane so it never stalls the workers. Awaiter state lives in
+ * the coroutine frame and is queued intrusively; frames come from
+ * mem_alloc, and a failed frame allocation surfaces as a Status, not an
+ * exception.
+ */
+
+#include "completion.hpp"
+#include "../core/memory.hpp"
+#include "../core/status.hpp"
+#include "../device/sync.hpp"
+#include "../io/async_reader.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace zero {
+namespace exec {
+
+constexpr int32_t CORO_MAX_THREADS = 64;
+
+/// Ops a CoStream runs back to back before yielding its worker
+constexpr int32_t CORO_STREAM_BATCH = 64;
+
+/**
+ * @brief Intrusive unit of executor work; the owner keeps it alive until run
+ */
+struct WorkItem {
+    void (*run)(WorkItem*) noexcept = nullptr;
+    WorkItem* next = nullptr;
+};
+
+struct ExecutorOptions {
+    int32_t threads = 2;            ///< Workers that resume coroutines and run stream ops
+    int32_t blocking_threads = 1;   ///< Blocking lane (reads, waits); 0 = use the workers
+};
+
+namespace detail {
+
+/// FIFO of work items with blocking pop
+struct WorkQueue {
+    std::mutex mu;
+    std::condition_variable cv;
+    WorkItem* head = nullptr;
+    WorkItem* tail = nullptr;
+    bool stopping = false;
+
+    void push(WorkItem* w) noexcept {
+        w->next = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mu);
+            if (tail != nullptr) tail->next = w;
+            else head = w;
+            tail = w;
+        }
+        ZERO_QUEUE_METRICS(telemetry::RuntimeSite::EXECUTOR, 1);
+        cv.notify_one();
+    }
+
+    /// Next item, or nullptr once stopping and drained
+    WorkItem* pop() noexcept {
+        std::unique_lock<std::mutex> lock(mu);
+        if (head == nullptr && !stopping) {
+            ZERO_IDLE_METRICS_SCOPE(telemetry::RuntimeSite::EXECUTOR);
+            cv.wait(lock, [this] { return head != nullptr || stopping; });
+        }
+        WorkItem* w = head;
+        if (w != nullptr) {
+            head = w->next;
+            if (head == nullptr) tail = nullptr;
+            ZERO_QUEUE_METRICS(telemetry::RuntimeSite::EXECUTOR, -1);
+        }
+        return w;
+    }
+};
+
+/// Work item that starts or resumes one coroutine
+struct ResumeItem : WorkItem {
+    std::coroutine_handle<> h;
+
+    void bind(std::coroutine_handle<> handle) noexcept {
+        h = handle;
+        run = [](WorkItem* w) noexcept { static_cast<ResumeItem*>(w)->h.resume(); };
+    }
+};
+
+} // namespace detail
+
+class Executor;
+
+/**
+ * @brief Coroutine returning a Status; lazily started
+ *
+ * Run a Task by co_await-ing it from another Task (it inherits the
+ * awaiting Task's executor) or by Executor::spawn. Move-only; destroying
+ * a Task that has not run destroys its frame.
+ */
+class [[nodiscard]] Task {
+public:
+    struct promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(Handle h) noexcept;
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type {
+        Status result;
+        Executor* executor = nullptr;
+        std::coroutine_handle<> continuation;
+        Completion* done = nullptr;   ///< Spawned tasks: completed with result
+        bool detached = false;        ///< Spawned tasks free their own frame
+        detail::ResumeItem start;     ///< Queue node used by spawn
+
+        static void* operator new(size_t size) noexcept { return mem_alloc(size, 64, Device::CPU); }
+        static void operator delete(void* p) noexcept { mem_free(p, Device::CPU); }
+
+        Task get_return_object() noexcept { return Task(Handle::from_promise(*this)); }
+        static Task get_return_object_on_allocation_failure() noexcept { return Task(); }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+        void return_value(Status s) noexcept { result = s; }
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+
+    Task() noexcept = default;
+    Task(Task&& o) noexcept : h_(std::exchange(o.h_, nullptr)) {}
+    Task& operator=(Task&& o) noexcept {
+        if (this != &o) {
+            if (h_) h_.destroy();
+            h_ = std::exchange(o.h_, nullptr);
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() {
+        if (h_) h_.destroy();
+    }
+
+    /// False if the coroutine frame could not be allocated
+    bool valid() const noexcept { return static_cast<bool>(h_); }
+
+    struct Awaiter {
+        Handle h;
+        bool await_ready() const noexcept { return !h; }
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> parent) noexcept {
+            h.promise().continuation = parent;
+            h.promise().executor = parent.promise().executor;
+            return h;
+        }
+        Status await_resume() const noexcept {
+            return h ? h.promise().result : status::allocation_failed("coroutine frame allocation failed");
+        }
+    };
+
+    Awaiter operator co_await() const& noexcept { return Awaiter{h_}; }
+
+    /// Give up ownership (used by Executor::spawn)
+    Handle release() noexcept { return std::exchange(h_, nullptr); }
+
+private:
+    explicit Task(Handle h) noexcept : h_(h) {}
+    Handle h_;
+};
+
+/**
+ * @brief Worker threads that resume coroutines, plus a blocking lane
+ */
+class Executor {
+public:
+    Executor() noexcept = default;
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+    ~Executor() { stop(); }
+
+    Status start(const ExecutorOptions& opt = {}) noexcept {
+        if (opt.threads < 1 || opt.blocking_threads < 0 ||
+            opt.threads + opt.blocking_threads > CORO_MAX_THREADS)
+            return status::invalid_argument("executor thread count out of range");
+        if (threads_ != 0) return status::invalid_state("executor already started");
+        work_.stopping = false;
+        blocking_.stopping = false;
+        threads_ = opt.threads;
+        blocking_threads_ = opt.blocking_threads;
+        for (int32_t t = 0; t < threads_ + blocking_threads_; ++t) {
+            detail::WorkQueue* q = t < threads_ ? &work_ : &blocking_;
+            pool_[t] = std::thread([this, q] { run(*q); });
+        }
+        return status::OK;
+    }
+
+    /**
+     * @brief Drain both queues and join the threads
+     *
+     * Coroutines still suspended on an Event or stream afterwards are not
+     * resumed; wait for spawned tasks to complete before stopping.
+     */
+    void stop() noexcept {
+        if (threads_ == 0) return;
+        for (detail::WorkQueue* q : {&work_, &blocking_}) {
+            {
+                std::lock_guard<std::mutex> lock(q->mu);
+                q->stopping = true;
+            }
+            q->cv.notify_all();
+        }
+        for (int32_t t = 0; t < threads_ + blocking_threads_; ++t) pool_[t].join();
+        threads_ = 0;
+        blocking_threads_ = 0;
+    }
+
+    int32_t threads() const noexcept { return threads_; }
+
+    /**
+     * @brief Start a task on a worker; `done` (if any) receives its Status
+     *
+     * The executor owns the frame until the task finishes.
+     */
+    Status spawn(Task task, Completion* done = nullptr) noexcept {
+        if (!task.valid()) return status::allocation_failed("coroutine frame allocation failed");
+        if (threads_ == 0) return status::invalid_state("executor not started");
+        Task::Handle h = task.release();
+        Task::promise_type& p = h.promise();
+        p.executor = this;
+        p.done = done;
+        p.detached = true;
+        p.start.bind(h);
+        in_flight_.fetch_add(1, std::memory_order_relaxed);
+        post(&p.start);
+        return status::OK;
+    }
+
+    /// Spawned tasks that have not finished
+    int64_t in_flight() const noexcept { return in_flight_.load(std::memory_order_acquire); }
+
+    /// Queue on the workers
+    void post(WorkItem* w) noexcept { work_.push(w); }
+
+    /// Queue on the blocking lane (the workers if it has no threads)
+    void post_blocking(WorkItem* w) noexcept {
+        if (blocking_threads_ > 0) blocking_.push(w);
+        else work_.push(w);
+    }
+
+    /// The executor whose thread is calling, or nullptr
+    static Executor* current() noexcept { return current_ref(); }
+
+private:
+    friend struct Task::FinalAwaiter;
+
+    static Executor*& current_ref() noexcept {
+        static thread_local Executor* ex = nullptr;
+        return ex;
+    }
+
+    void run(detail::WorkQueue& q) noexcept {
+        current_ref() = this;
+        while (WorkItem* w = q.pop()) w->run(w);
+        current_ref() = nullptr;
+    }
+
+    void finished() noexcept { in_flight_.fetch_sub(1, std::memory_order_release); }
+
+    detail::WorkQueue work_;
+    detail::WorkQueue blocking_;
+    std::thread pool_[CORO_MAX_THREADS];
+    int32_t threads_ = 0;
+    int32_t blocking_threads_ = 0;
+    std::atomic<int64_t> in_flight_{0};
+};
+
+inline std::coroutine_handle<> Task::FinalAwaiter::await_suspend(Handle h) noexcept {
+    promise_type& p = h.promise();
+    if (!p.detached) return p.continuation;
+    Completion* done = p.done;
+    Status result = p.result;
+    Executor* ex = p.executor;
+    h.destroy();
+    ex->finished();
+    if (done != nullptr) done->complete(result);
+    return std::noop_coroutine();
+}
+
+namespace detail {
+
+/// Resumes a suspended Task on the executor it runs on
+struct Resume : ResumeItem {
+    Executor* executor = nullptr;
+
+    template <typename P>
+    void bind(std::coroutine_handle<P> handle) noexcept {
+        ResumeItem::bind(handle);
+        executor = handle.promise().executor;
+    }
+
+    /// Hand the coroutine back to its executor (inline without one)
+    void wake() noexcept {
+        if (executor != nullptr) executor->post(this);
+        else h.resume();
+    }
+};
+
+/// Runs fn() on the blocking lane, then resumes the awaiting coroutine
+template <typename Fn>
+struct BlockingAwaiter : WorkItem {
+    Fn fn;
+    Status result;
+    Resume resume;
+
+    explicit BlockingAwaiter(Fn f) noexcept : fn(std::move(f)) {}
+
+    bool await_ready() const noexcept { return false; }
+    template <typename P>
+    bool await_suspend(std::coroutine_handle<P> h) noexcept {
+        resume.bind(h);
+        if (resume.executor == nullptr) {
+            result = fn();
+            return false;
+        }
+        run = [](WorkItem* w) noexcept {
+            auto* self = static_cast<BlockingAwaiter*>(w);
+            self->result = self->fn();
+            self->resume.wake();
+        };
+        resume.executor->post_blocking(this);
+        return true;
+    }
+    Status await_resume() const noexcept { return result; }
+};
+
+/// Resumes the awaiting coroutine from Completion::complete; holds no thread
+struct CompletionResume {
+    struct Hook : CompletionHook {
+        CompletionResume* self = nullptr;
+    };
+
+    Hook hook;
+    Resume resume;
+    Status result;
+
+    /// False, with result set, if c has already completed
+    bool suspend_on(const Completion& c) noexcept {
+        hook.self = this;
+        hook.fn = [](CompletionHook* k, Status s) noexcept {
+            CompletionResume* self = static_cast<Hook*>(k)->self;
+            self->result = s;
+            self->resume.wake();
+        };
+        if (c.on_complete(&hook)) return true;
+        result = c.result;
+        return false;
+    }
+};
+
+struct CompletionAwaiter : CompletionResume {
+    const Completion* c;
+
+    explicit CompletionAwaiter(const Completion& comp) noexcept : c(&comp) {}
+
+    bool await_ready() noexcept {
+        if (!c->ready()) return false;
+        result = c->result;
+        return true;
+    }
+    template <typename P>
+    bool await_suspend(std::coroutine_handle<P> h) noexcept {
+        resume.bind(h);
+        if (resume.executor == nullptr) {
+            result = c->wait();
+            return false;
+        }
+        return suspend_on(*c);
+    }
+    Status await_resume() const noexcept { return result; }
+};
+
+struct ReadAwaiter : CompletionResume {
+    io::AsyncReader* reader;
+    io::ReadBatch batch;
+    io::ReadStats* stats;
+    bool submitted = false;
+
+    ReadAwaiter(io::AsyncReader& r, const io::ReadRequest* reqs, int32_t n, io::ReadStats* st) noexcept
+        : reader(&r), stats(st) {
+        batch.reqs = reqs;
+        batch.n = n;
+    }
+
+    bool await_ready() const noexcept { return false; }
+    template <typename P>
+    bool await_suspend(std::coroutine_handle<P> h) noexcept {
+        resume.bind(h);
+        if (resume.executor == nullptr) {
+            result = reader->read(batch.reqs, batch.n, stats);
+            return false;
+        }
+        result = reader->submit(&batch);
+        if (result.is_error()) return false;
+        submitted = true;
+        return suspend_on(batch.done);
+    }
+    Status await_resume() const noexcept {
+        if (submitted && stats != nullptr) *stats = batch.stats;
+        return result;
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Manual-reset event; co_await suspends until set()
+ *
+ * set() posts every waiter back to its executor. Awaiting a set event
+ * does not suspend.
+ */
+class Event {
+public:
+    Event() noexcept = default;
+    Event(const Event&) = delete;
+    Event& operator=(const Event&) = delete;
+
+    struct Awaiter : detail::Resume {
+        Event* ev;
+        Awaiter* next_waiter = nullptr;
+
+        explicit Awaiter(Event* e) noexcept : ev(e) {}
+        bool await_ready() const noexcept { return ev->is_set(); }
+        template <typename P>
+        bool await_suspend(std::coroutine_handle<P> h) noexcept {
+            bind(h);
+            std::lock_guard<std::mutex> lock(ev->mu_);
+            if (ev->set_.load(std::memory_order_relaxed)) return false;
+            next_waiter = ev->waiters_;
+            ev->waiters_ = this;
+            return true;
+        }
+        void await_resume() const noexcept {}
+    };
+
+    Awaiter operator co_await() noexcept { return Awaiter(this); }
+
+    void set() noexcept {
+        Awaiter* w;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            set_.store(true, std::memory_order_release);
+            w = std::exchange(waiters_, nullptr);
+        }
+        while (w != nullptr) {
+            Awaiter* next = w->next_waiter;   // w may be gone once woken
+            w->wake();
+            w = next;
+        }
+    }
+
+    void reset() noexcept { set_.store(false, std::memory_order_release); }
+
+    bool is_set() const noexcept { return set_.load(std::memory_order_acquire); }
+
+private:
+    std::mutex mu_;
+    std::atomic<bool> set_{false};
+    Awaiter* waiters_ = nullptr;
+};
+
+/**
+ * @brief In-order op queue over a Stream, awaited per op
+ *
+ * enqueue(fn) suspends the caller; ops run one at a time in enqueue
+ * order on an executor worker, each followed by stream.sync(), and the
+ * caller resumes with fn()'s Status. sync() resumes once everything
+ * enqueued before it has finished, without blocking a thread.
+ */
+class CoStream {
+public:
+    struct Op : detail::Resume {
+        Status (*invoke)(Op*) noexcept = nullptr;
+        Op* next_op = nullptr;
+        CoStream* stream = nullptr;
+        Status result;
+    };
+
+    template <typename Fn>
+    struct OpAwaiter : Op {
+        Fn fn;
+
+        OpAwaiter(CoStream* s, Fn f) noexcept : fn(std::move(f)) { stream = s; }
+        bool await_ready() const noexcept { return false; }
+        template <typename P>
+        void await_suspend(std::coroutine_handle<P> h) noexcept {
+            bind(h);
+            invoke = [](Op* op) noexcept { return static_cast<OpAwaiter*>(op)->fn(); };
+            stream->push(this);
+        }
+        Status await_resume() const noexcept { return result; }
+    };
+
+    explicit CoStream(Executor& ex, Stream stream = Stream{}) noexcept : ex_(&ex), stream_(stream) {
+        drain_.self = this;
+        drain_.run = [](WorkItem* w) noexcept { static_cast<DrainItem*>(w)->self->drain(); };
+    }
+    CoStream(const CoStream&) = delete;
+    CoStream& operator=(const CoStream&) = delete;
+
+    /// Awaitable running fn() (returning Status) after every earlier op
+    template <typename Fn>
+    OpAwaiter<Fn> enqueue(Fn fn) noexcept { return OpAwaiter<Fn>(this, std::move(fn)); }
+
+    /// Awaitable that completes once every earlier op has
+    auto sync() noexcept {
+        return enqueue([]() noexcept { return status::OK; });
+    }
+
+    const Stream& stream() const noexcept { return stream_; }
+
+    /// Ops run so far
+    int64_t completed() const noexcept { return completed_.load(std::memory_order_relaxed); }
+
+private:
+    void push(Op* op) noexcept {
+        bool start = false;
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            if (tail_ != nullptr) tail_->next_op = op;
+            else head_ = op;
+            tail_ = op;
+            if (!draining_) draining_ = start = true;
+        }
+        if (start) ex_->post(&drain_);
+    }
+
+    void drain() noexcept {
+        for (int32_t k = 0; k < CORO_STREAM_BATCH; ++k) {
+            Op* op;
+            {
+                std::lock_guard<std::mutex> lock(mu_);
+                op = head_;
+                if (op == nullptr) {
+                    draining_ = false;
+                    return;
+                }
+                head_ = op->next_op;
+                if (head_ == nullptr) tail_ = nullptr;
+            }
+            op->result = op->invoke(op);
+            stream_.sync();
+            completed_.fetch_add(1, std::memory_order_relaxed);
+            op->wake();
+        }
+        ex_->post(&drain_);   // let other work in before the next batch
+    }
+
+    struct DrainItem : WorkItem {
+        CoStream* self = nullptr;
+    };
+
+    Executor* ex_;
+    Stream stream_;
+    DrainItem drain_;
+    std::mutex mu_;
+    Op* head_ = nullptr;
+    Op* tail_ = nullptr;
+    bool draining_ = false;
+    std::atomic<int64_t> completed_{0};
+};
+
+namespace detail {
+
+struct YieldAwaiter : Resume {
+    bool await_ready() const noexcept { return false; }
+    template <typename P>
+    bool await_suspend(std::coroutine_handle<P> h) noexcept {
+        bind(h);
+        if (executor == nullptr) return false;
+        executor->post(this);
+        return true;
+    }
+    void await_resume() const noexcept {}
+};
+
+} // namespace detail
+
+/**
+ * @brief Awaitable that re-queues the caller behind already posted work
+ */
+inline detail::YieldAwaiter yield() noexcept { return {}; }
+
+/**
+ * @brief Awaitable running fn() (returning Status) on the blocking lane
+ */
+template <typename Fn>
+inline detail::BlockingAwaiter<Fn> offload(Fn fn) noexcept {
+    return detail::BlockingAwaiter<Fn>(std::move(fn));
+}
+
+/**
+ * @brief Awaitable AsyncReader batch; resumes once the batch has landed
+ *
+ * The batch lives in the awaiting frame and goes through
+ * AsyncReader::submit; the reader's driver resumes the coroutine, so no
+ * executor thread waits on the read. Without an executor the read runs
+ * inline. `reqs` must stay valid until the await completes.
+ */
+inline detail::ReadAwaiter read_async(io::AsyncReader& reader, const io::ReadRequest* reqs, int32_t n,
+                                      io::ReadStats* stats = nullptr) noexcept {
+    return detail::ReadAwaiter(reader, reqs, n, stats);
+}
+
+/**
+ * @brief Awaitable Completion (e.g. a BatchRequest); resumes with its Status
+ *
+ * Registers a CompletionHook, so the coroutine holds no thread while it
+ * waits and is posted back by complete(). Without an executor it blocks
+ * in Completion::wait.
+ */
+inline detail::CompletionAwaiter wait_async(const Completion& c) noexcept {
+    return detail::CompletionAwaiter(c);
+}
+
+} // namespace exec
+} // namespace zero
@@ -0,0 +1,330 @@
+#pragma once
+
+/**
+ * @file cost_model.hpp
+ * @brief Zero Core Runtime — Adaptive Parallelism Cost Model
+ *
+ * Picks the participant count and grain of one op call from its
+ * estimated work instead of a fixed threshold. Each OpKind has two
+ * coefficients, ns per flop and ns per byte. A call on p participants
+ * is predicted as a roofline plus fork-join overhead:
+ *
+ *   T(p) = max(flops * ns_per_flop / p,  bytes * ns_per_byte / min(p, bw))
+ *        + (p > 1 ? sync_ns * (p - 1) : 0)
+ *
+ * where bw is the participant count that saturates memory bandwidth.
+ * plan() takes the p with the smallest T(p), preferring fewer threads
+ * on ties. Tasks are over-decomposed for stealing, but none is made
+ * cheaper than min_task_ns.
+ *
+ * record() feeds back a measured time. The ratio measured / predicted
+ * is split by each term's share of the prediction: the binding
+ * coefficient of the kind and the shared sync_ns are each scaled by
+ * ratio^(rate * share). Serial runs therefore calibrate the kernel,
+ * and parallel runs mostly calibrate the overhead.
+ */
+
+#include "../core/dtype.hpp"
+#include "../core/status.hpp"
+#include "../ir/op_kind.hpp"
+#include "thread_pool.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+
+namespace zero {
+namespace exec {
+
+/// Rows of the per-kind coefficient table (OpKind values are below this)
+constexpr int32_t COST_MAX_KINDS = 64;
+
+/**
+ * @brief Estimated work of one op call
+ */
+struct OpCost {
+    double flops = 0.0;
+    double bytes = 0.0;       ///< Bytes read plus bytes written
+    int64_t items = 0;        ///< Independent units to split (elements, rows)
+    int64_t granule = 1;      ///< Split points fall on multiples of this
+};
+
+/**
+ * @brief Flop-equivalents per element for the elementwise kinds
+ *
+ * Transcendentals count as their polynomial evaluation.
+ */
+constexpr double op_flops_per_element(ir::OpKind kind) noexcept {
+    switch (kind) {
+        case ir::OpKind::DIV:
+        case ir::OpKind::SQRT:    return 4.0;
+        case ir::OpKind::EXP:
+        case ir::OpKind::LOG:
+        case ir::OpKind::SIN:
+        case ir::OpKind::COS:
+        case ir::OpKind::TANH:
+        case ir::OpKind::SIGMOID: return 20.0;
+        case ir::OpKind::ROPE:    return 6.0;
+        default:                  return 1.0;
+    }
+}
+
+/**
+ * @brief Work of C[M, N] = A[M, K] @ B[K, N], split by rows of C
+ */
+inline OpCost estimate_gemm(int64_t M, int64_t N, int64_t K, DType dtype) noexcept {
+    double es = static_cast<double>(dtype_size(dtype));
+    double m = static_cast<double>(M), n = static_cast<double>(N), k = static_cast<double>(K);
+    OpCost c;
+    c.flops = 2.0 * m * n * k;
+    c.bytes = es * (m * k + k * n + m * n);
+    c.items = M;
+    return c;
+}
+
+/**
+ * @brief Work of an elementwise or last-axis op on a `shape` tensor
+ *
+ * Binary kinds read two inputs; reductions (SUM, MEAN, MAX, MIN, PROD) read
+ * the input once, write one value per row and split by rows. MATMUL
+ * expects shape {M, N, K}.
+ */
+inline OpCost estimate_cost(ir::OpKind kind, const int64_t* shape, int8_t ndim, DType dtype) noexcept {
+    if (kind == ir::OpKind::MATMUL && ndim == 3) return estimate_gemm(shape[0], shape[1], shape[2], dtype);
+    int64_t numel = 1;
+    for (int8_t d = 0; d < ndim; ++d) numel *= shape[d];
+    double es = static_cast<double>(dtype_size(dtype));
+    double n = static_cast<double>(numel);
+    OpCost c;
+    switch (kind) {
+        case ir::OpKind::SUM:
+        case ir::OpKind::MEAN:
+        case ir::OpKind::MAX:
+        case ir::OpKind::MIN:
+        case ir::OpKind::PROD: {
+            int64_t row = ndim > 0 ? shape[ndim - 1] : 1;
+            int64_t rows = row > 0 ? numel / row : 0;
+            c.flops = n;
+            c.bytes = es * (n + static_cast<double>(rows));
+            c.items = rows;
+            return c;
+        }
+        case ir::OpKind::ADD:
+        case ir::OpKind::SUB:
+        case ir::OpKind::MUL:
+        case ir::OpKind::DIV:
+            c.bytes = 3.0 * es * n;
+            break;
+        default:
+            c.bytes = 2.0 * es * n;
+            break;
+    }
+    c.flops = op_flops_per_element(kind) * n;
+    c.items = numel;
+    c.granule = es > 0.0 ? static_cast<int64_t>(64.0 / es) : 1;  // one cache line
+    if (c.granule < 1) c.granule = 1;
+    return c;
+}
+
+/**
+ * @brief Participants and split of one call
+ */
+struct ParallelPlan {
+    int32_t threads = 1;
+    int64_t grain = 0;        ///< Items per task
+    int64_t tasks = 0;        ///< ceil(items / grain)
+    double predicted_ns = 0.0;
+};
+
+struct CostModelOptions {
+    int32_t bandwidth_threads = 0;   ///< Participants that saturate memory; 0 = half the pool
+    double tasks_per_thread = 4.0;   ///< Over-decomposition so stealing can balance
+    double min_task_ns = 2000.0;     ///< No task is planned cheaper than this
+    double learning_rate = 0.25;     ///< Exponent weight of one measurement
+    double ns_per_flop = 0.1;        ///< Initial coefficients for every kind
+    double ns_per_byte = 0.1;
+    double sync_ns = 5000.0;         ///< Initial fork-join cost per extra participant
+};
+
+struct KindCoefficients {
+    double ns_per_flop;
+    double ns_per_byte;
+    int64_t samples;
+};
+
+/**
+ * @brief Per-OpKind cost model with online refinement. Thread-safe.
+ */
+class CostModel {
+public:
+    explicit CostModel(const CostModelOptions& opt = {}) noexcept : opt_(opt), sync_ns_(opt.sync_ns) {
+        for (auto& k : kinds_) k = KindCoefficients{opt.ns_per_flop, opt.ns_per_byte, 0};
+    }
+
+    CostModel(const CostModel&) = delete;
+    CostModel& operator=(const CostModel&) = delete;
+
+    /**
+     * @brief Predicted time of `cost` on `threads` of `pool_threads` participants
+     */
+    double predict(ir::OpKind kind, const OpCost& cost, int32_t threads, int32_t pool_threads = 0) const noexcept {
+        if (threads < 1) threads = 1;
+        std::lock_guard<std::mutex> lock(mu_);
+        return time_locked(kinds_[index(kind)], cost, threads, pool_threads);
+    }
+
+    /**
+     * @brief Choose participants (1 .. pool_threads) and grain for a call
+     */
+    ParallelPlan plan(ir::OpKind kind, const OpCost& cost, int32_t pool_threads) const noexcept {
+        ParallelPlan p;
+        int64_t items = cost.items > 0 ? cost.items : 1;
+        int64_t granule = cost.granule > 0 ? cost.granule : 1;
+        int64_t units = (items + granule - 1) / granule;
+        int32_t cap = pool_threads < 1 ? 1 : pool_threads;
+        if (units < cap) cap = static_cast<int32_t>(units);
+
+        std::lock_guard<std::mutex> lock(mu_);
+        const KindCoefficients& k = kinds_[index(kind)];
+        p.predicted_ns = time_locked(k, cost, 1, pool_threads);
+        for (int32_t t = 2; t <= cap; ++t) {
+            double ns = time_locked(k, cost, t, pool_threads);
+            if (ns < p.predicted_ns) {
+                p.predicted_ns = ns;
+                p.threads = t;
+            }
+        }
+
+        int64_t tasks = 1;
+        if (p.threads > 1) {
+            double serial = compute_ns(k, cost, 1, pool_threads);
+            double want = static_cast<double>(p.threads) * opt_.tasks_per_thread;
+            if (opt_.min_task_ns > 0.0 && serial / opt_.min_task_ns < want) want = serial / opt_.min_task_ns;
+            tasks = want < static_cast<double>(p.threads) ? p.threads : static_cast<int64_t>(want);
+            if (tasks > units) tasks = units;
+        }
+        int64_t per = (units + tasks - 1) / tasks;
+        p.grain = per * granule;
+        p.tasks = (items + p.grain - 1) / p.grain;
+        return p;
+    }
+
+    /**
+     * @brief Feed back the measured time of a call run on `threads`
+     */
+    void record(ir::OpKind kind, const OpCost& cost, int32_t threads, double measured_ns,
+                int32_t pool_threads = 0) noexcept {
+        if (!(measured_ns > 0.0) || threads < 1) return;
+        if (pool_threads < threads) pool_threads = threads;
+        std::lock_guard<std::mutex> lock(mu_);
+        KindCoefficients& k = kinds_[index(kind)];
+        double flop_ns = cost.flops * k.ns_per_flop / threads;
+        double byte_ns = cost.bytes * k.ns_per_byte / par_bw(threads, pool_threads);
+        // The binding term takes the correction
+        double compute = flop_ns > byte_ns ? flop_ns : byte_ns;
+        double sync = threads > 1 ? sync_ns_ * (threads - 1) : 0.0;
+        double predicted = compute + sync;
+        ++k.samples;
+        if (!(predicted > 0.0)) return;
+
+        double ratio = measured_ns / predicted;
+        if (ratio < 0.125) ratio = 0.125;
+        if (ratio > 8.0) ratio = 8.0;
+        double share = compute / predicted;
+        double step = std::pow(ratio, opt_.learning_rate * share);
+        if (flop_ns > byte_ns) k.ns_per_flop *= step;
+        else k.ns_per_byte *= step;
+        if (sync > 0.0) sync_ns_ *= std::pow(ratio, opt_.learning_rate * (1.0 - share));
+    }
+
+    KindCoefficients coefficients(ir::OpKind kind) const noexcept {
+        std::lock_guard<std::mutex> lock(mu_);
+        return kinds_[index(kind)];
+    }
+
+    double sync_ns() const noexcept {
+        std::lock_guard<std::mutex> lock(mu_);
+        return sync_ns_;
+    }
+
+private:
+    static int32_t index(ir::OpKind kind) noexcept {
+        int32_t i = static_cast<int32_t>(kind);
+        return i < COST_MAX_KINDS ? i : COST_MAX_KINDS - 1;
+    }
+
+    double par_bw(int32_t threads, int32_t pool_threads) const noexcept {
+        int32_t bw = opt_.bandwidth_threads;
+        if (bw < 1) bw = pool_threads / 2 > 1 ? pool_threads / 2 : 1;
+        return static_cast<double>(threads < bw ? threads : bw);
+    }
+
+    double compute_ns(const KindCoefficients& k, const OpCost& c, int32_t t, int32_t pool) const noexcept {
+        double f = c.flops * k.ns_per_flop / t;
+        double b = c.bytes * k.ns_per_byte / par_bw(t, pool < t ? t : pool);
+        return f > b ? f : b;
+    }
+
+    double time_locked(const KindCoefficients& k, const OpCost& c, int32_t t, int32_t pool) const noexcept {
+        return compute_ns(k, c, t, pool) + (t > 1 ? sync_ns_ * (t - 1) : 0.0);
+    }
+
+    CostModelOptions opt_;
+    mutable std::mutex mu_;
+    KindCoefficients kinds_[COST_MAX_KINDS];
+    double sync_ns_;
+};
+
+/**
+ * @brief Where an op may run in parallel
+ *
+ * Without a pool the op runs inline; without a model it uses the whole
+ * pool with the default split.
+ */
+struct ParallelContext {
+    ThreadPool* pool = nullptr;
+    CostModel* model = nullptr;
+    int32_t node = -1;          ///< NUMA hint passed to parallel_for (spec 025)
+};
+
+/**
+ * @brief Run fn(begin, end) over [0, cost.items) as planned, and record the time
+ */
+template <typename Fn>
+inline Status run_planned(const ParallelContext& par, ir::OpKind kind, const OpCost& cost, Fn&& fn) noexcept {
+    int64_t items = cost.items;
+    if (items <= 0) return status::OK;
+    int32_t pool_threads = par.pool != nullptr && par.pool->size() > 0 ? par.pool->size() : 1;
+
+    ParallelPlan plan;
+    if (par.model != nullptr) {
+        plan = par.model->plan(kind, cost, pool_threads);
+    } else {
+        plan.threads = pool_threads;
+        plan.grain = (items + pool_threads - 1) / pool_threads;
+        plan.tasks = (items + plan.grain - 1) / plan.grain;
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    Status s = status::OK;
+    if (plan.threads <= 1 || par.pool == nullptr) {
+        plan.threads = 1;
+        fn(int64_t{0}, items);
+    } else {
+        int64_t grain = plan.grain;
+        s = par.pool->parallel_for(plan.tasks, [&](int64_t t) {
+            int64_t b = t * grain;
+            int64_t e = b + grain < items ? b + grain : items;
+            fn(b, e);
+        }, par.node, plan.threads);
+    }
+    if (par.model != nullptr && s.is_ok()) {
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        par.model->record(kind, cost, plan.threads, ns, pool_threads);
+    }
+    return s;
+}
+
+} // namespace exec
+} // namespace zero
@@ -0,0 +1,357 @@
+#pragma once
+
+/**
+ * @file decode_scheduler.hpp
+ * @brief Zero Core Runtime — Continuous (Iteration-Level) Decode Batching
+ *
+ * Runs an autoregressive step over a ragged batch of sequences, admitting
+ * and evicting sequences at every iteration instead of per batch:
+ *
+ *   submit() ─lock-free push─▶ inbox ─drain─▶ FIFO ─admit─▶ rows [0, n) ─step─▶ next tokens
+ *                                                              ▲                  │
+ *                                                              └─ evict finished ─┘
+ *
+ * Active sequences occupy a dense prefix of the batch rows; their KV state
+ * lives in a fixed slot of a preallocated pool and never moves. Admission
+ * writes one row, eviction swaps the last row into the hole, and every
+ * other row is updated in place, so the step's inputs are never rebuilt.
+ */
+
+#include "completion.hpp"
+#include "../core/tensor.hpp"
+#include "../core/memory.hpp"
+#include "../core/status.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace zero {
+namespace exec {
+
+/**
+ * @brief One generation request. Caller-owned; must outlive its completion.
+ *
+ * Prompt tokens are fed one per iteration (prefill is interleaved with
+ * other sequences' decode); generation starts after the last prompt token.
+ */
+struct DecodeSequence {
+    const int64_t* prompt = nullptr;   ///< prompt_len tokens
+    int64_t prompt_len = 0;            ///< >= 1
+    int64_t* output = nullptr;         ///< Capacity max_new_tokens
+    int64_t max_new_tokens = 0;        ///< >= 1
+    int64_t eos_token = -1;            ///< Stop token (kept in output); -1 for none
+    int64_t generated = 0;             ///< Tokens written to output
+    Completion done;                   ///< Completed with the step's Status
+
+    // Owned by the scheduler while queued/active
+    DecodeSequence* next = nullptr;
+    int64_t slot = -1;
+};
+
+/**
+ * @brief Views handed to the step, all with leading extent size
+ *
+ * Row r decodes tokens[r] at positions[r] for the sequence whose KV state
+ * is kv[slots[r]]; the step writes the sampled token to next_tokens[r].
+ */
+struct DecodeBatch {
+    int64_t size;          ///< Active rows
+    Tensor tokens;         ///< [size] I64
+    Tensor positions;      ///< [size] I64
+    Tensor slots;          ///< [size] I64
+    Tensor next_tokens;    ///< [size] I64, written by the step
+    Tensor kv;             ///< [max_active, max_seq_len, kv_dim] F32 pool, or empty
+};
+
+using DecodeStepFn = Status (*)(const DecodeBatch& batch, void* user) noexcept;
+
+struct DecodeConfig {
+    int64_t max_active = 16;     ///< Rows / KV slots
+    int64_t max_seq_len = 2048;  ///< Prompt + generated tokens per sequence
+    int64_t kv_dim = 0;          ///< F32 values per (slot, position); 0 for no pool
+};
+
+/**
+ * @brief Continuous batching scheduler for decode loops
+ *
+ * Any number of threads may submit(). Exactly one thread drives steps,
+ * either the internal worker (start()/stop()) or the caller via step().
+ */
+struct DecodeScheduler {
+    DecodeScheduler() noexcept = default;
+    DecodeScheduler(const DecodeScheduler&) = delete;
+    DecodeScheduler& operator=(const DecodeScheduler&) = delete;
+    ~DecodeScheduler() { destroy(); }
+
+    /**
+     * @brief Preallocate batch rows, slot bookkeeping and the KV pool
+     */
+    Status init(const DecodeConfig& config, DecodeStepFn step, void* user) noexcept {
+        if (step == nullptr) return status::invalid_argument("null step function");
+        if (config.max_active < 1) return status::invalid_argument("max_active must be >= 1");
+        if (config.max_seq_len < 1) return status::invalid_argument("max_seq_len must be >= 1");
+        if (config.kv_dim < 0) return status::invalid_argument("kv_dim must be >= 0");
+
+        int64_t rows[] = {config.max_active};
+        tokens_ = Tensor::alloc(rows, 1, DType::I64);
+        positions_ = Tensor::alloc(rows, 1, DType::I64);
+        slots_ = Tensor::alloc(rows, 1, DType::I64);
+        next_tokens_ = Tensor::alloc(rows, 1, DType::I64);
+        size_t n = static_cast<size_t>(config.max_active);
+        rows_ = static_cast<DecodeSequence**>(
+            mem_alloc(n * sizeof(DecodeSequence*), alignof(DecodeSequence*), Device::CPU));
+        free_slots_ = static_cast<int64_t*>(mem_alloc(n * sizeof(int64_t), alignof(int64_t), Device::CPU));
+        if (config.kv_dim > 0) {
+            int64_t kv_shape[] = {config.max_active, config.max_seq_len, config.kv_dim};
+            kv_ = Tensor::alloc(kv_shape, 3, DType::F32);
+        }
+        if (tokens_.data == nullptr || positions_.data == nullptr || slots_.data == nullptr ||
+            next_tokens_.data == nullptr || rows_ == nullptr || free_slots_ == nullptr ||
+            (config.kv_dim > 0 && kv_.data == nullptr)) {
+            release();
+            return status::allocation_failed("decode scheduler buffers");
+        }
+
+        config_ = config;
+        step_ = step;
+        user_ = user;
+        active_ = 0;
+        free_top_ = config.max_active;
+        for (int64_t s = 0; s < config.max_active; ++s) free_slots_[s] = config.max_active - 1 - s;
+        stopping_.store(false, std::memory_order_relaxed);
+        return status::OK;
+    }
+
+    /**
+     * @brief Enqueue a sequence (lock-free for producers)
+     */
+    Status submit(DecodeSequence* seq) noexcept {
+        if (seq == nullptr) return status::invalid_argument("null sequence");
+        if (step_ == nullptr) return status::invalid_state("scheduler not initialized");
+        if (seq->prompt == nullptr || seq->output == nullptr)
+            return status::invalid_argument("null prompt or output");
+        if (seq->prompt_len < 1 || seq->prompt_len > config_.max_seq_len)
+            return status::invalid_argument("prompt_len must be in [1, max_seq_len]");
+        if (seq->max_new_tokens < 1) return status::invalid_argument("max_new_tokens must be >= 1");
+
+        // Announce before checking stopping_: stop() either makes us see
+        // the flag or waits for this push before its final drain.
+        submitting_.fetch_add(1, std::memory_order_seq_cst);
+        if (stopping_.load(std::memory_order_seq_cst)) {
+            leave_submit();
+            return status::invalid_state("scheduler stopping");
+        }
+
+        seq->done.reset();
+        seq->generated = 0;
+        seq->slot = -1;
+        DecodeSequence* head = inbox_.load(std::memory_order_relaxed);
+        do {
+            seq->next = head;
+        } while (!inbox_.compare_exchange_weak(head, seq, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed));
+        ZERO_QUEUE_METRICS(telemetry::RuntimeSite::DECODE_SCHEDULER, 1);
+        arrivals_.fetch_add(1, std::memory_order_release);
+        arrivals_.notify_one();
+        leave_submit();
+        return status::OK;
+    }
+
+    /**
+     * @brief Admit what fits, run one iteration, evict finished sequences
+     *
+     * Non-blocking. Returns the number of rows decoded (0 when idle).
+     */
+    int64_t step() noexcept {
+        drain_inbox();
+        while (pending_head_ != nullptr && free_top_ > 0) admit(pop_pending());
+        if (active_ == 0) return 0;
+
+        int64_t n = active_;
+        DecodeBatch batch{n, tokens_.slice(0, 0, n), positions_.slice(0, 0, n),
+                          slots_.slice(0, 0, n), next_tokens_.slice(0, 0, n), kv_};
+        Status s = step_(batch, user_);
+        steps_run_.fetch_add(1, std::memory_order_relaxed);
+
+        if (s.is_error()) {
+            while (active_ > 0) evict(active_ - 1, s);
+            return n;
+        }
+
+        int64_t* tok = static_cast<int64_t*>(tokens_.data);
+        int64_t* pos = static_cast<int64_t*>(positions_.data);
+        const int64_t* next = static_cast<const int64_t*>(next_tokens_.data);
+        int64_t generated = 0;
+        // Descending, so evict()'s swap only moves rows already handled.
+        for (int64_t r = n - 1; r >= 0; --r) {
+            DecodeSequence* seq = rows_[r];
+            int64_t fed = pos[r] + 1;
+            pos[r] = fed;
+            if (fed < seq->prompt_len) {
+                tok[r] = seq->prompt[fed];
+                continue;
+            }
+            seq->output[seq->generated++] = next[r];
+            ++generated;
+            tok[r] = next[r];
+            if (next[r] == seq->eos_token || seq->generated >= seq->max_new_tokens ||
+                fed >= config_.max_seq_len)
+                evict(r, status::OK);
+        }
+        tokens_generated_.fetch_add(static_cast<uint64_t>(generated), std::memory_order_relaxed);
+        return n;
+    }
+
+    /**
+     * @brief Drive step() on an internal worker thread
+     */
+    Status start() noexcept {
+        if (step_ == nullptr) return status::invalid_state("scheduler not initialized");
+        if (worker_.joinable()) return status::invalid_state("scheduler already started");
+        stopping_.store(false, std::memory_order_release);
+        worker_ = std::thread([this] {
+            for (;;) {
+                if (step() > 0) continue;
+                uint64_t seen = arrivals_.load(std::memory_order_acquire);
+                if (inbox_.load(std::memory_order_acquire) != nullptr) continue;
+                if (stopping_.load(std::memory_order_acquire)) return;
+                ZERO_IDLE_METRICS_SCOPE(telemetry::RuntimeSite::DECODE_SCHEDULER);
+                arrivals_.wait(seen, std::memory_order_acquire);
+            }
+        });
+        return status::OK;
+    }
+
+    /**
+     * @brief Stop accepting sequences, run everything queued to completion
+     *
+     * Every submit() that returned OK is decoded. Submits racing stop()
+     * are either decoded or rejected with INVALID_STATE.
+     */
+    void stop() noexcept {
+        stopping_.store(true, std::memory_order_seq_cst);
+        for (uint32_t n = submitting_.load(std::memory_order_seq_cst); n != 0;
+             n = submitting_.load(std::memory_order_seq_cst))
+            submitting_.wait(n, std::memory_order_seq_cst);
+        arrivals_.fetch_add(1, std::memory_order_release);
+        arrivals_.notify_all();
+        if (worker_.joinable()) worker_.join();
+        while (step() > 0) {}
+    }
+
+    /**
+     * @brief Stop and release all buffers
+     */
+    void destroy() noexcept {
+        if (step_ == nullptr) return;
+        stop();
+        release();
+        step_ = nullptr;
+    }
+
+    /**
+     * @brief KV state of one slot: [1, max_seq_len, kv_dim] view of the pool
+     */
+    Tensor kv_slot(int64_t slot) const noexcept { return kv_.slice(0, slot, slot + 1); }
+
+    int64_t active() const noexcept { return active_; }
+    uint64_t steps_run() const noexcept { return steps_run_.load(std::memory_order_relaxed); }
+    uint64_t tokens_generated() const noexcept { return tokens_generated_.load(std::memory_order_relaxed); }
+
+private:
+    void leave_submit() noexcept {
+        if (submitting_.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+            stopping_.load(std::memory_order_seq_cst))
+            submitting_.notify_all();
+    }
+
+    void drain_inbox() noexcept {
+        DecodeSequence* lifo = inbox_.exchange(nullptr, std::memory_order_acquire);
+        if (lifo == nullptr) return;
+        DecodeSequence* fifo = nullptr;
+        DecodeSequence* last = lifo;
+        while (lifo != nullptr) {
+            DecodeSequence* next = lifo->next;
+            lifo->next = fifo;
+            fifo = lifo;
+            lifo = next;
+        }
+        if (pending_tail_ != nullptr) pending_tail_->next = fifo; else pending_head_ = fifo;
+        pending_tail_ = last;
+    }
+
+    DecodeSequence* pop_pending() noexcept {
+        DecodeSequence* seq = pending_head_;
+        pending_head_ = seq->next;
+        if (pending_head_ == nullptr) pending_tail_ = nullptr;
+        seq->next = nullptr;
+        return seq;
+    }
+
+    // O(1): one new row at the end of the dense prefix.
+    void admit(DecodeSequence* seq) noexcept {
+        ZERO_QUEUE_METRICS(telemetry::RuntimeSite::DECODE_SCHEDULER, -1);
+        int64_t r = active_++;
+        seq->slot = free_slots_[--free_top_];
+        rows_[r] = seq;
+        static_cast<int64_t*>(tokens_.data)[r] = seq->prompt[0];
+        static_cast<int64_t*>(positions_.data)[r] = 0;
+        static_cast<int64_t*>(slots_.data)[r] = seq->slot;
+    }
+
+    // O(1): the last row moves into r. Completes seq last; the caller may free it.
+    void evict(int64_t r, Status s) noexcept {
+        DecodeSequence* seq = rows_[r];
+        int64_t last = --active_;
+        if (r != last) {
+            rows_[r] = rows_[last];
+            static_cast<int64_t*>(tokens_.data)[r] = static_cast<int64_t*>(tokens_.data)[last];
+            static_cast<int64_t*>(positions_.data)[r] = static_cast<int64_t*>(positions_.data)[last];
+            static_cast<int64_t*>(slots_.data)[r] = static_cast<int64_t*>(slots_.data)[last];
+        }
+        free_slots_[free_top_++] = seq->slot;
+        seq->done.complete(s);
+    }
+
+    void release() noexcept {
+        tokens_.free();
+        positions_.free();
+        slots_.free();
+        next_tokens_.free();
+        kv_.free();
+        if (rows_ != nullptr) mem_free(rows_, Device::CPU);
+        if (free_slots_ != nullptr) mem_free(free_slots_, Device::CPU);
+        rows_ = nullptr;
+        free_slots_ = nullptr;
+    }
+
+    DecodeConfig config_{};
+    DecodeStepFn step_ = nullptr;
+    void* user_ = nullptr;
+
+    Tensor tokens_ = Tensor::empty();
+    Tensor positions_ = Tensor::empty();
+    Tensor slots_ = Tensor::empty();
+    Tensor next_tokens_ = Tensor::empty();
+    Tensor kv_ = Tensor::empty();
+    DecodeSequence** rows_ = nullptr;   // Row -> sequence, dense prefix [0, active_)
+    int64_t* free_slots_ = nullptr;     // Stack of unused KV slots
+    int64_t free_top_ = 0;
+    int64_t active_ = 0;
+
+    std::atomic<DecodeSequence*> inbox_{nullptr};  // Treiber stack, producers push
+    std::atomic<uint64_t> arrivals_{0};
+    std::atomic<bool> stopping_{false};
+    std::atomic<uint32_t> submitting_{0};          // producers between announce and push
+    DecodeSequence* pending_head_ = nullptr;       // Driver-private FIFO
+    DecodeSequence* pending_tail_ = nullptr;
+
+    std::atomic<uint64_t> steps_run_{0};
+    std::atomic<uint64_t> tokens_generated_{0};
+    std::thread worker_;
+};
+
+} // namespace exec
+} // namespace zero
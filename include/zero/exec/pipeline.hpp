@@ -0,0 +1,288 @@
+#pragma once
+
+/**
+ * @file pipeline.hpp
+ * @brief Zero Core Runtime — Buffered Pipeline Stages
+ *
+ * Overlaps the stages of a data path (read/decode → normalize → compute)
+ * by running each on its own thread, connected by bounded rings of
+ * preallocated tensors:
+ *
+ *   [source stage] ─▶ ring(depth) ─▶ [transform stage] ─▶ ring(depth) ─▶ consumer
+ *
+ * With depth 2 (double buffering) a stage fills slot i+1 while its
+ * consumer works on slot i. A full ring blocks its producer
+ * (backpressure); slots are reused, so steady state does no allocation.
+ */
+
+#include "../core/tensor.hpp"
+#include "../core/memory.hpp"
+#include "../core/status.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <thread>
+
+namespace zero {
+namespace exec {
+
+/**
+ * @brief Single-producer / single-consumer bounded ring of tensors
+ *
+ * The producer does acquire_write() → fill → publish(); the consumer does
+ * acquire_read() → use → release(). Both block (atomic wait) when the ring
+ * is full / empty. close() ends the stream from either side.
+ */
+struct TensorRing {
+    TensorRing() noexcept = default;
+    TensorRing(const TensorRing&) = delete;
+    TensorRing& operator=(const TensorRing&) = delete;
+    ~TensorRing() { destroy(); }
+
+    /**
+     * @brief Allocate depth slots of the given shape/dtype
+     */
+    Status init(int64_t depth, const int64_t* shape, int8_t ndim, DType dtype) noexcept {
+        if (depth < 1) return status::invalid_argument("ring depth must be >= 1");
+        if (ndim < 0 || ndim > MAX_DIMS || (ndim > 0 && shape == nullptr))
+            return status::invalid_argument("invalid slot shape");
+
+        size_t n = static_cast<size_t>(depth);
+        slots_ = static_cast<Tensor*>(mem_alloc(2 * n * sizeof(Tensor), alignof(Tensor), Device::CPU));
+        if (slots_ == nullptr) return status::allocation_failed("ring slots");
+        views_ = slots_ + n;
+        depth_ = depth;
+        for (size_t i = 0; i < 2 * n; ++i) new (&slots_[i]) Tensor(Tensor::empty());
+        for (int64_t i = 0; i < depth; ++i) {
+            slots_[i] = Tensor::alloc(shape, ndim, dtype);
+            if (slots_[i].data == nullptr) {
+                destroy();
+                return status::allocation_failed("ring slot buffer");
+            }
+        }
+
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        closing_.store(false, std::memory_order_relaxed);
+        closed_.store(false, std::memory_order_relaxed);
+        status_ = status::OK;
+        return status::OK;
+    }
+
+    /**
+     * @brief Next free slot, as a full-size view the producer may slice
+     *
+     * Blocks while the ring is full. Returns nullptr once closed.
+     */
+    Tensor* acquire_write() noexcept {
+        bool stalled = false;
+        for (;;) {
+            uint32_t e = events_.load(std::memory_order_acquire);
+            if (closed_.load(std::memory_order_acquire)) return nullptr;
+            uint64_t h = head_.load(std::memory_order_relaxed);
+            uint64_t t = tail_.load(std::memory_order_acquire);
+            if (h - t < static_cast<uint64_t>(depth_)) {
+                if (stalled) producer_stalls_.fetch_add(1, std::memory_order_relaxed);
+                size_t i = static_cast<size_t>(h % static_cast<uint64_t>(depth_));
+                views_[i] = slots_[i].view_like();
+                return &views_[i];
+            }
+            stalled = true;
+            events_.wait(e, std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Hand the slot from acquire_write() to the consumer
+     */
+    void publish() noexcept {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        signal();
+    }
+
+    /**
+     * @brief Oldest published slot
+     *
+     * Blocks while the ring is empty. Returns nullptr once the ring is
+     * closed and drained; status() then tells why it closed.
+     */
+    const Tensor* acquire_read() noexcept {
+        bool stalled = false;
+        for (;;) {
+            uint32_t e = events_.load(std::memory_order_acquire);
+            bool c = closed_.load(std::memory_order_acquire);
+            uint64_t t = tail_.load(std::memory_order_relaxed);
+            uint64_t h = head_.load(std::memory_order_acquire);
+            if (h != t) {
+                if (stalled) consumer_stalls_.fetch_add(1, std::memory_order_relaxed);
+                return &views_[static_cast<size_t>(t % static_cast<uint64_t>(depth_))];
+            }
+            if (c) return nullptr;
+            stalled = true;
+            events_.wait(e, std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Return the slot from acquire_read() to the producer
+     */
+    void release() noexcept {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        signal();
+    }
+
+    /**
+     * @brief End the stream and wake both sides
+     *
+     * The producer closes with OK at end of data, or with an error; the
+     * consumer closes to cancel. The first close's Status is kept.
+     */
+    void close(Status s = status::OK) noexcept {
+        bool expected = false;
+        if (!closing_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) return;
+        status_ = s;
+        closed_.store(true, std::memory_order_release);
+        signal();
+    }
+
+    Status status() const noexcept {
+        return closed_.load(std::memory_order_acquire) ? status_ : status::OK;
+    }
+
+    bool closed() const noexcept { return closed_.load(std::memory_order_acquire); }
+    int64_t depth() const noexcept { return depth_; }
+
+    /**
+     * @brief Published slots not yet released
+     */
+    int64_t size() const noexcept {
+        uint64_t t = tail_.load(std::memory_order_acquire);
+        return static_cast<int64_t>(head_.load(std::memory_order_acquire) - t);
+    }
+
+    /**
+     * @brief Times a stage had to wait (full / empty ring)
+     */
+    uint64_t producer_stalls() const noexcept { return producer_stalls_.load(std::memory_order_relaxed); }
+    uint64_t consumer_stalls() const noexcept { return consumer_stalls_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Free the slot buffers. Both sides must be done with the ring.
+     */
+    void destroy() noexcept {
+        if (slots_ == nullptr) return;
+        for (int64_t i = 0; i < depth_; ++i) slots_[i].free();
+        mem_free(slots_, Device::CPU);
+        slots_ = nullptr;
+        views_ = nullptr;
+        depth_ = 0;
+    }
+
+private:
+    void signal() noexcept {
+        events_.fetch_add(1, std::memory_order_release);
+        events_.notify_all();
+    }
+
+    Tensor* slots_ = nullptr;     // Owning buffers
+    Tensor* views_ = nullptr;     // What the stages see; reset per acquire_write()
+    int64_t depth_ = 0;
+
+    std::atomic<uint64_t> head_{0};      // Published count (producer)
+    std::atomic<uint64_t> tail_{0};      // Released count (consumer)
+    std::atomic<uint32_t> events_{0};    // Bumped on every transition; waiters block on it
+    std::atomic<bool> closing_{false};
+    std::atomic<bool> closed_{false};
+    Status status_;
+
+    std::atomic<uint64_t> producer_stalls_{0};
+    std::atomic<uint64_t> consumer_stalls_{0};
+};
+
+/**
+ * @brief Stage body
+ *
+ * in is the input slot (nullptr for a source stage). Write the result to
+ * out, optionally slicing it (e.g. a short final batch). Set end to stop
+ * the stage without publishing out.
+ */
+using StageFn = Status (*)(const Tensor* in, Tensor& out, bool& end, void* user) noexcept;
+
+/**
+ * @brief One pipeline stage running on its own thread
+ *
+ * Reads from in (optional), writes to out. Closes out when in is drained
+ * or fn ends; an error from fn closes both rings with that Status, and a
+ * consumer closing out cancels upstream.
+ */
+struct PipelineStage {
+    PipelineStage() noexcept = default;
+    PipelineStage(const PipelineStage&) = delete;
+    PipelineStage& operator=(const PipelineStage&) = delete;
+    ~PipelineStage() { join(); }
+
+    Status start(TensorRing* in, TensorRing* out, StageFn fn, void* user) noexcept {
+        if (out == nullptr || fn == nullptr) return status::invalid_argument("null output ring or stage fn");
+        if (worker_.joinable()) return status::invalid_state("stage already started");
+        in_ = in;
+        out_ = out;
+        fn_ = fn;
+        user_ = user;
+        items_ = 0;
+        worker_ = std::thread([this] { run(); });
+        return status::OK;
+    }
+
+    /**
+     * @brief Wait for the stage to finish
+     */
+    void join() noexcept {
+        if (worker_.joinable()) worker_.join();
+    }
+
+    /**
+     * @brief Slots published to out. Valid after join().
+     */
+    int64_t items() const noexcept { return items_; }
+
+private:
+    void run() noexcept {
+        for (;;) {
+            const Tensor* src = nullptr;
+            if (in_ != nullptr) {
+                src = in_->acquire_read();
+                if (src == nullptr) {
+                    out_->close(in_->status());
+                    return;
+                }
+            }
+            Tensor* dst = out_->acquire_write();
+            if (dst == nullptr) {   // Downstream cancelled
+                if (in_ != nullptr) in_->close(out_->status());
+                return;
+            }
+
+            bool end = false;
+            Status s = fn_(src, *dst, end, user_);
+            if (in_ != nullptr) in_->release();
+            if (s.is_error() || end) {
+                out_->close(s);
+                if (in_ != nullptr) in_->close(s);
+                return;
+            }
+            out_->publish();
+            ++items_;
+        }
+    }
+
+    TensorRing* in_ = nullptr;
+    TensorRing* out_ = nullptr;
+    StageFn fn_ = nullptr;
+    void* user_ = nullptr;
+    int64_t items_ = 0;
+    std::thread worker_;
+};
+
+} // namespace exec
+} // namespace zero
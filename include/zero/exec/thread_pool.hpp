@@ -0,0 +1,421 @@
+#pragma once
+
+/**
+ * @file thread_pool.hpp
+ * @brief Zero Core Runtime — Work-Stealing Thread Pool
+ *
+ * Fork-join parallel_for over an index space [0, n). The range is split
+ * evenly across the participants (the workers plus the calling thread);
+ * each takes items from the front of its own span and, once empty,
+ * steals the back half of another participant's span:
+ *
+ *   span = (begin:32 | end:32) in one atomic word
+ *   owner  pop:    CAS (b, e) -> (b + 1, e)
+ *   thief  steal:  CAS (b, e) -> (b, mid), keeps [mid, e)
+ *
+ * Every worker joins every job and the caller returns only after all of
+ * them have left it, so no worker can touch a finished job. Workers
+ * sleep on an atomic epoch between jobs.
+ *
+ * Started with a Topology, the pool runs in NUMA mode:
+ *
+ *   - workers are spread over nodes one physical core at a time (SMT
+ *     siblings last) and pinned to their CPU;
+ *   - spans are dealt out grouped by node, so each node's participants
+ *     hold one contiguous block of the index space;
+ *   - a thief tries its SMT sibling, then its node, then its socket,
+ *     and only then the other sockets;
+ *   - a job with a node hint is dealt only to that node's participants,
+ *     and nobody outside the node steals from it.
+ */
+
+#include "../core/memory.hpp"
+#include "../core/status.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+#include "topology.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace zero {
+namespace exec {
+
+/// Maximum participants (workers + caller) in one pool
+constexpr int32_t POOL_MAX_THREADS = 64;
+
+/// Largest index space a single parallel_for accepts
+constexpr int64_t POOL_MAX_ITEMS = int64_t{0xFFFFFFFF};
+
+struct PoolOptions {
+    int32_t threads = 1;                  ///< Participants, including the caller
+    const Topology* topology = nullptr;   ///< Non-null: NUMA mode (copied by start)
+    bool pin = true;                      ///< Pin workers to their CPUs (NUMA mode)
+};
+
+struct ThreadPool {
+    ThreadPool() noexcept = default;
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ~ThreadPool() { stop(); }
+
+    /**
+     * @brief Spawn threads - 1 workers; the caller is the last participant
+     */
+    Status start(int32_t threads) noexcept {
+        PoolOptions opt;
+        opt.threads = threads;
+        return start(opt);
+    }
+
+    /**
+     * @brief Start with options; a topology selects NUMA mode
+     *
+     * Workers take the CPUs of the topology in placement order, wrapping
+     * around when there are more participants than CPUs. The caller is
+     * never pinned; its node is looked up on each job.
+     */
+    Status start(const PoolOptions& opt) noexcept {
+        int32_t threads = opt.threads;
+        if (threads < 1 || threads > POOL_MAX_THREADS)
+            return status::invalid_argument("pool size out of range");
+        if (size_ != 0) return status::invalid_state("pool already started");
+        const Topology* topo = opt.topology;
+        if (topo != nullptr && (topo->num_cpus < 1 || topo->num_cpus > TOPO_MAX_CPUS))
+            return status::invalid_argument("pool topology has no CPUs");
+
+        for (int32_t p = 0; p < threads; ++p) place_[p] = CpuInfo{-1, -1, -1, -1};
+        pinned_ = 0;
+        if (topo != nullptr) {
+            size_t bytes = static_cast<size_t>(topo->num_cpus) * sizeof(CpuInfo);
+            cpus_ = static_cast<CpuInfo*>(mem_alloc(bytes, alignof(CpuInfo), Device::CPU));
+            if (cpus_ == nullptr) return status::allocation_failed("pool topology allocation failed");
+            std::memcpy(cpus_, topo->cpus, bytes);
+            num_cpus_ = topo->num_cpus;
+            place_workers(threads);
+        }
+        numa_ = topo != nullptr;
+        size_ = threads;
+        for (int32_t p = 0; p < threads; ++p) build_steal_order(p);
+
+        stopping_.store(false, std::memory_order_relaxed);
+        uint32_t epoch = epoch_.load(std::memory_order_relaxed);
+        for (int32_t w = 1; w < threads; ++w) {
+            workers_[w] = std::thread([this, w, epoch] { worker_main(w, epoch); });
+            if (numa_ && opt.pin && pin_thread(workers_[w], place_[w].cpu)) ++pinned_;
+        }
+        return status::OK;
+    }
+
+    /**
+     * @brief Join the workers. Must not race with parallel_for.
+     */
+    void stop() noexcept {
+        if (size_ == 0) return;
+        stopping_.store(true, std::memory_order_release);
+        epoch_.fetch_add(1, std::memory_order_release);
+        epoch_.notify_all();
+        for (int32_t w = 1; w < size_; ++w) workers_[w].join();
+        size_ = 0;
+        if (cpus_ != nullptr) mem_free(cpus_, Device::CPU);
+        cpus_ = nullptr;
+        num_cpus_ = 0;
+        numa_ = false;
+    }
+
+    /**
+     * @brief Participants per job (workers + caller); 0 before start()
+     */
+    int32_t size() const noexcept { return size_; }
+
+    bool numa() const noexcept { return numa_; }
+
+    /**
+     * @brief Workers the OS accepted a CPU pin for
+     */
+    int32_t pinned() const noexcept { return pinned_; }
+
+    /**
+     * @brief Placement of participant p (0 = the caller, as of its last job)
+     *
+     * All fields are -1 outside NUMA mode or for an unknown CPU.
+     */
+    CpuInfo placement(int32_t p) const noexcept {
+        if (p < 0 || p >= size_) return CpuInfo{-1, -1, -1, -1};
+        return place_[p];
+    }
+
+    /**
+     * @brief Victims participant p tries, in order (size() - 1 entries)
+     */
+    const int8_t* steal_order(int32_t p) const noexcept {
+        return p >= 0 && p < POOL_MAX_THREADS ? order_[p] : nullptr;
+    }
+
+    /**
+     * @brief Participant index of the calling thread inside a task, else -1
+     */
+    static int32_t participant() noexcept { return participant_ref(); }
+
+    /**
+     * @brief Call fn(i) for every i in [0, n), in parallel
+     *
+     * Returns after every call has finished. Runs inline when the pool
+     * has one participant or is not started, and when called from inside
+     * one of this pool's tasks (nested loops do not deadlock). Concurrent
+     * callers are serialized.
+     *
+     * In NUMA mode a `node` hint (e.g. memory_node(t.data)) keeps the job
+     * on that node's participants. It is ignored if none is on the node,
+     * and outside NUMA mode.
+     *
+     * `threads` > 0 caps the participants that take part (the caller
+     * first, if eligible); the rest wake, find nothing and leave. A cap
+     * of 1 runs inline. CostModel (spec 026) picks the cap per call.
+     */
+    template <typename Fn>
+    Status parallel_for(int64_t n, Fn&& fn, int32_t node = -1, int32_t threads = 0) noexcept {
+        if (n < 0 || n > POOL_MAX_ITEMS) return status::invalid_argument("item count out of range");
+        if (n == 0) return status::OK;
+        if (size_ <= 1 || n == 1 || threads == 1 || current() == this) {
+            for (int64_t i = 0; i < n; ++i) fn(i);
+            return status::OK;
+        }
+
+        std::lock_guard<std::mutex> lock(submit_mu_);
+        using F = std::remove_reference_t<Fn>;
+        invoke_ = [](void* ctx, int64_t i) { (*static_cast<F*>(ctx))(i); };
+        ctx_ = const_cast<void*>(static_cast<const void*>(&fn));
+        deal(n, node, threads);
+        left_.store(0, std::memory_order_relaxed);
+        jobs_.fetch_add(1, std::memory_order_relaxed);
+        epoch_.fetch_add(1, std::memory_order_release);
+        epoch_.notify_all();
+
+        ThreadPool* outer = current();
+        int32_t outer_participant = participant_ref();
+        current() = this;
+        participant_ref() = 0;
+        work(0);
+        current() = outer;
+        participant_ref() = outer_participant;
+
+        int32_t workers = size_ - 1;
+        for (;;) {
+            int32_t v = left_.load(std::memory_order_acquire);
+            if (v == workers) break;
+            left_.wait(v, std::memory_order_acquire);
+        }
+        return status::OK;
+    }
+
+    uint64_t jobs() const noexcept { return jobs_.load(std::memory_order_relaxed); }
+    uint64_t steals() const noexcept { return steals_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Steals whose victim sat on another NUMA node
+     */
+    uint64_t remote_steals() const noexcept { return remote_steals_.load(std::memory_order_relaxed); }
+
+private:
+    struct alignas(64) Span {
+        std::atomic<uint64_t> span{0};
+    };
+
+    static uint64_t pack(uint64_t b, uint64_t e) noexcept { return (b << 32) | e; }
+    static uint64_t span_begin(uint64_t s) noexcept { return s >> 32; }
+    static uint64_t span_end(uint64_t s) noexcept { return s & 0xFFFFFFFFu; }
+
+    // Pool whose task the calling thread is running, if any.
+    static ThreadPool*& current() noexcept {
+        thread_local ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    static int32_t& participant_ref() noexcept {
+        thread_local int32_t index = -1;
+        return index;
+    }
+
+    // Placement order: one CPU per physical core, nodes interleaved, then
+    // the second SMT thread of every core, and so on. The caller is
+    // expected on the first entry, so workers start at the second.
+    void place_workers(int32_t threads) noexcept {
+        int32_t n = num_cpus_;
+        int32_t smt[TOPO_MAX_CPUS];
+        bool first_of_node[TOPO_MAX_CPUS];
+        for (int32_t i = 0; i < n; ++i) {
+            smt[i] = 0;
+            first_of_node[i] = true;
+            for (int32_t j = 0; j < i; ++j) {
+                if (cpus_[j].core == cpus_[i].core) ++smt[i];
+                if (cpus_[j].node == cpus_[i].node) first_of_node[i] = false;
+            }
+        }
+        // Sort key (SMT level, core rank within node, node rank)
+        int64_t key[TOPO_MAX_CPUS];
+        int32_t idx[TOPO_MAX_CPUS];
+        for (int32_t i = 0; i < n; ++i) {
+            int64_t core_rank = 0, node_rank = 0;
+            for (int32_t j = 0; j < n; ++j) {
+                if (smt[j] == 0 && cpus_[j].node == cpus_[i].node && cpus_[j].core < cpus_[i].core) ++core_rank;
+                if (first_of_node[j] && cpus_[j].node < cpus_[i].node) ++node_rank;
+            }
+            key[i] = (int64_t{smt[i]} << 40) | (core_rank << 20) | node_rank;
+            int32_t k = i;
+            for (; k > 0 && key[idx[k - 1]] > key[i]; --k) idx[k] = idx[k - 1];
+            idx[k] = i;
+        }
+        for (int32_t p = 0; p < threads; ++p) place_[p] = cpus_[idx[p % n]];
+    }
+
+    // Victims in distance order, rotating from self within each class.
+    void build_steal_order(int32_t self) noexcept {
+        int32_t k = 0;
+        for (int32_t d = TOPO_SAME_CORE; d <= TOPO_REMOTE; ++d) {
+            for (int32_t i = 1; i < size_; ++i) {
+                int32_t v = (self + i) % size_;
+                int32_t dv = numa_ ? Topology::distance(place_[self], place_[v]) : TOPO_REMOTE;
+                if (dv == d) order_[self][k++] = static_cast<int8_t>(v);
+            }
+        }
+    }
+
+    // Split [0, n) over the participants. In NUMA mode the spans go out
+    // grouped by node, and a node hint limits them to that node. Only the
+    // participants dealt a span may steal during the job.
+    void deal(int64_t n, int32_t node, int32_t threads) noexcept {
+        int32_t who[POOL_MAX_THREADS];
+        int32_t count = 0;
+        if (numa_) {
+            int32_t cpu = current_cpu();
+            place_[0] = CpuInfo{-1, -1, -1, -1};
+            for (int32_t i = 0; i < num_cpus_; ++i)
+                if (cpus_[i].cpu == cpu) place_[0] = cpus_[i];
+            build_steal_order(0);
+            for (int32_t p = 0; p < size_ && node >= 0; ++p)
+                if (place_[p].node == node) who[count++] = p;
+            if (count == 0) {
+                for (int32_t p = 0; p < size_; ++p) {
+                    int32_t k = count++;
+                    for (; k > 0 && place_[who[k - 1]].node > place_[p].node; --k) who[k] = who[k - 1];
+                    who[k] = p;
+                }
+            }
+        } else {
+            for (int32_t p = 0; p < size_; ++p) who[count++] = p;
+        }
+        if (threads > 0 && threads < count) {
+            // Keep the caller, then the first others in deal order
+            int32_t all[POOL_MAX_THREADS];
+            std::memcpy(all, who, sizeof(int32_t) * static_cast<size_t>(count));
+            int32_t kept = 0;
+            for (int32_t k = 0; k < count; ++k)
+                if (all[k] == 0) who[kept++] = 0;
+            for (int32_t k = 0; k < count && kept < threads; ++k)
+                if (all[k] != 0) who[kept++] = all[k];
+            count = threads;
+        }
+        for (int32_t p = 0; p < size_; ++p) {
+            spans_[p].span.store(0, std::memory_order_relaxed);
+            active_[p] = false;
+        }
+        for (int32_t k = 0; k < count; ++k) active_[who[k]] = true;
+        for (int32_t k = 0; k < count; ++k) {
+            uint64_t b = static_cast<uint64_t>(n * k / count);
+            uint64_t e = static_cast<uint64_t>(n * (k + 1) / count);
+            spans_[who[k]].span.store(pack(b, e), std::memory_order_relaxed);
+        }
+    }
+
+    bool pop(int32_t self, int64_t& item) noexcept {
+        std::atomic<uint64_t>& word = spans_[self].span;
+        uint64_t s = word.load(std::memory_order_acquire);
+        for (;;) {
+            uint64_t b = span_begin(s), e = span_end(s);
+            if (b >= e) return false;
+            if (word.compare_exchange_weak(s, pack(b + 1, e), std::memory_order_acq_rel)) {
+                item = static_cast<int64_t>(b);
+                return true;
+            }
+        }
+    }
+
+    // Move the back half of some other span into ours.
+    bool steal(int32_t self) noexcept {
+        if (!active_[self]) return false;
+        for (int32_t k = 0; k + 1 < size_; ++k) {
+            int32_t v = order_[self][k];
+            std::atomic<uint64_t>& word = spans_[v].span;
+            uint64_t s = word.load(std::memory_order_acquire);
+            for (;;) {
+                uint64_t b = span_begin(s), e = span_end(s);
+                if (b >= e) break;
+                uint64_t mid = b + (e - b) / 2;
+                if (word.compare_exchange_weak(s, pack(b, mid), std::memory_order_acq_rel)) {
+                    spans_[self].span.store(pack(mid, e), std::memory_order_release);
+                    steals_.fetch_add(1, std::memory_order_relaxed);
+                    if (numa_ && place_[v].node != place_[self].node)
+                        remote_steals_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void work(int32_t self) noexcept {
+        int64_t item = 0;
+        for (;;) {
+            if (pop(self, item)) {
+                invoke_(ctx_, item);
+                continue;
+            }
+            if (!steal(self)) return;
+        }
+    }
+
+    void worker_main(int32_t self, uint32_t seen) noexcept {
+        current() = this;
+        participant_ref() = self;
+        for (;;) {
+            {
+                ZERO_IDLE_METRICS_SCOPE(telemetry::RuntimeSite::THREAD_POOL);
+                epoch_.wait(seen, std::memory_order_acquire);
+            }
+            uint32_t e = epoch_.load(std::memory_order_acquire);
+            if (e == seen) continue;
+            seen = e;
+            if (stopping_.load(std::memory_order_acquire)) return;
+            work(self);
+            left_.fetch_add(1, std::memory_order_release);
+            left_.notify_one();
+        }
+    }
+
+    std::thread workers_[POOL_MAX_THREADS];
+    Span spans_[POOL_MAX_THREADS];
+    CpuInfo place_[POOL_MAX_THREADS] = {};
+    int8_t order_[POOL_MAX_THREADS][POOL_MAX_THREADS] = {};
+    CpuInfo* cpus_ = nullptr;        ///< Topology copy for the caller's lookup (NUMA mode)
+    int32_t num_cpus_ = 0;
+    bool active_[POOL_MAX_THREADS] = {};  ///< Dealt a span in the running job
+    int32_t pinned_ = 0;
+    bool numa_ = false;
+    int32_t size_ = 0;
+    void (*invoke_)(void*, int64_t) = nullptr;
+    void* ctx_ = nullptr;
+    std::mutex submit_mu_;
+    std::atomic<uint32_t> epoch_{0};
+    std::atomic<int32_t> left_{0};
+    std::atomic<bool> stopping_{false};
+    std::atomic<uint64_t> jobs_{0};
+    std::atomic<uint64_t> steals_{0};
+    std::atomic<uint64_t> remote_steals_{0};
+};
+
+} // namespace exec
+} // namespace zero
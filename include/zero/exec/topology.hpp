@@ -0,0 +1,244 @@
+#pragma once
+
+/**
+ * @file topology.hpp
+ * @brief Zero Core Runtime — CPU / NUMA Topology Discovery
+ *
+ * Sockets, NUMA nodes, physical cores and SMT siblings of the online
+ * CPUs, read from sysfs:
+ *
+ *   cpu/online                              online CPUs ("0-7,16-23")
+ *   cpu/cpuN/topology/physical_package_id   socket
+ *   cpu/cpuN/topology/core_id               core within the socket
+ *   node/online, node/nodeK/cpulist         NUMA node membership
+ *
+ * The sysfs root is a parameter, so tests can describe a machine they
+ * do not run on. A kernel without node/ gets one node per socket. With
+ * no sysfs at all, every CPU is its own core on one socket and node.
+ */
+
+#include "../core/status.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace zero {
+namespace exec {
+
+/// CPUs recorded by discover(); further online CPUs are ignored
+constexpr int32_t TOPO_MAX_CPUS = 1024;
+
+/// Distance classes, nearest first (Topology::distance)
+constexpr int32_t TOPO_SAME_CORE = 0;     ///< SMT siblings
+constexpr int32_t TOPO_SAME_NODE = 1;
+constexpr int32_t TOPO_SAME_SOCKET = 2;
+constexpr int32_t TOPO_REMOTE = 3;        ///< Other socket, or unknown
+
+struct CpuInfo {
+    int32_t cpu;     ///< OS CPU number; -1 if unknown
+    int32_t core;    ///< Physical core, dense and unique across sockets
+    int32_t socket;  ///< physical_package_id
+    int32_t node;    ///< NUMA node id as the kernel numbers it
+};
+
+namespace detail {
+
+inline bool read_text(const char* path, char* buf, size_t cap) noexcept {
+    std::FILE* f = std::fopen(path, "r");
+    if (f == nullptr) return false;
+    size_t n = std::fread(buf, 1, cap - 1, f);
+    std::fclose(f);
+    buf[n] = '\0';
+    return n > 0;
+}
+
+inline bool read_int(const char* path, int32_t& out) noexcept {
+    char buf[32];
+    if (!read_text(path, buf, sizeof(buf))) return false;
+    char* end = nullptr;
+    long v = std::strtol(buf, &end, 10);
+    if (end == buf) return false;
+    out = static_cast<int32_t>(v);
+    return true;
+}
+
+/// Call fn(cpu) for each entry of a kernel CPU list ("0-3,8,10-11").
+template <typename Fn>
+inline bool parse_cpulist(const char* s, Fn&& fn) noexcept {
+    while (*s != '\0' && *s != '\n') {
+        char* end = nullptr;
+        long lo = std::strtol(s, &end, 10);
+        if (end == s || lo < 0) return false;
+        long hi = lo;
+        s = end;
+        if (*s == '-') {
+            hi = std::strtol(s + 1, &end, 10);
+            if (end == s + 1 || hi < lo) return false;
+            s = end;
+        }
+        for (long c = lo; c <= hi; ++c) fn(static_cast<int32_t>(c));
+        if (*s == ',') ++s;
+        else if (*s != '\0' && *s != '\n') return false;
+    }
+    return true;
+}
+
+} // namespace detail
+
+struct Topology {
+    int32_t num_cpus = 0;
+    int32_t num_cores = 0;
+    int32_t num_sockets = 0;
+    int32_t num_nodes = 0;
+    CpuInfo cpus[TOPO_MAX_CPUS];
+
+    /**
+     * @brief One socket and node, one core per CPU (no SMT information)
+     */
+    static void flat(Topology& out, int32_t cpus) noexcept {
+        if (cpus < 1) cpus = 1;
+        if (cpus > TOPO_MAX_CPUS) cpus = TOPO_MAX_CPUS;
+        for (int32_t i = 0; i < cpus; ++i) out.cpus[i] = CpuInfo{i, i, 0, 0};
+        out.num_cpus = out.num_cores = cpus;
+        out.num_sockets = out.num_nodes = 1;
+    }
+
+    /**
+     * @brief Read the online CPUs under `root` (normally /sys/devices/system)
+     *
+     * Falls back to flat(hardware_concurrency) if cpu/online is missing.
+     * A malformed CPU list is INVALID_ARGUMENT.
+     */
+    static Status discover(Topology& out, const char* root = "/sys/devices/system") noexcept {
+        char path[512];
+        char buf[4096];
+        std::snprintf(path, sizeof(path), "%s/cpu/online", root);
+        if (!detail::read_text(path, buf, sizeof(buf))) {
+            flat(out, static_cast<int32_t>(std::thread::hardware_concurrency()));
+            return status::OK;
+        }
+        out.num_cpus = 0;
+        bool ok = detail::parse_cpulist(buf, [&](int32_t c) {
+            if (out.num_cpus < TOPO_MAX_CPUS) out.cpus[out.num_cpus++] = CpuInfo{c, -1, 0, -1};
+        });
+        if (!ok || out.num_cpus == 0) return status::invalid_argument("topology: malformed cpu/online");
+
+        // Raw core ids repeat across sockets; renumber (socket, core_id) densely below
+        int32_t raw_core[TOPO_MAX_CPUS];
+        for (int32_t i = 0; i < out.num_cpus; ++i) {
+            CpuInfo& c = out.cpus[i];
+            std::snprintf(path, sizeof(path), "%s/cpu/cpu%d/topology/physical_package_id", root, c.cpu);
+            if (!detail::read_int(path, c.socket) || c.socket < 0) c.socket = 0;
+            std::snprintf(path, sizeof(path), "%s/cpu/cpu%d/topology/core_id", root, c.cpu);
+            if (!detail::read_int(path, raw_core[i])) raw_core[i] = c.cpu;
+        }
+
+        std::snprintf(path, sizeof(path), "%s/node/online", root);
+        if (detail::read_text(path, buf, sizeof(buf))) {
+            char list[4096];
+            ok = detail::parse_cpulist(buf, [&](int32_t node) {
+                std::snprintf(path, sizeof(path), "%s/node/node%d/cpulist", root, node);
+                if (!detail::read_text(path, list, sizeof(list))) return;
+                detail::parse_cpulist(list, [&](int32_t cpu) {
+                    for (int32_t i = 0; i < out.num_cpus; ++i)
+                        if (out.cpus[i].cpu == cpu) out.cpus[i].node = node;
+                });
+            });
+            if (!ok) return status::invalid_argument("topology: malformed node/online");
+        }
+
+        out.num_cores = out.num_sockets = out.num_nodes = 0;
+        for (int32_t i = 0; i < out.num_cpus; ++i) {
+            CpuInfo& c = out.cpus[i];
+            if (c.node < 0) c.node = c.socket;
+            bool socket_seen = false, node_seen = false;
+            for (int32_t j = 0; j < i; ++j) {
+                const CpuInfo& p = out.cpus[j];
+                if (c.core < 0 && p.socket == c.socket && raw_core[j] == raw_core[i]) c.core = p.core;
+                socket_seen = socket_seen || p.socket == c.socket;
+                node_seen = node_seen || p.node == c.node;
+            }
+            if (c.core < 0) c.core = out.num_cores++;
+            if (!socket_seen) ++out.num_sockets;
+            if (!node_seen) ++out.num_nodes;
+        }
+        return status::OK;
+    }
+
+    const CpuInfo* find(int32_t cpu) const noexcept {
+        for (int32_t i = 0; i < num_cpus; ++i)
+            if (cpus[i].cpu == cpu) return &cpus[i];
+        return nullptr;
+    }
+
+    static int32_t distance(const CpuInfo& a, const CpuInfo& b) noexcept {
+        if (a.cpu < 0 || b.cpu < 0) return TOPO_REMOTE;
+        if (a.core == b.core) return TOPO_SAME_CORE;
+        if (a.node == b.node) return TOPO_SAME_NODE;
+        if (a.socket == b.socket) return TOPO_SAME_SOCKET;
+        return TOPO_REMOTE;
+    }
+};
+
+/**
+ * @brief CPU the calling thread is running on, or -1
+ */
+inline int32_t current_cpu() noexcept {
+#if defined(__linux__)
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Restrict a thread to one CPU; false if the OS refuses
+ */
+inline bool pin_thread(std::thread& t, int32_t cpu) noexcept {
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(t.native_handle(), sizeof(set), &set) == 0;
+#else
+    (void)t;
+    (void)cpu;
+    return false;
+#endif
+}
+
+/**
+ * @brief NUMA node holding the page at `p`, or -1 if unknown
+ *
+ * The page must have been touched. Pass the result as the node hint of
+ * ThreadPool::parallel_for to run work next to a tensor's memory.
+ */
+inline int32_t memory_node(const void* p) noexcept {
+#if defined(__linux__) && defined(SYS_move_pages)
+    if (p == nullptr) return -1;
+    uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    void* page = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(p) & ~(page_size - 1));
+    int status = -1;
+    // Null target nodes: query only, nothing moves
+    long r = syscall(SYS_move_pages, 0, 1UL, &page, nullptr, &status, 0);
+    if (r != 0 || status < 0) return -1;
+    return status;
+#else
+    (void)p;
+    return -1;
+#endif
+}
+
+} // namespace exec
+} // namespace zero
@@ -0,0 +1,804 @@
+#pragma once
+
+/**
+ * @file async_reader.hpp
+ * @brief Zero Core Runtime — Asynchronous Bulk File Reader
+ *
+ * Reads a batch of (fd, offset, dst, bytes) requests with many reads in
+ * flight at once. Each request is cut into chunk_bytes pieces and the
+ * pieces of the whole batch share one deep queue:
+ *
+ *   io_uring:  up to queue_depth pieces submitted, completions refill the queue
+ *   threads:   pool participants pull pieces and pread them
+ *
+ * The io_uring backend is driven with raw syscalls (no liburing) and
+ * reads into registered buffers with READ_FIXED when the destination
+ * lies inside one. Short reads are resubmitted for the remainder.
+ *
+ * On an O_DIRECT fd, offset and dst must be DIRECT_IO_ALIGN-aligned;
+ * the unaligned tail of a request is read as one aligned block into a
+ * bounce buffer and copied out, so tensors of any size can be loaded
+ * straight into alloc_direct() memory.
+ *
+ * read() blocks the caller. submit() queues a ReadBatch instead and
+ * returns; a driver thread owned by the reader runs queued batches and
+ * completes each batch's Completion, so nothing waits on a thread per
+ * batch. On io_uring, batches submitted while others are in flight join
+ * the same queue.
+ */
+
+#include "../core/memory.hpp"
+#include "../core/status.hpp"
+#include "../core/tensor.hpp"
+#include "../exec/completion.hpp"
+#include "../exec/thread_pool.hpp"
+#include "file_tensor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define ZERO_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#endif
+#endif
+
+namespace zero {
+namespace io {
+
+/// Offset, buffer and length alignment for O_DIRECT reads
+constexpr int64_t DIRECT_IO_ALIGN = 4096;
+
+constexpr int32_t READER_MAX_DEPTH = 4096;
+constexpr int64_t READER_DEFAULT_CHUNK = int64_t{1} << 20;
+constexpr int64_t READER_MAX_CHUNK = int64_t{1} << 30;
+constexpr int32_t READER_MAX_BUFFERS = 1024;
+
+enum class ReadBackend : uint8_t {
+    AUTO,       ///< io_uring when the kernel allows it, else THREADS
+    IO_URING,
+    THREADS,    ///< pread on a thread pool
+};
+
+struct ReadRequest {
+    int fd = -1;
+    int64_t offset = 0;   ///< File byte offset
+    void* dst = nullptr;
+    int64_t bytes = 0;
+};
+
+struct ReaderOptions {
+    ReadBackend backend = ReadBackend::AUTO;
+    int32_t queue_depth = 64;                     ///< Pieces in flight (io_uring)
+    int64_t chunk_bytes = READER_DEFAULT_CHUNK;   ///< Largest single read; rounded up to DIRECT_IO_ALIGN
+    int32_t threads = 4;                          ///< Fallback participants, caller included
+};
+
+struct ReadStats {
+    int64_t bytes = 0;
+    int64_t reads = 0;          ///< Reads issued, resubmissions included
+    int64_t short_reads = 0;    ///< Partial completions resubmitted for the rest
+    int64_t fixed_reads = 0;    ///< Reads into registered buffers
+    int32_t max_in_flight = 0;
+};
+
+struct ReadBatch;
+
+/**
+ * @brief Open a file for reading, with O_DIRECT if asked and supported
+ *
+ * Filesystems without direct I/O (tmpfs) reject O_DIRECT with EINVAL;
+ * the file is then opened buffered and `is_direct` reports false.
+ */
+inline Status open_read(const char* path, bool direct, int& fd, bool* is_direct = nullptr) noexcept {
+#ifdef ZERO_HAS_FILE_IO
+    fd = -1;
+#ifdef O_DIRECT
+    if (direct) fd = ::open(path, O_RDONLY | O_CLOEXEC | O_DIRECT);
+    if (fd >= 0) {
+        if (is_direct != nullptr) *is_direct = true;
+        return status::OK;
+    }
+    if (direct && errno != EINVAL) return status::invalid_argument("cannot open file");
+#else
+    (void)direct;
+#endif
+    fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return status::invalid_argument("cannot open file");
+    if (is_direct != nullptr) *is_direct = false;
+    return status::OK;
+#else
+    (void)path; (void)direct; (void)fd; (void)is_direct;
+    return Status::error(StatusCode::NOT_IMPLEMENTED, "file reads need POSIX I/O");
+#endif
+}
+
+/**
+ * @brief Allocate a contiguous CPU tensor usable as an O_DIRECT target
+ *
+ * data is DIRECT_IO_ALIGN-aligned and the buffer is rounded up to a
+ * whole number of DIRECT_IO_ALIGN blocks. Release with free().
+ */
+inline Tensor alloc_direct(const int64_t* shape, int8_t ndim, DType dtype) noexcept {
+    Tensor t = Tensor::empty();
+    t.dtype = dtype;
+    t.ndim = ndim;
+    for (int8_t i = 0; i < ndim; ++i) t.shape[i] = shape[i];
+    calc_contiguous_strides(shape, ndim, dtype, t.strides.data());
+    size_t bytes = calc_tensor_bytes(shape, ndim, dtype);
+    bytes = (bytes + DIRECT_IO_ALIGN - 1) / DIRECT_IO_ALIGN * DIRECT_IO_ALIGN;
+    t.data = mem_alloc(bytes > 0 ? bytes : DIRECT_IO_ALIGN, DIRECT_IO_ALIGN, Device::CPU);
+    t.owns_data = (t.data != nullptr);
+    return t;
+}
+
+namespace detail {
+
+inline bool fd_is_direct(int fd) noexcept {
+#if defined(ZERO_HAS_FILE_IO) && defined(O_DIRECT)
+    int flags = fcntl(fd, F_GETFL);
+    return flags >= 0 && (flags & O_DIRECT) != 0;
+#else
+    (void)fd;
+    return false;
+#endif
+}
+
+/// One read of a request. A bounce piece reads one aligned block and copies `bytes`.
+struct Piece {
+    int fd = -1;
+    int64_t offset = 0;
+    char* dst = nullptr;
+    int64_t bytes = 0;
+    int32_t buf_index = -1;   ///< Registered buffer containing dst, or -1
+    bool bounce = false;
+    ReadBatch* batch = nullptr;   ///< Owner of an io_uring slot
+};
+
+/// Walks a batch of requests, handing out pieces in order.
+struct PieceCursor {
+    const ReadRequest* reqs = nullptr;
+    int32_t n = 0;
+    int64_t chunk = 0;
+    int32_t i = 0;
+    int64_t pos = 0;
+    bool direct = false;
+
+    bool next(Piece& p) noexcept {
+        while (i < n) {
+            const ReadRequest& r = reqs[i];
+            if (pos == 0) direct = fd_is_direct(r.fd);
+            int64_t remain = r.bytes - pos;
+            if (remain <= 0) {
+                ++i;
+                pos = 0;
+                continue;
+            }
+            int64_t len = remain < chunk ? remain : chunk;
+            bool bounce = false;
+            if (direct && len % DIRECT_IO_ALIGN != 0) {
+                int64_t aligned = len / DIRECT_IO_ALIGN * DIRECT_IO_ALIGN;
+                if (aligned > 0) len = aligned;
+                else bounce = true;
+            }
+            p = Piece{};
+            p.fd = r.fd;
+            p.offset = r.offset + pos;
+            p.dst = static_cast<char*>(r.dst) + pos;
+            p.bytes = len;
+            p.bounce = bounce;
+            pos += len;
+            return true;
+        }
+        return false;
+    }
+};
+
+/// Blocking read of one piece; `bounce` is a DIRECT_IO_ALIGN-aligned block.
+inline Status read_piece(const Piece& p, char* bounce, int64_t& short_reads) noexcept {
+#ifdef ZERO_HAS_FILE_IO
+    char* dst = p.bounce ? bounce : p.dst;
+    int64_t want = p.bounce ? DIRECT_IO_ALIGN : p.bytes;
+    int64_t got = 0;
+    while (got < want) {
+        ssize_t r = ::pread(p.fd, dst + got, static_cast<size_t>(want - got), static_cast<off_t>(p.offset + got));
+        if (r < 0 && errno == EINTR) continue;
+        if (r < 0) return status::invalid_state("file read failed");
+        if (r == 0) break;
+        got += r;
+        if (got < want && !p.bounce) ++short_reads;
+    }
+    if (got < p.bytes) return status::out_of_bounds("read past end of file");
+    if (p.bounce) std::memcpy(p.dst, bounce, static_cast<size_t>(p.bytes));
+    return status::OK;
+#else
+    (void)p; (void)bounce; (void)short_reads;
+    return Status::error(StatusCode::NOT_IMPLEMENTED, "file reads need POSIX I/O");
+#endif
+}
+
+#ifdef ZERO_HAS_IO_URING
+
+/// Submission and completion rings of one io_uring instance, mapped.
+struct Uring {
+    int fd = -1;
+    void* sq_ptr = nullptr;
+    void* cq_ptr = nullptr;
+    size_t sq_len = 0, cq_len = 0, sqes_len = 0;
+    io_uring_sqe* sqes = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+
+    Status setup(unsigned entries) noexcept {
+        io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+        int r = static_cast<int>(syscall(__NR_io_uring_setup, entries, &p));
+        if (r < 0) return Status::error(StatusCode::NOT_IMPLEMENTED, "io_uring unavailable");
+        fd = r;
+        // IORING_OP_READ arrived with RW_CUR_POS (5.6); older kernels use the fallback
+        if ((p.features & IORING_FEAT_RW_CUR_POS) == 0) {
+            teardown();
+            return Status::error(StatusCode::NOT_IMPLEMENTED, "io_uring too old for OP_READ");
+        }
+        sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_len = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single) sq_len = cq_len = sq_len > cq_len ? sq_len : cq_len;
+        sq_ptr = mmap(nullptr, sq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (sq_ptr == MAP_FAILED) {
+            sq_ptr = nullptr;
+            teardown();
+            return status::allocation_failed("cannot map io_uring");
+        }
+        if (single) {
+            cq_ptr = sq_ptr;
+        } else {
+            cq_ptr = mmap(nullptr, cq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (cq_ptr == MAP_FAILED) {
+                cq_ptr = nullptr;
+                teardown();
+                return status::allocation_failed("cannot map io_uring");
+            }
+        }
+        sqes_len = p.sq_entries * sizeof(io_uring_sqe);
+        void* s = mmap(nullptr, sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (s == MAP_FAILED) {
+            teardown();
+            return status::allocation_failed("cannot map io_uring");
+        }
+        sqes = static_cast<io_uring_sqe*>(s);
+        char* sq = static_cast<char*>(sq_ptr);
+        char* cq = static_cast<char*>(cq_ptr);
+        sq_head = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+        sq_tail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+        sq_mask = reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+        sq_array = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+        cq_head = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+        cq_mask = reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+        return status::OK;
+    }
+
+    void teardown() noexcept {
+        if (sqes != nullptr) munmap(sqes, sqes_len);
+        if (cq_ptr != nullptr && cq_ptr != sq_ptr) munmap(cq_ptr, cq_len);
+        if (sq_ptr != nullptr) munmap(sq_ptr, sq_len);
+        if (fd >= 0) ::close(fd);
+        *this = Uring{};
+    }
+
+    /// Queue one read; visible to the kernel at the next enter().
+    void prep(const Piece& p, char* bounce, uint64_t user_data) noexcept {
+        unsigned tail = *sq_tail;   // single producer
+        unsigned idx = tail & *sq_mask;
+        io_uring_sqe* sqe = &sqes[idx];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = p.buf_index >= 0 ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        sqe->fd = p.fd;
+        sqe->off = static_cast<uint64_t>(p.offset);
+        sqe->addr = reinterpret_cast<uint64_t>(p.bounce ? bounce : p.dst);
+        sqe->len = static_cast<uint32_t>(p.bounce ? DIRECT_IO_ALIGN : p.bytes);
+        if (p.buf_index >= 0) sqe->buf_index = static_cast<uint16_t>(p.buf_index);
+        sqe->user_data = user_data;
+        sq_array[idx] = idx;
+        std::atomic_ref<unsigned>(*sq_tail).store(tail + 1, std::memory_order_release);
+    }
+
+    /// Withdraw entries the kernel has not consumed yet; fn(user_data) for each.
+    template <typename Fn>
+    void retract(Fn&& fn) noexcept {
+        unsigned head = std::atomic_ref<unsigned>(*sq_head).load(std::memory_order_acquire);
+        unsigned tail = *sq_tail;
+        for (unsigned i = head; i != tail; ++i) fn(sqes[sq_array[i & *sq_mask]].user_data);
+        std::atomic_ref<unsigned>(*sq_tail).store(head, std::memory_order_release);
+    }
+
+    /// Submit `submit` queued entries and wait for at least `wait` completions.
+    int enter(unsigned submit, unsigned wait) noexcept {
+        int r = static_cast<int>(syscall(__NR_io_uring_enter, fd, submit, wait,
+                                         wait > 0 ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0));
+        return r < 0 ? -errno : r;
+    }
+
+    int reg(unsigned opcode, const void* arg, unsigned n) noexcept {
+        int r = static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, n));
+        return r < 0 ? -errno : r;
+    }
+};
+
+#endif // ZERO_HAS_IO_URING
+
+} // namespace detail
+
+/**
+ * @brief Caller-owned batch for AsyncReader::submit
+ *
+ * Set reqs and n, submit, then wait on (or hook) `done`. The batch, the
+ * request list and the destinations must stay valid until `done`
+ * completes; `stats` is final by then.
+ */
+struct ReadBatch {
+    const ReadRequest* reqs = nullptr;
+    int32_t n = 0;
+    ReadStats stats;
+    exec::Completion done;
+
+private:
+    friend struct AsyncReader;
+    ReadBatch* next_ = nullptr;
+    detail::PieceCursor cur_;
+    Status first_;
+    int32_t in_flight_ = 0;
+};
+
+/**
+ * @brief Batched asynchronous reader with an io_uring or thread-pool backend
+ *
+ * read() blocks until every request of the batch has landed (or one
+ * failed and the rest in flight have drained), so destinations are
+ * never written after it returns. That holds when io_uring_enter itself
+ * fails too: unsubmitted entries are withdrawn and submitted ones are
+ * reaped before the error is returned. A submitted batch keeps the same
+ * guarantee for its `done`. Reads and driver runs are serialized.
+ */
+struct AsyncReader {
+    AsyncReader() noexcept = default;
+    AsyncReader(const AsyncReader&) = delete;
+    AsyncReader& operator=(const AsyncReader&) = delete;
+    ~AsyncReader() { close(); }
+
+    Status init(const ReaderOptions& opt = {}) noexcept {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (ready_) return status::invalid_state("reader already initialized");
+        if (opt.queue_depth < 1 || opt.queue_depth > READER_MAX_DEPTH)
+            return status::invalid_argument("queue depth out of range");
+        if (opt.chunk_bytes < 1 || opt.chunk_bytes > READER_MAX_CHUNK)
+            return status::invalid_argument("chunk size out of range");
+        if (opt.threads < 1 || opt.threads > exec::POOL_MAX_THREADS)
+            return status::invalid_argument("thread count out of range");
+        chunk_ = (opt.chunk_bytes + DIRECT_IO_ALIGN - 1) / DIRECT_IO_ALIGN * DIRECT_IO_ALIGN;
+        depth_ = opt.queue_depth;
+
+        if (opt.backend != ReadBackend::THREADS) {
+            Status s = start_uring();
+            if (s.is_ok()) {
+                backend_ = ReadBackend::IO_URING;
+                ready_ = true;
+                accept();
+                return status::OK;
+            }
+            if (opt.backend == ReadBackend::IO_URING) return s;
+        }
+        if (Status s = pool_.start(opt.threads); s.is_error()) return s;
+        backend_ = ReadBackend::THREADS;
+        ready_ = true;
+        accept();
+        return status::OK;
+    }
+
+    /// Runs every batch already submitted, then releases the reader
+    void close() noexcept {
+        std::thread driver;
+        {
+            std::lock_guard<std::mutex> g(inbox_mu_);
+            accepting_ = false;
+            driver = std::move(driver_);
+        }
+        inbox_cv_.notify_all();
+        if (driver.joinable()) driver.join();
+        std::lock_guard<std::mutex> lock(mu_);
+        drop_buffers();
+#ifdef ZERO_HAS_IO_URING
+        ring_.teardown();
+#endif
+        if (slots_ != nullptr) mem_free(slots_, Device::CPU);
+        if (bounce_ != nullptr) mem_free(bounce_, Device::CPU);
+        slots_ = nullptr;
+        bounce_ = nullptr;
+        pool_.stop();
+        ready_ = false;
+    }
+
+    bool ready() const noexcept { return ready_; }
+
+    /// IO_URING or THREADS once initialized
+    ReadBackend backend() const noexcept { return backend_; }
+
+    /**
+     * @brief Pin destination buffers so reads into them use READ_FIXED
+     *
+     * Replaces any previous set. The thread backend accepts and ignores
+     * them. Fails with ALLOCATION_FAILED when the pages cannot be locked
+     * (RLIMIT_MEMLOCK); unregistered reads still work.
+     */
+    Status register_buffers(void* const* bufs, const int64_t* sizes, int32_t n) noexcept {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (!ready_) return status::invalid_state("reader not initialized");
+        if (n < 1 || n > READER_MAX_BUFFERS) return status::invalid_argument("buffer count out of range");
+        for (int32_t i = 0; i < n; ++i)
+            if (bufs[i] == nullptr || sizes[i] < 1 || sizes[i] > READER_MAX_CHUNK)
+                return status::invalid_argument("bad registered buffer");
+        drop_buffers();
+        if (backend_ != ReadBackend::IO_URING) return status::OK;
+#ifdef ZERO_HAS_IO_URING
+        auto* iov = static_cast<iovec*>(mem_alloc(sizeof(iovec) * static_cast<size_t>(n), alignof(iovec), Device::CPU));
+        if (iov == nullptr) return status::allocation_failed("cannot allocate buffer table");
+        for (int32_t i = 0; i < n; ++i) {
+            iov[i].iov_base = bufs[i];
+            iov[i].iov_len = static_cast<size_t>(sizes[i]);
+        }
+        if (ring_.reg(IORING_REGISTER_BUFFERS, iov, static_cast<unsigned>(n)) < 0) {
+            mem_free(iov, Device::CPU);
+            return status::allocation_failed("cannot register buffers");
+        }
+        fixed_ = iov;
+        fixed_n_ = n;
+#endif
+        return status::OK;
+    }
+
+    void unregister_buffers() noexcept {
+        std::lock_guard<std::mutex> lock(mu_);
+        drop_buffers();
+    }
+
+    /**
+     * @brief Read every request in full; returns after all reads finish
+     *
+     * OUT_OF_BOUNDS if a request runs past the end of its file,
+     * INVALID_ARGUMENT for a bad request or a misaligned O_DIRECT one.
+     */
+    Status read(const ReadRequest* reqs, int32_t n, ReadStats* stats = nullptr) noexcept {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (!ready_) return status::invalid_state("reader not initialized");
+        ReadBatch b;
+        b.reqs = reqs;
+        b.n = n;
+        if (Status s = prepare(b); s.is_error()) return s;
+        run(&b, false);
+        if (stats != nullptr) *stats = b.stats;
+        return b.done.result;
+    }
+
+    /**
+     * @brief Queue a batch and return; `batch->done` completes once it has landed
+     *
+     * Validates like read(); on error nothing is queued and `done` is not
+     * touched. The first submit starts the reader's driver thread, which
+     * runs completion hooks: they must not block or call back into the
+     * reader. INVALID_STATE if that thread cannot be started.
+     */
+    Status submit(ReadBatch* batch) noexcept {
+        if (batch == nullptr) return status::invalid_argument("null read batch");
+        std::lock_guard<std::mutex> g(inbox_mu_);
+        if (!accepting_) return status::invalid_state("reader not initialized");
+        if (Status s = prepare(*batch); s.is_error()) return s;
+        if (!driver_.joinable()) {
+            try {
+                driver_ = std::thread([this] { drive(); });
+            } catch (const std::system_error&) {
+                return status::invalid_state("cannot start reader driver thread");
+            }
+        }
+        if (inbox_tail_ != nullptr) inbox_tail_->next_ = batch;
+        else inbox_ = batch;
+        inbox_tail_ = batch;
+        inbox_cv_.notify_one();
+        return status::OK;
+    }
+
+private:
+    void accept() noexcept {
+        std::lock_guard<std::mutex> g(inbox_mu_);
+        accepting_ = true;
+    }
+
+    // Validate the requests and reset the batch's progress.
+    Status prepare(ReadBatch& b) noexcept {
+        if (b.n < 0 || (b.n > 0 && b.reqs == nullptr)) return status::invalid_argument("bad request list");
+        ReadStats st;
+        for (int32_t i = 0; i < b.n; ++i) {
+            const ReadRequest& r = b.reqs[i];
+            if (r.fd < 0 || r.offset < 0 || r.bytes < 0 || (r.bytes > 0 && r.dst == nullptr))
+                return status::invalid_argument("bad read request");
+            if (r.bytes > 0 && detail::fd_is_direct(r.fd) &&
+                (r.offset % DIRECT_IO_ALIGN != 0 || reinterpret_cast<uintptr_t>(r.dst) % DIRECT_IO_ALIGN != 0))
+                return status::invalid_argument("O_DIRECT read not aligned");
+            st.bytes += r.bytes;
+        }
+        b.stats = st;
+        b.done.reset();
+        b.next_ = nullptr;
+        b.cur_ = detail::PieceCursor{};
+        b.cur_.reqs = b.reqs;
+        b.cur_.n = b.n;
+        b.cur_.chunk = chunk_;
+        b.first_ = status::OK;
+        b.in_flight_ = 0;
+        return status::OK;
+    }
+
+    // Detach everything submitted so far, oldest first.
+    ReadBatch* take_inbox() noexcept {
+        std::lock_guard<std::mutex> g(inbox_mu_);
+        ReadBatch* list = inbox_;
+        inbox_ = inbox_tail_ = nullptr;
+        return list;
+    }
+
+    void drive() noexcept {
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> g(inbox_mu_);
+                inbox_cv_.wait(g, [this] { return inbox_ != nullptr || !accepting_; });
+                if (inbox_ == nullptr) return;
+            }
+            std::lock_guard<std::mutex> lock(mu_);
+            run(take_inbox(), true);
+        }
+    }
+
+    // The batch must not be touched once done has completed.
+    static void finish(ReadBatch* b) noexcept { b->done.complete(b->first_); }
+
+    // Run a list of batches to completion; with intake, batches submitted
+    // meanwhile are adopted (io_uring only).
+    void run(ReadBatch* list, bool intake) noexcept {
+        if (backend_ == ReadBackend::IO_URING) {
+            run_uring(list, intake);
+            return;
+        }
+        while (list != nullptr) {
+            ReadBatch* b = list;
+            list = b->next_;
+            b->first_ = run_threads(b->cur_, b->stats);
+            finish(b);
+        }
+    }
+
+    Status start_uring() noexcept {
+#ifdef ZERO_HAS_IO_URING
+        if (Status s = ring_.setup(static_cast<unsigned>(depth_)); s.is_error()) return s;
+        slots_ = static_cast<detail::Piece*>(
+            mem_alloc(sizeof(detail::Piece) * static_cast<size_t>(depth_), alignof(detail::Piece), Device::CPU));
+        bounce_ = static_cast<char*>(mem_alloc(static_cast<size_t>(depth_ * DIRECT_IO_ALIGN), DIRECT_IO_ALIGN, Device::CPU));
+        if (slots_ == nullptr || bounce_ == nullptr) {
+            if (slots_ != nullptr) mem_free(slots_, Device::CPU);
+            if (bounce_ != nullptr) mem_free(bounce_, Device::CPU);
+            slots_ = nullptr;
+            bounce_ = nullptr;
+            ring_.teardown();
+            return status::allocation_failed("cannot allocate reader slots");
+        }
+        return status::OK;
+#else
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "io_uring unavailable");
+#endif
+    }
+
+    void drop_buffers() noexcept {
+#ifdef ZERO_HAS_IO_URING
+        if (fixed_ == nullptr) return;
+        (void)ring_.reg(IORING_UNREGISTER_BUFFERS, nullptr, 0);
+        mem_free(fixed_, Device::CPU);
+        fixed_ = nullptr;
+        fixed_n_ = 0;
+#endif
+    }
+
+    int32_t fixed_index(const detail::Piece& p) const noexcept {
+#ifdef ZERO_HAS_IO_URING
+        if (p.bounce) return -1;
+        for (int32_t i = 0; i < fixed_n_; ++i) {
+            const char* b = static_cast<const char*>(fixed_[i].iov_base);
+            if (p.dst >= b && p.dst + p.bytes <= b + fixed_[i].iov_len) return i;
+        }
+#else
+        (void)p;
+#endif
+        return -1;
+    }
+
+    Status run_threads(detail::PieceCursor& cur, ReadStats& st) noexcept {
+        std::mutex mu;
+        Status first = status::OK;
+        int32_t workers = pool_.size();
+        int32_t active = 0;
+        Status ps = pool_.parallel_for(workers, [&](int64_t) {
+            alignas(DIRECT_IO_ALIGN) char bounce[DIRECT_IO_ALIGN];
+            int64_t short_reads = 0, reads = 0;
+            for (;;) {
+                detail::Piece p;
+                {
+                    std::lock_guard<std::mutex> g(mu);
+                    if (first.is_error() || !cur.next(p)) break;
+                    ++active;
+                    if (active > st.max_in_flight) st.max_in_flight = active;
+                }
+                Status s = detail::read_piece(p, bounce, short_reads);
+                ++reads;
+                std::lock_guard<std::mutex> g(mu);
+                --active;
+                if (s.is_error() && first.is_ok()) first = s;
+            }
+            std::lock_guard<std::mutex> g(mu);
+            st.reads += reads + short_reads;
+            st.short_reads += short_reads;
+        });
+        return ps.is_error() ? ps : first;
+    }
+
+    // Batches share the slots, oldest first; each completes as soon as its
+    // last piece lands (or it failed and its pieces in flight drained).
+    void run_uring(ReadBatch* list, bool intake) noexcept {
+#ifdef ZERO_HAS_IO_URING
+        // Free slot stack: slots [0, free_n) of `order` are idle.
+        int32_t order[READER_MAX_DEPTH];
+        for (int32_t i = 0; i < depth_; ++i) order[i] = depth_ - 1 - i;
+        int32_t free_n = depth_, in_flight = 0;
+        unsigned to_submit = 0;
+
+        auto queue = [&](int32_t slot) {
+            detail::Piece& p = slots_[slot];
+            ring_.prep(p, bounce_ + slot * DIRECT_IO_ALIGN, static_cast<uint64_t>(slot));
+            if (p.buf_index >= 0) ++p.batch->stats.fixed_reads;
+            ++p.batch->stats.reads;
+            ++to_submit;
+        };
+        auto release = [&](int32_t slot) {
+            order[free_n++] = slot;
+            --in_flight;
+            --slots_[slot].batch->in_flight_;
+        };
+        auto fail = [](ReadBatch* b, Status s) {
+            if (b->first_.is_ok()) b->first_ = s;
+        };
+
+        for (;;) {
+            if (intake) {
+                ReadBatch** end = &list;
+                while (*end != nullptr) end = &(*end)->next_;
+                *end = take_inbox();
+            }
+            detail::Piece p;
+            for (ReadBatch* b = list; b != nullptr && free_n > 0; b = b->next_) {
+                while (b->first_.is_ok() && free_n > 0 && b->cur_.next(p)) {
+                    int32_t slot = order[--free_n];
+                    p.buf_index = fixed_index(p);
+                    p.batch = b;
+                    slots_[slot] = p;
+                    ++in_flight;
+                    if (++b->in_flight_ > b->stats.max_in_flight) b->stats.max_in_flight = b->in_flight_;
+                    queue(slot);
+                }
+            }
+            for (ReadBatch** link = &list; *link != nullptr;) {
+                ReadBatch* b = *link;
+                if (b->in_flight_ == 0 && (b->first_.is_error() || b->cur_.i >= b->cur_.n)) {
+                    *link = b->next_;
+                    finish(b);
+                } else {
+                    link = &b->next_;
+                }
+            }
+            if (in_flight == 0) break;   // every batch has finished
+
+            int r = ring_.enter(to_submit, 1);
+            if (r == -EINTR || r == -EAGAIN || r == -EBUSY) continue;
+            unsigned head = *ring_.cq_head;   // single consumer
+            unsigned tail = std::atomic_ref<unsigned>(*ring_.cq_tail).load(std::memory_order_acquire);
+            if (r < 0) {
+                // Stop issuing and withdraw what the kernel never saw. Reads it
+                // already took still write their destinations, so keep reaping
+                // (polling the CQ if enter keeps failing) until they land.
+                for (ReadBatch* b = list; b != nullptr; b = b->next_)
+                    fail(b, status::invalid_state("io_uring_enter failed"));
+                ring_.retract([&](uint64_t slot) noexcept { release(static_cast<int32_t>(slot)); });
+                to_submit = 0;
+                if (head == tail && in_flight > 0) std::this_thread::sleep_for(std::chrono::microseconds(100));
+            } else {
+                to_submit -= static_cast<unsigned>(r) < to_submit ? static_cast<unsigned>(r) : to_submit;
+            }
+
+            for (; head != tail; ++head) {
+                const io_uring_cqe& cqe = ring_.cqes[head & *ring_.cq_mask];
+                int32_t slot = static_cast<int32_t>(cqe.user_data);
+                int res = cqe.res;
+                detail::Piece& q = slots_[slot];
+                ReadBatch* b = q.batch;
+                bool done = true;
+                if (res == -EINTR || res == -EAGAIN) {
+                    done = false;
+                } else if (res < 0) {
+                    fail(b, status::invalid_state("file read failed"));
+                } else if (q.bounce) {
+                    if (res < q.bytes) {
+                        fail(b, status::out_of_bounds("read past end of file"));
+                    } else {
+                        std::memcpy(q.dst, bounce_ + slot * DIRECT_IO_ALIGN, static_cast<size_t>(q.bytes));
+                    }
+                } else if (res == 0) {
+                    fail(b, status::out_of_bounds("read past end of file"));
+                } else if (res < q.bytes) {
+                    q.offset += res;
+                    q.dst += res;
+                    q.bytes -= res;
+                    ++b->stats.short_reads;
+                    done = false;
+                }
+                if (!done && b->first_.is_ok()) queue(slot);
+                else release(slot);
+            }
+            std::atomic_ref<unsigned>(*ring_.cq_head).store(head, std::memory_order_release);
+        }
+#else
+        (void)intake;
+        while (list != nullptr) {
+            ReadBatch* b = list;
+            list = b->next_;
+            b->first_ = Status::error(StatusCode::NOT_IMPLEMENTED, "io_uring unavailable");
+            finish(b);
+        }
+#endif
+    }
+
+    std::mutex mu_;   // read(), driver runs, init/close/register
+    bool ready_ = false;
+    ReadBackend backend_ = ReadBackend::AUTO;
+    int32_t depth_ = 0;
+    int64_t chunk_ = READER_DEFAULT_CHUNK;
+    exec::ThreadPool pool_;
+    detail::Piece* slots_ = nullptr;
+    char* bounce_ = nullptr;
+#ifdef ZERO_HAS_IO_URING
+    detail::Uring ring_;
+    iovec* fixed_ = nullptr;
+    int32_t fixed_n_ = 0;
+#endif
+    std::mutex inbox_mu_;   // submitted batches and the driver thread
+    std::condition_variable inbox_cv_;
+    bool accepting_ = false;
+    ReadBatch* inbox_ = nullptr;
+    ReadBatch* inbox_tail_ = nullptr;
+    std::thread driver_;
+};
+
+} // namespace io
+} // namespace zero
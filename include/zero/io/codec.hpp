@@ -0,0 +1,520 @@
+#pragma once
+
+/**
+ * @file codec.hpp
+ * @brief Zero Core Runtime — Compressed Tensor Container
+ *
+ * Dependency-free lossless compression for checkpoints. The tensor's
+ * bytes are cut into fixed-size chunks; each chunk is byte-shuffled
+ * (all first bytes of its elements, then all second bytes, ...) and
+ * LZ-compressed on its own, so chunks compress and decompress in
+ * parallel and a damaged chunk stays local:
+ *
+ *   [CodecHeader][int64 end offset per chunk][chunk 0][chunk 1]...
+ *
+ * Shuffling turns the sign/exponent bytes of float data into long
+ * near-constant planes that the LZ stage collapses (a run is a match at
+ * offset 1). A chunk that does not shrink is stored as-is, unshuffled,
+ * so incompressible data costs only the chunk table.
+ *
+ * LZ format (per chunk): sequences of
+ *
+ *   token (literals:4 | match-4:4) [literal length ext] literals
+ *   offset:16 LE [match length ext]
+ *
+ * where a nibble of 15 continues in 255-saturated bytes. The last
+ * sequence ends after its literals. Offsets reach back 64 KiB.
+ * The container is host-endian.
+ */
+
+#include "../core/memory.hpp"
+#include "../core/status.hpp"
+#include "../core/tensor.hpp"
+#include "../exec/thread_pool.hpp"
+#include "../kernels/kernels.hpp"
+#include "file_tensor.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+namespace zero {
+namespace io {
+
+constexpr uint32_t CODEC_MAGIC = 0x3143545Au;   // "ZTC1"
+constexpr uint8_t CODEC_VERSION = 1;
+constexpr uint8_t CODEC_SHUFFLED = 1;
+constexpr int64_t CODEC_DEFAULT_CHUNK = int64_t{1} << 20;
+constexpr int64_t CODEC_MAX_CHUNK = int64_t{1} << 30;
+
+constexpr int32_t LZ_HASH_BITS = 14;
+constexpr int64_t LZ_MIN_MATCH = 4;
+constexpr int64_t LZ_MAX_OFFSET = 65535;
+
+struct CodecHeader {
+    uint32_t magic = CODEC_MAGIC;
+    uint8_t version = CODEC_VERSION;
+    uint8_t dtype = 0;
+    int8_t ndim = 0;
+    uint8_t flags = 0;
+    int64_t shape[MAX_DIMS] = {};
+    int64_t raw_bytes = 0;
+    int64_t chunk_bytes = 0;
+    int64_t chunks = 0;
+};
+
+struct CodecOptions {
+    int64_t chunk_bytes = CODEC_DEFAULT_CHUNK;   ///< Rounded down to a whole number of elements
+    bool shuffle = true;
+    exec::ThreadPool* pool = nullptr;            ///< Chunks run in parallel on it
+};
+
+struct CodecStats {
+    int64_t raw_bytes = 0;
+    int64_t stored_bytes = 0;    ///< Whole container, header included
+    int64_t chunks = 0;
+    int64_t stored_raw = 0;      ///< Chunks that did not shrink
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// LZ stage
+// ─────────────────────────────────────────────────────────────────────
+
+namespace detail {
+
+inline uint32_t load_u32(const uint8_t* p) noexcept {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+/// Length of the common prefix of a and b, at most `limit` bytes.
+inline int64_t common_prefix(const uint8_t* a, const uint8_t* b, int64_t limit) noexcept {
+    int64_t n = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        while (n + 8 <= limit) {
+            uint64_t x, y;
+            std::memcpy(&x, a + n, 8);
+            std::memcpy(&y, b + n, 8);
+            if (x != y) return n + std::countr_zero(x ^ y) / 8;
+            n += 8;
+        }
+    }
+    while (n < limit && a[n] == b[n]) ++n;
+    return n;
+}
+
+inline uint8_t* put_length(uint8_t* op, int64_t len) noexcept {
+    for (; len >= 255; len -= 255) *op++ = 255;
+    *op++ = static_cast<uint8_t>(len);
+    return op;
+}
+
+inline bool get_length(const uint8_t*& ip, const uint8_t* iend, int64_t& len) noexcept {
+    uint8_t b;
+    do {
+        if (ip >= iend) return false;
+        b = *ip++;
+        len += b;
+    } while (b == 255);
+    return true;
+}
+
+} // namespace detail
+
+/// Worst-case LZ output for n input bytes
+constexpr int64_t lz_bound(int64_t n) noexcept { return n + n / 255 + 16; }
+
+/**
+ * @brief Compress n bytes; returns the output size, or -1 if cap is too small
+ *
+ * Greedy single-probe hash matching. After 64 misses in a row the scan
+ * skips ahead faster, so incompressible input costs little.
+ */
+inline int64_t lz_compress(const uint8_t* src, int64_t n, uint8_t* dst, int64_t cap) noexcept {
+    uint32_t table[1 << LZ_HASH_BITS] = {};
+    uint8_t* op = dst;
+    uint8_t* const oend = dst + cap;
+    int64_t anchor = 0;
+
+    auto emit = [&](int64_t lit_end, int64_t offset, int64_t match) -> bool {
+        int64_t lit = lit_end - anchor;
+        int64_t need = 1 + lit + lit / 255 + 1 + (match > 0 ? 2 + match / 255 + 1 : 0);
+        if (need > oend - op) return false;
+        int64_t ml = match > 0 ? match - LZ_MIN_MATCH : 0;
+        *op++ = static_cast<uint8_t>((lit < 15 ? lit : 15) << 4 | (ml < 15 ? ml : 15));
+        if (lit >= 15) op = detail::put_length(op, lit - 15);
+        std::memcpy(op, src + anchor, static_cast<size_t>(lit));
+        op += lit;
+        if (match > 0) {
+            *op++ = static_cast<uint8_t>(offset);
+            *op++ = static_cast<uint8_t>(offset >> 8);
+            if (ml >= 15) op = detail::put_length(op, ml - 15);
+        }
+        return true;
+    };
+
+    int64_t i = 0, misses = 0;
+    while (i + LZ_MIN_MATCH <= n) {
+        uint32_t v = detail::load_u32(src + i);
+        uint32_t h = (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+        int64_t cand = table[h];
+        table[h] = static_cast<uint32_t>(i);
+        if (cand < i && i - cand <= LZ_MAX_OFFSET && detail::load_u32(src + cand) == v) {
+            int64_t len = LZ_MIN_MATCH + detail::common_prefix(src + cand + LZ_MIN_MATCH, src + i + LZ_MIN_MATCH,
+                                                               n - i - LZ_MIN_MATCH);
+            if (!emit(i, i - cand, len)) return -1;
+            i += len;
+            anchor = i;
+            misses = 0;
+            continue;
+        }
+        ++misses;
+        i += 1 + (misses >> 6);
+    }
+    if (!emit(n, 0, 0)) return -1;
+    return op - dst;
+}
+
+/**
+ * @brief Decompress into exactly `raw` bytes; false on malformed input
+ *
+ * Every length and offset is bounds-checked against both buffers.
+ */
+inline bool lz_decompress(const uint8_t* src, int64_t n, uint8_t* dst, int64_t raw) noexcept {
+    const uint8_t* ip = src;
+    const uint8_t* const iend = src + n;
+    uint8_t* op = dst;
+    uint8_t* const oend = dst + raw;
+    for (;;) {
+        if (ip >= iend) return false;
+        uint8_t token = *ip++;
+        int64_t lit = token >> 4;
+        if (lit == 15 && !detail::get_length(ip, iend, lit)) return false;
+        if (lit > iend - ip || lit > oend - op) return false;
+        if (lit <= 16 && iend - ip >= 16 && oend - op >= 16)
+            std::memcpy(op, ip, 16);   // fixed-size copy; the excess is overwritten next
+        else
+            std::memcpy(op, ip, static_cast<size_t>(lit));
+        ip += lit;
+        op += lit;
+        if (ip == iend) return op == oend;
+
+        if (iend - ip < 2) return false;
+        int64_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op - dst) return false;
+        int64_t len = token & 15;
+        if (len == 15 && !detail::get_length(ip, iend, len)) return false;
+        len += LZ_MIN_MATCH;
+        if (len > oend - op) return false;
+
+        const uint8_t* match = op - offset;
+        if (len <= 16 && offset >= 16 && oend - op >= 16) {
+            std::memcpy(op, match, 16);
+        } else if (offset >= len) {
+            std::memcpy(op, match, static_cast<size_t>(len));
+        } else if (offset == 1) {
+            std::memset(op, *match, static_cast<size_t>(len));
+        } else {
+            // Period-`offset` pattern: each copy reads only bytes already
+            // written and at most doubles the written span.
+            int64_t done = 0;
+            while (done < len) {
+                int64_t c = done + offset < len - done ? done + offset : len - done;
+                std::memcpy(op + done, match, static_cast<size_t>(c));
+                done += c;
+            }
+        }
+        op += len;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// Container
+// ─────────────────────────────────────────────────────────────────────
+
+namespace detail {
+
+inline int64_t codec_chunk(int64_t chunk_bytes, int64_t width) noexcept {
+    int64_t c = chunk_bytes / width * width;
+    return c > 0 ? c : width;
+}
+
+template <typename Fn>
+inline void for_chunks(exec::ThreadPool* pool, int64_t n, Fn&& fn) noexcept {
+    if (pool != nullptr) {
+        (void)pool->parallel_for(n, fn);
+        return;
+    }
+    for (int64_t i = 0; i < n; ++i) fn(i);
+}
+
+inline int64_t codec_wave(exec::ThreadPool* pool) noexcept {
+    return pool != nullptr && pool->size() > 1 ? 2 * static_cast<int64_t>(pool->size()) : 1;
+}
+
+} // namespace detail
+
+/**
+ * @brief Upper bound on the container size of `t` (chunks never grow)
+ */
+inline int64_t compressed_bound(const Tensor& t, const CodecOptions& opt = {}) noexcept {
+    int64_t width = static_cast<int64_t>(dtype_size(t.dtype));
+    int64_t raw = static_cast<int64_t>(t.nbytes());
+    int64_t chunk = detail::codec_chunk(opt.chunk_bytes, width);
+    int64_t chunks = (raw + chunk - 1) / chunk;
+    return static_cast<int64_t>(sizeof(CodecHeader)) + chunks * 8 + raw;
+}
+
+/**
+ * @brief Compress a contiguous CPU tensor into dst
+ *
+ * Chunks are processed in waves of twice the pool size; each wave's
+ * results are appended in chunk order, so the output does not depend on
+ * the pool. OUT_OF_BOUNDS if dst is smaller than needed.
+ */
+inline Status compress(const Tensor& t, void* dst, int64_t capacity, int64_t& written,
+                       const CodecOptions& opt = {}, CodecStats* stats = nullptr) noexcept {
+    if (t.device != Device::CPU || !t.is_contiguous() || (t.data == nullptr && t.numel() > 0))
+        return status::invalid_argument("codec needs a contiguous CPU tensor");
+    if (opt.chunk_bytes < 1 || opt.chunk_bytes > CODEC_MAX_CHUNK)
+        return status::invalid_argument("chunk size out of range");
+    int64_t width = static_cast<int64_t>(dtype_size(t.dtype));
+    CodecHeader h;
+    h.dtype = static_cast<uint8_t>(t.dtype);
+    h.ndim = t.ndim;
+    for (int8_t i = 0; i < t.ndim; ++i) h.shape[i] = t.shape[i];
+    h.raw_bytes = static_cast<int64_t>(t.nbytes());
+    h.chunk_bytes = detail::codec_chunk(opt.chunk_bytes, width);
+    h.chunks = (h.raw_bytes + h.chunk_bytes - 1) / h.chunk_bytes;
+    bool shuffle = opt.shuffle && width > 1;
+    if (shuffle) h.flags |= CODEC_SHUFFLED;
+
+    int64_t table_bytes = h.chunks * 8;
+    int64_t pos = static_cast<int64_t>(sizeof(CodecHeader)) + table_bytes;
+    if (capacity < pos) return status::out_of_bounds("output buffer too small");
+    auto* out = static_cast<uint8_t*>(dst);
+    std::memcpy(out, &h, sizeof(h));
+    auto* ends = out + sizeof(CodecHeader);
+
+    int64_t wave = detail::codec_wave(opt.pool);
+    if (wave > h.chunks) wave = h.chunks;
+    int64_t slot = (h.chunk_bytes + lz_bound(h.chunk_bytes) + 63) / 64 * 64;
+    auto* scratch = static_cast<uint8_t*>(mem_alloc(static_cast<size_t>(wave * slot + wave * 8 + 1), 64, Device::CPU));
+    if (scratch == nullptr) return status::allocation_failed("cannot allocate codec scratch");
+    auto* sizes = reinterpret_cast<int64_t*>(scratch + wave * slot);
+
+    const auto* raw = static_cast<const uint8_t*>(t.data);
+    CodecStats st;
+    st.raw_bytes = h.raw_bytes;
+    st.chunks = h.chunks;
+    Status result = status::OK;
+    for (int64_t w0 = 0; w0 < h.chunks && result.is_ok(); w0 += wave) {
+        int64_t cnt = h.chunks - w0 < wave ? h.chunks - w0 : wave;
+        detail::for_chunks(opt.pool, cnt, [&](int64_t i) {
+            int64_t c = w0 + i;
+            int64_t len = h.raw_bytes - c * h.chunk_bytes < h.chunk_bytes ? h.raw_bytes - c * h.chunk_bytes : h.chunk_bytes;
+            const uint8_t* src = raw + c * h.chunk_bytes;
+            uint8_t* sh = scratch + i * slot;
+            uint8_t* lz = sh + h.chunk_bytes;
+            if (shuffle) {
+                kernels::shuffle_bytes(src, sh, len / width, width);
+                src = sh;
+            }
+            int64_t r = lz_compress(src, len, lz, lz_bound(len));
+            sizes[i] = r < 0 || r >= len ? -len : r;   // negative: store raw
+        });
+        for (int64_t i = 0; i < cnt; ++i) {
+            int64_t c = w0 + i;
+            bool stored_raw = sizes[i] < 0;
+            int64_t n = stored_raw ? -sizes[i] : sizes[i];
+            if (capacity - pos < n) {
+                result = status::out_of_bounds("output buffer too small");
+                break;
+            }
+            const uint8_t* from = stored_raw ? raw + c * h.chunk_bytes : scratch + i * slot + h.chunk_bytes;
+            std::memcpy(out + pos, from, static_cast<size_t>(n));
+            pos += n;
+            int64_t end = pos - static_cast<int64_t>(sizeof(CodecHeader)) - table_bytes;
+            std::memcpy(ends + c * 8, &end, 8);
+            if (stored_raw) ++st.stored_raw;
+        }
+    }
+    mem_free(scratch, Device::CPU);
+    if (result.is_error()) return result;
+    written = pos;
+    st.stored_bytes = pos;
+    if (stats != nullptr) *stats = st;
+    return status::OK;
+}
+
+/**
+ * @brief Validate a container's header and chunk table; fills `out`
+ */
+inline Status read_header(const void* src, int64_t size, CodecHeader& out) noexcept {
+    if (src == nullptr || size < static_cast<int64_t>(sizeof(CodecHeader)))
+        return status::invalid_argument("truncated compressed tensor");
+    CodecHeader h;
+    std::memcpy(&h, src, sizeof(h));
+    if (h.magic != CODEC_MAGIC || h.version != CODEC_VERSION) return status::invalid_argument("not a compressed tensor");
+    if (h.ndim < 0 || h.ndim > MAX_DIMS || dtype_size(static_cast<DType>(h.dtype)) == 0)
+        return status::invalid_argument("corrupt compressed tensor header");
+    int64_t numel = 1;
+    for (int8_t i = 0; i < h.ndim; ++i) {
+        if (h.shape[i] < 0) return status::invalid_argument("corrupt compressed tensor header");
+        numel *= h.shape[i];
+    }
+    int64_t width = static_cast<int64_t>(dtype_size(static_cast<DType>(h.dtype)));
+    if (h.raw_bytes != numel * width || h.chunk_bytes < 1 || h.chunk_bytes % width != 0 ||
+        h.chunks != (h.raw_bytes + h.chunk_bytes - 1) / h.chunk_bytes)
+        return status::invalid_argument("corrupt compressed tensor header");
+    int64_t payload = size - static_cast<int64_t>(sizeof(CodecHeader)) - h.chunks * 8;
+    if (payload < 0) return status::invalid_argument("truncated compressed tensor");
+    const auto* ends = static_cast<const uint8_t*>(src) + sizeof(CodecHeader);
+    int64_t prev = 0;
+    for (int64_t c = 0; c < h.chunks; ++c) {
+        int64_t end;
+        std::memcpy(&end, ends + c * 8, 8);
+        int64_t len = h.raw_bytes - c * h.chunk_bytes < h.chunk_bytes ? h.raw_bytes - c * h.chunk_bytes : h.chunk_bytes;
+        if (end <= prev || end - prev > len || end > payload) return status::invalid_argument("corrupt chunk table");
+        prev = end;
+    }
+    out = h;
+    return status::OK;
+}
+
+/**
+ * @brief Decompress into a preallocated contiguous tensor of the stored dtype and shape
+ */
+inline Status decompress(const void* src, int64_t size, Tensor& out, exec::ThreadPool* pool = nullptr) noexcept {
+    CodecHeader h;
+    if (Status s = read_header(src, size, h); s.is_error()) return s;
+    if (out.device != Device::CPU || !out.is_contiguous() || out.dtype != static_cast<DType>(h.dtype) ||
+        out.ndim != h.ndim)
+        return status::type_mismatch("output does not match the stored tensor");
+    for (int8_t i = 0; i < h.ndim; ++i)
+        if (out.shape[i] != h.shape[i]) return status::type_mismatch("output does not match the stored tensor");
+    if (out.data == nullptr && h.raw_bytes > 0) return status::invalid_state("null data pointer");
+
+    int64_t width = static_cast<int64_t>(dtype_size(out.dtype));
+    bool shuffle = (h.flags & CODEC_SHUFFLED) != 0;
+    const auto* ends = static_cast<const uint8_t*>(src) + sizeof(CodecHeader);
+    const auto* payload = ends + h.chunks * 8;
+    auto* dst = static_cast<uint8_t*>(out.data);
+
+    int64_t wave = shuffle ? detail::codec_wave(pool) : h.chunks;
+    if (wave > h.chunks) wave = h.chunks;
+    uint8_t* scratch = nullptr;
+    if (shuffle && wave > 0) {
+        scratch = static_cast<uint8_t*>(mem_alloc(static_cast<size_t>(wave * h.chunk_bytes), 64, Device::CPU));
+        if (scratch == nullptr) return status::allocation_failed("cannot allocate codec scratch");
+    }
+    std::atomic<bool> bad{false};
+    for (int64_t w0 = 0; w0 < h.chunks && !bad.load(std::memory_order_relaxed); w0 += wave) {
+        int64_t cnt = h.chunks - w0 < wave ? h.chunks - w0 : wave;
+        detail::for_chunks(pool, cnt, [&](int64_t i) {
+            int64_t c = w0 + i;
+            int64_t begin = 0, end;
+            if (c > 0) std::memcpy(&begin, ends + (c - 1) * 8, 8);
+            std::memcpy(&end, ends + c * 8, 8);
+            int64_t len = h.raw_bytes - c * h.chunk_bytes < h.chunk_bytes ? h.raw_bytes - c * h.chunk_bytes : h.chunk_bytes;
+            uint8_t* to = dst + c * h.chunk_bytes;
+            if (end - begin == len) {
+                std::memcpy(to, payload + begin, static_cast<size_t>(len));
+                return;
+            }
+            uint8_t* plain = shuffle ? scratch + i * h.chunk_bytes : to;
+            if (!lz_decompress(payload + begin, end - begin, plain, len)) {
+                bad.store(true, std::memory_order_relaxed);
+                return;
+            }
+            if (shuffle) kernels::unshuffle_bytes(plain, to, len / width, width);
+        });
+    }
+    if (scratch != nullptr) mem_free(scratch, Device::CPU);
+    return bad.load() ? status::invalid_argument("corrupt compressed chunk") : status::OK;
+}
+
+/**
+ * @brief Compress `t` into a new file at `path`
+ */
+inline Status save_compressed(const char* path, const Tensor& t, const CodecOptions& opt = {},
+                              CodecStats* stats = nullptr) noexcept {
+#ifdef ZERO_HAS_FILE_IO
+    int64_t cap = compressed_bound(t, opt);
+    auto* buf = static_cast<uint8_t*>(mem_alloc(static_cast<size_t>(cap), 64, Device::CPU));
+    if (buf == nullptr) return status::allocation_failed("cannot allocate compression buffer");
+    int64_t n = 0;
+    Status s = compress(t, buf, cap, n, opt, stats);
+    if (s.is_ok()) {
+        int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            s = status::invalid_argument("cannot create checkpoint file");
+        } else {
+            for (int64_t done = 0; done < n && s.is_ok();) {
+                ssize_t w = ::write(fd, buf + done, static_cast<size_t>(n - done));
+                if (w < 0 && errno == EINTR) continue;
+                if (w <= 0) s = status::invalid_state("checkpoint write failed");
+                else done += w;
+            }
+            ::close(fd);
+        }
+    }
+    mem_free(buf, Device::CPU);
+    return s;
+#else
+    (void)path; (void)t; (void)opt; (void)stats;
+    return Status::error(StatusCode::NOT_IMPLEMENTED, "checkpoints need POSIX I/O");
+#endif
+}
+
+/**
+ * @brief Load a file written by save_compressed into a newly allocated tensor
+ */
+inline Status load_compressed(const char* path, Tensor& out, exec::ThreadPool* pool = nullptr) noexcept {
+#ifdef ZERO_HAS_FILE_IO
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return status::invalid_argument("cannot open checkpoint file");
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return status::invalid_state("cannot stat checkpoint file");
+    }
+    int64_t size = static_cast<int64_t>(st.st_size);
+    auto* buf = static_cast<uint8_t*>(mem_alloc(static_cast<size_t>(size > 0 ? size : 1), 64, Device::CPU));
+    if (buf == nullptr) {
+        ::close(fd);
+        return status::allocation_failed("cannot allocate checkpoint buffer");
+    }
+    Status s = status::OK;
+    for (int64_t done = 0; done < size && s.is_ok();) {
+        ssize_t r = ::pread(fd, buf + done, static_cast<size_t>(size - done), static_cast<off_t>(done));
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) s = status::invalid_state("checkpoint read failed");
+        else done += r;
+    }
+    ::close(fd);
+    CodecHeader h;
+    if (s.is_ok()) s = read_header(buf, size, h);
+    if (s.is_ok()) {
+        Tensor t = Tensor::alloc(h.shape, h.ndim, static_cast<DType>(h.dtype));
+        if (t.data == nullptr && h.raw_bytes > 0) {
+            s = status::allocation_failed("cannot allocate tensor");
+        } else {
+            s = decompress(buf, size, t, pool);
+            if (s.is_ok()) out = t;
+            else t.free();
+        }
+    }
+    mem_free(buf, Device::CPU);
+    return s;
+#else
+    (void)path; (void)out; (void)pool;
+    return Status::error(StatusCode::NOT_IMPLEMENTED, "checkpoints need POSIX I/O");
+#endif
+}
+
+} // namespace io
+} // namespace zero
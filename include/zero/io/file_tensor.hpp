@@ -0,0 +1,174 @@
+#pragma once
+
+/**
+ * @file file_tensor.hpp
+ * @brief Zero Core Runtime — File-Backed Tensors
+ *
+ * A dense row-major tensor stored at a byte offset in a file, accessed
+ * with positional reads and writes (no mapping). This is the handle the
+ * out-of-core ops tile over; a FileTensor never holds its data in
+ * memory.
+ */
+
+#include "../core/dtype.hpp"
+#include "../core/status.hpp"
+#include "../core/tensor.hpp"
+
+#include <cstdint>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ZERO_HAS_FILE_IO 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace zero {
+namespace io {
+
+struct FileTensor {
+    int fd = -1;
+    int64_t offset = 0;          ///< Byte offset of element 0 in the file
+    DType dtype = DType::F32;
+    int8_t ndim = 0;
+    int64_t shape[MAX_DIMS] = {};
+
+    /**
+     * @brief Open an existing file holding at least offset + nbytes
+     */
+    static Status open(const char* path, const int64_t* shape, int8_t ndim, DType dtype, FileTensor& out,
+                       int64_t offset = 0, bool writable = false) noexcept {
+#ifdef ZERO_HAS_FILE_IO
+        FileTensor t;
+        if (Status s = t.describe(shape, ndim, dtype, offset); s.is_error()) return s;
+        t.fd = ::open(path, (writable ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+        if (t.fd < 0) return status::invalid_argument("cannot open tensor file");
+        struct stat st;
+        if (fstat(t.fd, &st) != 0 || st.st_size < offset + t.nbytes()) {
+            t.close();
+            return status::out_of_bounds("file shorter than the tensor");
+        }
+        out = t;
+        return status::OK;
+#else
+        (void)path; (void)shape; (void)ndim; (void)dtype; (void)out; (void)offset; (void)writable;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "file tensors need POSIX I/O");
+#endif
+    }
+
+    /**
+     * @brief Create (or truncate) a file sized for the tensor, zero-filled
+     */
+    static Status create(const char* path, const int64_t* shape, int8_t ndim, DType dtype,
+                         FileTensor& out) noexcept {
+#ifdef ZERO_HAS_FILE_IO
+        FileTensor t;
+        if (Status s = t.describe(shape, ndim, dtype, 0); s.is_error()) return s;
+        t.fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (t.fd < 0) return status::invalid_argument("cannot create tensor file");
+        if (ftruncate(t.fd, static_cast<off_t>(t.nbytes())) != 0) {
+            t.close();
+            return status::allocation_failed("cannot size tensor file");
+        }
+        out = t;
+        return status::OK;
+#else
+        (void)path; (void)shape; (void)ndim; (void)dtype; (void)out;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "file tensors need POSIX I/O");
+#endif
+    }
+
+    void close() noexcept {
+#ifdef ZERO_HAS_FILE_IO
+        if (fd >= 0) ::close(fd);
+#endif
+        fd = -1;
+    }
+
+    bool is_open() const noexcept { return fd >= 0; }
+
+    int64_t numel() const noexcept {
+        int64_t n = 1;
+        for (int8_t i = 0; i < ndim; ++i) n *= shape[i];
+        return n;
+    }
+
+    int64_t nbytes() const noexcept { return numel() * static_cast<int64_t>(dtype_size(dtype)); }
+
+    /// Size of the last axis (1 for a scalar)
+    int64_t row_length() const noexcept { return ndim > 0 ? shape[ndim - 1] : 1; }
+
+    /**
+     * @brief Read `bytes` at tensor byte offset `pos` (retries short reads)
+     */
+    Status read(int64_t pos, void* dst, int64_t bytes) const noexcept {
+#ifdef ZERO_HAS_FILE_IO
+        char* p = static_cast<char*>(dst);
+        while (bytes > 0) {
+            ssize_t n = ::pread(fd, p, static_cast<size_t>(bytes), static_cast<off_t>(offset + pos));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return status::invalid_state("tensor file read failed");
+            p += n;
+            pos += n;
+            bytes -= n;
+        }
+        return status::OK;
+#else
+        (void)pos; (void)dst; (void)bytes;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "file tensors need POSIX I/O");
+#endif
+    }
+
+    /**
+     * @brief Write `bytes` at tensor byte offset `pos` (retries short writes)
+     */
+    Status write(int64_t pos, const void* src, int64_t bytes) const noexcept {
+#ifdef ZERO_HAS_FILE_IO
+        const char* p = static_cast<const char*>(src);
+        while (bytes > 0) {
+            ssize_t n = ::pwrite(fd, p, static_cast<size_t>(bytes), static_cast<off_t>(offset + pos));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return status::invalid_state("tensor file write failed");
+            p += n;
+            pos += n;
+            bytes -= n;
+        }
+        return status::OK;
+#else
+        (void)pos; (void)src; (void)bytes;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "file tensors need POSIX I/O");
+#endif
+    }
+
+    /**
+     * @brief Drop a consumed range from the page cache (advisory)
+     *
+     * Streaming readers call this so a single pass over a file larger
+     * than RAM does not evict everything else.
+     */
+    void evict(int64_t pos, int64_t bytes) const noexcept {
+#if defined(__linux__)
+        (void)posix_fadvise(fd, static_cast<off_t>(offset + pos), static_cast<off_t>(bytes), POSIX_FADV_DONTNEED);
+#else
+        (void)pos; (void)bytes;
+#endif
+    }
+
+private:
+    Status describe(const int64_t* s, int8_t n, DType d, int64_t off) noexcept {
+        if (n < 0 || n > MAX_DIMS) return status::invalid_argument("ndim out of range");
+        if (off < 0) return status::invalid_argument("negative file offset");
+        for (int8_t i = 0; i < n; ++i) {
+            if (s[i] < 0) return status::invalid_argument("negative dimension");
+            shape[i] = s[i];
+        }
+        ndim = n;
+        dtype = d;
+        offset = off;
+        return status::OK;
+    }
+};
+
+} // namespace io
+} // namespace zero
@@ -0,0 +1,496 @@
+#pragma once
+
+/**
+ * @file out_of_core.hpp
+ * @brief Zero Core Runtime — Out-of-Core GEMM and Reductions
+ *
+ * gemm and reduce_last_axis over FileTensors larger than memory. The
+ * operands are cut into tiles that fit a fixed memory budget, every
+ * operand gets two tile buffers, and a background reader fills the
+ * idle buffer with the next step's tiles while the current step
+ * computes. The background reads run on the driver thread of
+ * OocOptions::reader, or of one process-wide reader when none is given:
+ *
+ *   step s:   compute on A[cur], B[cur]   |   reader: A[other], B[other] ← tiles of s + 1
+ *
+ * GEMM tile shapes come from a search over (tm, tn, tk) that minimises
+ * the estimated bytes read under the budget. When tk == K, the A panel
+ * stays resident across a whole row of C tiles, and the column order
+ * snakes between rows so the last B panel is reused. Tiles already
+ * resident are never read again.
+ */
+
+#include "../core/memory.hpp"
+#include "../core/status.hpp"
+#include "../core/tensor.hpp"
+#include "../exec/thread_pool.hpp"
+#include "../kernels/kernels.hpp"
+#include "../ops/reduce.hpp"
+#include "../telemetry/histogram.hpp"
+#include "../telemetry/profiler.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+#include "async_reader.hpp"
+#include "file_tensor.hpp"
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+
+namespace zero {
+namespace io {
+
+constexpr int64_t OOC_DEFAULT_BUDGET = int64_t{256} << 20;
+
+struct OocOptions {
+    int64_t memory_budget = OOC_DEFAULT_BUDGET;   ///< Bytes of tile buffers, all included
+    exec::ThreadPool* pool = nullptr;             ///< Splits each tile's compute by rows
+    AsyncReader* reader = nullptr;                ///< Issues each step's tile reads as one batch
+};
+
+struct OocStats {
+    int64_t tile_m = 0, tile_n = 0, tile_k = 0;   ///< GEMM tile shape (reduce: rows, cols per block)
+    int64_t resident_bytes = 0;                   ///< Buffer bytes actually allocated
+    int64_t bytes_read = 0;
+    int64_t bytes_written = 0;
+    int64_t tiles_loaded = 0;
+    int64_t tiles_reused = 0;                     ///< Needed tiles found already resident
+};
+
+namespace detail {
+
+/// rows x cols block of a FileTensor viewed as [numel / C, C]; dst is dense.
+struct BlockRead {
+    const FileTensor* src = nullptr;
+    int64_t row0 = 0, col0 = 0, rows = 0, cols = 0;
+    float* dst = nullptr;
+};
+
+inline Status read_block(const BlockRead& b) noexcept {
+    int64_t C = b.src->row_length();
+    if (b.col0 == 0 && b.cols == C)
+        return b.src->read(b.row0 * C * 4, b.dst, b.rows * C * 4);
+    for (int64_t r = 0; r < b.rows; ++r)
+        if (Status s = b.src->read(((b.row0 + r) * C + b.col0) * 4, b.dst + r * b.cols, b.cols * 4); s.is_error())
+            return s;
+    return status::OK;
+}
+
+/// Reads a block takes through an AsyncReader: one if it spans whole rows, else one per row.
+inline int64_t block_parts(const BlockRead& b) noexcept {
+    return b.col0 == 0 && b.cols == b.src->row_length() ? 1 : b.rows;
+}
+
+inline ReadRequest block_request(const BlockRead& b, int64_t r) noexcept {
+    const FileTensor& f = *b.src;
+    int64_t C = f.row_length();
+    bool whole = b.col0 == 0 && b.cols == C;
+    ReadRequest q;
+    q.fd = f.fd;
+    q.offset = f.offset + ((b.row0 + r) * C + b.col0) * 4;
+    q.dst = b.dst + r * b.cols;
+    q.bytes = (whole ? b.rows * C : b.cols) * 4;
+    return q;
+}
+
+/// Read several blocks; with an AsyncReader every row of every block goes in one queue.
+inline Status read_blocks(const BlockRead* b, int32_t n, AsyncReader* via) noexcept {
+    if (via == nullptr) {
+        for (int32_t i = 0; i < n; ++i)
+            if (Status s = read_block(b[i]); s.is_error()) return s;
+        return status::OK;
+    }
+    constexpr int32_t BATCH = 64;
+    ReadRequest reqs[BATCH];
+    int32_t k = 0;
+    for (int32_t i = 0; i < n; ++i) {
+        for (int64_t r = 0, parts = block_parts(b[i]); r < parts; ++r) {
+            reqs[k++] = block_request(b[i], r);
+            if (k == BATCH) {
+                if (Status s = via->read(reqs, k); s.is_error()) return s;
+                k = 0;
+            }
+        }
+    }
+    return k > 0 ? via->read(reqs, k) : status::OK;
+}
+
+inline Status write_block(const FileTensor& dst, int64_t row0, int64_t col0, int64_t rows, int64_t cols,
+                          const float* src) noexcept {
+    int64_t C = dst.row_length();
+    if (col0 == 0 && cols == C) return dst.write(row0 * C * 4, src, rows * C * 4);
+    for (int64_t r = 0; r < rows; ++r)
+        if (Status s = dst.write(((row0 + r) * C + col0) * 4, src + r * cols, cols * 4); s.is_error()) return s;
+    return status::OK;
+}
+
+/**
+ * Process-wide reader for calls that bring none. Its one driver thread
+ * starts on first use and lives until exit; nullptr if it cannot init.
+ */
+inline AsyncReader* prefetch_reader() noexcept {
+    static AsyncReader reader;
+    static const bool ok = [] {
+        ReaderOptions o;
+        o.backend = ReadBackend::THREADS;
+        o.threads = 1;
+        return reader.init(o).is_ok();
+    }();
+    return ok ? &reader : nullptr;
+}
+
+/**
+ * Background tile reads on an AsyncReader's driver thread. submit()
+ * queues up to two block reads as one ReadBatch; wait() blocks until
+ * they have landed. One batch in flight at a time; no thread per call.
+ */
+struct Prefetcher {
+    Prefetcher() noexcept = default;
+    Prefetcher(const Prefetcher&) = delete;
+    Prefetcher& operator=(const Prefetcher&) = delete;
+    ~Prefetcher() {
+        (void)wait();
+        if (reqs_ != nullptr) mem_free(reqs_, Device::CPU);
+    }
+
+    /// max_parts bounds block_parts() summed over one submit
+    Status start(AsyncReader* via, int64_t max_parts) noexcept {
+        via_ = via != nullptr ? via : prefetch_reader();
+        if (via_ == nullptr) return status::invalid_state("prefetch reader unavailable");
+        if (max_parts < 1 || max_parts > INT32_MAX) return status::invalid_argument("too many reads per tile");
+        reqs_ = static_cast<ReadRequest*>(
+            mem_alloc(sizeof(ReadRequest) * static_cast<size_t>(max_parts), alignof(ReadRequest), Device::CPU));
+        if (reqs_ == nullptr) return status::allocation_failed("prefetch request list");
+        cap_ = max_parts;
+        return status::OK;
+    }
+
+    /// On error nothing is in flight.
+    Status submit(const BlockRead* reads, int32_t n) noexcept {
+        int32_t k = 0;
+        for (int32_t i = 0; i < n; ++i)
+            for (int64_t r = 0, parts = block_parts(reads[i]); r < parts; ++r) {
+                if (k == cap_) return status::out_of_bounds("prefetch request list full");
+                reqs_[k++] = block_request(reads[i], r);
+            }
+        if (k == 0) return status::OK;
+        batch_.reqs = reqs_;
+        batch_.n = k;
+        if (Status s = via_->submit(&batch_); s.is_error()) return s;
+        pending_ = true;
+        return status::OK;
+    }
+
+    Status wait() noexcept {
+        if (!pending_) return status::OK;
+        pending_ = false;
+        return batch_.done.wait();
+    }
+
+private:
+    AsyncReader* via_ = nullptr;
+    ReadRequest* reqs_ = nullptr;
+    int64_t cap_ = 0;
+    ReadBatch batch_;
+    bool pending_ = false;
+};
+
+// Owns the tile buffers of one call.
+struct TileBuffers {
+    float* base = nullptr;
+    ~TileBuffers() {
+        if (base != nullptr) mem_free(base, Device::CPU);
+    }
+};
+
+/**
+ * Pick (tm, tn, tk) with 2*tm*tk + 2*tk*tn + tm*tn <= elems that
+ * minimises estimated elements read; ties go to the larger tile.
+ */
+inline bool plan_gemm(int64_t M, int64_t N, int64_t K, int64_t elems, int64_t& tm, int64_t& tn,
+                      int64_t& tk) noexcept {
+    double best = -1.0;
+    for (int64_t d = 1;; d *= 2) {
+        int64_t ck = (K + d - 1) / d;
+        for (int64_t cm = M;; cm = (cm + 1) / 2) {
+            int64_t room = elems - 2 * cm * ck;
+            if (room > 0) {
+                int64_t cn = room / (2 * ck + cm);
+                if (cn > N) cn = N;
+                if (cn >= 1) {
+                    double mb = static_cast<double>((M + cm - 1) / cm);
+                    double nb = static_cast<double>((N + cn - 1) / cn);
+                    double kb = static_cast<double>((K + ck - 1) / ck);
+                    double a = static_cast<double>(M) * static_cast<double>(K) * (kb == 1.0 ? 1.0 : nb);
+                    double b = static_cast<double>(K) * static_cast<double>(N) * mb;
+                    if (kb == 1.0 && nb > 1.0) b -= (mb - 1.0) * static_cast<double>(ck * cn);   // snake reuse
+                    double io = a + b;
+                    if (best < 0.0 || io < best || (io == best && cm * cn * ck > tm * tn * tk)) {
+                        best = io;
+                        tm = cm;
+                        tn = cn;
+                        tk = ck;
+                    }
+                }
+            }
+            if (cm == 1) break;
+        }
+        if (ck == 1) break;
+    }
+    return best >= 0.0;
+}
+
+inline bool is_f32_matrix(const FileTensor& t) noexcept {
+    return t.is_open() && t.dtype == DType::F32 && t.ndim == 2;
+}
+
+inline void tile_gemm(const float* a, const float* b, float* c, int64_t rows, int64_t cols, int64_t depth,
+                      float beta, exec::ThreadPool* pool) noexcept {
+    if (pool == nullptr || pool->size() <= 1 || rows < 2) {
+        kernels::gemm_f32(a, b, c, rows, cols, depth, 1.0f, beta);
+        return;
+    }
+    int64_t tasks = 4 * static_cast<int64_t>(pool->size());
+    if (tasks > rows) tasks = rows;
+    (void)pool->parallel_for(tasks, [&](int64_t t) noexcept {
+        int64_t r0 = rows * t / tasks, r1 = rows * (t + 1) / tasks;
+        kernels::gemm_f32(a + r0 * depth, b, c + r0 * cols, r1 - r0, cols, depth, 1.0f, beta);
+    });
+}
+
+} // namespace detail
+
+/**
+ * @brief C = A @ B with A [M, K], B [K, N], C [M, N] all F32 files
+ *
+ * Resident memory never exceeds opt.memory_budget. C is written tile by
+ * tile; on error its contents are unspecified.
+ */
+inline Status gemm(const FileTensor& A, const FileTensor& B, const FileTensor& C, const OocOptions& opt = {},
+                   OocStats* stats = nullptr) noexcept {
+    if (!detail::is_f32_matrix(A) || !detail::is_f32_matrix(B) || !detail::is_f32_matrix(C))
+        return status::invalid_argument("out-of-core gemm needs open rank-2 F32 files");
+    int64_t M = A.shape[0], K = A.shape[1], N = B.shape[1];
+    if (B.shape[0] != K || C.shape[0] != M || C.shape[1] != N)
+        return status::invalid_argument("gemm shape mismatch");
+    if (K == 0) return status::invalid_argument("empty inner dimension");
+    if (M == 0 || N == 0) return status::OK;
+
+    int64_t tm = 0, tn = 0, tk = 0;
+    if (!detail::plan_gemm(M, N, K, opt.memory_budget / 4, tm, tn, tk))
+        return status::invalid_argument("memory budget too small for one tile");
+    ZERO_OP_TIMER(ir::OpKind::MATMUL, M * N * K);
+    ZERO_OP_PROFILE_SCOPE(ir::OpKind::MATMUL);
+    ZERO_OP_METRICS(ir::OpKind::MATMUL, (M * K + K * N + M * N) * static_cast<int64_t>(sizeof(float)),
+                    2 * M * N * K);
+
+    int64_t a_elems = tm * tk, b_elems = tk * tn;
+    int64_t total = 2 * a_elems + 2 * b_elems + tm * tn;
+    detail::TileBuffers mem;
+    mem.base = static_cast<float*>(mem_alloc(static_cast<size_t>(total) * 4, 64, Device::CPU));
+    if (mem.base == nullptr) return status::allocation_failed("out-of-core tile buffers");
+    float* abuf[2] = {mem.base, mem.base + a_elems};
+    float* bbuf[2] = {mem.base + 2 * a_elems, mem.base + 2 * a_elems + b_elems};
+    float* cbuf = mem.base + 2 * a_elems + 2 * b_elems;
+
+    OocStats st;
+    st.tile_m = tm;
+    st.tile_n = tn;
+    st.tile_k = tk;
+    st.resident_bytes = total * 4;
+
+    int64_t Mb = (M + tm - 1) / tm, Nb = (N + tn - 1) / tn, Kb = (K + tk - 1) / tk;
+    int64_t steps = Mb * Nb * Kb;
+    // Step s -> (i, j, k); j snakes so consecutive row blocks meet on the same B panel.
+    auto decode = [&](int64_t s, int64_t& ib, int64_t& jb, int64_t& kb) noexcept {
+        ib = s / (Nb * Kb);
+        int64_t r = s % (Nb * Kb);
+        kb = r % Kb;
+        jb = ib % 2 == 0 ? r / Kb : Nb - 1 - r / Kb;
+    };
+    int64_t akey[2] = {-1, -1}, bkey[2] = {-1, -1};
+    int32_t acur = 0, bcur = 0;
+    // Queue the reads for step s into the buffers step `busy_a/b` is not using.
+    auto stage = [&](int64_t s, int32_t busy_a, int32_t busy_b, detail::BlockRead* reads, int32_t& n,
+                     int32_t& aslot, int32_t& bslot) noexcept {
+        int64_t ib, jb, kb;
+        decode(s, ib, jb, kb);
+        int64_t ka = ib * Kb + kb, kbk = kb * Nb + jb;
+        n = 0;
+        if (akey[0] == ka || akey[1] == ka) {
+            aslot = akey[0] == ka ? 0 : 1;
+            ++st.tiles_reused;
+        } else {
+            aslot = busy_a < 0 ? 0 : 1 - busy_a;
+            akey[aslot] = ka;
+            int64_t rows = M - ib * tm < tm ? M - ib * tm : tm, depth = K - kb * tk < tk ? K - kb * tk : tk;
+            reads[n++] = {&A, ib * tm, kb * tk, rows, depth, abuf[aslot]};
+            st.bytes_read += rows * depth * 4;
+            ++st.tiles_loaded;
+        }
+        if (bkey[0] == kbk || bkey[1] == kbk) {
+            bslot = bkey[0] == kbk ? 0 : 1;
+            ++st.tiles_reused;
+        } else {
+            bslot = busy_b < 0 ? 0 : 1 - busy_b;
+            bkey[bslot] = kbk;
+            int64_t depth = K - kb * tk < tk ? K - kb * tk : tk, cols = N - jb * tn < tn ? N - jb * tn : tn;
+            reads[n++] = {&B, kb * tk, jb * tn, depth, cols, bbuf[bslot]};
+            st.bytes_read += depth * cols * 4;
+            ++st.tiles_loaded;
+        }
+    };
+
+    detail::BlockRead reads[2];
+    int32_t n = 0;
+    stage(0, -1, -1, reads, n, acur, bcur);
+    if (Status s = detail::read_blocks(reads, n, opt.reader); s.is_error()) return s;
+
+    detail::Prefetcher reader;
+    if (Status s = reader.start(opt.reader, tm + tk); s.is_error()) return s;
+    for (int64_t s = 0; s < steps; ++s) {
+        int32_t anext = acur, bnext = bcur;
+        if (s + 1 < steps) {
+            stage(s + 1, acur, bcur, reads, n, anext, bnext);
+            if (Status q = reader.submit(reads, n); q.is_error()) return q;
+        }
+        int64_t ib, jb, kb;
+        decode(s, ib, jb, kb);
+        int64_t rows = M - ib * tm < tm ? M - ib * tm : tm;
+        int64_t cols = N - jb * tn < tn ? N - jb * tn : tn;
+        int64_t depth = K - kb * tk < tk ? K - kb * tk : tk;
+        detail::tile_gemm(abuf[acur], bbuf[bcur], cbuf, rows, cols, depth, kb == 0 ? 0.0f : 1.0f, opt.pool);
+        Status io = status::OK;
+        if (kb == Kb - 1) {
+            io = detail::write_block(C, ib * tm, jb * tn, rows, cols, cbuf);
+            st.bytes_written += rows * cols * 4;
+        }
+        if (s + 1 < steps) {
+            Status r = reader.wait();
+            if (io.is_ok()) io = r;
+        }
+        if (io.is_error()) return io;
+        acur = anext;
+        bcur = bnext;
+    }
+    if (stats != nullptr) *stats = st;
+    return status::OK;
+}
+
+/**
+ * @brief out = op over the last axis of a file tensor (F32)
+ *
+ * Streams the file once in order, two blocks resident at a time, and
+ * drops consumed ranges from the page cache. When a whole row fits in
+ * half the budget, blocks are whole rows and the result is bit-identical
+ * to ops::reduce_last_axis; otherwise rows are reduced in chunks and
+ * the partial results combined.
+ */
+inline Status reduce_last_axis(const FileTensor& in, Tensor& out, ops::ReduceOp op, const OocOptions& opt = {},
+                               OocStats* stats = nullptr) noexcept {
+    if (!in.is_open() || in.dtype != DType::F32 || in.ndim < 1)
+        return status::invalid_argument("out-of-core reduce needs an open F32 file of rank >= 1");
+    if (out.data == nullptr || out.device != Device::CPU || out.dtype != DType::F32 || !out.is_contiguous())
+        return status::invalid_argument("output must be a contiguous F32 CPU tensor");
+    if (out.ndim != in.ndim - 1) return status::invalid_argument("output rank must be input rank - 1");
+    for (int8_t i = 0; i < out.ndim; ++i)
+        if (out.shape[i] != in.shape[i]) return status::invalid_argument("output leading-axis shape must match input");
+
+    int64_t cols = in.row_length();
+    int64_t rows = out.numel();
+    float* y = static_cast<float*>(out.data);
+    auto rows_kernel = [](ops::ReduceOp o, const float* x, float* r, int64_t n, int64_t len) noexcept {
+        switch (o) {
+            case ops::ReduceOp::SUM:  kernels::sum_rows_f32(x, r, n, len); break;
+            case ops::ReduceOp::MAX:  kernels::max_rows_f32(x, r, n, len); break;
+            case ops::ReduceOp::MIN:  kernels::min_rows_f32(x, r, n, len); break;
+            case ops::ReduceOp::MEAN: kernels::mean_rows_f32(x, r, n, len); break;
+            case ops::ReduceOp::PROD: kernels::prod_rows_f32(x, r, n, len); break;
+        }
+    };
+    if (rows == 0) return status::OK;
+    if (cols == 0) {
+        rows_kernel(op, nullptr, y, rows, 0);
+        return status::OK;
+    }
+
+    int64_t half = opt.memory_budget / 8;   // elements per buffer
+    if (half < 1) return status::invalid_argument("memory budget too small for one tile");
+    ZERO_OP_TIMER(ops::detail::reduce_op_kind(op), rows * cols);
+    ZERO_OP_PROFILE_SCOPE(ops::detail::reduce_op_kind(op));
+    ZERO_OP_METRICS(ops::detail::reduce_op_kind(op),
+                    (rows * cols + rows) * static_cast<int64_t>(sizeof(float)), rows * cols);
+
+    // Pieces of the flat stream: whole rows when one fits, else row chunks.
+    bool whole = half >= cols;
+    int64_t block_rows = whole ? (half / cols < rows ? half / cols : rows) : 1;
+    int64_t chunk = whole ? cols : half;
+    int64_t per_row = (cols + chunk - 1) / chunk;
+    int64_t pieces = whole ? (rows + block_rows - 1) / block_rows : rows * per_row;
+    int64_t buf_elems = whole ? block_rows * cols : chunk;
+
+    detail::TileBuffers mem;
+    mem.base = static_cast<float*>(mem_alloc(static_cast<size_t>(2 * buf_elems) * 4, 64, Device::CPU));
+    if (mem.base == nullptr) return status::allocation_failed("out-of-core block buffers");
+    float* buf[2] = {mem.base, mem.base + buf_elems};
+
+    OocStats st;
+    st.tile_m = block_rows;
+    st.tile_n = chunk;
+    st.resident_bytes = 2 * buf_elems * 4;
+    auto piece = [&](int64_t p, float* dst) noexcept {
+        detail::BlockRead b;
+        b.src = &in;
+        b.dst = dst;
+        if (whole) {
+            b.row0 = p * block_rows;
+            b.rows = rows - b.row0 < block_rows ? rows - b.row0 : block_rows;
+            b.cols = cols;
+        } else {
+            b.row0 = p / per_row;
+            b.col0 = (p % per_row) * chunk;
+            b.rows = 1;
+            b.cols = cols - b.col0 < chunk ? cols - b.col0 : chunk;
+        }
+        return b;
+    };
+
+    detail::BlockRead cur = piece(0, buf[0]);
+    if (Status s = detail::read_blocks(&cur, 1, opt.reader); s.is_error()) return s;
+    detail::Prefetcher reader;
+    if (Status s = reader.start(opt.reader, 1); s.is_error()) return s;
+    ops::ReduceOp part_op = op == ops::ReduceOp::MEAN ? ops::ReduceOp::SUM : op;
+    float acc = 0.0f;
+    for (int64_t p = 0; p < pieces; ++p) {
+        detail::BlockRead next;
+        if (p + 1 < pieces) {
+            next = piece(p + 1, buf[(p + 1) % 2]);
+            if (Status s = reader.submit(&next, 1); s.is_error()) return s;
+        }
+        if (whole) {
+            rows_kernel(op, cur.dst, y + cur.row0, cur.rows, cols);
+        } else {
+            float part;
+            rows_kernel(part_op, cur.dst, &part, 1, cur.cols);
+            if (cur.col0 == 0) acc = part;
+            else if (part_op == ops::ReduceOp::SUM) acc += part;
+            else if (part_op == ops::ReduceOp::MAX) acc = part > acc ? part : acc;
+            else if (part_op == ops::ReduceOp::MIN) acc = part < acc ? part : acc;
+            else acc *= part;
+            if (cur.col0 + cur.cols == cols)
+                y[cur.row0] = op == ops::ReduceOp::MEAN ? acc / static_cast<float>(cols) : acc;
+        }
+        int64_t start = (cur.row0 * cols + cur.col0) * 4, len = cur.rows * cur.cols * 4;
+        in.evict(start, len);
+        st.bytes_read += len;
+        ++st.tiles_loaded;
+        if (p + 1 < pieces) {
+            if (Status s = reader.wait(); s.is_error()) return s;
+            cur = next;
+        }
+    }
+    if (stats != nullptr) *stats = st;
+    return status::OK;
+}
+
+} // namespace io
+} // namespace zero
@@ -0,0 +1,432 @@
+#pragma once
+
+/**
+ * @file collectives.hpp
+ * @brief Zero Core Runtime — Shared-Memory Multi-Process Collectives
+ *
+ * All-reduce (ring or tree), all-gather, reduce-scatter and barrier
+ * between N processes on one host. There is no network: the ranks map
+ * one POSIX shared-memory segment.
+ *
+ *   [ control page: doorbell futex, per-rank step counters ]
+ *   [ slot 0 ][ slot 1 ] ... [ slot N-1 ]     one chunk per rank
+ *
+ * Each rank publishes a step counter. A step reads neighbours' slots
+ * and writes only its own; a rank starts step t once the ranks it
+ * exchanges data with have finished step t - 1. Tensors larger than a
+ * slot are processed chunk by chunk, and because ranks only wait on
+ * their neighbours, one rank's copy-in of the next chunk overlaps
+ * another's reduction of the current one. Waits go through the shared
+ * Doorbell (futex.hpp).
+ *
+ * Every rank first-touches its own slot, so under the default NUMA
+ * policy the slot's pages live on the node where that rank runs.
+ */
+
+#include "../core/tensor.hpp"
+#include "../core/status.hpp"
+#include "../ops/reduce.hpp"
+#include "futex.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+#define ZERO_HAS_SHM_COLLECTIVES 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace zero {
+namespace ipc {
+
+constexpr int32_t COLL_MAX_RANKS = 64;
+constexpr int64_t COLL_PAGE = 4096;
+constexpr int64_t COLL_DEFAULT_CHUNK_BYTES = int64_t{256} << 10;
+
+enum class AllReduceAlgo : uint8_t {
+    RING = 0,   ///< Reduce-scatter then all-gather around the ring; 2(N-1) steps
+    TREE = 1,   ///< Binary-tree reduce to rank 0, then broadcast back down
+};
+
+struct CollectiveOptions {
+    int64_t chunk_bytes = COLL_DEFAULT_CHUNK_BYTES;   ///< Per-rank slot size (rounded up to a page)
+    int64_t timeout_ms = 30000;                       ///< Per wait; 0 waits forever
+};
+
+namespace detail {
+
+struct alignas(64) StepCounter {
+    std::atomic<uint64_t> value;
+};
+
+// Lives at offset 0 of the segment. Zero-filled pages are the valid
+// initial state, so no rank has to construct it.
+struct CollControl {
+    alignas(64) Doorbell door;
+    std::atomic<int32_t> attached;
+    StepCounter step[COLL_MAX_RANKS];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "step counters must be address-free");
+
+inline int64_t round_up(int64_t v, int64_t a) noexcept { return (v + a - 1) / a * a; }
+
+inline void combine(float* dst, const float* src, int64_t n, ops::ReduceOp op) noexcept {
+    switch (op) {
+        case ops::ReduceOp::SUM:
+        case ops::ReduceOp::MEAN:
+            for (int64_t i = 0; i < n; ++i) dst[i] += src[i];
+            return;
+        case ops::ReduceOp::MAX:
+            for (int64_t i = 0; i < n; ++i) dst[i] = src[i] > dst[i] ? src[i] : dst[i];
+            return;
+        case ops::ReduceOp::MIN:
+            for (int64_t i = 0; i < n; ++i) dst[i] = src[i] < dst[i] ? src[i] : dst[i];
+            return;
+        case ops::ReduceOp::PROD:
+            for (int64_t i = 0; i < n; ++i) dst[i] *= src[i];
+            return;
+    }
+}
+
+// Copy a finished chunk out; MEAN divides by the world size here.
+inline void copy_out(float* dst, const float* src, int64_t n, ops::ReduceOp op, int32_t world) noexcept {
+    if (op != ops::ReduceOp::MEAN) {
+        std::memcpy(dst, src, static_cast<size_t>(n) * sizeof(float));
+        return;
+    }
+    float w = static_cast<float>(world);
+    for (int64_t i = 0; i < n; ++i) dst[i] = src[i] / w;
+}
+
+inline bool is_dense_f32(const Tensor& t) noexcept {
+    return t.data != nullptr && t.device == Device::CPU && t.is_contiguous();
+}
+
+} // namespace detail
+
+/**
+ * @brief One rank's handle on a shared-memory collective group
+ *
+ * All ranks call init() with the same name, world size and chunk size,
+ * then issue the same sequence of collectives on tensors of the same
+ * shape. Results are bit-identical on every rank. A timed-out wait
+ * leaves the group unusable; every later call returns INVALID_STATE.
+ */
+struct Communicator {
+    Communicator() noexcept = default;
+    Communicator(const Communicator&) = delete;
+    Communicator& operator=(const Communicator&) = delete;
+    ~Communicator() { close(); }
+
+    /**
+     * @brief Create (rank 0) or attach to the segment, then wait for all ranks
+     *
+     * @param name  POSIX shm name ("/job-42"), unique per job. Rank 0
+     *              removes a stale segment of that name and unlinks the
+     *              name again once every rank has attached.
+     */
+    Status init(const char* name, int32_t rank, int32_t world, CollectiveOptions opt = {}) noexcept {
+#ifdef ZERO_HAS_SHM_COLLECTIVES
+        if (ctl_ != nullptr) return status::invalid_state("communicator already initialized");
+        if (name == nullptr || name[0] != '/') return status::invalid_argument("shm name must start with '/'");
+        if (world < 1 || world > COLL_MAX_RANKS) return status::invalid_argument("world size out of range");
+        if (rank < 0 || rank >= world) return status::invalid_argument("rank out of range");
+        if (opt.chunk_bytes < static_cast<int64_t>(sizeof(float)) || opt.timeout_ms < 0)
+            return status::invalid_argument("invalid collective options");
+
+        rank_ = rank;
+        world_ = world;
+        timeout_ms_ = opt.timeout_ms;
+        slot_bytes_ = detail::round_up(opt.chunk_bytes, COLL_PAGE);
+        int64_t ctl_bytes = detail::round_up(static_cast<int64_t>(sizeof(detail::CollControl)), COLL_PAGE);
+        map_bytes_ = ctl_bytes + slot_bytes_ * world;
+
+        int fd = -1;
+        int64_t deadline = deadline_after_ms(timeout_ms_);
+        if (rank == 0) {
+            shm_unlink(name);
+            fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd < 0) return status::invalid_argument("shm_open failed");
+            if (ftruncate(fd, static_cast<off_t>(map_bytes_)) != 0) {
+                ::close(fd);
+                shm_unlink(name);
+                return status::allocation_failed("cannot size shared segment");
+            }
+        } else {
+            // Wait for rank 0 to create and size the segment.
+            for (;;) {
+                fd = shm_open(name, O_RDWR, 0600);
+                struct stat st;
+                if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size != 0) {
+                    if (st.st_size != map_bytes_) {
+                        ::close(fd);
+                        return status::invalid_argument("ranks disagree on world size or chunk size");
+                    }
+                    break;
+                }
+                if (fd >= 0) ::close(fd);
+                if (deadline_passed(deadline)) return status::invalid_state("timed out waiting for rank 0");
+                usleep(1000);
+            }
+        }
+        void* base = mmap(nullptr, static_cast<size_t>(map_bytes_), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            if (rank == 0) shm_unlink(name);
+            return status::allocation_failed("cannot map shared segment");
+        }
+        ctl_ = static_cast<detail::CollControl*>(base);
+        slots_ = static_cast<char*>(base) + ctl_bytes;
+        std::memset(slot(rank_), 0, static_cast<size_t>(slot_bytes_));   // first touch
+        step_ = 0;
+        broken_ = false;
+
+        ctl_->attached.fetch_add(1, std::memory_order_seq_cst);
+        ctl_->door.ring();
+        Status s = wait([this] { return ctl_->attached.load(std::memory_order_acquire) >= world_; });
+        if (rank == 0) shm_unlink(name);
+        if (s.is_error()) {
+            close();
+            return s;
+        }
+        return status::OK;
+#else
+        (void)name; (void)rank; (void)world; (void)opt;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "shared-memory collectives need Linux");
+#endif
+    }
+
+    /**
+     * @brief Unmap the segment. Other ranks are not notified.
+     */
+    void close() noexcept {
+#ifdef ZERO_HAS_SHM_COLLECTIVES
+        if (ctl_ != nullptr) munmap(ctl_, static_cast<size_t>(map_bytes_));
+#endif
+        ctl_ = nullptr;
+        slots_ = nullptr;
+    }
+
+    int32_t rank() const noexcept { return rank_; }
+    int32_t world() const noexcept { return world_; }
+    int64_t chunk_elems() const noexcept { return slot_bytes_ / static_cast<int64_t>(sizeof(float)); }
+
+    /**
+     * @brief Return once every rank has entered the barrier
+     */
+    Status barrier() noexcept {
+        if (Status s = usable(); s.is_error()) return s;
+        advance();
+        return wait_all(step_);
+    }
+
+    /**
+     * @brief In place: x = op(x_0, ..., x_{N-1}) elementwise (F32)
+     */
+    Status all_reduce(Tensor& x, ops::ReduceOp op = ops::ReduceOp::SUM,
+                      AllReduceAlgo algo = AllReduceAlgo::RING) noexcept {
+        if (Status s = usable(); s.is_error()) return s;
+        if (Status s = check_f32(x); s.is_error()) return s;
+        float* data = static_cast<float*>(x.data);
+        int64_t n = x.numel();
+        if (world_ == 1) return status::OK;
+        if (Status s = wait_all(step_); s.is_error()) return s;
+        return algo == AllReduceAlgo::RING ? ring_all_reduce(data, n, op) : tree_all_reduce(data, n, op);
+    }
+
+    /**
+     * @brief out[r * n : (r + 1) * n] = in of rank r, on every rank
+     */
+    Status all_gather(const Tensor& in, Tensor& out) noexcept {
+        if (Status s = usable(); s.is_error()) return s;
+        if (Status s = check_f32(in); s.is_error()) return s;
+        if (Status s = check_f32(out); s.is_error()) return s;
+        int64_t n = in.numel();
+        if (out.numel() != n * world_) return status::invalid_argument("all_gather output must hold world * input");
+        const float* src = static_cast<const float*>(in.data);
+        float* dst = static_cast<float*>(out.data);
+        float* mine = slot(rank_);
+        for (int64_t off = 0; off < n; off += chunk_elems()) {
+            int64_t len = n - off < chunk_elems() ? n - off : chunk_elems();
+            if (Status s = wait_all(step_); s.is_error()) return s;
+            std::memcpy(mine, src + off, static_cast<size_t>(len) * sizeof(float));
+            advance();
+            if (Status s = wait_all(step_); s.is_error()) return s;
+            for (int32_t r = 0; r < world_; ++r)
+                std::memcpy(dst + r * n + off, slot(r), static_cast<size_t>(len) * sizeof(float));
+            advance();
+        }
+        return status::OK;
+    }
+
+    /**
+     * @brief out = op over ranks of in[rank * n : (rank + 1) * n]
+     *
+     * Ranks are combined in rank order, so the result does not depend
+     * on timing.
+     */
+    Status reduce_scatter(const Tensor& in, Tensor& out, ops::ReduceOp op = ops::ReduceOp::SUM) noexcept {
+        if (Status s = usable(); s.is_error()) return s;
+        if (Status s = check_f32(in); s.is_error()) return s;
+        if (Status s = check_f32(out); s.is_error()) return s;
+        int64_t n = out.numel();
+        if (in.numel() != n * world_) return status::invalid_argument("reduce_scatter input must hold world * output");
+        const float* src = static_cast<const float*>(in.data);
+        float* dst = static_cast<float*>(out.data);
+        float* mine = slot(rank_);
+        int64_t piece = chunk_elems() / world_ > 0 ? chunk_elems() / world_ : 1;
+        if (piece * world_ > chunk_elems()) return status::invalid_argument("chunk too small for world size");
+        for (int64_t off = 0; off < n; off += piece) {
+            int64_t len = n - off < piece ? n - off : piece;
+            if (Status s = wait_all(step_); s.is_error()) return s;
+            for (int32_t j = 0; j < world_; ++j)
+                std::memcpy(mine + j * piece, src + j * n + off, static_cast<size_t>(len) * sizeof(float));
+            advance();
+            if (Status s = wait_all(step_); s.is_error()) return s;
+            float* acc = dst + off;
+            std::memcpy(acc, slot(0) + rank_ * piece, static_cast<size_t>(len) * sizeof(float));
+            for (int32_t r = 1; r < world_; ++r) detail::combine(acc, slot(r) + rank_ * piece, len, op);
+            if (op == ops::ReduceOp::MEAN) detail::copy_out(acc, acc, len, op, world_);
+            advance();
+        }
+        return status::OK;
+    }
+
+private:
+    float* slot(int32_t r) const noexcept {
+        return reinterpret_cast<float*>(slots_ + slot_bytes_ * r);
+    }
+
+    Status usable() const noexcept {
+        if (ctl_ == nullptr) return status::invalid_state("communicator not initialized");
+        if (broken_) return status::invalid_state("communicator broken by an earlier timeout");
+        return status::OK;
+    }
+
+    static Status check_f32(const Tensor& t) noexcept {
+        if (t.dtype != DType::F32) return status::type_mismatch("collectives support F32 only");
+        if (!detail::is_dense_f32(t)) return status::invalid_argument("collective tensors must be contiguous CPU");
+        return status::OK;
+    }
+
+    // Publish the end of our current step.
+    void advance() noexcept {
+        ++step_;
+        ctl_->step[rank_].value.store(step_, std::memory_order_seq_cst);
+        ctl_->door.ring();
+    }
+
+    bool reached(int32_t r, uint64_t target) const noexcept {
+        return ctl_->step[r].value.load(std::memory_order_acquire) >= target;
+    }
+
+    Status wait_all(uint64_t target) noexcept {
+        return wait([&] {
+            for (int32_t r = 0; r < world_; ++r)
+                if (!reached(r, target)) return false;
+            return true;
+        });
+    }
+
+    // Our ring / tree neighbours have finished step `target`.
+    Status wait_peers(int32_t a, int32_t b, int32_t c, uint64_t target) noexcept {
+        return wait([&] {
+            return (a < 0 || reached(a, target)) && (b < 0 || reached(b, target)) &&
+                   (c < 0 || reached(c, target));
+        });
+    }
+
+    template <typename Ready>
+    Status wait(Ready&& ready) noexcept {
+        if (ctl_->door.wait(ready, deadline_after_ms(timeout_ms_))) return status::OK;
+        broken_ = true;
+        return status::invalid_state("collective timed out waiting for a peer");
+    }
+
+    // Segment j of an n-element chunk split across the ranks.
+    void segment(int64_t n, int32_t j, int64_t& begin, int64_t& len) const noexcept {
+        begin = n * j / world_;
+        len = n * (j + 1) / world_ - begin;
+    }
+
+    Status ring_all_reduce(float* data, int64_t n, ops::ReduceOp op) noexcept {
+        int32_t pred = (rank_ + world_ - 1) % world_, succ = (rank_ + 1) % world_;
+        float* mine = slot(rank_);
+        const float* prev = slot(pred);
+        for (int64_t off = 0; off < n; off += chunk_elems()) {
+            int64_t len = n - off < chunk_elems() ? n - off : chunk_elems();
+            // The first chunk's entry wait (all ranks) happened in all_reduce.
+            if (off > 0)
+                if (Status s = wait_peers(pred, succ, -1, step_); s.is_error()) return s;
+            std::memcpy(mine, data + off, static_cast<size_t>(len) * sizeof(float));
+            advance();
+            // Reduce-scatter: add pred's partial of segment (rank - s) into ours.
+            for (int32_t s = 1; s < world_; ++s) {
+                if (Status st = wait_peers(pred, succ, -1, step_); st.is_error()) return st;
+                int64_t b, l;
+                segment(len, (rank_ - s + world_) % world_, b, l);
+                detail::combine(mine + b, prev + b, l, op);
+                advance();
+            }
+            // All-gather: segment (rank + 1 - s) is complete at pred.
+            for (int32_t s = 1; s < world_; ++s) {
+                if (Status st = wait_peers(pred, succ, -1, step_); st.is_error()) return st;
+                int64_t b, l;
+                segment(len, (rank_ - s + 1 + world_) % world_, b, l);
+                std::memcpy(mine + b, prev + b, static_cast<size_t>(l) * sizeof(float));
+                advance();
+            }
+            if (Status s = wait_peers(pred, succ, -1, step_); s.is_error()) return s;
+            detail::copy_out(data + off, mine, len, op, world_);
+            advance();
+        }
+        return status::OK;
+    }
+
+    Status tree_all_reduce(float* data, int64_t n, ops::ReduceOp op) noexcept {
+        int32_t parent = rank_ == 0 ? -1 : (rank_ - 1) / 2;
+        int32_t left = 2 * rank_ + 1 < world_ ? 2 * rank_ + 1 : -1;
+        int32_t right = 2 * rank_ + 2 < world_ ? 2 * rank_ + 2 : -1;
+        float* mine = slot(rank_);
+        for (int64_t off = 0; off < n; off += chunk_elems()) {
+            int64_t len = n - off < chunk_elems() ? n - off : chunk_elems();
+            if (off > 0)
+                if (Status s = wait_peers(parent, left, right, step_); s.is_error()) return s;
+            std::memcpy(mine, data + off, static_cast<size_t>(len) * sizeof(float));
+            advance();
+            // Up: children have folded their subtrees into their slots.
+            if (Status s = wait_peers(left, right, -1, step_ + 1); s.is_error()) return s;
+            if (Status s = wait_peers(parent, -1, -1, step_); s.is_error()) return s;
+            if (left >= 0) detail::combine(mine, slot(left), len, op);
+            if (right >= 0) detail::combine(mine, slot(right), len, op);
+            advance();
+            // Down: take the finished chunk from the parent.
+            if (Status s = wait_peers(parent, -1, -1, step_ + 1); s.is_error()) return s;
+            if (Status s = wait_peers(left, right, -1, step_); s.is_error()) return s;
+            if (parent >= 0) std::memcpy(mine, slot(parent), static_cast<size_t>(len) * sizeof(float));
+            advance();
+            if (Status s = wait_peers(parent, left, right, step_); s.is_error()) return s;
+            detail::copy_out(data + off, mine, len, op, world_);
+            advance();
+        }
+        return status::OK;
+    }
+
+    detail::CollControl* ctl_ = nullptr;
+    char* slots_ = nullptr;
+    int64_t slot_bytes_ = 0;
+    int64_t map_bytes_ = 0;
+    int64_t timeout_ms_ = 0;
+    uint64_t step_ = 0;
+    int32_t rank_ = 0;
+    int32_t world_ = 0;
+    bool broken_ = false;
+};
+
+} // namespace ipc
+} // namespace zero
@@ -0,0 +1,109 @@
+#pragma once
+
+/**
+ * @file futex.hpp
+ * @brief Zero Core Runtime — Cross-Process Doorbell
+ *
+ * An event count that lives in shared memory. Producers ring() after
+ * publishing state; consumers wait() until a predicate over that state
+ * holds. Waiters spin briefly, then sleep on a shared (non-private)
+ * futex, so one doorbell works across processes that map it. An
+ * all-zero Doorbell is valid, so it can sit in freshly truncated
+ * memory without construction.
+ */
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__linux__)
+#define ZERO_HAS_FUTEX 1
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace zero {
+namespace ipc {
+
+constexpr int32_t DOORBELL_SPIN_ITERS = 2048;   ///< Polls before sleeping on the futex
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free && sizeof(std::atomic<uint32_t>) == 4,
+              "futex word must be a plain 32-bit atomic");
+
+inline int64_t monotonic_ns() noexcept {
+#ifdef ZERO_HAS_FUTEX
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+/// Absolute deadline for a timeout in milliseconds; 0 means none.
+inline int64_t deadline_after_ms(int64_t timeout_ms) noexcept {
+    return timeout_ms == 0 ? 0 : monotonic_ns() + timeout_ms * 1000000LL;
+}
+
+inline bool deadline_passed(int64_t deadline) noexcept {
+    return deadline != 0 && monotonic_ns() >= deadline;
+}
+
+struct Doorbell {
+    std::atomic<uint32_t> bell;
+    std::atomic<uint32_t> sleepers;
+
+    /**
+     * @brief Wake every waiter; a syscall only when someone sleeps
+     */
+    void ring() noexcept {
+        bell.fetch_add(1, std::memory_order_seq_cst);
+#ifdef ZERO_HAS_FUTEX
+        if (sleepers.load(std::memory_order_seq_cst) > 0)
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&bell), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+#endif
+    }
+
+    /**
+     * @brief Return true once ready() holds, false at the deadline
+     *
+     * State read by ready() must be published before the matching ring().
+     */
+    template <typename Ready>
+    bool wait(Ready&& ready, int64_t deadline) noexcept {
+        for (int32_t i = 0; i < DOORBELL_SPIN_ITERS; ++i) {
+            if (ready()) return true;
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        }
+#ifdef ZERO_HAS_FUTEX
+        for (;;) {
+            uint32_t seen = bell.load(std::memory_order_seq_cst);
+            if (ready()) return true;
+            sleepers.fetch_add(1, std::memory_order_seq_cst);
+            timespec ts;
+            timespec* tp = nullptr;
+            if (deadline != 0) {
+                int64_t left = deadline - monotonic_ns();
+                if (left < 0) left = 0;
+                ts.tv_sec = static_cast<time_t>(left / 1000000000);
+                ts.tv_nsec = static_cast<long>(left % 1000000000);
+                tp = &ts;
+            }
+            if (!ready())
+                syscall(SYS_futex, reinterpret_cast<uint32_t*>(&bell), FUTEX_WAIT, seen, tp, nullptr, 0);
+            sleepers.fetch_sub(1, std::memory_order_seq_cst);
+            if (ready()) return true;
+            if (deadline_passed(deadline)) return false;
+        }
+#else
+        (void)deadline;
+        return false;
+#endif
+    }
+};
+
+} // namespace ipc
+} // namespace zero
@@ -0,0 +1,613 @@
+#pragma once
+
+/**
+ * @file transport.hpp
+ * @brief Zero Core Runtime — Zero-Copy Inter-Process Tensor Transport
+ *
+ * Tensors live in memfd-backed shared regions. Only a fixed-size
+ * descriptor (dtype, shape, byte strides, offset) crosses the Unix
+ * domain socket; the region's fd rides along as SCM_RIGHTS, and the
+ * receiver maps it and hands out a Tensor::wrap view.
+ *
+ * One-shot:  memfd_tensor → send_tensor  ──fd + descriptor──▶  recv_tensor
+ *
+ * Streaming: TensorSender maps a ring of reusable slots and passes its
+ * fd once. After that a transfer is
+ *
+ *   acquire (CAS FREE → WRITING)  fill in place  send (→ IN_FLIGHT, one sendmsg)
+ *   recv (one recvmsg, view into the slot)  use  release (→ FREE, doorbell)
+ *
+ * with no allocation, no mapping and no payload copy. Regions are
+ * size-sealed (F_SEAL_SHRINK | F_SEAL_GROW) and the receiver refuses
+ * unsealed fds, so a peer cannot truncate memory under a live view.
+ */
+
+#include "../core/tensor.hpp"
+#include "../core/status.hpp"
+#include "futex.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+#define ZERO_HAS_MEMFD_TRANSPORT 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace zero {
+namespace ipc {
+
+constexpr int32_t TRANSPORT_MAX_SLOTS = 256;
+constexpr int64_t TRANSPORT_PAGE = 4096;
+constexpr uint32_t TRANSPORT_MAGIC = 0x5A54524Eu;   ///< "ZTRN"
+
+/**
+ * @brief Where a tensor sits in a shared region
+ */
+struct TensorDescriptor {
+    int64_t offset;                  ///< Byte offset of data in the region
+    int64_t shape[MAX_DIMS];
+    int64_t strides[MAX_DIMS];       ///< Bytes, as in Tensor
+    int32_t slot;                    ///< Ring slot, or -1 for a one-shot region
+    DType dtype;
+    int8_t ndim;
+};
+
+struct TransportOptions {
+    int32_t slots = 8;
+    int64_t slot_bytes = int64_t{1} << 20;   ///< Rounded up to a page
+    int64_t timeout_ms = 30000;              ///< acquire() wait for a free slot; 0 waits forever
+};
+
+/**
+ * @brief A mapped memfd. Plain handle: close() releases it.
+ */
+struct SharedRegion {
+    int fd = -1;
+    char* base = nullptr;
+    int64_t bytes = 0;
+
+    /**
+     * @brief New zero-filled, size-sealed region of at least `size` bytes
+     */
+    static Status create(int64_t size, SharedRegion& out) noexcept {
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+        if (size <= 0) return status::invalid_argument("region size must be positive");
+        int fd = memfd_create("zero-tensor", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if (fd < 0) return status::allocation_failed("memfd_create failed");
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0 ||
+            fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+            ::close(fd);
+            return status::allocation_failed("cannot size memfd region");
+        }
+        return map(fd, size, out);
+#else
+        (void)size; (void)out;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "memfd transport needs Linux");
+#endif
+    }
+
+    /**
+     * @brief Map a received fd, taking ownership of it (closed on failure)
+     */
+    static Status adopt(int fd, SharedRegion& out) noexcept {
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+        struct stat st;
+        int seals = fcntl(fd, F_GET_SEALS);
+        if (seals < 0 || (seals & F_SEAL_SHRINK) == 0 || fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return status::invalid_argument("region fd is not a size-sealed memfd");
+        }
+        return map(fd, static_cast<int64_t>(st.st_size), out);
+#else
+        (void)fd; (void)out;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "memfd transport needs Linux");
+#endif
+    }
+
+    bool contains(int64_t lo, int64_t hi) const noexcept { return lo >= 0 && lo <= hi && hi <= bytes; }
+
+    void close() noexcept {
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+        if (base != nullptr) munmap(base, static_cast<size_t>(bytes));
+        if (fd >= 0) ::close(fd);
+#endif
+        fd = -1;
+        base = nullptr;
+        bytes = 0;
+    }
+
+private:
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+    static Status map(int fd, int64_t size, SharedRegion& out) noexcept {
+        void* p = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            return status::allocation_failed("cannot map memfd region");
+        }
+        out.fd = fd;
+        out.base = static_cast<char*>(p);
+        out.bytes = size;
+        return status::OK;
+    }
+#endif
+};
+
+namespace detail {
+
+enum class TransportKind : uint32_t {
+    TENSOR = 1,   ///< One-shot region; fd attached
+    RING = 2,     ///< Ring handshake; fd attached
+    SLOT = 3,     ///< Tensor in a ring slot; no fd
+};
+
+struct TransportMsg {
+    uint32_t magic;
+    TransportKind kind;
+    TensorDescriptor desc;
+};
+
+// Ring region header; the slots start at the next page.
+struct RingHeader {
+    uint32_t magic;
+    int32_t slots;
+    int64_t slot_bytes;
+    Doorbell door;                                   ///< Rung on every release
+    std::atomic<uint32_t> state[TRANSPORT_MAX_SLOTS];
+};
+
+constexpr uint32_t SLOT_FREE = 0;
+constexpr uint32_t SLOT_WRITING = 1;
+constexpr uint32_t SLOT_IN_FLIGHT = 2;
+
+constexpr int64_t ring_data_offset() noexcept {
+    return (static_cast<int64_t>(sizeof(RingHeader)) + TRANSPORT_PAGE - 1) / TRANSPORT_PAGE * TRANSPORT_PAGE;
+}
+
+inline Status describe(const Tensor& t, const char* base, int32_t slot, TensorDescriptor& d) noexcept {
+    if (t.device != Device::CPU || t.ndim < 0 || t.ndim > MAX_DIMS)
+        return status::invalid_argument("only CPU tensors can be sent");
+    std::memset(&d, 0, sizeof(d));
+    d.offset = static_cast<const char*>(t.data) - base;
+    d.slot = slot;
+    d.dtype = t.dtype;
+    d.ndim = t.ndim;
+    for (int8_t i = 0; i < t.ndim; ++i) {
+        d.shape[i] = t.shape[i];
+        d.strides[i] = t.strides[i];
+    }
+    return status::OK;
+}
+
+// Byte range [lo, hi) the descriptor touches; false if malformed.
+inline bool extent(const TensorDescriptor& d, int64_t& lo, int64_t& hi) noexcept {
+    int64_t elem = static_cast<int64_t>(dtype_size(d.dtype));
+    if (elem == 0 || d.ndim < 0 || d.ndim > MAX_DIMS) return false;
+    lo = hi = d.offset;
+    for (int8_t i = 0; i < d.ndim; ++i) {
+        if (d.shape[i] < 0) return false;
+        if (d.shape[i] == 0) {
+            hi = lo;
+            return true;
+        }
+        int64_t span = (d.shape[i] - 1) * d.strides[i];
+        if (span < 0) lo += span;
+        else hi += span;
+    }
+    hi += elem;
+    return true;
+}
+
+inline Tensor view_of(const TensorDescriptor& d, char* base) noexcept {
+    Tensor t = Tensor::wrap(base + d.offset, d.shape, d.ndim, d.dtype);
+    for (int8_t i = 0; i < d.ndim; ++i) t.strides[i] = d.strides[i];
+    return t;
+}
+
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+
+inline Status send_msg(int sock, const TransportMsg& m, int fd) noexcept {
+    const char* p = reinterpret_cast<const char*>(&m);
+    size_t left = sizeof(m);
+    bool attach = fd >= 0;
+    while (left > 0) {
+        iovec iov{const_cast<char*>(p), left};
+        msghdr h{};
+        h.msg_iov = &iov;
+        h.msg_iovlen = 1;
+        union {
+            cmsghdr align;
+            char buf[CMSG_SPACE(sizeof(int))];
+        } ctrl;
+        if (attach) {
+            std::memset(&ctrl, 0, sizeof(ctrl));
+            h.msg_control = ctrl.buf;
+            h.msg_controllen = sizeof(ctrl.buf);
+            cmsghdr* c = CMSG_FIRSTHDR(&h);
+            c->cmsg_level = SOL_SOCKET;
+            c->cmsg_type = SCM_RIGHTS;
+            c->cmsg_len = CMSG_LEN(sizeof(int));
+            std::memcpy(CMSG_DATA(c), &fd, sizeof(int));
+        }
+        ssize_t n = sendmsg(sock, &h, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return status::invalid_state("transport send failed");
+        }
+        attach = false;
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+    return status::OK;
+}
+
+// *fd receives an attached descriptor, or -1.
+inline Status recv_msg(int sock, TransportMsg& m, int* fd) noexcept {
+    char* p = reinterpret_cast<char*>(&m);
+    size_t left = sizeof(m);
+    *fd = -1;
+    while (left > 0) {
+        iovec iov{p, left};
+        msghdr h{};
+        h.msg_iov = &iov;
+        h.msg_iovlen = 1;
+        union {
+            cmsghdr align;
+            char buf[CMSG_SPACE(sizeof(int))];
+        } ctrl;
+        h.msg_control = ctrl.buf;
+        h.msg_controllen = sizeof(ctrl.buf);
+        ssize_t n = recvmsg(sock, &h, MSG_CMSG_CLOEXEC);
+        if (n < 0 && errno == EINTR) continue;
+        for (cmsghdr* c = n > 0 ? CMSG_FIRSTHDR(&h) : nullptr; c != nullptr; c = CMSG_NXTHDR(&h, c)) {
+            if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_RIGHTS) {
+                int got;
+                std::memcpy(&got, CMSG_DATA(c), sizeof(int));
+                if (*fd >= 0) ::close(*fd);
+                *fd = got;
+            }
+        }
+        if (n <= 0 || (h.msg_flags & MSG_CTRUNC) != 0) {
+            if (*fd >= 0) ::close(*fd);
+            *fd = -1;
+            return status::invalid_state(n == 0 ? "transport peer closed" : "transport receive failed");
+        }
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+    if (m.magic != TRANSPORT_MAGIC) {
+        if (*fd >= 0) ::close(*fd);
+        *fd = -1;
+        return status::invalid_argument("not a transport message");
+    }
+    return status::OK;
+}
+
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Allocate a tensor in its own memfd region (contiguous)
+ */
+inline Status memfd_tensor(const int64_t* shape, int8_t ndim, DType dtype, SharedRegion& region,
+                           Tensor& out) noexcept {
+    if (ndim < 0 || ndim > MAX_DIMS) return status::invalid_argument("ndim out of range");
+    int64_t bytes = static_cast<int64_t>(dtype_size(dtype));
+    for (int8_t i = 0; i < ndim; ++i) {
+        if (shape[i] < 0) return status::invalid_argument("negative dimension");
+        bytes *= shape[i];
+    }
+    if (Status s = SharedRegion::create(bytes > 0 ? bytes : 1, region); s.is_error()) return s;
+    out = Tensor::wrap(region.base, shape, ndim, dtype);
+    return status::OK;
+}
+
+/**
+ * @brief Send a view into `region`: its fd plus the descriptor
+ *
+ * The receiver shares the memory; nothing is copied.
+ */
+inline Status send_tensor(int sock, const SharedRegion& region, const Tensor& t) noexcept {
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+    if (region.base == nullptr) return status::invalid_state("region not mapped");
+    detail::TransportMsg m{};
+    m.magic = TRANSPORT_MAGIC;
+    m.kind = detail::TransportKind::TENSOR;
+    if (Status s = detail::describe(t, region.base, -1, m.desc); s.is_error()) return s;
+    int64_t lo, hi;
+    if (!detail::extent(m.desc, lo, hi) || !region.contains(lo, hi))
+        return status::out_of_bounds("tensor does not lie inside the region");
+    return detail::send_msg(sock, m, region.fd);
+#else
+    (void)sock; (void)region; (void)t;
+    return Status::error(StatusCode::NOT_IMPLEMENTED, "memfd transport needs Linux");
+#endif
+}
+
+/**
+ * @brief Receive a one-shot tensor; `out` views `region`, which the caller closes
+ */
+inline Status recv_tensor(int sock, SharedRegion& region, Tensor& out) noexcept {
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+    detail::TransportMsg m;
+    int fd = -1;
+    if (Status s = detail::recv_msg(sock, m, &fd); s.is_error()) return s;
+    if (m.kind != detail::TransportKind::TENSOR || fd < 0) {
+        if (fd >= 0) ::close(fd);
+        return status::invalid_state("expected a one-shot tensor message");
+    }
+    SharedRegion r;
+    if (Status s = SharedRegion::adopt(fd, r); s.is_error()) return s;
+    int64_t lo, hi;
+    if (!detail::extent(m.desc, lo, hi) || !r.contains(lo, hi)) {
+        r.close();
+        return status::out_of_bounds("descriptor outside the received region");
+    }
+    region = r;
+    out = detail::view_of(m.desc, region.base);
+    return status::OK;
+#else
+    (void)sock; (void)region; (void)out;
+    return Status::error(StatusCode::NOT_IMPLEMENTED, "memfd transport needs Linux");
+#endif
+}
+
+/**
+ * @brief Producer end of a slot ring
+ */
+struct TensorSender {
+    TensorSender() noexcept = default;
+    TensorSender(const TensorSender&) = delete;
+    TensorSender& operator=(const TensorSender&) = delete;
+    ~TensorSender() { close(); }
+
+    /**
+     * @brief Create the ring and hand its fd to the receiver on `sock`
+     */
+    Status init(int sock, TransportOptions opt = {}) noexcept {
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+        if (ring_ != nullptr) return status::invalid_state("sender already initialized");
+        if (opt.slots < 1 || opt.slots > TRANSPORT_MAX_SLOTS || opt.slot_bytes <= 0 || opt.timeout_ms < 0)
+            return status::invalid_argument("invalid transport options");
+        slot_bytes_ = (opt.slot_bytes + TRANSPORT_PAGE - 1) / TRANSPORT_PAGE * TRANSPORT_PAGE;
+        if (Status s = SharedRegion::create(detail::ring_data_offset() + slot_bytes_ * opt.slots, region_);
+            s.is_error())
+            return s;
+        ring_ = reinterpret_cast<detail::RingHeader*>(region_.base);
+        ring_->magic = TRANSPORT_MAGIC;
+        ring_->slots = opt.slots;
+        ring_->slot_bytes = slot_bytes_;
+        sock_ = sock;
+        slots_ = opt.slots;
+        timeout_ms_ = opt.timeout_ms;
+        next_ = 0;
+        detail::TransportMsg m{};
+        m.magic = TRANSPORT_MAGIC;
+        m.kind = detail::TransportKind::RING;
+        m.desc.slot = -1;
+        if (Status s = detail::send_msg(sock, m, region_.fd); s.is_error()) {
+            close();
+            return s;
+        }
+        return status::OK;
+#else
+        (void)sock; (void)opt;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "memfd transport needs Linux");
+#endif
+    }
+
+    void close() noexcept {
+        region_.close();
+        ring_ = nullptr;
+    }
+
+    int32_t slots() const noexcept { return slots_; }
+    int64_t slot_bytes() const noexcept { return slot_bytes_; }
+
+    /**
+     * @brief Claim a free slot and view it as a contiguous tensor
+     *
+     * Waits up to timeout_ms for the receiver to release one.
+     */
+    Status acquire(const int64_t* shape, int8_t ndim, DType dtype, Tensor& out) noexcept {
+        if (ring_ == nullptr) return status::invalid_state("sender not initialized");
+        if (ndim < 0 || ndim > MAX_DIMS) return status::invalid_argument("ndim out of range");
+        int64_t bytes = static_cast<int64_t>(dtype_size(dtype));
+        for (int8_t i = 0; i < ndim; ++i) {
+            if (shape[i] < 0) return status::invalid_argument("negative dimension");
+            bytes *= shape[i];
+        }
+        if (bytes > slot_bytes_) return status::invalid_argument("tensor larger than a transport slot");
+        int32_t got = -1;
+        auto claim = [&]() noexcept {
+            for (int32_t k = 0; k < slots_; ++k) {
+                int32_t s = (next_ + k) % slots_;
+                uint32_t expect = detail::SLOT_FREE;
+                if (ring_->state[s].compare_exchange_strong(expect, detail::SLOT_WRITING,
+                                                            std::memory_order_acquire)) {
+                    got = s;
+                    return true;
+                }
+            }
+            return false;
+        };
+        if (!ring_->door.wait(claim, deadline_after_ms(timeout_ms_)))
+            return status::invalid_state("no free transport slot");
+        next_ = (got + 1) % slots_;
+        out = Tensor::wrap(slot_base(got), shape, ndim, dtype);
+        return status::OK;
+    }
+
+    /**
+     * @brief Publish a view into an acquired slot; the slot is the receiver's until release
+     *
+     * If the message cannot be sent the slot stays acquired: send() may be
+     * retried, or abandon() returns the slot to the ring.
+     */
+    Status send(const Tensor& t) noexcept {
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+        if (ring_ == nullptr) return status::invalid_state("sender not initialized");
+        int32_t slot = -1;
+        if (Status s = slot_of(t, slot); s.is_error()) return s;
+        detail::TransportMsg m{};
+        m.magic = TRANSPORT_MAGIC;
+        m.kind = detail::TransportKind::SLOT;
+        if (Status s = detail::describe(t, region_.base, slot, m.desc); s.is_error()) return s;
+        int64_t lo, hi, slot_lo = slot_base(slot) - region_.base;
+        if (!detail::extent(m.desc, lo, hi) || lo < slot_lo || hi > slot_lo + slot_bytes_)
+            return status::out_of_bounds("tensor crosses its transport slot");
+        uint32_t expect = detail::SLOT_WRITING;
+        if (!ring_->state[slot].compare_exchange_strong(expect, detail::SLOT_IN_FLIGHT, std::memory_order_release))
+            return status::invalid_state("slot was not acquired");
+        if (Status s = detail::send_msg(sock_, m, -1); s.is_error()) {
+            // The receiver never got the descriptor, so the slot is still ours.
+            ring_->state[slot].store(detail::SLOT_WRITING, std::memory_order_relaxed);
+            return s;
+        }
+        return status::OK;
+#else
+        (void)t;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "memfd transport needs Linux");
+#endif
+    }
+
+    /**
+     * @brief Give an acquired, unsent slot back to the ring
+     */
+    Status abandon(const Tensor& t) noexcept {
+        if (ring_ == nullptr) return status::invalid_state("sender not initialized");
+        int32_t slot = -1;
+        if (Status s = slot_of(t, slot); s.is_error()) return s;
+        uint32_t expect = detail::SLOT_WRITING;
+        if (!ring_->state[slot].compare_exchange_strong(expect, detail::SLOT_FREE, std::memory_order_release))
+            return status::invalid_state("slot was not acquired");
+        ring_->door.ring();
+        return status::OK;
+    }
+
+private:
+    char* slot_base(int32_t s) const noexcept {
+        return region_.base + detail::ring_data_offset() + slot_bytes_ * s;
+    }
+
+    Status slot_of(const Tensor& t, int32_t& slot) const noexcept {
+        int64_t off = static_cast<const char*>(t.data) - slot_base(0);
+        if (t.data == nullptr || off < 0 || off >= slot_bytes_ * slots_)
+            return status::out_of_bounds("tensor is not in a transport slot");
+        slot = static_cast<int32_t>(off / slot_bytes_);
+        return status::OK;
+    }
+
+    SharedRegion region_;
+    detail::RingHeader* ring_ = nullptr;
+    int64_t slot_bytes_ = 0;
+    int64_t timeout_ms_ = 0;
+    int32_t slots_ = 0;
+    int32_t next_ = 0;
+    int sock_ = -1;
+};
+
+/**
+ * @brief Consumer end of a slot ring
+ */
+struct TensorReceiver {
+    TensorReceiver() noexcept = default;
+    TensorReceiver(const TensorReceiver&) = delete;
+    TensorReceiver& operator=(const TensorReceiver&) = delete;
+    ~TensorReceiver() { close(); }
+
+    /**
+     * @brief Block for the sender's ring handshake on `sock` and map the ring
+     */
+    Status init(int sock) noexcept {
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+        if (ring_ != nullptr) return status::invalid_state("receiver already initialized");
+        detail::TransportMsg m;
+        int fd = -1;
+        if (Status s = detail::recv_msg(sock, m, &fd); s.is_error()) return s;
+        if (m.kind != detail::TransportKind::RING || fd < 0) {
+            if (fd >= 0) ::close(fd);
+            return status::invalid_state("expected a ring handshake");
+        }
+        if (Status s = SharedRegion::adopt(fd, region_); s.is_error()) return s;
+        const detail::RingHeader* h = reinterpret_cast<const detail::RingHeader*>(region_.base);
+        if (region_.bytes < detail::ring_data_offset() || h->magic != TRANSPORT_MAGIC || h->slots < 1 ||
+            h->slots > TRANSPORT_MAX_SLOTS || h->slot_bytes <= 0 ||
+            h->slot_bytes > (region_.bytes - detail::ring_data_offset()) / h->slots) {
+            region_.close();
+            return status::invalid_argument("malformed transport ring");
+        }
+        ring_ = reinterpret_cast<detail::RingHeader*>(region_.base);
+        slots_ = h->slots;
+        slot_bytes_ = h->slot_bytes;
+        sock_ = sock;
+        return status::OK;
+#else
+        (void)sock;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "memfd transport needs Linux");
+#endif
+    }
+
+    void close() noexcept {
+        region_.close();
+        ring_ = nullptr;
+    }
+
+    /**
+     * @brief Block for the next tensor; `out` views its slot until release(out)
+     */
+    Status recv(Tensor& out) noexcept {
+#ifdef ZERO_HAS_MEMFD_TRANSPORT
+        if (ring_ == nullptr) return status::invalid_state("receiver not initialized");
+        detail::TransportMsg m;
+        int fd = -1;
+        if (Status s = detail::recv_msg(sock_, m, &fd); s.is_error()) return s;
+        if (fd >= 0) ::close(fd);
+        if (m.kind != detail::TransportKind::SLOT || m.desc.slot < 0 || m.desc.slot >= slots_)
+            return status::invalid_state("expected a ring slot message");
+        int64_t lo, hi, slot_lo = detail::ring_data_offset() + slot_bytes_ * m.desc.slot;
+        if (!detail::extent(m.desc, lo, hi) || lo < slot_lo || hi > slot_lo + slot_bytes_)
+            return status::out_of_bounds("descriptor outside its slot");
+        if (ring_->state[m.desc.slot].load(std::memory_order_acquire) != detail::SLOT_IN_FLIGHT)
+            return status::invalid_state("slot message for a slot not in flight");
+        out = detail::view_of(m.desc, region_.base);
+        return status::OK;
+#else
+        (void)out;
+        return Status::error(StatusCode::NOT_IMPLEMENTED, "memfd transport needs Linux");
+#endif
+    }
+
+    /**
+     * @brief Hand the slot under `t` back to the sender
+     */
+    Status release(const Tensor& t) noexcept {
+        if (ring_ == nullptr) return status::invalid_state("receiver not initialized");
+        int64_t off = static_cast<const char*>(t.data) - (region_.base + detail::ring_data_offset());
+        if (t.data == nullptr || off < 0 || off >= slot_bytes_ * slots_)
+            return status::out_of_bounds("tensor is not in a transport slot");
+        int32_t slot = static_cast<int32_t>(off / slot_bytes_);
+        uint32_t expect = detail::SLOT_IN_FLIGHT;
+        if (!ring_->state[slot].compare_exchange_strong(expect, detail::SLOT_FREE, std::memory_order_release))
+            return status::invalid_state("slot released twice");
+        ring_->door.ring();
+        return status::OK;
+    }
+
+private:
+    SharedRegion region_;
+    detail::RingHeader* ring_ = nullptr;
+    int64_t slot_bytes_ = 0;
+    int32_t slots_ = 0;
+    int sock_ = -1;
+};
+
+} // namespace ipc
+} // namespace zero
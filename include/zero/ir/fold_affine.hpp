@@ -0,0 +1,437 @@
+#pragma once
+
+/**
+ * @file fold_affine.hpp
+ * @brief Zero Core Runtime — Affine / BatchNorm Folding Pass
+ *
+ * Load-time rewrite of a layer chain. A per-channel affine transform or
+ * inference-mode batch norm that directly follows a linear layer is
+ * folded into that layer's weights and bias:
+ *
+ *   y_j = s_j * (x·W[:, j] + b_j) + t_j   =>   W'[:, j] = s_j * W[:, j]
+ *                                               b'_j    = s_j * b_j + t_j
+ *   batch norm:  s_j = gamma_j / sqrt(var_j + eps),  t_j = beta_j - mean_j * s_j
+ *
+ * The folded nodes are removed, so their elementwise passes disappear.
+ * Each fold is checked numerically against the original chain on a
+ * probe input before it is committed.
+ */
+
+#include "../core/status.hpp"
+#include "../core/tensor.hpp"
+#include "../ops/elementwise.hpp"
+#include "../ops/matmul.hpp"
+#include "op_kind.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+namespace zero {
+namespace ir {
+
+/// Maximum number of nodes in a LayerGraph
+constexpr int32_t MAX_LAYERS = 64;
+
+/**
+ * @brief Layer node types
+ */
+enum class LayerKind : uint8_t {
+    LINEAR = 0,       ///< y = x·W + b (gemm; HWIO conv filters lowered via im2col)
+    AFFINE = 1,       ///< y = x * scale + shift, per output channel
+    BATCH_NORM = 2,   ///< Inference-mode batch norm with fixed statistics
+    ACTIVATION = 3,   ///< Elementwise activation (RELU / SIGMOID / TANH)
+};
+
+/**
+ * @brief One node of a layer chain
+ *
+ * Channels are the last axis. A LINEAR weight is [..., N] with the
+ * output channel last, so a [K, N] gemm matrix and a [KH, KW, Cin, Cout]
+ * conv filter fold the same way. Per-channel parameters are F32 [N];
+ * an empty tensor means the identity (scale 1, shift 0, no bias).
+ * The graph owns every tensor it holds.
+ */
+struct LayerNode {
+    LayerKind kind;
+    OpKind act;       ///< ACTIVATION only
+    Tensor weight;    ///< LINEAR
+    Tensor bias;      ///< LINEAR
+    Tensor scale;     ///< AFFINE scale, BATCH_NORM gamma
+    Tensor shift;     ///< AFFINE shift, BATCH_NORM beta
+    Tensor mean;      ///< BATCH_NORM running mean
+    Tensor var;       ///< BATCH_NORM running variance
+    float eps;        ///< BATCH_NORM epsilon
+
+    LayerNode() noexcept
+        : kind(LayerKind::ACTIVATION), act(OpKind::RELU),
+          weight(Tensor::empty()), bias(Tensor::empty()),
+          scale(Tensor::empty()), shift(Tensor::empty()),
+          mean(Tensor::empty()), var(Tensor::empty()), eps(0.0f) {}
+
+    static LayerNode linear(const Tensor& w, const Tensor& b = Tensor::empty()) noexcept {
+        LayerNode n;
+        n.kind = LayerKind::LINEAR;
+        n.weight = w;
+        n.bias = b;
+        return n;
+    }
+
+    static LayerNode affine(const Tensor& scale, const Tensor& shift) noexcept {
+        LayerNode n;
+        n.kind = LayerKind::AFFINE;
+        n.scale = scale;
+        n.shift = shift;
+        return n;
+    }
+
+    static LayerNode batch_norm(const Tensor& gamma, const Tensor& beta,
+                                const Tensor& mean, const Tensor& var,
+                                float eps = 1e-5f) noexcept {
+        LayerNode n;
+        n.kind = LayerKind::BATCH_NORM;
+        n.scale = gamma;
+        n.shift = beta;
+        n.mean = mean;
+        n.var = var;
+        n.eps = eps;
+        return n;
+    }
+
+    static LayerNode activation(OpKind op) noexcept {
+        LayerNode n;
+        n.kind = LayerKind::ACTIVATION;
+        n.act = op;
+        return n;
+    }
+
+    /**
+     * @brief Output channels of a LINEAR node (last weight axis)
+     */
+    int64_t out_channels() const noexcept {
+        return weight.ndim > 0 ? weight.shape[weight.ndim - 1] : 0;
+    }
+
+    void free() noexcept {
+        weight.free(); bias.free();
+        scale.free(); shift.free();
+        mean.free(); var.free();
+    }
+};
+
+/**
+ * @brief A chain of layers, executed in order
+ */
+struct LayerGraph {
+    LayerNode nodes[MAX_LAYERS];
+    int32_t count = 0;
+
+    Status push(const LayerNode& node) noexcept {
+        if (count >= MAX_LAYERS) return status::out_of_bounds("layer graph is full");
+        nodes[count++] = node;
+        return status::OK;
+    }
+
+    /**
+     * @brief Remove nodes [first, first + n) and free their tensors
+     */
+    void erase(int32_t first, int32_t n) noexcept {
+        for (int32_t i = first; i < first + n; ++i) nodes[i].free();
+        for (int32_t i = first; i + n < count; ++i) nodes[i] = nodes[i + n];
+        count -= n;
+    }
+
+    void free() noexcept {
+        for (int32_t i = 0; i < count; ++i) nodes[i].free();
+        count = 0;
+    }
+};
+
+/**
+ * @brief Pass options
+ */
+struct FoldOptions {
+    bool verify = true;        ///< Check each fold on a probe before committing
+    int64_t probe_rows = 8;    ///< Rows of the generated probe input
+    float tol = 1e-4f;         ///< Max |ref - folded| / (1 + |ref|)
+};
+
+/**
+ * @brief What the pass did
+ */
+struct FoldReport {
+    int32_t folded_layers = 0;   ///< LINEAR nodes that absorbed a transform
+    int32_t removed_nodes = 0;   ///< AFFINE / BATCH_NORM nodes removed
+    float max_error = 0.0f;      ///< Largest verified error, same metric as tol
+};
+
+namespace detail {
+
+inline bool is_channel_param(const Tensor& t, int64_t n) noexcept {
+    return t.ndim == 1 && t.shape[0] == n && t.dtype == DType::F32 &&
+           t.device == Device::CPU && t.data != nullptr && t.is_contiguous();
+}
+
+inline bool foldable_linear(const LayerNode& node) noexcept {
+    return node.kind == LayerKind::LINEAR && node.weight.ndim >= 2 &&
+           node.weight.dtype == DType::F32 && node.weight.device == Device::CPU &&
+           node.weight.data != nullptr && node.weight.is_contiguous();
+}
+
+inline bool is_channel_transform(const LayerNode& node) noexcept {
+    return node.kind == LayerKind::AFFINE || node.kind == LayerKind::BATCH_NORM;
+}
+
+// Parameter check for one AFFINE / BATCH_NORM node over n channels.
+inline Status validate_transform(const LayerNode& node, int64_t n) noexcept {
+    bool scale_ok = node.scale.data == nullptr ? node.kind == LayerKind::AFFINE
+                                               : is_channel_param(node.scale, n);
+    bool shift_ok = node.shift.data == nullptr ? node.kind == LayerKind::AFFINE
+                                               : is_channel_param(node.shift, n);
+    if (!scale_ok || !shift_ok)
+        return status::invalid_argument("per-channel parameter must be F32 [out_channels]");
+    if (node.kind == LayerKind::BATCH_NORM) {
+        if (!is_channel_param(node.mean, n) || !is_channel_param(node.var, n))
+            return status::invalid_argument("batch norm statistics must be F32 [out_channels]");
+        const float* v = static_cast<const float*>(node.var.data);
+        for (int64_t j = 0; j < n; ++j)
+            if (!(static_cast<double>(v[j]) + node.eps > 0.0))
+                return status::invalid_argument("batch norm var + eps must be positive");
+    }
+    return status::OK;
+}
+
+inline float param_at(const Tensor& t, int64_t j, float fallback) noexcept {
+    return t.data == nullptr ? fallback : static_cast<const float*>(t.data)[j];
+}
+
+// y = y * s + t per channel, in place on a contiguous [M, N] buffer.
+inline void apply_transform(const LayerNode& node, float* y, int64_t m, int64_t n) noexcept {
+    for (int64_t j = 0; j < n; ++j) {
+        float s = param_at(node.scale, j, 1.0f);
+        float t = param_at(node.shift, j, 0.0f);
+        if (node.kind == LayerKind::BATCH_NORM) {
+            float inv = 1.0f / std::sqrt(param_at(node.var, j, 1.0f) + node.eps);
+            float mu = param_at(node.mean, j, 0.0f);
+            for (int64_t i = 0; i < m; ++i) y[i * n + j] = (y[i * n + j] - mu) * inv * s + t;
+        } else {
+            for (int64_t i = 0; i < m; ++i) y[i * n + j] = y[i * n + j] * s + t;
+        }
+    }
+}
+
+// Run nodes [first, last) of g on x [M, K]. out receives a fresh [M, N] tensor.
+inline Status run_range(const LayerGraph& g, int32_t first, int32_t last,
+                        const Tensor& x, Tensor& out) noexcept {
+    if (x.ndim != 2 || x.dtype != DType::F32 || x.data == nullptr || !x.is_contiguous())
+        return status::invalid_argument("input must be contiguous F32 [rows, features]");
+    int64_t m = x.shape[0];
+    Tensor cur = x.clone();
+    if (cur.data == nullptr) return status::allocation_failed("layer activation");
+    for (int32_t i = first; i < last; ++i) {
+        const LayerNode& node = g.nodes[i];
+        int64_t width = cur.shape[1];
+        float* y = static_cast<float*>(cur.data);
+        switch (node.kind) {
+            case LayerKind::LINEAR: {
+                if (node.weight.ndim < 2 || node.weight.data == nullptr) {
+                    cur.free();
+                    return status::invalid_argument("linear layer without weights");
+                }
+                int64_t n = node.out_channels();
+                int64_t w2[2] = {node.weight.numel() / n, n};
+                int64_t o2[2] = {m, n};
+                Tensor next = Tensor::alloc(o2, 2, DType::F32);
+                if (next.data == nullptr) {
+                    cur.free();
+                    return status::allocation_failed("layer activation");
+                }
+                // A weight view with no [K, N] strides is gathered once
+                Tensor w = node.weight.reshape(w2, 2);
+                if (w.data == nullptr && node.weight.same_numel(w2, 2)) {
+                    w = node.weight.reshape_copy(w2, 2);
+                    if (w.data == nullptr) {
+                        cur.free();
+                        next.free();
+                        return status::allocation_failed("linear weight");
+                    }
+                }
+                Status s = ops::matmul(cur, w, next);
+                w.free();   // no-op on a view
+                cur.free();
+                if (s.is_error()) {
+                    next.free();
+                    return s;
+                }
+                cur = next;
+                if (node.bias.data != nullptr) {
+                    if (!is_channel_param(node.bias, n)) {
+                        cur.free();
+                        return status::invalid_argument("bias must be F32 [out_channels]");
+                    }
+                    float* out_p = static_cast<float*>(cur.data);
+                    const float* b = static_cast<const float*>(node.bias.data);
+                    for (int64_t r = 0; r < m; ++r)
+                        for (int64_t j = 0; j < n; ++j) out_p[r * n + j] += b[j];
+                }
+                break;
+            }
+            case LayerKind::AFFINE:
+            case LayerKind::BATCH_NORM:
+                if (Status s = validate_transform(node, width); s.is_error()) {
+                    cur.free();
+                    return s;
+                }
+                apply_transform(node, y, m, width);
+                break;
+            case LayerKind::ACTIVATION:
+                if (!is_activation(node.act)) {
+                    cur.free();
+                    return status::invalid_argument("activation node needs RELU, SIGMOID or TANH");
+                }
+                if (Status s = ops::unary_op(cur, cur, static_cast<ops::ElementwiseOp>(node.act));
+                    s.is_error()) {
+                    cur.free();
+                    return s;
+                }
+                break;
+        }
+    }
+    out = cur;
+    return status::OK;
+}
+
+// Deterministic probe in [-1, 1).
+inline void fill_probe(Tensor& t) noexcept {
+    float* p = static_cast<float*>(t.data);
+    uint32_t state = 0x9E3779B9u;
+    for (int64_t i = 0; i < t.numel(); ++i) {
+        state = state * 1664525u + 1013904223u;
+        p[i] = static_cast<float>(state >> 8) / static_cast<float>(1u << 23) - 1.0f;
+    }
+}
+
+// Fold nodes [first + 1, last) into the LINEAR node at first.
+inline Status fold_segment(LayerGraph& g, int32_t first, int32_t last,
+                           const FoldOptions& opt, FoldReport& report) noexcept {
+    LayerNode& lin = g.nodes[first];
+    int64_t n = lin.out_channels();
+    int64_t k = lin.weight.numel() / n;
+    if (lin.bias.data != nullptr && !is_channel_param(lin.bias, n))
+        return status::invalid_argument("bias must be F32 [out_channels]");
+    for (int32_t i = first + 1; i < last; ++i)
+        if (Status s = validate_transform(g.nodes[i], n); s.is_error()) return s;
+
+    Tensor w = lin.weight.clone();
+    int64_t bshape[1] = {n};
+    Tensor b = Tensor::alloc(bshape, 1, DType::F32);
+    if (w.data == nullptr || b.data == nullptr) {
+        w.free(); b.free();
+        return status::allocation_failed("folded weights");
+    }
+
+    // Compose the chain per channel in double: y = s * (x·W) + t.
+    float* wp = static_cast<float*>(w.data);
+    float* bp = static_cast<float*>(b.data);
+    for (int64_t j = 0; j < n; ++j) {
+        double s = 1.0;
+        double t = param_at(lin.bias, j, 0.0f);
+        for (int32_t i = first + 1; i < last; ++i) {
+            const LayerNode& node = g.nodes[i];
+            double a = param_at(node.scale, j, 1.0f);
+            double c = param_at(node.shift, j, 0.0f);
+            if (node.kind == LayerKind::BATCH_NORM) {
+                double inv = 1.0 / std::sqrt(static_cast<double>(param_at(node.var, j, 1.0f)) + node.eps);
+                t -= param_at(node.mean, j, 0.0f);
+                a *= inv;
+            }
+            s *= a;
+            t = t * a + c;
+        }
+        for (int64_t r = 0; r < k; ++r) wp[r * n + j] = static_cast<float>(wp[r * n + j] * s);
+        bp[j] = static_cast<float>(t);
+    }
+
+    if (opt.verify) {
+        int64_t pshape[2] = {opt.probe_rows > 0 ? opt.probe_rows : 1, k};
+        Tensor probe = Tensor::alloc(pshape, 2, DType::F32);
+        if (probe.data == nullptr) {
+            w.free(); b.free();
+            return status::allocation_failed("fold probe");
+        }
+        fill_probe(probe);
+
+        LayerGraph folded;
+        folded.nodes[0] = LayerNode::linear(w, b);
+        folded.count = 1;
+        Tensor ref = Tensor::empty();
+        Tensor got = Tensor::empty();
+        Status s = run_range(g, first, last, probe, ref);
+        if (s.is_ok()) s = run_range(folded, 0, 1, probe, got);
+        probe.free();
+        float err = 0.0f;
+        if (s.is_ok()) {
+            const float* rp = static_cast<const float*>(ref.data);
+            const float* gp = static_cast<const float*>(got.data);
+            for (int64_t i = 0; i < ref.numel(); ++i) {
+                float e = std::fabs(rp[i] - gp[i]) / (1.0f + std::fabs(rp[i]));
+                if (!(e <= err)) err = e;   // NaN propagates as a failure
+            }
+        }
+        ref.free();
+        got.free();
+        if (s.is_ok() && !(err <= opt.tol))
+            s = status::invalid_state("folded layer diverges from the original chain");
+        if (s.is_error()) {
+            w.free(); b.free();
+            return s;
+        }
+        if (err > report.max_error) report.max_error = err;
+    }
+
+    lin.weight.free();
+    lin.bias.free();
+    lin.weight = w;
+    lin.bias = b;
+    g.erase(first + 1, last - first - 1);
+    report.folded_layers += 1;
+    report.removed_nodes += last - first - 1;
+    return status::OK;
+}
+
+} // namespace detail
+
+/**
+ * @brief Run the chain on x [M, K]; out is allocated as [M, N] (caller frees)
+ *
+ * Reference executor for load-time checks and tests.
+ */
+inline Status run_layers(const LayerGraph& g, const Tensor& x, Tensor& out) noexcept {
+    return detail::run_range(g, 0, g.count, x, out);
+}
+
+/**
+ * @brief Fold AFFINE / BATCH_NORM nodes into the LINEAR node before them
+ *
+ * A fold applies when one or more transforms directly follow a LINEAR
+ * node with contiguous F32 weights; an activation or a non-F32 weight
+ * ends the match. Malformed parameters fail with INVALID_ARGUMENT and a
+ * fold that does not reproduce the original chain within opt.tol fails
+ * with INVALID_STATE. On failure the failing segment is left unchanged;
+ * segments before it stay folded, so the graph is always equivalent.
+ */
+inline Status fold_affine(LayerGraph& g, FoldReport* report = nullptr,
+                          const FoldOptions& opt = FoldOptions{}) noexcept {
+    FoldReport local;
+    FoldReport& r = report != nullptr ? *report : local;
+    for (int32_t i = 0; i < g.count; ++i) {
+        if (!detail::foldable_linear(g.nodes[i])) continue;
+        int32_t end = i + 1;
+        while (end < g.count && detail::is_channel_transform(g.nodes[end])) ++end;
+        if (end == i + 1) continue;
+        if (Status s = detail::fold_segment(g, i, end, opt, r); s.is_error()) return s;
+    }
+    return status::OK;
+}
+
+} // namespace ir
+} // namespace zero
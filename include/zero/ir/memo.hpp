@@ -0,0 +1,450 @@
+#pragma once
+
+/**
+ * @file memo.hpp
+ * @brief Zero Core Runtime — Result Cache for Pure Functions
+ *
+ * Opt-in memoization of ir::Function calls. A call to a pure function
+ * is keyed by a 64-bit content hash (kernels::hash_bytes) of its entry
+ * point, its signature and every input: dtype, shape and bytes for
+ * tensors, dtype and value bytes for scalars. A hit returns the cached
+ * outputs as shared views (Tensor::share, spec 010) without running the
+ * function. A miss runs it and keeps a copy of the outputs.
+ *
+ * The cache is bounded by a byte budget and an entry count, and evicts
+ * the least recently used entry first. By default each entry also keeps
+ * its inputs, so a hash collision is detected and treated as a miss.
+ */
+
+#include "../core/memory.hpp"
+#include "../core/scalar.hpp"
+#include "../core/status.hpp"
+#include "../core/tensor.hpp"
+#include "../kernels/kernels.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+#include "function.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace zero {
+namespace ir {
+
+/// Upper bound on MemoOptions::max_entries
+constexpr int64_t MEMO_MAX_ENTRIES = int64_t{1} << 20;
+
+struct MemoOptions {
+    int64_t memory_budget = int64_t{64} << 20;  ///< Cached outputs plus input copies, in bytes
+    int64_t max_entries = 1024;
+    bool verify_inputs = true;                  ///< Keep inputs and compare them on a hit
+};
+
+struct MemoStats {
+    int64_t hits;
+    int64_t misses;
+    int64_t collisions;   ///< Hash matched, inputs differed (verify_inputs only)
+    int64_t evictions;
+    int64_t uncacheable;  ///< Run directly: impure, or an argument that cannot be keyed
+    int64_t entries;
+    int64_t bytes;
+};
+
+namespace detail {
+
+/**
+ * @brief Visit the byte segments that identify a call's inputs, in order
+ *
+ * Returns false if an input is missing, off the CPU or strided; such a
+ * call is not cached. Empty segments are skipped.
+ */
+template <typename Fn>
+inline bool for_each_input(const FunctionSig& sig, const FunctionCall& call, Fn&& fn) noexcept {
+    for (int8_t i = 0; i < sig.num_inputs; ++i) {
+        int64_t head[2 + MAX_DIMS];
+        if (sig.args[i].is_tensor) {
+            const Tensor* t = call.get_tensor(i);
+            if (t == nullptr || t->device != Device::CPU || !t->is_contiguous()) return false;
+            head[0] = static_cast<int64_t>(t->dtype);
+            head[1] = t->ndim;
+            for (int8_t d = 0; d < t->ndim; ++d) head[2 + d] = t->shape[d];
+            fn(head, (2 + t->ndim) * static_cast<int64_t>(sizeof(int64_t)));
+            int64_t bytes = static_cast<int64_t>(t->nbytes());
+            if (bytes > 0) fn(t->data, bytes);
+        } else {
+            const Scalar* s = call.get_scalar(i);
+            if (s == nullptr) return false;
+            // Value bytes only: the union's tail beyond dtype_size is unspecified
+            head[0] = static_cast<int64_t>(s->dtype);
+            head[1] = -1;
+            fn(head, 2 * static_cast<int64_t>(sizeof(int64_t)));
+            fn(&s->value, static_cast<int64_t>(dtype_size(s->dtype)));
+        }
+    }
+    return true;
+}
+
+/// Seed from the entry point and the signature's name and argument layout.
+inline uint64_t signature_seed(const Function& f) noexcept {
+    const FunctionSig& sig = f.signature;
+    int64_t desc[3 + 3 * MAX_FUNC_ARGS];
+    int64_t n = 0;
+    uintptr_t ep = reinterpret_cast<uintptr_t>(f.entry_point);
+    desc[n++] = static_cast<int64_t>(ep);
+    desc[n++] = sig.num_inputs;
+    desc[n++] = sig.num_outputs;
+    for (int8_t i = 0; i < sig.total_args(); ++i) {
+        desc[n++] = sig.args[i].is_tensor;
+        desc[n++] = static_cast<int64_t>(sig.args[i].dtype);
+        desc[n++] = sig.args[i].is_output;
+    }
+    uint64_t h = kernels::hash_bytes(reinterpret_cast<const uint8_t*>(desc),
+                                     n * static_cast<int64_t>(sizeof(int64_t)), 0);
+    if (sig.name != nullptr)
+        h = kernels::hash_bytes(reinterpret_cast<const uint8_t*>(sig.name),
+                                static_cast<int64_t>(std::strlen(sig.name)), h);
+    return h;
+}
+
+} // namespace detail
+
+/**
+ * @brief Bounded LRU result cache for pure functions
+ *
+ * Thread-safe. Lookups and inserts take an internal lock; the function
+ * itself runs outside it, so two threads missing on the same key both
+ * run it and the second insert is dropped.
+ *
+ * Output slots on a hit:
+ *   - an empty or storage-backed tensor drops its reference and becomes
+ *     a shared view of the cached output (no copy);
+ *   - any other tensor is a caller buffer and receives a copy, which
+ *     requires matching dtype and shape (TYPE_MISMATCH otherwise);
+ *   - scalars are copied.
+ *
+ * Shared views follow the COW contract: write through make_writable().
+ * call() does this itself for output slots before it runs the function.
+ */
+class MemoCache {
+public:
+    MemoCache() noexcept = default;
+    MemoCache(const MemoCache&) = delete;
+    MemoCache& operator=(const MemoCache&) = delete;
+    ~MemoCache() { close(); }
+
+    Status init(const MemoOptions& opt = {}) noexcept {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (entries_ != nullptr) return status::invalid_state("memo cache already initialized");
+        if (opt.memory_budget < 0) return status::invalid_argument("memo: negative memory budget");
+        if (opt.max_entries < 1 || opt.max_entries > MEMO_MAX_ENTRIES)
+            return status::invalid_argument("memo: max_entries out of range");
+
+        int64_t buckets = 1;
+        while (buckets < 2 * opt.max_entries) buckets <<= 1;
+        entries_ = static_cast<Entry*>(mem_alloc(static_cast<size_t>(opt.max_entries) * sizeof(Entry),
+                                                 alignof(Entry), Device::CPU));
+        buckets_ = static_cast<int32_t*>(mem_alloc(static_cast<size_t>(buckets) * sizeof(int32_t),
+                                                   alignof(int32_t), Device::CPU));
+        if (entries_ == nullptr || buckets_ == nullptr) {
+            release_arrays();
+            return status::allocation_failed("memo: table allocation failed");
+        }
+        opt_ = opt;
+        mask_ = static_cast<uint64_t>(buckets - 1);
+        reset_table();
+        return status::OK;
+    }
+
+    /// Drop every entry (outstanding shared views stay valid).
+    void clear() noexcept {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (entries_ == nullptr) return;
+        for (int32_t e = head_; e >= 0; e = entries_[e].next) drop(entries_[e]);
+        reset_table();
+    }
+
+    void close() noexcept {
+        clear();
+        std::lock_guard<std::mutex> lock(mu_);
+        release_arrays();
+        stats_ = {};
+    }
+
+    MemoStats stats() const noexcept {
+        std::lock_guard<std::mutex> lock(mu_);
+        return stats_;
+    }
+
+    /**
+     * @brief Run `fn` on `call`, or serve its outputs from the cache
+     *
+     * Impure functions and calls with a missing, non-CPU or strided input
+     * run directly. `hit` (optional) reports whether the function was
+     * skipped.
+     */
+    Status call(const Function& fn, FunctionCall* call, bool* hit = nullptr) noexcept {
+        if (hit != nullptr) *hit = false;
+        if (call == nullptr || fn.entry_point == nullptr)
+            return status::invalid_argument("memo: null call or entry point");
+        if (entries_ == nullptr) return status::invalid_state("memo cache not initialized");
+        const FunctionSig& sig = fn.signature;
+
+        for (int8_t o = 0; o < sig.num_outputs; ++o) {
+            int8_t idx = static_cast<int8_t>(sig.num_inputs + o);
+            if (call->arg_ptrs[idx] == nullptr) return status::invalid_argument("memo: missing output argument");
+        }
+
+        uint64_t key = detail::signature_seed(fn);
+        int64_t input_bytes = 0;
+        bool keyed = sig.is_pure && detail::for_each_input(sig, *call, [&](const void* p, int64_t n) {
+            key = kernels::hash_bytes(static_cast<const uint8_t*>(p), n, key);
+            input_bytes += n;
+        });
+
+        if (keyed) {
+            std::lock_guard<std::mutex> lock(mu_);
+            int32_t e = find(key, fn, *call, input_bytes);
+            if (e >= 0) {
+                if (Status s = deliver(entries_[e], sig, *call); s.is_error()) return s;
+                touch(e);
+                ++stats_.hits;
+                ZERO_CACHE_METRICS(telemetry::RuntimeSite::MEMO, true);
+                if (hit != nullptr) *hit = true;
+                return status::OK;
+            }
+            ++stats_.misses;
+            ZERO_CACHE_METRICS(telemetry::RuntimeSite::MEMO, false);
+        } else {
+            std::lock_guard<std::mutex> lock(mu_);
+            ++stats_.uncacheable;
+        }
+
+        for (int8_t o = 0; o < sig.num_outputs; ++o) {
+            int8_t idx = static_cast<int8_t>(sig.num_inputs + o);
+            if (!sig.args[idx].is_tensor) continue;
+            if (Status s = call->get_tensor(idx)->make_writable(); s.is_error()) return s;
+        }
+        fn(call);
+        if (keyed) insert(key, fn, *call, input_bytes);
+        return status::OK;
+    }
+
+private:
+    struct Entry {
+        uint64_t key;
+        CompiledFn fn;
+        void* block;           ///< [Tensor × outs][Scalar × outs][input copy]
+        Tensor* outs;
+        Scalar* scalars;
+        uint8_t* inputs;       ///< nullptr without verify_inputs
+        int64_t input_bytes;
+        int64_t bytes;         ///< Charged against the budget
+        int8_t num_outputs;
+        int32_t chain;         ///< Next entry in the bucket, or free list
+        int32_t prev, next;    ///< LRU neighbours (head = most recent)
+    };
+
+    void release_arrays() noexcept {
+        if (entries_ != nullptr) mem_free(entries_, Device::CPU);
+        if (buckets_ != nullptr) mem_free(buckets_, Device::CPU);
+        entries_ = nullptr;
+        buckets_ = nullptr;
+    }
+
+    void reset_table() noexcept {
+        for (uint64_t b = 0; b <= mask_; ++b) buckets_[b] = -1;
+        for (int64_t i = 0; i < opt_.max_entries; ++i) {
+            new (&entries_[i]) Entry{};
+            entries_[i].chain = i + 1 < opt_.max_entries ? static_cast<int32_t>(i + 1) : -1;
+        }
+        free_ = 0;
+        head_ = tail_ = -1;
+        stats_.entries = 0;
+        stats_.bytes = 0;
+    }
+
+    static void drop(Entry& e) noexcept {
+        for (int8_t o = 0; o < e.num_outputs; ++o) e.outs[o].free();
+        mem_free(e.block, Device::CPU);
+        e.block = nullptr;
+    }
+
+    int32_t find(uint64_t key, const Function& fn, const FunctionCall& call, int64_t input_bytes) noexcept {
+        for (int32_t e = buckets_[key & mask_]; e >= 0; e = entries_[e].chain) {
+            const Entry& ent = entries_[e];
+            if (ent.key != key || ent.fn != fn.entry_point) continue;
+            if (ent.inputs == nullptr) return e;
+            bool same = ent.input_bytes == input_bytes;
+            int64_t pos = 0;
+            if (same) {
+                detail::for_each_input(fn.signature, call, [&](const void* p, int64_t n) {
+                    if (same) same = std::memcmp(ent.inputs + pos, p, static_cast<size_t>(n)) == 0;
+                    pos += n;
+                });
+            }
+            if (same) return e;
+            ++stats_.collisions;
+        }
+        return -1;
+    }
+
+    static Status deliver(const Entry& e, const FunctionSig& sig, FunctionCall& call) noexcept {
+        // Validate every slot before touching any of them
+        for (int8_t o = 0; o < e.num_outputs; ++o) {
+            if (!sig.args[sig.num_inputs + o].is_tensor) continue;
+            const Tensor* dst = call.get_tensor(static_cast<int8_t>(sig.num_inputs + o));
+            if (dst->data == nullptr || dst->storage != nullptr) continue;
+            const Tensor& src = e.outs[o];
+            bool same = dst->dtype == src.dtype && dst->ndim == src.ndim && dst->device == Device::CPU &&
+                        dst->is_contiguous();
+            for (int8_t d = 0; same && d < src.ndim; ++d) same = dst->shape[d] == src.shape[d];
+            if (!same) return status::type_mismatch("memo: output buffer does not match the cached result");
+        }
+        for (int8_t o = 0; o < e.num_outputs; ++o) {
+            int8_t idx = static_cast<int8_t>(sig.num_inputs + o);
+            if (!sig.args[idx].is_tensor) {
+                *call.get_scalar(idx) = e.scalars[o];
+                continue;
+            }
+            Tensor* dst = call.get_tensor(idx);
+            if (dst->data == nullptr || dst->storage != nullptr) {
+                dst->free();
+                *dst = e.outs[o].share();
+            } else if (e.outs[o].nbytes() > 0) {
+                std::memcpy(dst->data, e.outs[o].data, e.outs[o].nbytes());
+            }
+        }
+        return status::OK;
+    }
+
+    void insert(uint64_t key, const Function& fn, const FunctionCall& call, int64_t input_bytes) noexcept {
+        const FunctionSig& sig = fn.signature;
+        int64_t no = sig.num_outputs;
+        int64_t copy_bytes = opt_.verify_inputs ? input_bytes : 0;
+        size_t head = static_cast<size_t>(no) * (sizeof(Tensor) + sizeof(Scalar));
+        int64_t bytes = static_cast<int64_t>(head + sizeof(Entry)) + copy_bytes;
+        for (int8_t o = 0; o < no; ++o) {
+            int8_t idx = static_cast<int8_t>(sig.num_inputs + o);
+            if (!sig.args[idx].is_tensor) continue;
+            const Tensor* t = call.get_tensor(idx);
+            // Strided results would need a gather on every hit; not cached
+            if (t->device != Device::CPU || !t->is_contiguous()) return;
+            bytes += static_cast<int64_t>(t->nbytes());
+        }
+        if (bytes > opt_.memory_budget) return;
+
+        void* block = mem_alloc(head + static_cast<size_t>(copy_bytes), alignof(Tensor), Device::CPU);
+        if (block == nullptr) return;
+        auto* outs = static_cast<Tensor*>(block);
+        auto* scalars = reinterpret_cast<Scalar*>(outs + no);
+        uint8_t* inputs = opt_.verify_inputs ? reinterpret_cast<uint8_t*>(scalars + no) : nullptr;
+        for (int8_t o = 0; o < no; ++o) {
+            int8_t idx = static_cast<int8_t>(sig.num_inputs + o);
+            new (&outs[o]) Tensor(Tensor::empty());
+            new (&scalars[o]) Scalar{};
+            if (!sig.args[idx].is_tensor) {
+                scalars[o] = *call.get_scalar(idx);
+                continue;
+            }
+            const Tensor* t = call.get_tensor(idx);
+            if (t->storage != nullptr) {
+                outs[o] = t->share();
+                continue;
+            }
+            outs[o] = Tensor::alloc_shared(t->shape.data(), t->ndim, t->dtype);
+            if (outs[o].data == nullptr && t->nbytes() > 0) {
+                for (int8_t k = 0; k <= o; ++k) outs[k].free();
+                mem_free(block, Device::CPU);
+                return;
+            }
+            if (t->nbytes() > 0) std::memcpy(outs[o].data, t->data, t->nbytes());
+        }
+        if (inputs != nullptr) {
+            int64_t pos = 0;
+            detail::for_each_input(sig, call, [&](const void* p, int64_t n) {
+                std::memcpy(inputs + pos, p, static_cast<size_t>(n));
+                pos += n;
+            });
+        }
+
+        std::lock_guard<std::mutex> lock(mu_);
+        for (int32_t e = buckets_[key & mask_]; e >= 0; e = entries_[e].chain) {
+            const Entry& ent = entries_[e];
+            bool dup = ent.key == key && ent.fn == fn.entry_point && ent.input_bytes == input_bytes &&
+                       (inputs == nullptr || ent.inputs == nullptr ||
+                        std::memcmp(ent.inputs, inputs, static_cast<size_t>(input_bytes)) == 0);
+            if (!dup) continue;
+            // Another thread stored this result first
+            for (int8_t o = 0; o < no; ++o) outs[o].free();
+            mem_free(block, Device::CPU);
+            return;
+        }
+        while (free_ < 0 || stats_.bytes + bytes > opt_.memory_budget) evict_lru();
+
+        int32_t e = free_;
+        Entry& ent = entries_[e];
+        free_ = ent.chain;
+        ent.key = key;
+        ent.fn = fn.entry_point;
+        ent.block = block;
+        ent.outs = outs;
+        ent.scalars = scalars;
+        ent.inputs = inputs;
+        ent.input_bytes = input_bytes;
+        ent.bytes = bytes;
+        ent.num_outputs = static_cast<int8_t>(no);
+        ent.chain = buckets_[key & mask_];
+        buckets_[key & mask_] = e;
+        ent.prev = -1;
+        ent.next = head_;
+        if (head_ >= 0) entries_[head_].prev = e;
+        head_ = e;
+        if (tail_ < 0) tail_ = e;
+        ++stats_.entries;
+        stats_.bytes += bytes;
+    }
+
+    void unlink(int32_t e) noexcept {
+        Entry& ent = entries_[e];
+        if (ent.prev >= 0) entries_[ent.prev].next = ent.next; else head_ = ent.next;
+        if (ent.next >= 0) entries_[ent.next].prev = ent.prev; else tail_ = ent.prev;
+    }
+
+    void touch(int32_t e) noexcept {
+        if (head_ == e) return;
+        unlink(e);
+        entries_[e].prev = -1;
+        entries_[e].next = head_;
+        entries_[head_].prev = e;
+        head_ = e;
+    }
+
+    void evict_lru() noexcept {
+        int32_t e = tail_;
+        Entry& ent = entries_[e];
+        unlink(e);
+        int32_t* link = &buckets_[ent.key & mask_];
+        while (*link != e) link = &entries_[*link].chain;
+        *link = ent.chain;
+        stats_.bytes -= ent.bytes;
+        --stats_.entries;
+        ++stats_.evictions;
+        drop(ent);
+        ent.chain = free_;
+        free_ = e;
+    }
+
+    MemoOptions opt_{};
+    mutable std::mutex mu_;
+    Entry* entries_ = nullptr;
+    int32_t* buckets_ = nullptr;
+    uint64_t mask_ = 0;
+    int32_t free_ = -1;
+    int32_t head_ = -1;
+    int32_t tail_ = -1;
+    MemoStats stats_{};
+};
+
+} // namespace ir
+} // namespace zero
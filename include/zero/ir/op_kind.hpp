@@ -8,6 +8,8 @@
  * No execution logic, no scheduling — just naming.
  * 
  * v1.1: Added activation ops (RELU, SIGMOID, TANH)
+ * v1.2: Added EMBEDDING_BAG, ROPE
+ * v1.3: Added MoE routing kinds (MOE_GATE .. MOE_UNPERMUTE)
  */
 
 #include <cstdint>
@@ -44,6 +46,15 @@ enum class OpKind : uint8_t {
     RELU = 12,
     SIGMOID = 13,
     
+    // Positional
+    ROPE = 14,
+    
+    // Mixture-of-experts routing
+    MOE_GATE = 16,       // Softmax + top-k over experts
+    MOE_ROUTE = 17,      // Tokens-per-expert offsets
+    MOE_PERMUTE = 18,
+    MOE_UNPERMUTE = 19,
+    
     // Matrix operations
     MATMUL = 20,
     MATVEC = 21,
@@ -53,6 +64,8 @@ enum class OpKind : uint8_t {
     MEAN = 31,
     MAX = 32,
     MIN = 33,
+    EMBEDDING_BAG = 34,  // Gather + pool over CSR bags
+    PROD = 35,
     
     // Memory operations
     LOAD = 40,
@@ -85,12 +98,19 @@ constexpr const char* op_kind_name(OpKind kind) noexcept {
         case OpKind::TANH:    return "tanh";
         case OpKind::RELU:    return "relu";
         case OpKind::SIGMOID: return "sigmoid";
+        case OpKind::ROPE:    return "rope";
+        case OpKind::MOE_GATE:      return "moe_gate";
+        case OpKind::MOE_ROUTE:     return "moe_route";
+        case OpKind::MOE_PERMUTE:   return "moe_permute";
+        case OpKind::MOE_UNPERMUTE: return "moe_unpermute";
         case OpKind::MATMUL:  return "matmul";
         case OpKind::MATVEC:  return "matvec";
         case OpKind::SUM:     return "sum";
         case OpKind::MEAN:    return "mean";
         case OpKind::MAX:     return "max";
         case OpKind::MIN:     return "min";
+        case OpKind::EMBEDDING_BAG: return "embedding_bag";
+        case OpKind::PROD:    return "prod";
         case OpKind::LOAD:    return "load";
         case OpKind::STORE:   return "store";
         case OpKind::ALLOC:   return "alloc";
@@ -0,0 +1,373 @@
+#pragma once
+
+/**
+ * @file cpu_kernels.hpp
+ * @brief Zero Core Runtime — Raw CPU Kernel Bodies
+ *
+ * Pointer-and-length loops behind the F32 ops in ops/. Operands are
+ * contiguous and already validated; nothing here checks anything.
+ *
+ * The bodies are templated on the target Isa so the compiled kernels
+ * library (spec 005) can explicitly instantiate them once per -m flag
+ * set without symbol collisions. For the same reason this header must
+ * not pull in Tensor, Status or any other shared inline code: an ISA
+ * translation unit could emit its own copy of such a function, and the
+ * linker may hand that copy to baseline callers. Math goes through the
+ * libm C entry points (expf, fabsf, ...) for the same reason.
+ */
+
+#include "isa.hpp"
+
+#include <cstdint>
+#include <math.h>
+#include <string.h>
+
+namespace zero {
+namespace kernels {
+namespace impl {
+
+/// Column block for gemm: accumulator row kept on the stack.
+constexpr int64_t GEMM_NB = 64;
+
+/// Embedding bag: how many ids ahead to prefetch table rows.
+constexpr int64_t EMBEDDING_PREFETCH = 8;
+
+template <Isa I>
+struct Cpu {
+    // ─────────────────────────────────────────────────────────────────
+    // Unary: y[i] = f(x[i])
+    // ─────────────────────────────────────────────────────────────────
+
+    static void neg(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = -x[i];
+    }
+    static void abs(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = fabsf(x[i]);
+    }
+    static void exp(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = expf(x[i]);
+    }
+    static void log(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = logf(x[i]);
+    }
+    static void sqrt(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = sqrtf(x[i]);
+    }
+    static void sin(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = sinf(x[i]);
+    }
+    static void cos(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = cosf(x[i]);
+    }
+    static void tanh(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = tanhf(x[i]);
+    }
+    static void relu(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = x[i] > 0.0f ? x[i] : 0.0f;
+    }
+    static void sigmoid(const float* x, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = 1.0f / (1.0f + expf(-x[i]));
+    }
+
+    // ─────────────────────────────────────────────────────────────────
+    // Binary: y[i] = a[i] (op) b[i]
+    // ─────────────────────────────────────────────────────────────────
+
+    static void add(const float* a, const float* b, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = a[i] + b[i];
+    }
+    static void sub(const float* a, const float* b, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = a[i] - b[i];
+    }
+    static void mul(const float* a, const float* b, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = a[i] * b[i];
+    }
+    static void div(const float* a, const float* b, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = a[i] / b[i];
+    }
+
+    // ─────────────────────────────────────────────────────────────────
+    // Scalar RHS: y[i] = a[i] (op) s
+    // ─────────────────────────────────────────────────────────────────
+
+    static void add_scalar(const float* a, float s, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = a[i] + s;
+    }
+    static void sub_scalar(const float* a, float s, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = a[i] - s;
+    }
+    static void mul_scalar(const float* a, float s, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = a[i] * s;
+    }
+    static void div_scalar(const float* a, float s, float* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i) y[i] = a[i] / s;
+    }
+
+    // ─────────────────────────────────────────────────────────────────
+    // GEMM: C[M,N] = alpha * A[M,K] @ B[K,N] + beta * C
+    //
+    // Walks k outside n with a stack accumulator per GEMM_NB columns so
+    // the inner loop is a unit-stride axpy the compiler can vectorize.
+    // Each output still sums its k terms in ascending order from 0.0f,
+    // so results are bit-identical to the naive i-j-k loop.
+    // ─────────────────────────────────────────────────────────────────
+
+    static void gemm(const float* a, const float* b, float* c,
+                     int64_t M, int64_t N, int64_t K,
+                     float alpha, float beta) noexcept {
+        float acc[GEMM_NB];
+        for (int64_t m = 0; m < M; ++m) {
+            const float* a_row = a + m * K;
+            float* c_row = c + m * N;
+            for (int64_t n0 = 0; n0 < N; n0 += GEMM_NB) {
+                int64_t w = (N - n0 < GEMM_NB) ? N - n0 : GEMM_NB;
+                for (int64_t j = 0; j < w; ++j) acc[j] = 0.0f;
+                for (int64_t k = 0; k < K; ++k) {
+                    float av = a_row[k];
+                    const float* b_row = b + k * N + n0;
+                    for (int64_t j = 0; j < w; ++j) acc[j] += av * b_row[j];
+                }
+                for (int64_t j = 0; j < w; ++j) {
+                    c_row[n0 + j] = alpha * acc[j] + beta * c_row[n0 + j];
+                }
+            }
+        }
+    }
+
+    // ─────────────────────────────────────────────────────────────────
+    // Row reductions: y[r] = reduce(x[r, 0:len]) for r in [0, rows)
+    // ─────────────────────────────────────────────────────────────────
+
+    static void sum_rows(const float* x, float* y, int64_t rows, int64_t len) noexcept {
+        for (int64_t r = 0; r < rows; ++r) {
+            const float* row = x + r * len;
+            float sum = 0.0f;
+            for (int64_t i = 0; i < len; ++i) sum += row[i];
+            y[r] = sum;
+        }
+    }
+    static void max_rows(const float* x, float* y, int64_t rows, int64_t len) noexcept {
+        for (int64_t r = 0; r < rows; ++r) {
+            const float* row = x + r * len;
+            float max_val = -HUGE_VALF;
+            for (int64_t i = 0; i < len; ++i) {
+                if (row[i] > max_val) max_val = row[i];
+            }
+            y[r] = max_val;
+        }
+    }
+    static void min_rows(const float* x, float* y, int64_t rows, int64_t len) noexcept {
+        for (int64_t r = 0; r < rows; ++r) {
+            const float* row = x + r * len;
+            float min_val = HUGE_VALF;
+            for (int64_t i = 0; i < len; ++i) {
+                if (row[i] < min_val) min_val = row[i];
+            }
+            y[r] = min_val;
+        }
+    }
+    static void mean_rows(const float* x, float* y, int64_t rows, int64_t len) noexcept {
+        for (int64_t r = 0; r < rows; ++r) {
+            const float* row = x + r * len;
+            float sum = 0.0f;
+            for (int64_t i = 0; i < len; ++i) sum += row[i];
+            y[r] = sum / static_cast<float>(len);
+        }
+    }
+    static void prod_rows(const float* x, float* y, int64_t rows, int64_t len) noexcept {
+        for (int64_t r = 0; r < rows; ++r) {
+            const float* row = x + r * len;
+            float prod = 1.0f;
+            for (int64_t i = 0; i < len; ++i) prod *= row[i];
+            y[r] = prod;
+        }
+    }
+
+    // First index of the row maximum; 0 for rows that are all -inf/NaN.
+    static void argmax_rows_i64(const float* x, int64_t* y, int64_t rows, int64_t len) noexcept {
+        for (int64_t r = 0; r < rows; ++r) {
+            const float* row = x + r * len;
+            float max_val = -HUGE_VALF;
+            int64_t max_idx = 0;
+            for (int64_t i = 0; i < len; ++i) {
+                if (row[i] > max_val) { max_val = row[i]; max_idx = i; }
+            }
+            y[r] = max_idx;
+        }
+    }
+    static void argmax_rows_i32(const float* x, int32_t* y, int64_t rows, int64_t len) noexcept {
+        for (int64_t r = 0; r < rows; ++r) {
+            const float* row = x + r * len;
+            float max_val = -HUGE_VALF;
+            int32_t max_idx = 0;
+            for (int64_t i = 0; i < len; ++i) {
+                if (row[i] > max_val) { max_val = row[i]; max_idx = static_cast<int32_t>(i); }
+            }
+            y[r] = max_idx;
+        }
+    }
+
+    // ─────────────────────────────────────────────────────────────────
+    // Embedding bag: out[b] = pool(w[p] * table[idx[p]]) over the CSR bag
+    // p in [offsets[b], offsets[b+1]), for b in [bag_begin, bag_end)
+    //
+    // Rows accumulate straight into the output row (an axpy the compiler
+    // vectorizes at the variant's width); the row EMBEDDING_PREFETCH ids
+    // ahead is prefetched. weights may be null (all 1). mean != 0 divides
+    // by the bag size; empty bags are zero.
+    // ─────────────────────────────────────────────────────────────────
+
+    static void embedding_bag_i64(const float* table, int64_t dim, const int64_t* idx,
+                                  const int64_t* offsets, const float* weights, float* out,
+                                  int64_t bag_begin, int64_t bag_end, int32_t mean) noexcept {
+        embedding_bag(table, dim, idx, offsets, weights, out, bag_begin, bag_end, mean);
+    }
+    static void embedding_bag_i32(const float* table, int64_t dim, const int32_t* idx,
+                                  const int32_t* offsets, const float* weights, float* out,
+                                  int64_t bag_begin, int64_t bag_end, int32_t mean) noexcept {
+        embedding_bag(table, dim, idx, offsets, weights, out, bag_begin, bag_end, mean);
+    }
+
+    template <typename Idx>
+    static void embedding_bag(const float* table, int64_t dim, const Idx* idx,
+                              const Idx* offsets, const float* weights, float* out,
+                              int64_t bag_begin, int64_t bag_end, int32_t mean) noexcept {
+        int64_t last = static_cast<int64_t>(offsets[bag_end]);
+        for (int64_t b = bag_begin; b < bag_end; ++b) {
+            float* y = out + b * dim;
+            for (int64_t j = 0; j < dim; ++j) y[j] = 0.0f;
+            int64_t p0 = static_cast<int64_t>(offsets[b]);
+            int64_t p1 = static_cast<int64_t>(offsets[b + 1]);
+            for (int64_t p = p0; p < p1; ++p) {
+#if defined(__GNUC__) || defined(__clang__)
+                if (p + EMBEDDING_PREFETCH < last)
+                    __builtin_prefetch(table + static_cast<int64_t>(idx[p + EMBEDDING_PREFETCH]) * dim);
+#endif
+                const float* row = table + static_cast<int64_t>(idx[p]) * dim;
+                float w = weights != nullptr ? weights[p] : 1.0f;
+                for (int64_t j = 0; j < dim; ++j) y[j] += w * row[j];
+            }
+            if (mean != 0 && p1 > p0) {
+                float inv = 1.0f / static_cast<float>(p1 - p0);
+                for (int64_t j = 0; j < dim; ++j) y[j] *= inv;
+            }
+        }
+    }
+
+    // ─────────────────────────────────────────────────────────────────
+    // RoPE: rotate pairs of the first 2*half dims of each head in place
+    //
+    //   (a, b) -> (a*cos[i] - b*sin[i], b*cos[i] + a*sin[i])
+    //
+    // Half-split pairs x[i] with x[i + half]; interleaved pairs x[2i]
+    // with x[2i + 1]. x is one token: heads rows of head_dim floats.
+    // ─────────────────────────────────────────────────────────────────
+
+    static void rope_half(float* x, int64_t heads, int64_t head_dim,
+                          const float* cos, const float* sin, int64_t half) noexcept {
+        for (int64_t h = 0; h < heads; ++h) {
+            float* lo = x + h * head_dim;
+            float* hi = lo + half;
+            for (int64_t i = 0; i < half; ++i) {
+                float a = lo[i];
+                float b = hi[i];
+                lo[i] = a * cos[i] - b * sin[i];
+                hi[i] = b * cos[i] + a * sin[i];
+            }
+        }
+    }
+    static void rope_interleaved(float* x, int64_t heads, int64_t head_dim,
+                                 const float* cos, const float* sin, int64_t half) noexcept {
+        for (int64_t h = 0; h < heads; ++h) {
+            float* v = x + h * head_dim;
+            for (int64_t i = 0; i < half; ++i) {
+                float a = v[2 * i];
+                float b = v[2 * i + 1];
+                v[2 * i] = a * cos[i] - b * sin[i];
+                v[2 * i + 1] = b * cos[i] + a * sin[i];
+            }
+        }
+    }
+
+    // ─────────────────────────────────────────────────────────────────
+    // Byte shuffle: split n elements of `width` bytes into byte planes
+    //
+    //   y[b * n + i] = x[i * width + b]      (unshuffle is the inverse)
+    //
+    // Widths 2, 4 and 8 get a constant stride so the variant vectorizes
+    // the grouped loads; other widths take the plain loop.
+    // ─────────────────────────────────────────────────────────────────
+
+    static void shuffle_bytes(const uint8_t* x, uint8_t* y, int64_t n, int64_t width) noexcept {
+        switch (width) {
+            case 2: shuffle_fixed<2>(x, y, n); return;
+            case 4: shuffle_fixed<4>(x, y, n); return;
+            case 8: shuffle_fixed<8>(x, y, n); return;
+            default: break;
+        }
+        for (int64_t i = 0; i < n; ++i)
+            for (int64_t b = 0; b < width; ++b) y[b * n + i] = x[i * width + b];
+    }
+    static void unshuffle_bytes(const uint8_t* x, uint8_t* y, int64_t n, int64_t width) noexcept {
+        switch (width) {
+            case 2: unshuffle_fixed<2>(x, y, n); return;
+            case 4: unshuffle_fixed<4>(x, y, n); return;
+            case 8: unshuffle_fixed<8>(x, y, n); return;
+            default: break;
+        }
+        for (int64_t i = 0; i < n; ++i)
+            for (int64_t b = 0; b < width; ++b) y[i * width + b] = x[b * n + i];
+    }
+
+    template <int64_t W>
+    static void shuffle_fixed(const uint8_t* x, uint8_t* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i)
+            for (int64_t b = 0; b < W; ++b) y[b * n + i] = x[i * W + b];
+    }
+    template <int64_t W>
+    static void unshuffle_fixed(const uint8_t* x, uint8_t* y, int64_t n) noexcept {
+        for (int64_t i = 0; i < n; ++i)
+            for (int64_t b = 0; b < W; ++b) y[i * W + b] = x[b * n + i];
+    }
+
+    // ─────────────────────────────────────────────────────────────────
+    // Content hash: 64-bit, four independent 8-byte lanes per 32-byte
+    // stripe (the variant vectorizes across lanes), then a scalar tail
+    // and a final avalanche. Integer-only, so every variant agrees.
+    // ─────────────────────────────────────────────────────────────────
+
+    static constexpr uint64_t HASH_P1 = 0x9E3779B185EBCA87ull;
+    static constexpr uint64_t HASH_P2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr uint64_t HASH_P3 = 0x165667B19E3779F9ull;
+
+    static uint64_t rotl64(uint64_t v, int r) noexcept { return (v << r) | (v >> (64 - r)); }
+
+    static uint64_t hash_bytes(const uint8_t* x, int64_t n, uint64_t seed) noexcept {
+        uint64_t acc[4] = {seed + HASH_P1 + HASH_P2, seed + HASH_P2, seed, seed - HASH_P1};
+        int64_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            uint64_t w[4];
+            memcpy(w, x + i, 32);
+            for (int l = 0; l < 4; ++l) acc[l] = rotl64(acc[l] + w[l] * HASH_P2, 31) * HASH_P1;
+        }
+        uint64_t h = rotl64(acc[0], 1) + rotl64(acc[1], 7) + rotl64(acc[2], 12) + rotl64(acc[3], 18);
+        h += static_cast<uint64_t>(n);
+        for (; i + 8 <= n; i += 8) {
+            uint64_t w;
+            memcpy(&w, x + i, 8);
+            h ^= rotl64(w * HASH_P2, 31) * HASH_P1;
+            h = rotl64(h, 27) * HASH_P1 + HASH_P3;
+        }
+        for (; i < n; ++i) h = rotl64(h ^ (x[i] * HASH_P3), 11) * HASH_P1;
+        h ^= h >> 33;
+        h *= HASH_P2;
+        h ^= h >> 29;
+        h *= HASH_P3;
+        h ^= h >> 32;
+        return h;
+    }
+};
+
+} // namespace impl
+} // namespace kernels
+} // namespace zero
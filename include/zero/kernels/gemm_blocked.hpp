@@ -0,0 +1,255 @@
+#pragma once
+
+/**
+ * @file gemm_blocked.hpp
+ * @brief Zero Core Runtime — Cache-Blocked GEMM Kernel
+ *
+ * C = alpha * A @ B + beta * C over row-major F32, blocked for the cache
+ * hierarchy with tunable tiles:
+ *
+ *   for jc in N by nc              B panel columns
+ *     for ic in M by mc            accumulator block mc x nc
+ *       for pc in K by kc          (ascending) pack B kc x nc, A mc x kc
+ *         for ir, jr by mr, nr     mr x nr register micro-kernel
+ *
+ * Panels are packed into zero-padded mr / nr strips so the micro-kernel
+ * streams contiguous memory. Each output keeps one accumulator for all of
+ * K and adds its k terms in ascending order, so every tile choice is
+ * bit-identical to gemm_f32. Raw pointers only, like cpu_kernels.hpp.
+ *
+ * The thread split cuts M into row chunks with one workspace slice each.
+ * The kernel never spawns threads: gemm_blocked_chunk_f32 runs one chunk,
+ * and ops::gemm_blocked hands the chunks to a persistent pool.
+ */
+
+#include <cstdint>
+
+// Full unroll of the fixed-size micro-kernel loops; without it GCC keeps
+// larger register tiles in memory.
+#if defined(__GNUC__) || defined(__clang__)
+#define ZERO_GEMM_UNROLL _Pragma("GCC unroll 64")
+#else
+#define ZERO_GEMM_UNROLL
+#endif
+
+namespace zero {
+namespace kernels {
+
+/**
+ * @brief Tile configuration for gemm_blocked_f32
+ */
+struct GemmTiles {
+    int32_t mc = 64;       ///< Rows of A per block
+    int32_t kc = 256;      ///< Depth per block
+    int32_t nc = 512;      ///< Columns of B per panel
+    int32_t mr = 4;        ///< Micro-kernel rows (see gemm_micro_supported)
+    int32_t nr = 16;       ///< Micro-kernel columns
+    int32_t threads = 1;   ///< Row chunks of M, one per thread (<= GEMM_MAX_THREADS)
+};
+
+constexpr int32_t GEMM_MAX_THREADS = 64;
+
+/**
+ * @brief Micro-kernel shapes with a register-blocked instantiation
+ */
+constexpr bool gemm_micro_supported(int32_t mr, int32_t nr) noexcept {
+    return (mr == 4 && nr == 8) || (mr == 4 && nr == 16) ||
+           (mr == 6 && nr == 16) || (mr == 8 && nr == 8);
+}
+
+constexpr bool gemm_tiles_valid(const GemmTiles& t) noexcept {
+    return t.mc > 0 && t.kc > 0 && t.nc > 0 && t.threads > 0 && t.threads <= GEMM_MAX_THREADS &&
+           gemm_micro_supported(t.mr, t.nr);
+}
+
+/**
+ * @brief Per-thread workspace floats: accumulator + packed A + packed B
+ */
+constexpr int64_t gemm_blocked_thread_workspace(const GemmTiles& t) noexcept {
+    int64_t mc_up = (static_cast<int64_t>(t.mc) + t.mr - 1) / t.mr * t.mr;
+    int64_t nc_up = (static_cast<int64_t>(t.nc) + t.nr - 1) / t.nr * t.nr;
+    return t.mc * nc_up + mc_up * t.kc + static_cast<int64_t>(t.kc) * nc_up;
+}
+
+/**
+ * @brief Workspace floats gemm_blocked_f32 needs for these tiles
+ */
+constexpr int64_t gemm_blocked_workspace(const GemmTiles& t) noexcept {
+    return static_cast<int64_t>(t.threads) * gemm_blocked_thread_workspace(t);
+}
+
+namespace impl {
+
+// acc[MR x NR] (row stride ldc) += packed A strip (k-major, MR per k)
+//                                 @ packed B strip (k-major, NR per k)
+template <int MR, int NR>
+inline void gemm_micro(const float* __restrict ap, const float* __restrict bp,
+                       float* __restrict acc, int64_t ldc, int64_t kc) noexcept {
+    float r[MR * NR];
+    ZERO_GEMM_UNROLL
+    for (int i = 0; i < MR; ++i) {
+        ZERO_GEMM_UNROLL
+        for (int j = 0; j < NR; ++j) r[i * NR + j] = acc[i * ldc + j];
+    }
+    for (int64_t k = 0; k < kc; ++k) {
+        const float* a = ap + k * MR;
+        const float* b = bp + k * NR;
+        ZERO_GEMM_UNROLL
+        for (int i = 0; i < MR; ++i) {
+            float av = a[i];
+            ZERO_GEMM_UNROLL
+            for (int j = 0; j < NR; ++j) r[i * NR + j] += av * b[j];
+        }
+    }
+    ZERO_GEMM_UNROLL
+    for (int i = 0; i < MR; ++i) {
+        ZERO_GEMM_UNROLL
+        for (int j = 0; j < NR; ++j) acc[i * ldc + j] = r[i * NR + j];
+    }
+}
+
+// B[0:kb, 0:nb] (row stride ldb) → NR-wide k-major strips, zero-padded.
+template <int NR>
+inline void gemm_pack_b(const float* b, int64_t ldb, int64_t kb, int64_t nb, float* dst) noexcept {
+    for (int64_t jr = 0; jr < nb; jr += NR) {
+        int64_t w = (nb - jr < NR) ? nb - jr : NR;
+        float* strip = dst + jr * kb;
+        for (int64_t k = 0; k < kb; ++k) {
+            const float* src = b + k * ldb + jr;
+            int64_t j = 0;
+            for (; j < w; ++j) strip[k * NR + j] = src[j];
+            for (; j < NR; ++j) strip[k * NR + j] = 0.0f;
+        }
+    }
+}
+
+// A[0:mb, 0:kb] (row stride lda) → MR-tall k-major strips, zero-padded.
+template <int MR>
+inline void gemm_pack_a(const float* a, int64_t lda, int64_t mb, int64_t kb, float* dst) noexcept {
+    for (int64_t ir = 0; ir < mb; ir += MR) {
+        int64_t h = (mb - ir < MR) ? mb - ir : MR;
+        float* strip = dst + ir * kb;
+        for (int64_t k = 0; k < kb; ++k) {
+            int64_t i = 0;
+            for (; i < h; ++i) strip[k * MR + i] = a[(ir + i) * lda + k];
+            for (; i < MR; ++i) strip[k * MR + i] = 0.0f;
+        }
+    }
+}
+
+template <int MR, int NR>
+inline void gemm_blocked_rows(const float* a, const float* b, float* c,
+                              int64_t m0, int64_t m1, int64_t N, int64_t K,
+                              float alpha, float beta, const GemmTiles& t,
+                              float* ws) noexcept {
+    int64_t mc_up = (static_cast<int64_t>(t.mc) + MR - 1) / MR * MR;
+    int64_t nc_up = (static_cast<int64_t>(t.nc) + NR - 1) / NR * NR;
+    float* acc = ws;                        // [mc x nc_up]
+    float* a_pack = acc + t.mc * nc_up;     // [mc_up x kc]
+    float* b_pack = a_pack + mc_up * t.kc;  // [kc x nc_up]
+    float edge[MR * NR];
+
+    for (int64_t jc = 0; jc < N; jc += t.nc) {
+        int64_t nb = (N - jc < t.nc) ? N - jc : t.nc;
+        int64_t nb_up = (nb + NR - 1) / NR * NR;
+        for (int64_t ic = m0; ic < m1; ic += t.mc) {
+            int64_t mb = (m1 - ic < t.mc) ? m1 - ic : t.mc;
+            for (int64_t i = 0; i < mb * nb_up; ++i) acc[i] = 0.0f;
+
+            for (int64_t pc = 0; pc < K; pc += t.kc) {
+                int64_t kb = (K - pc < t.kc) ? K - pc : t.kc;
+                gemm_pack_b<NR>(b + pc * N + jc, N, kb, nb, b_pack);
+                gemm_pack_a<MR>(a + ic * K + pc, K, mb, kb, a_pack);
+                for (int64_t ir = 0; ir < mb; ir += MR) {
+                    int64_t h = (mb - ir < MR) ? mb - ir : MR;
+                    for (int64_t jr = 0; jr < nb_up; jr += NR) {
+                        float* acc_tile = acc + ir * nb_up + jr;
+                        if (h == MR) {
+                            gemm_micro<MR, NR>(a_pack + ir * kb, b_pack + jr * kb, acc_tile, nb_up, kb);
+                            continue;
+                        }
+                        // Short last row strip: run the full tile on a copy.
+                        for (int64_t i = 0; i < MR * NR; ++i) edge[i] = 0.0f;
+                        for (int64_t i = 0; i < h; ++i)
+                            for (int64_t j = 0; j < NR; ++j) edge[i * NR + j] = acc_tile[i * nb_up + j];
+                        gemm_micro<MR, NR>(a_pack + ir * kb, b_pack + jr * kb, edge, NR, kb);
+                        for (int64_t i = 0; i < h; ++i)
+                            for (int64_t j = 0; j < NR; ++j) acc_tile[i * nb_up + j] = edge[i * NR + j];
+                    }
+                }
+            }
+
+            for (int64_t i = 0; i < mb; ++i) {
+                float* c_row = c + (ic + i) * N + jc;
+                const float* acc_row = acc + i * nb_up;
+                for (int64_t j = 0; j < nb; ++j) c_row[j] = alpha * acc_row[j] + beta * c_row[j];
+            }
+        }
+    }
+}
+
+} // namespace impl
+
+/**
+ * @brief Rows per chunk: ceil(M / threads), rounded up to mr so only the
+ * last chunk has a short strip
+ */
+constexpr int64_t gemm_blocked_chunk_rows(int64_t M, const GemmTiles& t) noexcept {
+    int64_t threads = t.threads < M ? t.threads : (M > 0 ? M : 1);
+    int64_t rows = (M + threads - 1) / threads;
+    return (rows + t.mr - 1) / t.mr * t.mr;
+}
+
+/**
+ * @brief Non-empty row chunks for M rows (<= t.threads)
+ */
+constexpr int64_t gemm_blocked_chunks(int64_t M, const GemmTiles& t) noexcept {
+    if (M <= 0) return 0;
+    int64_t rows = gemm_blocked_chunk_rows(M, t);
+    return (M + rows - 1) / rows;
+}
+
+/**
+ * @brief Run row chunk `chunk` of a blocked GEMM in workspace slice `chunk`
+ *
+ * Chunks write disjoint rows of C and may run concurrently.
+ * Preconditions: gemm_tiles_valid(t), 0 <= chunk < gemm_blocked_chunks(M, t),
+ * and workspace holds gemm_blocked_chunks(M, t) slices of
+ * gemm_blocked_thread_workspace(t) floats (gemm_blocked_workspace(t)
+ * always suffices).
+ */
+inline void gemm_blocked_chunk_f32(const float* a, const float* b, float* c,
+                                   int64_t M, int64_t N, int64_t K,
+                                   float alpha, float beta, const GemmTiles& t,
+                                   float* workspace, int64_t chunk) noexcept {
+    int64_t rows = gemm_blocked_chunk_rows(M, t);
+    int64_t m0 = chunk * rows;
+    int64_t m1 = (m0 + rows < M) ? m0 + rows : M;
+    float* ws = workspace + chunk * gemm_blocked_thread_workspace(t);
+    if (t.mr == 4 && t.nr == 8) {
+        impl::gemm_blocked_rows<4, 8>(a, b, c, m0, m1, N, K, alpha, beta, t, ws);
+    } else if (t.mr == 4 && t.nr == 16) {
+        impl::gemm_blocked_rows<4, 16>(a, b, c, m0, m1, N, K, alpha, beta, t, ws);
+    } else if (t.mr == 6 && t.nr == 16) {
+        impl::gemm_blocked_rows<6, 16>(a, b, c, m0, m1, N, K, alpha, beta, t, ws);
+    } else {
+        impl::gemm_blocked_rows<8, 8>(a, b, c, m0, m1, N, K, alpha, beta, t, ws);
+    }
+}
+
+/**
+ * @brief Blocked GEMM with explicit tiles, every chunk on the calling thread
+ *
+ * Preconditions as for gemm_blocked_chunk_f32.
+ */
+inline void gemm_blocked_f32(const float* a, const float* b, float* c,
+                             int64_t M, int64_t N, int64_t K,
+                             float alpha, float beta, const GemmTiles& t,
+                             float* workspace) noexcept {
+    int64_t chunks = gemm_blocked_chunks(M, t);
+    for (int64_t i = 0; i < chunks; ++i)
+        gemm_blocked_chunk_f32(a, b, c, M, N, K, alpha, beta, t, workspace, i);
+}
+
+} // namespace kernels
+} // namespace zero
@@ -0,0 +1,38 @@
+#pragma once
+
+/**
+ * @file isa.hpp
+ * @brief Zero Core Runtime — CPU Instruction Set Tags
+ *
+ * Names the instruction sets the compiled kernels library (spec 005)
+ * builds a variant for. Header-only builds only ever run GENERIC.
+ */
+
+#include <cstdint>
+
+namespace zero {
+namespace kernels {
+
+/**
+ * @brief Kernel variant, ordered from least to most capable
+ */
+enum class Isa : uint8_t {
+    GENERIC = 0,  // Baseline flags of the consumer's toolchain
+    AVX2 = 1,     // -mavx2 -mfma
+    AVX512 = 2,   // -mavx512f -mavx512bw -mavx512dq -mavx512vl
+};
+
+/**
+ * @brief Get human-readable name for an Isa
+ */
+constexpr const char* isa_name(Isa isa) noexcept {
+    switch (isa) {
+        case Isa::GENERIC: return "generic";
+        case Isa::AVX2:    return "avx2";
+        case Isa::AVX512:  return "avx512";
+    }
+    return "unknown";
+}
+
+} // namespace kernels
+} // namespace zero
@@ -0,0 +1,181 @@
+#pragma once
+
+/**
+ * @file kernels.hpp
+ * @brief Zero Core Runtime — Kernel Entry Points
+ *
+ * The ops in ops/ validate Tensors, then call these pointer-level
+ * kernels. Two build modes (spec 005):
+ *
+ * - Header-only (default): each entry point is an inline call into
+ *   impl::Cpu<Isa::GENERIC>, compiled with the consumer's own flags.
+ * - ZERO_USE_COMPILED_KERNELS (set by linking zero-core-kernels): the
+ *   entry points are thin declarations. The library holds one explicit
+ *   instantiation per ISA and dispatches to the best one the host
+ *   supports on first use.
+ *
+ * Every translation unit of a program must agree on the mode; the CMake
+ * target propagates the define to all consumers.
+ */
+
+#include "isa.hpp"
+
+#include <cstdint>
+
+#if !defined(ZERO_USE_COMPILED_KERNELS)
+#include "cpu_kernels.hpp"
+#endif
+
+namespace zero {
+namespace kernels {
+
+#if defined(ZERO_USE_COMPILED_KERNELS)
+
+// ─────────────────────────────────────────────────────────────────────
+// Compiled mode: defined in src/kernels/dispatch.cpp
+// ─────────────────────────────────────────────────────────────────────
+
+/**
+ * @brief ISA variant the entry points currently dispatch to
+ *
+ * Chosen on first use: the best variant the host supports, capped by the
+ * ZERO_KERNEL_ISA environment variable (generic | avx2 | avx512).
+ */
+Isa active_isa() noexcept;
+
+/**
+ * @brief Check if a variant was built and the host can run it
+ */
+bool isa_supported(Isa isa) noexcept;
+
+/**
+ * @brief Force a variant. Returns false (and changes nothing) if unsupported.
+ *
+ * @warning Not synchronized with in-flight kernels. Call at startup.
+ */
+bool select_isa(Isa isa) noexcept;
+
+void neg_f32(const float* x, float* y, int64_t n) noexcept;
+void abs_f32(const float* x, float* y, int64_t n) noexcept;
+void exp_f32(const float* x, float* y, int64_t n) noexcept;
+void log_f32(const float* x, float* y, int64_t n) noexcept;
+void sqrt_f32(const float* x, float* y, int64_t n) noexcept;
+void sin_f32(const float* x, float* y, int64_t n) noexcept;
+void cos_f32(const float* x, float* y, int64_t n) noexcept;
+void tanh_f32(const float* x, float* y, int64_t n) noexcept;
+void relu_f32(const float* x, float* y, int64_t n) noexcept;
+void sigmoid_f32(const float* x, float* y, int64_t n) noexcept;
+
+void add_f32(const float* a, const float* b, float* y, int64_t n) noexcept;
+void sub_f32(const float* a, const float* b, float* y, int64_t n) noexcept;
+void mul_f32(const float* a, const float* b, float* y, int64_t n) noexcept;
+void div_f32(const float* a, const float* b, float* y, int64_t n) noexcept;
+
+void add_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept;
+void sub_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept;
+void mul_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept;
+void div_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept;
+
+void gemm_f32(const float* a, const float* b, float* c,
+              int64_t M, int64_t N, int64_t K, float alpha, float beta) noexcept;
+
+void sum_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept;
+void max_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept;
+void min_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept;
+void mean_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept;
+void prod_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept;
+void argmax_rows_f32_i64(const float* x, int64_t* y, int64_t rows, int64_t len) noexcept;
+void argmax_rows_f32_i32(const float* x, int32_t* y, int64_t rows, int64_t len) noexcept;
+
+void embedding_bag_f32_i64(const float* table, int64_t dim, const int64_t* idx, const int64_t* offsets,
+                           const float* weights, float* out, int64_t bag_begin, int64_t bag_end,
+                           int32_t mean) noexcept;
+void embedding_bag_f32_i32(const float* table, int64_t dim, const int32_t* idx, const int32_t* offsets,
+                           const float* weights, float* out, int64_t bag_begin, int64_t bag_end,
+                           int32_t mean) noexcept;
+
+void rope_half_f32(float* x, int64_t heads, int64_t head_dim, const float* cos, const float* sin,
+                   int64_t half) noexcept;
+void rope_interleaved_f32(float* x, int64_t heads, int64_t head_dim, const float* cos, const float* sin,
+                          int64_t half) noexcept;
+
+void shuffle_bytes(const uint8_t* x, uint8_t* y, int64_t n, int64_t width) noexcept;
+void unshuffle_bytes(const uint8_t* x, uint8_t* y, int64_t n, int64_t width) noexcept;
+
+uint64_t hash_bytes(const uint8_t* x, int64_t n, uint64_t seed) noexcept;
+
+#else
+
+// ─────────────────────────────────────────────────────────────────────
+// Header-only mode: inline GENERIC bodies
+// ─────────────────────────────────────────────────────────────────────
+
+using Generic = impl::Cpu<Isa::GENERIC>;
+
+inline Isa active_isa() noexcept { return Isa::GENERIC; }
+inline bool isa_supported(Isa isa) noexcept { return isa == Isa::GENERIC; }
+inline bool select_isa(Isa isa) noexcept { return isa == Isa::GENERIC; }
+
+inline void neg_f32(const float* x, float* y, int64_t n) noexcept { Generic::neg(x, y, n); }
+inline void abs_f32(const float* x, float* y, int64_t n) noexcept { Generic::abs(x, y, n); }
+inline void exp_f32(const float* x, float* y, int64_t n) noexcept { Generic::exp(x, y, n); }
+inline void log_f32(const float* x, float* y, int64_t n) noexcept { Generic::log(x, y, n); }
+inline void sqrt_f32(const float* x, float* y, int64_t n) noexcept { Generic::sqrt(x, y, n); }
+inline void sin_f32(const float* x, float* y, int64_t n) noexcept { Generic::sin(x, y, n); }
+inline void cos_f32(const float* x, float* y, int64_t n) noexcept { Generic::cos(x, y, n); }
+inline void tanh_f32(const float* x, float* y, int64_t n) noexcept { Generic::tanh(x, y, n); }
+inline void relu_f32(const float* x, float* y, int64_t n) noexcept { Generic::relu(x, y, n); }
+inline void sigmoid_f32(const float* x, float* y, int64_t n) noexcept { Generic::sigmoid(x, y, n); }
+
+inline void add_f32(const float* a, const float* b, float* y, int64_t n) noexcept { Generic::add(a, b, y, n); }
+inline void sub_f32(const float* a, const float* b, float* y, int64_t n) noexcept { Generic::sub(a, b, y, n); }
+inline void mul_f32(const float* a, const float* b, float* y, int64_t n) noexcept { Generic::mul(a, b, y, n); }
+inline void div_f32(const float* a, const float* b, float* y, int64_t n) noexcept { Generic::div(a, b, y, n); }
+
+inline void add_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept { Generic::add_scalar(a, s, y, n); }
+inline void sub_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept { Generic::sub_scalar(a, s, y, n); }
+inline void mul_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept { Generic::mul_scalar(a, s, y, n); }
+inline void div_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept { Generic::div_scalar(a, s, y, n); }
+
+inline void gemm_f32(const float* a, const float* b, float* c,
+                     int64_t M, int64_t N, int64_t K, float alpha, float beta) noexcept {
+    Generic::gemm(a, b, c, M, N, K, alpha, beta);
+}
+
+inline void sum_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { Generic::sum_rows(x, y, rows, len); }
+inline void max_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { Generic::max_rows(x, y, rows, len); }
+inline void min_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { Generic::min_rows(x, y, rows, len); }
+inline void mean_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { Generic::mean_rows(x, y, rows, len); }
+inline void prod_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { Generic::prod_rows(x, y, rows, len); }
+inline void argmax_rows_f32_i64(const float* x, int64_t* y, int64_t rows, int64_t len) noexcept { Generic::argmax_rows_i64(x, y, rows, len); }
+inline void argmax_rows_f32_i32(const float* x, int32_t* y, int64_t rows, int64_t len) noexcept { Generic::argmax_rows_i32(x, y, rows, len); }
+
+inline void embedding_bag_f32_i64(const float* table, int64_t dim, const int64_t* idx, const int64_t* offsets,
+                                  const float* weights, float* out, int64_t bag_begin, int64_t bag_end,
+                                  int32_t mean) noexcept {
+    Generic::embedding_bag_i64(table, dim, idx, offsets, weights, out, bag_begin, bag_end, mean);
+}
+inline void embedding_bag_f32_i32(const float* table, int64_t dim, const int32_t* idx, const int32_t* offsets,
+                                  const float* weights, float* out, int64_t bag_begin, int64_t bag_end,
+                                  int32_t mean) noexcept {
+    Generic::embedding_bag_i32(table, dim, idx, offsets, weights, out, bag_begin, bag_end, mean);
+}
+
+inline void rope_half_f32(float* x, int64_t heads, int64_t head_dim, const float* cos, const float* sin,
+                          int64_t half) noexcept {
+    Generic::rope_half(x, heads, head_dim, cos, sin, half);
+}
+inline void rope_interleaved_f32(float* x, int64_t heads, int64_t head_dim, const float* cos, const float* sin,
+                                 int64_t half) noexcept {
+    Generic::rope_interleaved(x, heads, head_dim, cos, sin, half);
+}
+
+inline void shuffle_bytes(const uint8_t* x, uint8_t* y, int64_t n, int64_t width) noexcept { Generic::shuffle_bytes(x, y, n, width); }
+inline void unshuffle_bytes(const uint8_t* x, uint8_t* y, int64_t n, int64_t width) noexcept { Generic::unshuffle_bytes(x, y, n, width); }
+
+inline uint64_t hash_bytes(const uint8_t* x, int64_t n, uint64_t seed) noexcept { return Generic::hash_bytes(x, n, seed); }
+
+#endif
+
+} // namespace kernels
+} // namespace zero
@@ -17,6 +17,11 @@
 #include "../core/scalar.hpp"
 #include "../core/status.hpp"
 #include "../device/sync.hpp"
+#include "../exec/cost_model.hpp"
+#include "../kernels/kernels.hpp"
+#include "../telemetry/histogram.hpp"
+#include "../telemetry/profiler.hpp"
+#include "../telemetry/runtime_metrics.hpp"
 
 #include <cmath>
 #include <algorithm>
@@ -45,6 +50,9 @@ enum class ElementwiseOp : uint8_t {
     SIGMOID = 13,  // v1.1: 1 / (1 + exp(-x))
 };
 
+// Values match ir::OpKind, so latency histograms key on the cast (spec 012).
+static_assert(static_cast<uint8_t>(ElementwiseOp::SIGMOID) == static_cast<uint8_t>(ir::OpKind::SIGMOID));
+
 namespace detail {
 
 // File-private validation helpers. Not part of the public API.
@@ -62,6 +70,8 @@ inline Status validate_unary(const Tensor& input, const Tensor& output) noexcept
         return status::invalid_argument("ndim mismatch");
     if (input.numel() != output.numel())
         return status::invalid_argument("shape mismatch");
+    if (!input.is_contiguous() || !output.is_contiguous())
+        return status::invalid_argument("non-contiguous input");
     return status::OK;
 }
 
@@ -81,6 +91,8 @@ inline Status validate_binary(const Tensor& a, const Tensor& b, const Tensor& ou
         return status::invalid_argument("a and output must have matching numel");
     if (a.numel() != b.numel() && b.numel() != 1)
         return status::invalid_argument("b must match a or be a scalar (numel==1)");
+    if (!a.is_contiguous() || !b.is_contiguous() || !output.is_contiguous())
+        return status::invalid_argument("non-contiguous input");
     return status::OK;
 }
 
@@ -91,6 +103,88 @@ inline Status validate_scalar_op(const Tensor& input, const Tensor& output) noex
 
 } // namespace detail
 
+// ─────────────────────────────────────────────────────────────────────
+// Kernels (spec 004)
+//
+// Shared bodies of the checked and unchecked entry points. They assume
+// validated operands, only reject an `op` with no kernel, and forward the
+// loops to kernels/kernels.hpp (spec 005). [begin, end) selects a range
+// of elements (end < 0: all) for the parallel entry points (spec 026).
+// ─────────────────────────────────────────────────────────────────────
+
+namespace detail {
+
+inline Status unary_kernel(const Tensor& input, Tensor& output, ElementwiseOp op,
+                           int64_t begin = 0, int64_t end = -1) noexcept {
+    if (end < 0) end = input.numel();
+    const float* in_ptr = static_cast<const float*>(input.data) + begin;
+    float* out_ptr = static_cast<float*>(output.data) + begin;
+    int64_t n = end - begin;
+
+    switch (op) {
+        case ElementwiseOp::NEG:     kernels::neg_f32(in_ptr, out_ptr, n); break;
+        case ElementwiseOp::ABS:     kernels::abs_f32(in_ptr, out_ptr, n); break;
+        case ElementwiseOp::EXP:     kernels::exp_f32(in_ptr, out_ptr, n); break;
+        case ElementwiseOp::LOG:     kernels::log_f32(in_ptr, out_ptr, n); break;
+        case ElementwiseOp::SQRT:    kernels::sqrt_f32(in_ptr, out_ptr, n); break;
+        case ElementwiseOp::SIN:     kernels::sin_f32(in_ptr, out_ptr, n); break;
+        case ElementwiseOp::COS:     kernels::cos_f32(in_ptr, out_ptr, n); break;
+        case ElementwiseOp::TANH:    kernels::tanh_f32(in_ptr, out_ptr, n); break;
+        case ElementwiseOp::RELU:    kernels::relu_f32(in_ptr, out_ptr, n); break;
+        case ElementwiseOp::SIGMOID: kernels::sigmoid_f32(in_ptr, out_ptr, n); break;
+        default:
+            return status::invalid_argument("unsupported unary op");
+    }
+    return status::OK;
+}
+
+// Scalar-RHS form shared by scalar_op and the b.numel() == 1 binary path.
+inline Status scalar_rhs_kernel(const float* a_ptr, float s_val, float* out_ptr, int64_t n,
+                                ElementwiseOp op, const char* unsupported_msg) noexcept {
+    switch (op) {
+        case ElementwiseOp::ADD: kernels::add_scalar_f32(a_ptr, s_val, out_ptr, n); break;
+        case ElementwiseOp::SUB: kernels::sub_scalar_f32(a_ptr, s_val, out_ptr, n); break;
+        case ElementwiseOp::MUL: kernels::mul_scalar_f32(a_ptr, s_val, out_ptr, n); break;
+        case ElementwiseOp::DIV: kernels::div_scalar_f32(a_ptr, s_val, out_ptr, n); break;
+        default:
+            return status::invalid_argument(unsupported_msg);
+    }
+    return status::OK;
+}
+
+inline Status binary_kernel(const Tensor& a, const Tensor& b, Tensor& output,
+                            ElementwiseOp op, int64_t begin = 0, int64_t end = -1) noexcept {
+    if (end < 0) end = output.numel();
+    const float* a_ptr = static_cast<const float*>(a.data) + begin;
+    const float* b_ptr = static_cast<const float*>(b.data);
+    float* out_ptr = static_cast<float*>(output.data) + begin;
+    int64_t n = end - begin;
+
+    if (a.numel() != b.numel()) {
+        return scalar_rhs_kernel(a_ptr, b_ptr[0], out_ptr, n, op, "unsupported binary op");
+    }
+    b_ptr += begin;
+    switch (op) {
+        case ElementwiseOp::ADD: kernels::add_f32(a_ptr, b_ptr, out_ptr, n); break;
+        case ElementwiseOp::SUB: kernels::sub_f32(a_ptr, b_ptr, out_ptr, n); break;
+        case ElementwiseOp::MUL: kernels::mul_f32(a_ptr, b_ptr, out_ptr, n); break;
+        case ElementwiseOp::DIV: kernels::div_f32(a_ptr, b_ptr, out_ptr, n); break;
+        default:
+            return status::invalid_argument("unsupported binary op");
+    }
+    return status::OK;
+}
+
+inline Status scalar_kernel(const Tensor& input, const Scalar& scalar, Tensor& output,
+                            ElementwiseOp op, int64_t begin = 0, int64_t end = -1) noexcept {
+    if (end < 0) end = input.numel();
+    return scalar_rhs_kernel(static_cast<const float*>(input.data) + begin, scalar.to_f32(),
+                             static_cast<float*>(output.data) + begin, end - begin,
+                             op, "unsupported scalar op");
+}
+
+} // namespace detail
+
 // ─────────────────────────────────────────────────────────────────────
 // Unary Operations (in-place capable)
 // ─────────────────────────────────────────────────────────────────────
@@ -104,46 +198,10 @@ inline Status unary_op(const Tensor& input, Tensor& output, ElementwiseOp op,
                        Stream* stream = nullptr) noexcept {
     (void)stream;  // Spec 003: parameter committed for GPU; CPU ignores.
     if (Status s = detail::validate_unary(input, output); s.is_error()) return s;
-
-    const float* in_ptr = static_cast<const float*>(input.data);
-    float* out_ptr = static_cast<float*>(output.data);
-    int64_t n = input.numel();
-
-    switch (op) {
-        case ElementwiseOp::NEG:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = -in_ptr[i];
-            break;
-        case ElementwiseOp::ABS:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = std::abs(in_ptr[i]);
-            break;
-        case ElementwiseOp::EXP:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = std::exp(in_ptr[i]);
-            break;
-        case ElementwiseOp::LOG:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = std::log(in_ptr[i]);
-            break;
-        case ElementwiseOp::SQRT:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = std::sqrt(in_ptr[i]);
-            break;
-        case ElementwiseOp::SIN:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = std::sin(in_ptr[i]);
-            break;
-        case ElementwiseOp::COS:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = std::cos(in_ptr[i]);
-            break;
-        case ElementwiseOp::TANH:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = std::tanh(in_ptr[i]);
-            break;
-        case ElementwiseOp::RELU:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = in_ptr[i] > 0.0f ? in_ptr[i] : 0.0f;
-            break;
-        case ElementwiseOp::SIGMOID:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = 1.0f / (1.0f + std::exp(-in_ptr[i]));
-            break;
-        default:
-            return status::invalid_argument("unsupported unary op");
-    }
-    return status::OK;
+    ZERO_OP_TIMER(static_cast<ir::OpKind>(op), output.numel());
+    ZERO_OP_PROFILE_SCOPE(static_cast<ir::OpKind>(op));
+    ZERO_OP_METRICS(static_cast<ir::OpKind>(op), input.nbytes() + output.nbytes(), output.numel());
+    return detail::unary_kernel(input, output, op);
 }
 
 // ─────────────────────────────────────────────────────────────────────
@@ -164,49 +222,11 @@ inline Status binary_op(
 ) noexcept {
     (void)stream;
     if (Status s = detail::validate_binary(a, b, output); s.is_error()) return s;
-
-    const float* a_ptr = static_cast<const float*>(a.data);
-    const float* b_ptr = static_cast<const float*>(b.data);
-    float* out_ptr = static_cast<float*>(output.data);
-    int64_t n = output.numel();
-
-    if (a.numel() == b.numel()) {
-        switch (op) {
-            case ElementwiseOp::ADD:
-                for (int64_t i = 0; i < n; ++i) out_ptr[i] = a_ptr[i] + b_ptr[i];
-                break;
-            case ElementwiseOp::SUB:
-                for (int64_t i = 0; i < n; ++i) out_ptr[i] = a_ptr[i] - b_ptr[i];
-                break;
-            case ElementwiseOp::MUL:
-                for (int64_t i = 0; i < n; ++i) out_ptr[i] = a_ptr[i] * b_ptr[i];
-                break;
-            case ElementwiseOp::DIV:
-                for (int64_t i = 0; i < n; ++i) out_ptr[i] = a_ptr[i] / b_ptr[i];
-                break;
-            default:
-                return status::invalid_argument("unsupported binary op");
-        }
-    } else {
-        float b_val = b_ptr[0];
-        switch (op) {
-            case ElementwiseOp::ADD:
-                for (int64_t i = 0; i < n; ++i) out_ptr[i] = a_ptr[i] + b_val;
-                break;
-            case ElementwiseOp::SUB:
-                for (int64_t i = 0; i < n; ++i) out_ptr[i] = a_ptr[i] - b_val;
-                break;
-            case ElementwiseOp::MUL:
-                for (int64_t i = 0; i < n; ++i) out_ptr[i] = a_ptr[i] * b_val;
-                break;
-            case ElementwiseOp::DIV:
-                for (int64_t i = 0; i < n; ++i) out_ptr[i] = a_ptr[i] / b_val;
-                break;
-            default:
-                return status::invalid_argument("unsupported binary op");
-        }
-    }
-    return status::OK;
+    ZERO_OP_TIMER(static_cast<ir::OpKind>(op), output.numel());
+    ZERO_OP_PROFILE_SCOPE(static_cast<ir::OpKind>(op));
+    ZERO_OP_METRICS(static_cast<ir::OpKind>(op), a.nbytes() + b.nbytes() + output.nbytes(),
+                    output.numel());
+    return detail::binary_kernel(a, b, output, op);
 }
 
 // ─────────────────────────────────────────────────────────────────────
@@ -222,29 +242,60 @@ inline Status scalar_op(
 ) noexcept {
     (void)stream;
     if (Status s = detail::validate_scalar_op(input, output); s.is_error()) return s;
+    ZERO_OP_TIMER(static_cast<ir::OpKind>(op), output.numel());
+    ZERO_OP_PROFILE_SCOPE(static_cast<ir::OpKind>(op));
+    ZERO_OP_METRICS(static_cast<ir::OpKind>(op), input.nbytes() + output.nbytes(), output.numel());
+    return detail::scalar_kernel(input, scalar, output, op);
+}
 
-    const float* in_ptr = static_cast<const float*>(input.data);
-    float* out_ptr = static_cast<float*>(output.data);
-    float s_val = scalar.to_f32();
-    int64_t n = input.numel();
+// ─────────────────────────────────────────────────────────────────────
+// Parallel Entry Points (spec 026)
+//
+// Same validation and results as above. The element range is split on
+// par.pool with the participants and grain par.model picks for this
+// call; the measured time is fed back to the model.
+// ─────────────────────────────────────────────────────────────────────
 
-    switch (op) {
-        case ElementwiseOp::ADD:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = in_ptr[i] + s_val;
-            break;
-        case ElementwiseOp::SUB:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = in_ptr[i] - s_val;
-            break;
-        case ElementwiseOp::MUL:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = in_ptr[i] * s_val;
-            break;
-        case ElementwiseOp::DIV:
-            for (int64_t i = 0; i < n; ++i) out_ptr[i] = in_ptr[i] / s_val;
-            break;
-        default:
-            return status::invalid_argument("unsupported scalar op");
-    }
-    return status::OK;
+inline Status unary_op(const Tensor& input, Tensor& output, ElementwiseOp op,
+                       const exec::ParallelContext& par) noexcept {
+    if (Status s = detail::validate_unary(input, output); s.is_error()) return s;
+    if (Status s = detail::unary_kernel(input, output, op, 0, 0); s.is_error()) return s;
+    auto kind = static_cast<ir::OpKind>(op);
+    ZERO_OP_TIMER(kind, output.numel());
+    ZERO_OP_PROFILE_SCOPE(kind);
+    ZERO_OP_METRICS(kind, input.nbytes() + output.nbytes(), output.numel());
+    exec::OpCost cost = exec::estimate_cost(kind, output.shape.data(), output.ndim, output.dtype);
+    return exec::run_planned(par, kind, cost, [&](int64_t b, int64_t e) {
+        (void)detail::unary_kernel(input, output, op, b, e);
+    });
+}
+
+inline Status binary_op(const Tensor& a, const Tensor& b, Tensor& output, ElementwiseOp op,
+                        const exec::ParallelContext& par) noexcept {
+    if (Status s = detail::validate_binary(a, b, output); s.is_error()) return s;
+    if (Status s = detail::binary_kernel(a, b, output, op, 0, 0); s.is_error()) return s;
+    auto kind = static_cast<ir::OpKind>(op);
+    ZERO_OP_TIMER(kind, output.numel());
+    ZERO_OP_PROFILE_SCOPE(kind);
+    ZERO_OP_METRICS(kind, a.nbytes() + b.nbytes() + output.nbytes(), output.numel());
+    exec::OpCost cost = exec::estimate_cost(kind, output.shape.data(), output.ndim, output.dtype);
+    return exec::run_planned(par, kind, cost, [&](int64_t lo, int64_t hi) {
+        (void)detail::binary_kernel(a, b, output, op, lo, hi);
+    });
+}
+
+inline Status scalar_op(const Tensor& input, const Scalar& scalar, Tensor& output, ElementwiseOp op,
+                        const exec::ParallelContext& par) noexcept {
+    if (Status s = detail::validate_scalar_op(input, output); s.is_error()) return s;
+    if (Status s = detail::scalar_kernel(input, scalar, output, op, 0, 0); s.is_error()) return s;
+    auto kind = static_cast<ir::OpKind>(op);
+    ZERO_OP_TIMER(kind, output.numel());
+    ZERO_OP_PROFILE_SCOPE(kind);
+    ZERO_OP_METRICS(kind, input.nbytes() + output.nbytes(), output.numel());
+    exec::OpCost cost = exec::estimate_cost(kind, output.shape.data(), output.ndim, output.dtype);
+    return exec::run_planned(par, kind, cost, [&](int64_t b, int64_t e) {
+        (void)detail::scalar_kernel(input, scalar, output, op, b, e);
+    });
 }
 
 // ─────────────────────────────────────────────────────────────────────
@@ -295,5 +346,82 @@ inline Status sigmoid(const Tensor& input, Tensor& out, Stream* stream = nullptr
     return unary_op(input, out, ElementwiseOp::SIGMOID, stream);
 }
 
+// ─────────────────────────────────────────────────────────────────────
+// Unchecked Entry Points (spec 004)
+//
+// For compiler-generated code that has already proven every precondition
+// of the checked op statically. No validation in release builds; debug
+// builds assert via ZERO_UNCHECKED_PRECONDITION. Violating a precondition
+// in a release build is undefined behavior.
+// ─────────────────────────────────────────────────────────────────────
+
+inline void unary_op_unchecked(const Tensor& input, Tensor& output, ElementwiseOp op,
+                               Stream* stream = nullptr) noexcept {
+    (void)stream;
+    ZERO_UNCHECKED_PRECONDITION(detail::validate_unary(input, output));
+    [[maybe_unused]] Status s = detail::unary_kernel(input, output, op);
+    ZERO_UNCHECKED_PRECONDITION(s);
+}
+
+inline void binary_op_unchecked(const Tensor& a, const Tensor& b, Tensor& output,
+                                ElementwiseOp op, Stream* stream = nullptr) noexcept {
+    (void)stream;
+    ZERO_UNCHECKED_PRECONDITION(detail::validate_binary(a, b, output));
+    [[maybe_unused]] Status s = detail::binary_kernel(a, b, output, op);
+    ZERO_UNCHECKED_PRECONDITION(s);
+}
+
+inline void scalar_op_unchecked(const Tensor& input, const Scalar& scalar, Tensor& output,
+                                ElementwiseOp op, Stream* stream = nullptr) noexcept {
+    (void)stream;
+    ZERO_UNCHECKED_PRECONDITION(detail::validate_scalar_op(input, output));
+    [[maybe_unused]] Status s = detail::scalar_kernel(input, scalar, output, op);
+    ZERO_UNCHECKED_PRECONDITION(s);
+}
+
+inline void add_unchecked(const Tensor& a, const Tensor& b, Tensor& out, Stream* stream = nullptr) noexcept {
+    binary_op_unchecked(a, b, out, ElementwiseOp::ADD, stream);
+}
+
+inline void sub_unchecked(const Tensor& a, const Tensor& b, Tensor& out, Stream* stream = nullptr) noexcept {
+    binary_op_unchecked(a, b, out, ElementwiseOp::SUB, stream);
+}
+
+inline void mul_unchecked(const Tensor& a, const Tensor& b, Tensor& out, Stream* stream = nullptr) noexcept {
+    binary_op_unchecked(a, b, out, ElementwiseOp::MUL, stream);
+}
+
+inline void div_unchecked(const Tensor& a, const Tensor& b, Tensor& out, Stream* stream = nullptr) noexcept {
+    binary_op_unchecked(a, b, out, ElementwiseOp::DIV, stream);
+}
+
+inline void neg_unchecked(const Tensor& input, Tensor& out, Stream* stream = nullptr) noexcept {
+    unary_op_unchecked(input, out, ElementwiseOp::NEG, stream);
+}
+
+inline void exp_unchecked(const Tensor& input, Tensor& out, Stream* stream = nullptr) noexcept {
+    unary_op_unchecked(input, out, ElementwiseOp::EXP, stream);
+}
+
+inline void log_unchecked(const Tensor& input, Tensor& out, Stream* stream = nullptr) noexcept {
+    unary_op_unchecked(input, out, ElementwiseOp::LOG, stream);
+}
+
+inline void sqrt_unchecked(const Tensor& input, Tensor& out, Stream* stream = nullptr) noexcept {
+    unary_op_unchecked(input, out, ElementwiseOp::SQRT, stream);
+}
+
+inline void tanh_unchecked(const Tensor& input, Tensor& out, Stream* stream = nullptr) noexcept {
+    unary_op_unchecked(input, out, ElementwiseOp::TANH, stream);
+}
+
+inline void relu_unchecked(const Tensor& input, Tensor& out, Stream* stream = nullptr) noexcept {
+    unary_op_unchecked(input, out, ElementwiseOp::RELU, stream);
+}
+
+inline void sigmoid_unchecked(const Tensor& input, Tensor& out, Stream* stream = nullptr) noexcept {
+    unary_op_unchecked(input, out, ElementwiseOp::SIGMOID, stream);
+}
+
 } // namespace ops
 } // namespace zero
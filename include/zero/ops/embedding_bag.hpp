@@ -0,0 +1,194 @@
+#pragma once
+
+/**
+ * @file embedding_bag.hpp
+ * @brief Zero Core Runtime — Fused Embedding Bag
+ *
+ * out[b, :] = pool over p in [offsets[b], offsets[b+1]) of
+ *             weights[p] * table[indices[p], :]
+ *
+ * Bags are CSR: offsets has n_bags + 1 entries, offsets[0] == 0 and
+ * offsets[n_bags] == n_ids. Rows are accumulated straight into the
+ * pooled output; no [n_ids, D] gather tensor is ever built.
+ */
+
+#include "../core/tensor.hpp"
+#include "../core/status.hpp"
+#include "../device/sync.hpp"
+#include "../exec/thread_pool.hpp"
+#include "../kernels/kernels.hpp"
+#include "../telemetry/histogram.hpp"
+#include "../telemetry/profiler.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+
+#include <algorithm>
+
+namespace zero {
+namespace ops {
+
+/**
+ * @brief Pooling applied within a bag
+ */
+enum class BagMode : uint8_t {
+    SUM = 0,
+    MEAN = 1,
+};
+
+/// Upper bound on bag ranges (parallel tasks) for one embedding_bag call.
+constexpr int32_t EMBEDDING_BAG_MAX_THREADS = 64;
+
+/// Auto threading uses one range per this many gathered floats.
+constexpr int64_t EMBEDDING_BAG_WORK_PER_THREAD = int64_t{1} << 16;
+
+namespace detail {
+
+inline int64_t bag_offset(const Tensor& offsets, int64_t i) noexcept {
+    return offsets.dtype == DType::I64 ? static_cast<const int64_t*>(offsets.data)[i]
+                                       : static_cast<const int32_t*>(offsets.data)[i];
+}
+
+inline Status validate_embedding_bag(const Tensor& table, const Tensor& indices,
+                                     const Tensor& offsets, const Tensor& weights,
+                                     const Tensor& out, BagMode mode) noexcept {
+    if (table.data == nullptr || out.data == nullptr || offsets.data == nullptr)
+        return status::invalid_state("null data pointer");
+    if (table.device != Device::CPU || indices.device != Device::CPU ||
+        offsets.device != Device::CPU || out.device != Device::CPU)
+        return status::invalid_argument("non-CPU device not supported");
+    if (table.dtype != DType::F32 || out.dtype != DType::F32)
+        return status::type_mismatch("table and output must be F32");
+    if (indices.dtype != DType::I64 && indices.dtype != DType::I32)
+        return status::type_mismatch("indices must be I64 or I32");
+    if (offsets.dtype != indices.dtype)
+        return status::type_mismatch("offsets and indices dtype disagree");
+    if (table.ndim != 2 || out.ndim != 2 || indices.ndim != 1 || offsets.ndim != 1)
+        return status::invalid_argument("expected table [R, D], indices [n], offsets [B + 1], out [B, D]");
+    if (!table.is_contiguous() || !indices.is_contiguous() || !offsets.is_contiguous() ||
+        !out.is_contiguous())
+        return status::invalid_argument("operands must be contiguous");
+    int64_t bags = offsets.shape[0] - 1;
+    if (bags < 0 || out.shape[0] != bags || out.shape[1] != table.shape[1])
+        return status::invalid_argument("output shape mismatch (must be [n_bags, D])");
+    int64_t n = indices.shape[0];
+    if (n > 0 && indices.data == nullptr) return status::invalid_state("null data pointer");
+    if (weights.data != nullptr) {
+        if (mode != BagMode::SUM)
+            return status::invalid_argument("per-sample weights require BagMode::SUM");
+        if (weights.dtype != DType::F32 || weights.device != Device::CPU ||
+            weights.ndim != 1 || weights.shape[0] != n || !weights.is_contiguous())
+            return status::invalid_argument("per-sample weights must be contiguous F32 [n]");
+    }
+    if (bag_offset(offsets, 0) != 0 || bag_offset(offsets, bags) != n)
+        return status::invalid_argument("offsets must start at 0 and end at n_ids");
+    for (int64_t b = 0; b < bags; ++b)
+        if (bag_offset(offsets, b + 1) < bag_offset(offsets, b))
+            return status::invalid_argument("offsets must be non-decreasing");
+    int64_t rows = table.shape[0];
+    for (int64_t p = 0; p < n; ++p) {
+        int64_t id = indices.dtype == DType::I64 ? static_cast<const int64_t*>(indices.data)[p]
+                                                 : static_cast<const int32_t*>(indices.data)[p];
+        if (id < 0 || id >= rows) return status::out_of_bounds("embedding index outside table");
+    }
+    return status::OK;
+}
+
+inline void embedding_bag_range(const Tensor& table, const Tensor& indices,
+                                const Tensor& offsets, const float* weights, Tensor& out,
+                                int64_t b0, int64_t b1, int32_t mean) noexcept {
+    const float* t = static_cast<const float*>(table.data);
+    float* y = static_cast<float*>(out.data);
+    int64_t dim = table.shape[1];
+    if (indices.dtype == DType::I64) {
+        kernels::embedding_bag_f32_i64(t, dim, static_cast<const int64_t*>(indices.data),
+                                       static_cast<const int64_t*>(offsets.data), weights, y,
+                                       b0, b1, mean);
+    } else {
+        kernels::embedding_bag_f32_i32(t, dim, static_cast<const int32_t*>(indices.data),
+                                       static_cast<const int32_t*>(offsets.data), weights, y,
+                                       b0, b1, mean);
+    }
+}
+
+// First bag whose ids start at or after target (offsets are sorted).
+inline int64_t bag_at_id(const Tensor& offsets, int64_t bags, int64_t target) noexcept {
+    int64_t lo = 0, hi = bags;
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (bag_offset(offsets, mid) < target) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+} // namespace detail
+
+/**
+ * @brief Fused gather + pool over CSR bags
+ *
+ * @param table    F32 [R, D] embedding rows
+ * @param indices  I64 or I32 [n] row ids, each in [0, R)
+ * @param offsets  same dtype as indices, [B + 1] bag boundaries
+ * @param out      F32 [B, D]; empty bags produce zeros
+ * @param weights  optional F32 [n] per-sample weights (SUM only); empty = none
+ * @param threads  bag ranges to split into; 0 picks from the gathered volume
+ * @param pool     runs the ranges; nullptr runs on the caller only
+ *
+ * Bags are split into contiguous ranges holding about the same number
+ * of ids, so skewed bag sizes still balance. The range count is capped
+ * by the pool's participants. Each bag is reduced by one thread in id
+ * order, so results do not depend on the thread count.
+ */
+inline Status embedding_bag(
+    const Tensor& table,
+    const Tensor& indices,
+    const Tensor& offsets,
+    Tensor& out,
+    BagMode mode = BagMode::SUM,
+    const Tensor& weights = Tensor::empty(),
+    int32_t threads = 0,
+    exec::ThreadPool* pool = nullptr,
+    Stream* stream = nullptr
+) noexcept {
+    (void)stream;  // Spec 003: parameter committed for GPU; CPU ignores.
+    if (threads < 0 || threads > EMBEDDING_BAG_MAX_THREADS)
+        return status::invalid_argument("thread count out of range");
+    if (Status s = detail::validate_embedding_bag(table, indices, offsets, weights, out, mode);
+        s.is_error())
+        return s;
+    int64_t bags = out.shape[0];
+    int64_t n = indices.shape[0];
+    ZERO_OP_TIMER(ir::OpKind::EMBEDDING_BAG, n * table.shape[1]);
+    ZERO_OP_PROFILE_SCOPE(ir::OpKind::EMBEDDING_BAG);
+    ZERO_OP_METRICS(ir::OpKind::EMBEDDING_BAG,
+                    n * table.shape[1] * static_cast<int64_t>(sizeof(float)) + indices.nbytes() +
+                        offsets.nbytes() + weights.nbytes() + out.nbytes(),
+                    (weights.data != nullptr ? 2 : 1) * n * table.shape[1]);
+
+    const float* w = static_cast<const float*>(weights.data);
+    int32_t mean = mode == BagMode::MEAN ? 1 : 0;
+    int64_t participants = pool != nullptr && pool->size() > 0 ? pool->size() : 1;
+    int64_t nt = threads;
+    if (nt == 0) nt = std::min<int64_t>(n * table.shape[1] / EMBEDDING_BAG_WORK_PER_THREAD,
+                                        EMBEDDING_BAG_MAX_THREADS);
+    nt = std::max<int64_t>(1, std::min(std::min(nt, participants), bags));
+    if (nt == 1) {
+        if (bags > 0) detail::embedding_bag_range(table, indices, offsets, w, out, 0, bags, mean);
+        return status::OK;
+    }
+
+    // Split points by id count; range i is bags [cut[i], cut[i+1]).
+    int64_t cut[EMBEDDING_BAG_MAX_THREADS + 1];
+    cut[0] = 0;
+    cut[nt] = bags;
+    for (int64_t i = 1; i < nt; ++i) {
+        int64_t c = detail::bag_at_id(offsets, bags, n * i / nt);
+        cut[i] = std::max(c, cut[i - 1]);
+    }
+    return pool->parallel_for(nt, [&](int64_t i) noexcept {
+        if (cut[i] < cut[i + 1])
+            detail::embedding_bag_range(table, indices, offsets, w, out, cut[i], cut[i + 1], mean);
+    }, -1, static_cast<int32_t>(nt));
+}
+
+} // namespace ops
+} // namespace zero
@@ -0,0 +1,556 @@
+#pragma once
+
+/**
+ * @file gemm_tune.hpp
+ * @brief Zero Core Runtime — Blocked GEMM Autotuning
+ *
+ * The best blocked-gemm tiles (mc/kc/nc, micro-kernel shape, thread split)
+ * depend on the host's caches and the problem shape. GemmTuner benchmarks
+ * candidate tiles per (M, N, K, dtype, threads) key, keeps the winners,
+ * and persists them to a versioned cache file stamped with the CPU model.
+ * Shapes without an entry fall back to gemm_heuristic().
+ *
+ * gemm_blocked never allocates or spawns: the caller passes the workspace
+ * (see gemm_blocked_workspace_floats) and, to split rows, a ThreadPool.
+ *
+ * Typical fleet flow: run tune() for the serving shapes once per host
+ * type, save() the cache, and point ZERO_GEMM_TUNE_CACHE at it; the global
+ * gemm_tuner() loads it on first use.
+ */
+
+#include "../core/tensor.hpp"
+#include "../core/memory.hpp"
+#include "../core/status.hpp"
+#include "../device/sync.hpp"
+#include "../exec/thread_pool.hpp"
+#include "../kernels/gemm_blocked.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+#include "matmul.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace zero {
+namespace ops {
+
+/**
+ * @brief Tuning cache key
+ */
+struct GemmKey {
+    int64_t m = 0;
+    int64_t n = 0;
+    int64_t k = 0;
+    DType dtype = DType::F32;
+    int32_t threads = 1;
+
+    bool operator==(const GemmKey& o) const noexcept {
+        return m == o.m && n == o.n && k == o.k && dtype == o.dtype && threads == o.threads;
+    }
+};
+
+struct GemmTuneOptions {
+    int32_t reps = 3;                     ///< Timed runs per candidate (best kept)
+    int32_t max_candidates = 0;           ///< 0 = the whole tile grid
+    exec::ThreadPool* pool = nullptr;     ///< Runs the timed calls; bounds the split search
+};
+
+struct GemmTuneEntry {
+    GemmKey key;
+    kernels::GemmTiles tiles;
+    double gflops = 0.0;
+};
+
+/// Bumped whenever the file layout or the meaning of a tile field changes.
+constexpr int32_t GEMM_TUNE_CACHE_VERSION = 2;
+constexpr int32_t GEMM_TUNE_MAX_ENTRIES = 256;
+constexpr size_t GEMM_TUNE_CPU_MODEL_MAX = 128;
+
+namespace detail {
+
+inline int32_t clip_tile(int64_t want, int64_t extent) noexcept {
+    return static_cast<int32_t>(want < extent ? want : extent);
+}
+
+// Tiles larger than the problem only waste workspace; results are
+// identical for any tiles.
+inline kernels::GemmTiles clip_tiles(const kernels::GemmTiles& tiles,
+                                     int64_t m, int64_t n, int64_t k) noexcept {
+    kernels::GemmTiles t = tiles;
+    t.mc = clip_tile(t.mc, m > 0 ? m : 1);
+    t.kc = clip_tile(t.kc, k > 0 ? k : 1);
+    t.nc = clip_tile(t.nc, n > 0 ? n : 1);
+    return t;
+}
+
+inline int32_t pool_participants(const exec::ThreadPool* pool) noexcept {
+    return pool != nullptr && pool->size() > 0 ? pool->size() : 1;
+}
+
+// Run every row chunk, on the pool when there is one.
+inline void run_gemm_blocked(const float* a, const float* b, float* c,
+                             int64_t M, int64_t N, int64_t K, float alpha, float beta,
+                             const kernels::GemmTiles& t, float* ws,
+                             exec::ThreadPool* pool) noexcept {
+    int64_t chunks = kernels::gemm_blocked_chunks(M, t);
+    if (pool == nullptr || chunks <= 1) {
+        kernels::gemm_blocked_f32(a, b, c, M, N, K, alpha, beta, t, ws);
+        return;
+    }
+    (void)pool->parallel_for(chunks, [&](int64_t i) noexcept {
+        kernels::gemm_blocked_chunk_f32(a, b, c, M, N, K, alpha, beta, t, ws, i);
+    }, -1, t.threads);
+}
+
+inline void read_cpu_model(char* out, size_t cap) noexcept {
+    std::snprintf(out, cap, "unknown");
+#if defined(__linux__)
+    std::FILE* f = std::fopen("/proc/cpuinfo", "r");
+    if (f == nullptr) return;
+    char line[256];
+    while (std::fgets(line, sizeof(line), f) != nullptr) {
+        if (std::strncmp(line, "model name", 10) != 0) continue;
+        const char* colon = std::strchr(line, ':');
+        if (colon == nullptr) break;
+        const char* v = colon + 1;
+        while (*v == ' ' || *v == '\t') ++v;
+        std::snprintf(out, cap, "%s", v);
+        size_t len = std::strlen(out);
+        while (len > 0 && (out[len - 1] == '\n' || out[len - 1] == '\r' || out[len - 1] == ' '))
+            out[--len] = '\0';
+        break;
+    }
+    std::fclose(f);
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @brief Host CPU model string used to stamp tuning caches
+ */
+inline const char* host_cpu_model() noexcept {
+    static char model[GEMM_TUNE_CPU_MODEL_MAX] = {};
+    static bool once = (detail::read_cpu_model(model, sizeof(model)), true);
+    (void)once;
+    return model;
+}
+
+/**
+ * @brief Untuned tiles: A block ~64 KiB (L2), B panel and accumulator sized
+ * for a shared L3 slice, 4x16 micro-kernel.
+ */
+inline kernels::GemmTiles gemm_heuristic(const GemmKey& key) noexcept {
+    kernels::GemmTiles t;
+    t.kc = detail::clip_tile(256, key.k > 0 ? key.k : 1);
+    t.mc = detail::clip_tile(64, key.m > 0 ? key.m : 1);
+    t.nc = detail::clip_tile(512, key.n > 0 ? key.n : 1);
+    t.mr = 4;
+    t.nr = key.n < 16 ? 8 : 16;
+    t.threads = key.threads < 1 ? 1
+              : key.threads > kernels::GEMM_MAX_THREADS ? kernels::GEMM_MAX_THREADS
+              : key.threads;
+    return t;
+}
+
+/**
+ * @brief Tuning table with on-disk persistence
+ *
+ * Not thread-safe for writers: tune()/load()/insert() at startup, then
+ * select()/find() from any thread.
+ */
+struct GemmTuner {
+    GemmTuner() noexcept {
+        std::snprintf(cpu_model_, sizeof(cpu_model_), "%s", host_cpu_model());
+    }
+
+    /**
+     * @brief Tuned tiles for key, if cached
+     */
+    bool find(const GemmKey& key, kernels::GemmTiles* out) const noexcept {
+        for (int32_t i = 0; i < count_; ++i) {
+            if (entries_[i].key == key) {
+                if (out != nullptr) *out = entries_[i].tiles;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Cached tiles, else gemm_heuristic(key)
+     */
+    kernels::GemmTiles select(const GemmKey& key) const noexcept {
+        kernels::GemmTiles t;
+        return find(key, &t) ? t : gemm_heuristic(key);
+    }
+
+    /**
+     * @brief Add or replace an entry
+     *
+     * The tiles' thread split may be below key.threads (the tuner found
+     * fewer chunks faster) but never above it.
+     */
+    Status insert(const GemmKey& key, const kernels::GemmTiles& tiles, double gflops) noexcept {
+        if (key.m < 1 || key.n < 1 || key.k < 1) return status::invalid_argument("empty gemm shape");
+        if (key.dtype != DType::F32) return status::type_mismatch("only F32 gemm is tunable");
+        if (key.threads < 1 || key.threads > kernels::GEMM_MAX_THREADS)
+            return status::invalid_argument("threads out of range");
+        if (!kernels::gemm_tiles_valid(tiles)) return status::invalid_argument("invalid gemm tiles");
+        if (tiles.threads > key.threads)
+            return status::invalid_argument("thread split exceeds the key's threads");
+        for (int32_t i = 0; i < count_; ++i) {
+            if (entries_[i].key == key) {
+                entries_[i].tiles = tiles;
+                entries_[i].gflops = gflops;
+                return status::OK;
+            }
+        }
+        if (count_ == GEMM_TUNE_MAX_ENTRIES) return status::out_of_bounds("tuning table full");
+        entries_[count_++] = GemmTuneEntry{key, tiles, gflops};
+        return status::OK;
+    }
+
+    /**
+     * @brief Benchmark the candidate grid for key and cache the winner
+     *
+     * Two passes. First the tile grid: mc x kc x nc x micro-kernel shapes,
+     * clipped to the problem and de-duplicated, at the widest split; the
+     * heuristic is always measured first. Then the thread split for the
+     * winning tiles: powers of two up to the widest. The widest split is
+     * min(key.threads, opts.pool participants), so tuning without a pool
+     * settles on one chunk. Allocates the operands and workspace for the
+     * duration of the call.
+     */
+    Status tune(const GemmKey& key, const GemmTuneOptions& opts = GemmTuneOptions{},
+                kernels::GemmTiles* best_out = nullptr) noexcept {
+        if (key.m < 1 || key.n < 1 || key.k < 1) return status::invalid_argument("empty gemm shape");
+        if (key.dtype != DType::F32) return status::type_mismatch("only F32 gemm is tunable");
+        if (key.threads < 1 || key.threads > kernels::GEMM_MAX_THREADS)
+            return status::invalid_argument("threads out of range");
+        if (opts.reps < 1) return status::invalid_argument("reps must be >= 1");
+
+        static constexpr int32_t kMc[] = {32, 64, 128, 256};
+        static constexpr int32_t kKc[] = {64, 128, 256, 512};
+        static constexpr int32_t kNc[] = {128, 256, 512, 1024};
+        static constexpr int32_t kMicro[][2] = {{4, 8}, {4, 16}, {6, 16}, {8, 8}};
+
+        int32_t widest = detail::pool_participants(opts.pool);
+        if (widest > key.threads) widest = key.threads;
+
+        constexpr int32_t kMaxCandidates = 4 * 4 * 4 * 4 + 1;
+        kernels::GemmTiles cand[kMaxCandidates];
+        int32_t n_cand = 0;
+        auto add = [&](kernels::GemmTiles t) noexcept {
+            t = detail::clip_tiles(t, key.m, key.n, key.k);
+            t.threads = widest;
+            for (int32_t i = 0; i < n_cand; ++i) {
+                const kernels::GemmTiles& c = cand[i];
+                if (c.mc == t.mc && c.kc == t.kc && c.nc == t.nc && c.mr == t.mr && c.nr == t.nr) return;
+            }
+            cand[n_cand++] = t;
+        };
+        add(gemm_heuristic(key));
+        for (const auto& micro : kMicro)
+            for (int32_t mc : kMc)
+                for (int32_t kc : kKc)
+                    for (int32_t nc : kNc) {
+                        kernels::GemmTiles t;
+                        t.mc = mc; t.kc = kc; t.nc = nc; t.mr = micro[0]; t.nr = micro[1];
+                        add(t);
+                    }
+        if (opts.max_candidates > 0 && opts.max_candidates < n_cand) n_cand = opts.max_candidates;
+
+        int64_t a_shape[] = {key.m, key.k};
+        int64_t b_shape[] = {key.k, key.n};
+        int64_t c_shape[] = {key.m, key.n};
+        Tensor A = Tensor::alloc(a_shape, 2, DType::F32);
+        Tensor B = Tensor::alloc(b_shape, 2, DType::F32);
+        Tensor C = Tensor::alloc(c_shape, 2, DType::F32);
+        int64_t ws_floats = 0;
+        for (int32_t i = 0; i < n_cand; ++i) {
+            int64_t w = kernels::gemm_blocked_workspace(cand[i]);
+            if (w > ws_floats) ws_floats = w;
+        }
+        // Later splits are narrower than `widest`, so need no more.
+        float* ws = static_cast<float*>(
+            mem_alloc(static_cast<size_t>(ws_floats) * sizeof(float), 64, Device::CPU));
+        if (A.data == nullptr || B.data == nullptr || C.data == nullptr || ws == nullptr) {
+            A.free(); B.free(); C.free();
+            if (ws != nullptr) mem_free(ws, Device::CPU);
+            return status::allocation_failed("tuning operands");
+        }
+        float* ap = static_cast<float*>(A.data);
+        float* bp = static_cast<float*>(B.data);
+        for (int64_t i = 0; i < key.m * key.k; ++i) ap[i] = static_cast<float>(i % 7) * 0.25f;
+        for (int64_t i = 0; i < key.k * key.n; ++i) bp[i] = static_cast<float>(i % 5) * 0.5f;
+
+        double flops = 2.0 * static_cast<double>(key.m) * static_cast<double>(key.n) *
+                       static_cast<double>(key.k);
+        auto measure = [&](const kernels::GemmTiles& t) noexcept {
+            double best_rep = 0.0;
+            for (int32_t r = 0; r < opts.reps; ++r) {
+                auto t0 = std::chrono::steady_clock::now();
+                detail::run_gemm_blocked(ap, bp, static_cast<float*>(C.data),
+                                         key.m, key.n, key.k, 1.0f, 0.0f, t, ws, opts.pool);
+                double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - t0).count());
+                if (r == 0 || ns < best_rep) best_rep = ns;
+            }
+            return best_rep;
+        };
+
+        kernels::GemmTiles best = cand[0];
+        double best_ns = 0.0;
+        for (int32_t i = 0; i < n_cand; ++i) {
+            double cand_ns = measure(cand[i]);
+            if (i == 0 || cand_ns < best_ns) {
+                best = cand[i];
+                best_ns = cand_ns;
+            }
+        }
+
+        // Split pass: narrower splits win when chunks are too thin to pay
+        // for the fork-join.
+        kernels::GemmTiles tiles = best;
+        for (int32_t split = 1; split < widest; split *= 2) {
+            kernels::GemmTiles t = tiles;
+            t.threads = split;
+            double ns = measure(t);
+            if (ns < best_ns) {
+                best = t;
+                best_ns = ns;
+            }
+        }
+
+        A.free(); B.free(); C.free();
+        mem_free(ws, Device::CPU);
+
+        double gflops = best_ns > 0.0 ? flops / best_ns : 0.0;
+        if (best_out != nullptr) *best_out = best;
+        return insert(key, best, gflops);
+    }
+
+    /**
+     * @brief Write the table (atomically: temp file + rename)
+     *
+     * Format, one record per line:
+     *   zero-gemm-tune <version>
+     *   cpu <model>
+     *   <m> <n> <k> <dtype> <threads> <mc> <kc> <nc> <mr> <nr> <split> <gflops>
+     */
+    Status save(const char* path) const noexcept {
+        if (path == nullptr) return status::invalid_argument("null path");
+        char tmp[4096];
+        if (std::snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= static_cast<int>(sizeof(tmp)))
+            return status::invalid_argument("path too long");
+        std::FILE* f = std::fopen(tmp, "w");
+        if (f == nullptr) return status::invalid_argument("cannot open tuning cache for writing");
+        std::fprintf(f, "zero-gemm-tune %d\n", GEMM_TUNE_CACHE_VERSION);
+        std::fprintf(f, "cpu %s\n", cpu_model_);
+        for (int32_t i = 0; i < count_; ++i) {
+            const GemmTuneEntry& e = entries_[i];
+            std::fprintf(f, "%lld %lld %lld %d %d %d %d %d %d %d %d %.3f\n",
+                         static_cast<long long>(e.key.m), static_cast<long long>(e.key.n),
+                         static_cast<long long>(e.key.k), static_cast<int>(e.key.dtype),
+                         e.key.threads, e.tiles.mc, e.tiles.kc, e.tiles.nc,
+                         e.tiles.mr, e.tiles.nr, e.tiles.threads, e.gflops);
+        }
+        bool ok = std::fflush(f) == 0;
+        ok = (std::fclose(f) == 0) && ok;
+        if (!ok || std::rename(tmp, path) != 0) {
+            std::remove(tmp);
+            return status::invalid_state("failed to write tuning cache");
+        }
+        return status::OK;
+    }
+
+    /**
+     * @brief Replace the table with a cache file's entries
+     *
+     * Rejects (table unchanged) a missing file, another format version,
+     * a cache stamped with a different CPU model, or a malformed entry
+     * (including an untunable dtype or a split above the key's threads).
+     */
+    Status load(const char* path) noexcept {
+        if (path == nullptr) return status::invalid_argument("null path");
+        std::FILE* f = std::fopen(path, "r");
+        if (f == nullptr) return status::invalid_argument("cannot open tuning cache");
+
+        char line[512];
+        int version = -1;
+        if (std::fgets(line, sizeof(line), f) == nullptr ||
+            std::sscanf(line, "zero-gemm-tune %d", &version) != 1) {
+            std::fclose(f);
+            return status::invalid_argument("not a gemm tuning cache");
+        }
+        if (version != GEMM_TUNE_CACHE_VERSION) {
+            std::fclose(f);
+            return status::invalid_state("tuning cache version mismatch");
+        }
+        if (std::fgets(line, sizeof(line), f) == nullptr || std::strncmp(line, "cpu ", 4) != 0) {
+            std::fclose(f);
+            return status::invalid_argument("tuning cache missing cpu line");
+        }
+        size_t len = std::strlen(line);
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) line[--len] = '\0';
+        if (std::strcmp(line + 4, cpu_model_) != 0) {
+            std::fclose(f);
+            return status::invalid_state("tuning cache built for a different CPU model");
+        }
+
+        GemmTuner staged;
+        std::snprintf(staged.cpu_model_, sizeof(staged.cpu_model_), "%s", cpu_model_);
+        Status s = status::OK;
+        while (s.is_ok() && std::fgets(line, sizeof(line), f) != nullptr) {
+            if (line[0] == '\n' || line[0] == '#') continue;
+            long long m = 0, n = 0, k = 0;
+            int dtype = 0;
+            GemmKey key;
+            kernels::GemmTiles t;
+            double gflops = 0.0;
+            if (std::sscanf(line, "%lld %lld %lld %d %d %d %d %d %d %d %d %lf", &m, &n, &k, &dtype,
+                            &key.threads, &t.mc, &t.kc, &t.nc, &t.mr, &t.nr, &t.threads,
+                            &gflops) != 12) {
+                s = status::invalid_argument("malformed tuning cache entry");
+                break;
+            }
+            if (dtype != static_cast<int>(DType::F32)) {
+                s = status::type_mismatch("tuning cache entry has an untunable dtype");
+                break;
+            }
+            key.m = m;
+            key.n = n;
+            key.k = k;
+            key.dtype = DType::F32;
+            s = staged.insert(key, t, gflops);
+        }
+        std::fclose(f);
+        if (s.is_error()) return s;
+
+        count_ = staged.count_;
+        for (int32_t i = 0; i < count_; ++i) entries_[i] = staged.entries_[i];
+        return status::OK;
+    }
+
+    void clear() noexcept { count_ = 0; }
+    int32_t size() const noexcept { return count_; }
+    const GemmTuneEntry& entry(int32_t i) const noexcept { return entries_[i]; }
+
+    /**
+     * @brief Model this table is stamped with (defaults to the host)
+     */
+    const char* cpu_model() const noexcept { return cpu_model_; }
+
+private:
+    char cpu_model_[GEMM_TUNE_CPU_MODEL_MAX];
+    GemmTuneEntry entries_[GEMM_TUNE_MAX_ENTRIES];
+    int32_t count_ = 0;
+};
+
+/**
+ * @brief Process-wide tuner, loaded from $ZERO_GEMM_TUNE_CACHE on first use
+ *
+ * A missing, stale or foreign cache leaves it empty (heuristics only).
+ */
+inline GemmTuner& gemm_tuner() noexcept {
+    static GemmTuner* tuner = [] {
+        static GemmTuner t;
+        if (const char* path = std::getenv("ZERO_GEMM_TUNE_CACHE")) (void)t.load(path);
+        return &t;
+    }();
+    return *tuner;
+}
+
+/**
+ * @brief Workspace floats gemm_blocked needs for A[M, K] @ B[K, N] with tiles
+ *
+ * Tiles are clipped to the problem first, so this is usually far below
+ * kernels::gemm_blocked_workspace(tiles). Returns 0 for rank != 2 operands.
+ */
+inline int64_t gemm_blocked_workspace_floats(const Tensor& A, const Tensor& B,
+                                             const kernels::GemmTiles& tiles) noexcept {
+    if (A.ndim != 2 || B.ndim != 2) return 0;
+    kernels::GemmTiles t = detail::clip_tiles(tiles, A.shape[0], B.shape[1], A.shape[1]);
+    return kernels::gemm_blocked_chunks(A.shape[0], t) * kernels::gemm_blocked_thread_workspace(t);
+}
+
+/**
+ * @brief Blocked GEMM with explicit tiles: C = alpha * A @ B + beta * C
+ *
+ * Same contract as gemm (spec 002) and bit-identical results for every
+ * tile choice, split and pool. Panels are packed into the caller's
+ * workspace, which must hold gemm_blocked_workspace_floats(A, B, tiles)
+ * floats. The tiles' row chunks run on `pool` (capped at tiles.threads
+ * participants), or on the calling thread when pool is null.
+ */
+inline Status gemm_blocked(
+    const Tensor& A,
+    const Tensor& B,
+    Tensor& C,
+    const kernels::GemmTiles& tiles,
+    float* workspace,
+    int64_t workspace_floats,
+    float alpha = 1.0f,
+    float beta = 0.0f,
+    exec::ThreadPool* pool = nullptr,
+    Stream* stream = nullptr
+) noexcept {
+    (void)stream;
+    if (Status s = detail::validate_gemm(A, B, C); s.is_error()) return s;
+    if (!kernels::gemm_tiles_valid(tiles)) return status::invalid_argument("invalid gemm tiles");
+    if (workspace_floats < gemm_blocked_workspace_floats(A, B, tiles))
+        return status::invalid_argument("gemm workspace too small");
+    if (workspace == nullptr && workspace_floats > 0)
+        return status::invalid_state("null gemm workspace");
+
+    ZERO_OP_METRICS(ir::OpKind::MATMUL, A.nbytes() + B.nbytes() + C.nbytes(),
+                    2 * A.shape[0] * B.shape[1] * A.shape[1]);
+    kernels::GemmTiles t = detail::clip_tiles(tiles, A.shape[0], B.shape[1], A.shape[1]);
+    detail::run_gemm_blocked(static_cast<const float*>(A.data),
+                             static_cast<const float*>(B.data),
+                             static_cast<float*>(C.data),
+                             A.shape[0], B.shape[1], A.shape[1], alpha, beta, t, workspace, pool);
+    return status::OK;
+}
+
+/**
+ * @brief Key gemm_tuned looks up: the shape plus the pool's participants
+ */
+inline GemmKey gemm_tuned_key(const Tensor& A, const Tensor& B,
+                              const exec::ThreadPool* pool = nullptr) noexcept {
+    return GemmKey{A.ndim == 2 ? A.shape[0] : 0, B.ndim == 2 ? B.shape[1] : 0,
+                   A.ndim == 2 ? A.shape[1] : 0, A.dtype, detail::pool_participants(pool)};
+}
+
+/**
+ * @brief Workspace floats gemm_tuned needs for these operands and pool
+ */
+inline int64_t gemm_tuned_workspace_floats(const Tensor& A, const Tensor& B,
+                                           const exec::ThreadPool* pool = nullptr) noexcept {
+    return gemm_blocked_workspace_floats(A, B, gemm_tuner().select(gemm_tuned_key(A, B, pool)));
+}
+
+/**
+ * @brief Blocked GEMM with tiles from gemm_tuner() (cached or heuristic)
+ *
+ * The key's thread count is the pool's participants (1 without a pool).
+ */
+inline Status gemm_tuned(
+    const Tensor& A,
+    const Tensor& B,
+    Tensor& C,
+    float* workspace,
+    int64_t workspace_floats,
+    float alpha = 1.0f,
+    float beta = 0.0f,
+    exec::ThreadPool* pool = nullptr,
+    Stream* stream = nullptr
+) noexcept {
+    kernels::GemmTiles tiles = gemm_tuner().select(gemm_tuned_key(A, B, pool));
+    return gemm_blocked(A, B, C, tiles, workspace, workspace_floats, alpha, beta, pool, stream);
+}
+
+} // namespace ops
+} // namespace zero
@@ -0,0 +1,144 @@
+#pragma once
+
+/**
+ * @file grouped_gemm.hpp
+ * @brief Zero Core Runtime — Grouped GEMM
+ *
+ * C_g = alpha * A_g @ B_g + beta * C_g for a list of groups that share
+ * K and N but differ in M (mixture-of-experts: one group per expert,
+ * M_g = tokens routed to it). All groups are cut into row tiles and the
+ * tiles from every group go into one parallel_for on a work-stealing
+ * pool, so a large expert spreads over idle cores instead of leaving
+ * them waiting behind one call per expert.
+ */
+
+#include "../core/tensor.hpp"
+#include "../core/status.hpp"
+#include "../device/sync.hpp"
+#include "../exec/thread_pool.hpp"
+#include "../kernels/kernels.hpp"
+#include "../telemetry/histogram.hpp"
+#include "../telemetry/profiler.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+#include "matmul.hpp"
+
+#include <cstdint>
+
+namespace zero {
+namespace ops {
+
+/// Maximum groups in one grouped_gemm call
+constexpr int32_t GROUPED_GEMM_MAX_GROUPS = 256;
+
+/// Row tile bounds; the tile height adapts to the total M and pool size.
+constexpr int64_t GROUPED_GEMM_MIN_TILE_M = 4;
+constexpr int64_t GROUPED_GEMM_MAX_TILE_M = 64;
+
+/**
+ * @brief One problem of a grouped GEMM
+ *
+ * A [M_g, K], B [K, N], C [M_g, N]. A group with M_g == 0 is skipped
+ * (its data pointers may be null).
+ */
+struct GemmGroup {
+    Tensor A;
+    Tensor B;
+    Tensor C;
+};
+
+namespace detail {
+
+inline Status validate_grouped_gemm(const GemmGroup* groups, int32_t count) noexcept {
+    if (count < 0 || count > GROUPED_GEMM_MAX_GROUPS)
+        return status::invalid_argument("group count out of range");
+    if (count > 0 && groups == nullptr) return status::invalid_state("null group list");
+    int64_t K = -1, N = -1;
+    for (int32_t g = 0; g < count; ++g) {
+        const GemmGroup& p = groups[g];
+        if (p.A.ndim != 2 || p.B.ndim != 2 || p.C.ndim != 2)
+            return status::invalid_argument("gemm requires rank-2 tensors");
+        if (K < 0) {
+            K = p.B.shape[0];
+            N = p.B.shape[1];
+        } else if (p.B.shape[0] != K || p.B.shape[1] != N) {
+            return status::invalid_argument("groups must share K and N");
+        }
+        if (p.A.shape[0] == 0 && p.C.shape[0] == 0 && p.A.shape[1] == K && p.C.shape[1] == N)
+            continue;
+        if (Status s = validate_gemm(p.A, p.B, p.C); s.is_error()) return s;
+        if (!p.A.is_contiguous() || !p.B.is_contiguous() || !p.C.is_contiguous())
+            return status::invalid_argument("grouped gemm operands must be contiguous");
+    }
+    return status::OK;
+}
+
+} // namespace detail
+
+/**
+ * @brief Run every group's GEMM as one load-balanced job
+ *
+ * With pool == nullptr (or a one-participant pool) the tiles run on the
+ * calling thread. Each output row is produced by the same kernel as
+ * ops::gemm, so results are bit-identical to one gemm call per group
+ * for every pool size. Nothing is written on validation failure.
+ */
+inline Status grouped_gemm(
+    const GemmGroup* groups,
+    int32_t count,
+    exec::ThreadPool* pool = nullptr,
+    float alpha = 1.0f,
+    float beta = 0.0f,
+    Stream* stream = nullptr
+) noexcept {
+    (void)stream;  // Spec 003: parameter committed for GPU; CPU ignores.
+    if (Status s = detail::validate_grouped_gemm(groups, count); s.is_error()) return s;
+    if (count == 0) return status::OK;
+
+    int64_t K = groups[0].B.shape[0];
+    int64_t N = groups[0].B.shape[1];
+    int64_t total_m = 0;
+    for (int32_t g = 0; g < count; ++g) total_m += groups[g].A.shape[0];
+    if (total_m == 0) return status::OK;
+    ZERO_OP_TIMER(ir::OpKind::MATMUL, total_m * N * K);
+    ZERO_OP_PROFILE_SCOPE(ir::OpKind::MATMUL);
+    ZERO_OP_METRICS(ir::OpKind::MATMUL,
+                    (total_m * K + count * K * N + total_m * N) * static_cast<int64_t>(sizeof(float)),
+                    2 * total_m * N * K);
+
+    // About 8 tiles per participant, clamped to [MIN, MAX] rows.
+    int64_t participants = pool != nullptr && pool->size() > 0 ? pool->size() : 1;
+    int64_t tile_m = (total_m + 8 * participants - 1) / (8 * participants);
+    if (tile_m < GROUPED_GEMM_MIN_TILE_M) tile_m = GROUPED_GEMM_MIN_TILE_M;
+    if (tile_m > GROUPED_GEMM_MAX_TILE_M) tile_m = GROUPED_GEMM_MAX_TILE_M;
+
+    // first_tile[g] is the global index of group g's first tile.
+    int64_t first_tile[GROUPED_GEMM_MAX_GROUPS + 1];
+    first_tile[0] = 0;
+    for (int32_t g = 0; g < count; ++g)
+        first_tile[g + 1] = first_tile[g] + (groups[g].A.shape[0] + tile_m - 1) / tile_m;
+    int64_t tiles = first_tile[count];
+
+    auto run_tile = [&](int64_t t) noexcept {
+        int32_t lo = 0, hi = count - 1;   // last group with first_tile <= t
+        while (lo < hi) {
+            int32_t mid = lo + (hi - lo + 1) / 2;
+            if (first_tile[mid] <= t) lo = mid;
+            else hi = mid - 1;
+        }
+        const GemmGroup& p = groups[lo];
+        int64_t m0 = (t - first_tile[lo]) * tile_m;
+        int64_t rows = p.A.shape[0] - m0 < tile_m ? p.A.shape[0] - m0 : tile_m;
+        kernels::gemm_f32(static_cast<const float*>(p.A.data) + m0 * K,
+                          static_cast<const float*>(p.B.data),
+                          static_cast<float*>(p.C.data) + m0 * N,
+                          rows, N, K, alpha, beta);
+    };
+    if (pool == nullptr) {
+        for (int64_t t = 0; t < tiles; ++t) run_tile(t);
+        return status::OK;
+    }
+    return pool->parallel_for(tiles, run_tile);
+}
+
+} // namespace ops
+} // namespace zero
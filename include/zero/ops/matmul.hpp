@@ -13,6 +13,10 @@
 #include "../core/scalar.hpp"
 #include "../core/status.hpp"
 #include "../device/sync.hpp"
+#include "../kernels/kernels.hpp"
+#include "../telemetry/histogram.hpp"
+#include "../telemetry/profiler.hpp"
+#include "../telemetry/runtime_metrics.hpp"
 
 namespace zero {
 namespace ops {
@@ -34,9 +38,20 @@ inline Status validate_gemm(const Tensor& A, const Tensor& B, const Tensor& C) n
         return status::invalid_argument("inner dimension mismatch (A.cols != B.rows)");
     if (C.shape[0] != A.shape[0] || C.shape[1] != B.shape[1])
         return status::invalid_argument("output shape mismatch (must be [A.rows, B.cols])");
+    if (!A.is_contiguous() || !B.is_contiguous() || !C.is_contiguous())
+        return status::invalid_argument("non-contiguous input");
     return status::OK;
 }
 
+// GEMM over validated, contiguous rank-2 F32 operands.
+inline void gemm_kernel(const Tensor& A, const Tensor& B, Tensor& C,
+                        float alpha, float beta) noexcept {
+    kernels::gemm_f32(static_cast<const float*>(A.data),
+                      static_cast<const float*>(B.data),
+                      static_cast<float*>(C.data),
+                      A.shape[0], B.shape[1], A.shape[1], alpha, beta);
+}
+
 } // namespace detail
 
 /**
@@ -52,24 +67,11 @@ inline Status gemm(
 ) noexcept {
     (void)stream;  // Spec 003: parameter committed for GPU; CPU ignores.
     if (Status s = detail::validate_gemm(A, B, C); s.is_error()) return s;
-
-    int64_t M = A.shape[0];
-    int64_t K = A.shape[1];
-    int64_t N = B.shape[1];
-
-    const float* a_ptr = static_cast<const float*>(A.data);
-    const float* b_ptr = static_cast<const float*>(B.data);
-    float* c_ptr = static_cast<float*>(C.data);
-
-    for (int64_t m = 0; m < M; ++m) {
-        for (int64_t n = 0; n < N; ++n) {
-            float sum = 0.0f;
-            for (int64_t k = 0; k < K; ++k) {
-                sum += a_ptr[m * K + k] * b_ptr[k * N + n];
-            }
-            c_ptr[m * N + n] = alpha * sum + beta * c_ptr[m * N + n];
-        }
-    }
+    ZERO_OP_TIMER(ir::OpKind::MATMUL, A.shape[0] * B.shape[1] * A.shape[1]);
+    ZERO_OP_PROFILE_SCOPE(ir::OpKind::MATMUL);
+    ZERO_OP_METRICS(ir::OpKind::MATMUL, A.nbytes() + B.nbytes() + C.nbytes(),
+                    2 * A.shape[0] * B.shape[1] * A.shape[1]);
+    detail::gemm_kernel(A, B, C, alpha, beta);
     return status::OK;
 }
 
@@ -81,6 +83,29 @@ inline Status matmul(const Tensor& A, const Tensor& B, Tensor& C,
     return gemm(A, B, C, 1.0f, 0.0f, stream);
 }
 
+/**
+ * @brief Unchecked gemm for compiler-generated code (spec 004).
+ *
+ * Preconditions are those of gemm; debug builds assert them.
+ */
+inline void gemm_unchecked(
+    const Tensor& A,
+    const Tensor& B,
+    Tensor& C,
+    float alpha = 1.0f,
+    float beta = 0.0f,
+    Stream* stream = nullptr
+) noexcept {
+    (void)stream;
+    ZERO_UNCHECKED_PRECONDITION(detail::validate_gemm(A, B, C));
+    detail::gemm_kernel(A, B, C, alpha, beta);
+}
+
+inline void matmul_unchecked(const Tensor& A, const Tensor& B, Tensor& C,
+                             Stream* stream = nullptr) noexcept {
+    gemm_unchecked(A, B, C, 1.0f, 0.0f, stream);
+}
+
 // NOTE: batched_matmul and matvec removed from core.
 // - batched_matmul: violates "no hidden allocation" (view creation in loop)
 // - matvec: derivable from matmul via reshape
@@ -0,0 +1,288 @@
+#pragma once
+
+/**
+ * @file moe.hpp
+ * @brief Zero Core Runtime — Mixture-of-Experts Token Routing
+ *
+ * The steps around grouped_gemm (spec 017):
+ *
+ *   logits [T, E] ─ moe_gate_topk ─▶ ids [T, k], gates [T, k]
+ *   x [T, D] ─ moe_permute ─▶ xp [T*k, D] (expert-contiguous), offsets [E+1], rows [T, k]
+ *   expert outputs yp [T*k, D] ─ moe_unpermute ─▶ y [T, D] = Σ_s gates[t,s] * yp[rows[t,s]]
+ *
+ * Tokens are split into chunks of consecutive tokens. The histogram
+ * counts per chunk, a prefix sum turns the counts into each chunk's
+ * first row per expert, and the scatter then writes without atomics.
+ * Within an expert, rows keep token order, so the layout does not depend
+ * on the chunking. Nothing here allocates.
+ */
+
+#include "../core/tensor.hpp"
+#include "../core/status.hpp"
+#include "../exec/thread_pool.hpp"
+#include "../telemetry/histogram.hpp"
+#include "../telemetry/profiler.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace zero {
+namespace ops {
+
+constexpr int32_t MOE_MAX_EXPERTS = 256;   ///< Experts per layer
+constexpr int32_t MOE_MAX_TOPK = 8;        ///< Experts per token
+constexpr int32_t MOE_MAX_CHUNKS = 16;     ///< Histogram chunks (per-chunk counts live on the stack)
+constexpr int64_t MOE_GATE_BLOCK = 64;     ///< Tokens per gating task
+
+namespace detail {
+
+template <typename Fn>
+inline Status moe_parallel(exec::ThreadPool* pool, int64_t n, Fn&& fn) noexcept {
+    if (pool == nullptr) {
+        for (int64_t i = 0; i < n; ++i) fn(i);
+        return status::OK;
+    }
+    return pool->parallel_for(n, fn);
+}
+
+inline bool is_dense_2d(const Tensor& t, DType dtype) noexcept {
+    return t.data != nullptr && t.device == Device::CPU && t.dtype == dtype &&
+           t.ndim == 2 && t.is_contiguous();
+}
+
+inline Status validate_moe_ids(const Tensor& ids, int32_t experts) noexcept {
+    if (experts < 1 || experts > MOE_MAX_EXPERTS)
+        return status::invalid_argument("expert count out of range");
+    if (!is_dense_2d(ids, DType::I32))
+        return status::invalid_argument("expert ids must be contiguous I32 [tokens, k]");
+    if (ids.shape[1] < 1 || ids.shape[1] > MOE_MAX_TOPK)
+        return status::invalid_argument("top-k out of range");
+    if (ids.numel() > INT32_MAX) return status::invalid_argument("too many routed rows for I32 row indices");
+    const int32_t* p = static_cast<const int32_t*>(ids.data);
+    for (int64_t i = 0; i < ids.numel(); ++i)
+        if (p[i] < 0 || p[i] >= experts) return status::out_of_bounds("expert id out of range");
+    return status::OK;
+}
+
+inline int64_t moe_chunks(const exec::ThreadPool* pool, int64_t tokens) noexcept {
+    int64_t c = pool != nullptr && pool->size() > 1 ? pool->size() : 1;
+    if (c > MOE_MAX_CHUNKS) c = MOE_MAX_CHUNKS;
+    if (c > tokens) c = tokens > 0 ? tokens : 1;
+    return c;
+}
+
+// counts[c][e] for each chunk, then offsets [E+1] and base[c][e] (first
+// row of chunk c's tokens for expert e).
+inline Status moe_histogram(const Tensor& ids, int32_t experts, int64_t chunks, int64_t* offsets,
+                            int32_t (*base)[MOE_MAX_EXPERTS], exec::ThreadPool* pool) noexcept {
+    int64_t tokens = ids.shape[0], k = ids.shape[1];
+    const int32_t* id = static_cast<const int32_t*>(ids.data);
+    Status s = moe_parallel(pool, chunks, [&](int64_t c) noexcept {
+        int32_t* count = base[c];
+        for (int32_t e = 0; e < experts; ++e) count[e] = 0;
+        for (int64_t i = tokens * c / chunks * k; i < tokens * (c + 1) / chunks * k; ++i) ++count[id[i]];
+    });
+    if (s.is_error()) return s;
+    int64_t row = 0;
+    for (int32_t e = 0; e < experts; ++e) {
+        offsets[e] = row;
+        for (int64_t c = 0; c < chunks; ++c) {
+            int32_t n = base[c][e];
+            base[c][e] = static_cast<int32_t>(row);
+            row += n;
+        }
+    }
+    offsets[experts] = row;
+    return status::OK;
+}
+
+} // namespace detail
+
+/**
+ * @brief Softmax over experts, then the k largest per token
+ *
+ * @param logits  F32 [T, E]
+ * @param ids     I32 [T, k] out: chosen experts, highest probability first
+ *                (ties go to the lower expert id)
+ * @param gates   F32 [T, k] out: their softmax probabilities, divided by
+ *                their sum when renormalize is set
+ */
+inline Status moe_gate_topk(const Tensor& logits, Tensor& ids, Tensor& gates, bool renormalize = true,
+                            exec::ThreadPool* pool = nullptr) noexcept {
+    if (!detail::is_dense_2d(logits, DType::F32))
+        return status::invalid_argument("logits must be contiguous F32 [tokens, experts]");
+    if (!detail::is_dense_2d(ids, DType::I32) || !detail::is_dense_2d(gates, DType::F32))
+        return status::invalid_argument("ids / gates must be contiguous I32 / F32 [tokens, k]");
+    int64_t tokens = logits.shape[0], experts = logits.shape[1], k = ids.shape[1];
+    if (experts < 1 || experts > MOE_MAX_EXPERTS) return status::invalid_argument("expert count out of range");
+    if (k < 1 || k > MOE_MAX_TOPK || k > experts) return status::invalid_argument("top-k out of range");
+    if (ids.shape[0] != tokens || gates.shape[0] != tokens || gates.shape[1] != k)
+        return status::invalid_argument("ids / gates shape mismatch");
+    ZERO_OP_TIMER(ir::OpKind::MOE_GATE, tokens * experts);
+    ZERO_OP_PROFILE_SCOPE(ir::OpKind::MOE_GATE);
+    ZERO_OP_METRICS(ir::OpKind::MOE_GATE, logits.nbytes() + ids.nbytes() + gates.nbytes(), tokens * experts);
+
+    const float* lg = static_cast<const float*>(logits.data);
+    int32_t* id_out = static_cast<int32_t*>(ids.data);
+    float* g_out = static_cast<float*>(gates.data);
+    int64_t blocks = (tokens + MOE_GATE_BLOCK - 1) / MOE_GATE_BLOCK;
+    return detail::moe_parallel(pool, blocks, [&](int64_t blk) noexcept {
+        int64_t t1 = (blk + 1) * MOE_GATE_BLOCK < tokens ? (blk + 1) * MOE_GATE_BLOCK : tokens;
+        for (int64_t t = blk * MOE_GATE_BLOCK; t < t1; ++t) {
+            const float* row = lg + t * experts;
+            float mx = row[0];
+            for (int64_t e = 1; e < experts; ++e) mx = row[e] > mx ? row[e] : mx;
+            // Insertion into a sorted top-k of logits; softmax is monotonic.
+            float best[MOE_MAX_TOPK];
+            int32_t which[MOE_MAX_TOPK];
+            int64_t have = 0;
+            float denom = 0.0f;
+            for (int64_t e = 0; e < experts; ++e) {
+                float v = row[e];
+                denom += std::exp(v - mx);
+                if (have == k && !(v > best[k - 1])) continue;
+                int64_t pos = have < k ? have++ : k - 1;
+                while (pos > 0 && v > best[pos - 1]) {
+                    best[pos] = best[pos - 1];
+                    which[pos] = which[pos - 1];
+                    --pos;
+                }
+                best[pos] = v;
+                which[pos] = static_cast<int32_t>(e);
+            }
+            float chosen = 0.0f;
+            for (int64_t s = 0; s < k; ++s) {
+                best[s] = std::exp(best[s] - mx) / denom;
+                chosen += best[s];
+            }
+            float scale = renormalize && chosen > 0.0f ? 1.0f / chosen : 1.0f;
+            for (int64_t s = 0; s < k; ++s) {
+                id_out[t * k + s] = which[s];
+                g_out[t * k + s] = best[s] * scale;
+            }
+        }
+    });
+}
+
+/**
+ * @brief Tokens per expert as CSR offsets: expert e owns rows [offsets[e], offsets[e+1])
+ *
+ * @param ids      I32 [T, k], each in [0, experts)
+ * @param offsets  I64 [experts + 1] out
+ */
+inline Status moe_expert_offsets(const Tensor& ids, int32_t experts, Tensor& offsets,
+                                 exec::ThreadPool* pool = nullptr) noexcept {
+    if (Status s = detail::validate_moe_ids(ids, experts); s.is_error()) return s;
+    if (offsets.data == nullptr || offsets.dtype != DType::I64 || offsets.ndim != 1 ||
+        offsets.shape[0] != experts + 1 || !offsets.is_contiguous())
+        return status::invalid_argument("offsets must be contiguous I64 [experts + 1]");
+    ZERO_OP_TIMER(ir::OpKind::MOE_ROUTE, ids.numel());
+    ZERO_OP_PROFILE_SCOPE(ir::OpKind::MOE_ROUTE);
+    ZERO_OP_METRICS(ir::OpKind::MOE_ROUTE, ids.nbytes() + offsets.nbytes(), ids.numel());
+    int32_t base[MOE_MAX_CHUNKS][MOE_MAX_EXPERTS];
+    int64_t chunks = detail::moe_chunks(pool, ids.shape[0]);
+    return detail::moe_histogram(ids, experts, chunks, static_cast<int64_t*>(offsets.data), base, pool);
+}
+
+/**
+ * @brief Copy each (token, slot) row of x into expert-contiguous order
+ *
+ * @param x         F32 [T, D]
+ * @param ids       I32 [T, k]
+ * @param permuted  F32 [T*k, D] out, preallocated
+ * @param offsets   I64 [experts + 1] out (as moe_expert_offsets)
+ * @param rows      I32 [T, k] out: permuted row of (t, s)
+ *
+ * Expert e's slice permuted[offsets[e]:offsets[e+1]] is the A operand
+ * of its GemmGroup.
+ */
+inline Status moe_permute(const Tensor& x, const Tensor& ids, int32_t experts, Tensor& permuted,
+                          Tensor& offsets, Tensor& rows, exec::ThreadPool* pool = nullptr) noexcept {
+    if (Status s = detail::validate_moe_ids(ids, experts); s.is_error()) return s;
+    int64_t tokens = ids.shape[0], k = ids.shape[1];
+    if (!detail::is_dense_2d(x, DType::F32) || x.shape[0] != tokens)
+        return status::invalid_argument("x must be contiguous F32 [tokens, D]");
+    int64_t dim = x.shape[1];
+    if (!detail::is_dense_2d(permuted, DType::F32) || permuted.shape[0] != tokens * k ||
+        permuted.shape[1] != dim)
+        return status::invalid_argument("permuted must be contiguous F32 [tokens * k, D]");
+    if (!detail::is_dense_2d(rows, DType::I32) || rows.shape[0] != tokens || rows.shape[1] != k)
+        return status::invalid_argument("rows must be contiguous I32 [tokens, k]");
+    if (offsets.data == nullptr || offsets.dtype != DType::I64 || offsets.ndim != 1 ||
+        offsets.shape[0] != experts + 1 || !offsets.is_contiguous())
+        return status::invalid_argument("offsets must be contiguous I64 [experts + 1]");
+    ZERO_OP_TIMER(ir::OpKind::MOE_PERMUTE, tokens * k * dim);
+    ZERO_OP_PROFILE_SCOPE(ir::OpKind::MOE_PERMUTE);
+    ZERO_OP_METRICS(ir::OpKind::MOE_PERMUTE,
+                    2 * permuted.nbytes() + ids.nbytes() + rows.nbytes() + offsets.nbytes(), 0);
+
+    int32_t base[MOE_MAX_CHUNKS][MOE_MAX_EXPERTS];
+    int64_t chunks = detail::moe_chunks(pool, tokens);
+    if (Status s = detail::moe_histogram(ids, experts, chunks, static_cast<int64_t*>(offsets.data),
+                                         base, pool);
+        s.is_error())
+        return s;
+
+    const int32_t* id = static_cast<const int32_t*>(ids.data);
+    const float* src = static_cast<const float*>(x.data);
+    float* dst = static_cast<float*>(permuted.data);
+    int32_t* row_of = static_cast<int32_t*>(rows.data);
+    size_t row_bytes = static_cast<size_t>(dim) * sizeof(float);
+    return detail::moe_parallel(pool, chunks, [&](int64_t c) noexcept {
+        int32_t* next = base[c];
+        for (int64_t t = tokens * c / chunks; t < tokens * (c + 1) / chunks; ++t) {
+            for (int64_t s = 0; s < k; ++s) {
+                int32_t r = next[id[t * k + s]]++;
+                row_of[t * k + s] = r;
+                std::memcpy(dst + static_cast<int64_t>(r) * dim, src + t * dim, row_bytes);
+            }
+        }
+    });
+}
+
+/**
+ * @brief y[t] = Σ_s gates[t, s] * expert_out[rows[t, s]]
+ *
+ * Gathers per token, so each output row is written by one task.
+ */
+inline Status moe_unpermute(const Tensor& expert_out, const Tensor& rows, const Tensor& gates,
+                            Tensor& out, exec::ThreadPool* pool = nullptr) noexcept {
+    if (!detail::is_dense_2d(rows, DType::I32) || !detail::is_dense_2d(gates, DType::F32) ||
+        gates.shape[0] != rows.shape[0] || gates.shape[1] != rows.shape[1])
+        return status::invalid_argument("rows / gates must be contiguous I32 / F32 [tokens, k]");
+    int64_t tokens = rows.shape[0], k = rows.shape[1];
+    if (!detail::is_dense_2d(expert_out, DType::F32) || expert_out.shape[0] != tokens * k)
+        return status::invalid_argument("expert output must be contiguous F32 [tokens * k, D]");
+    int64_t dim = expert_out.shape[1];
+    if (!detail::is_dense_2d(out, DType::F32) || out.shape[0] != tokens || out.shape[1] != dim)
+        return status::invalid_argument("out must be contiguous F32 [tokens, D]");
+    const int32_t* row_of = static_cast<const int32_t*>(rows.data);
+    for (int64_t i = 0; i < rows.numel(); ++i)
+        if (row_of[i] < 0 || row_of[i] >= tokens * k) return status::out_of_bounds("row index out of range");
+    ZERO_OP_TIMER(ir::OpKind::MOE_UNPERMUTE, tokens * k * dim);
+    ZERO_OP_PROFILE_SCOPE(ir::OpKind::MOE_UNPERMUTE);
+    ZERO_OP_METRICS(ir::OpKind::MOE_UNPERMUTE,
+                    expert_out.nbytes() + rows.nbytes() + gates.nbytes() + out.nbytes(), 2 * tokens * k * dim);
+
+    const float* yp = static_cast<const float*>(expert_out.data);
+    const float* g = static_cast<const float*>(gates.data);
+    float* y = static_cast<float*>(out.data);
+    int64_t blocks = (tokens + MOE_GATE_BLOCK - 1) / MOE_GATE_BLOCK;
+    return detail::moe_parallel(pool, blocks, [&](int64_t blk) noexcept {
+        int64_t t1 = (blk + 1) * MOE_GATE_BLOCK < tokens ? (blk + 1) * MOE_GATE_BLOCK : tokens;
+        for (int64_t t = blk * MOE_GATE_BLOCK; t < t1; ++t) {
+            float* dst = y + t * dim;
+            for (int64_t j = 0; j < dim; ++j) dst[j] = 0.0f;
+            for (int64_t s = 0; s < k; ++s) {
+                const float* src = yp + static_cast<int64_t>(row_of[t * k + s]) * dim;
+                float w = g[t * k + s];
+                for (int64_t j = 0; j < dim; ++j) dst[j] += w * src[j];
+            }
+        }
+    });
+}
+
+} // namespace ops
+} // namespace zero
@@ -14,6 +14,11 @@
 #include "../core/tensor.hpp"
 #include "../core/status.hpp"
 #include "../device/sync.hpp"
+#include "../exec/cost_model.hpp"
+#include "../kernels/kernels.hpp"
+#include "../telemetry/histogram.hpp"
+#include "../telemetry/profiler.hpp"
+#include "../telemetry/runtime_metrics.hpp"
 
 #include <limits>
 #include <cmath>
@@ -106,9 +111,79 @@ inline Status validate_reduce_last(
         if (output.shape[i] != input.shape[i])
             return status::invalid_argument("output leading-axis shape must match input");
     }
+    if (!input.is_contiguous() || !output.is_contiguous())
+        return status::invalid_argument("non-contiguous input");
     return status::OK;
 }
 
+// Argmax accepts either I32 or I64 indices (spec 002 amendment).
+inline Status validate_argmax(const Tensor& input, const Tensor& output) noexcept {
+    if (input.data == nullptr || output.data == nullptr)
+        return status::invalid_state("null data pointer");
+    if (input.device != Device::CPU || output.device != Device::CPU)
+        return status::invalid_argument("non-CPU device not supported");
+    if (input.dtype != DType::F32)
+        return status::type_mismatch("argmax input must be F32");
+    if (output.dtype != DType::I64 && output.dtype != DType::I32)
+        return status::type_mismatch("argmax output must be I32 or I64");
+    if (input.ndim < 1)
+        return status::invalid_argument("input must have rank >= 1");
+    if (output.ndim != input.ndim - 1)
+        return status::invalid_argument("output rank must be input rank - 1");
+    for (int8_t i = 0; i < output.ndim; ++i) {
+        if (output.shape[i] != input.shape[i])
+            return status::invalid_argument("output leading-axis shape must match input");
+    }
+    if (!input.is_contiguous() || !output.is_contiguous())
+        return status::invalid_argument("non-contiguous input");
+    return status::OK;
+}
+
+// Rows [begin, end) of the output (end < 0: all rows).
+inline void reduce_last_kernel(const Tensor& input, Tensor& output, ReduceOp op,
+                               int64_t begin = 0, int64_t end = -1) noexcept {
+    int64_t reduction_size = input.shape[input.ndim - 1];
+    if (end < 0) end = (reduction_size > 0) ? input.numel() / reduction_size : 0;
+    const float* in_ptr = static_cast<const float*>(input.data) + begin * reduction_size;
+    float* out_ptr = static_cast<float*>(output.data) + begin;
+    int64_t outer_size = end - begin;
+
+    switch (op) {
+        case ReduceOp::SUM:  kernels::sum_rows_f32(in_ptr, out_ptr, outer_size, reduction_size); break;
+        case ReduceOp::MAX:  kernels::max_rows_f32(in_ptr, out_ptr, outer_size, reduction_size); break;
+        case ReduceOp::MIN:  kernels::min_rows_f32(in_ptr, out_ptr, outer_size, reduction_size); break;
+        case ReduceOp::MEAN: kernels::mean_rows_f32(in_ptr, out_ptr, outer_size, reduction_size); break;
+        case ReduceOp::PROD: kernels::prod_rows_f32(in_ptr, out_ptr, outer_size, reduction_size); break;
+    }
+}
+
+inline void argmax_kernel(const Tensor& input, Tensor& output) noexcept {
+    const float* in_ptr = static_cast<const float*>(input.data);
+
+    int64_t reduction_size = input.shape[input.ndim - 1];
+    int64_t outer_size = (reduction_size > 0) ? input.numel() / reduction_size : 0;
+
+    if (output.dtype == DType::I64) {
+        kernels::argmax_rows_f32_i64(in_ptr, static_cast<int64_t*>(output.data),
+                                     outer_size, reduction_size);
+    } else {  // I32
+        kernels::argmax_rows_f32_i32(in_ptr, static_cast<int32_t*>(output.data),
+                                     outer_size, reduction_size);
+    }
+}
+
+// Latency-table key (spec 012).
+constexpr ir::OpKind reduce_op_kind(ReduceOp op) noexcept {
+    switch (op) {
+        case ReduceOp::SUM:  return ir::OpKind::SUM;
+        case ReduceOp::MAX:  return ir::OpKind::MAX;
+        case ReduceOp::MIN:  return ir::OpKind::MIN;
+        case ReduceOp::MEAN: return ir::OpKind::MEAN;
+        case ReduceOp::PROD: return ir::OpKind::PROD;
+    }
+    return ir::OpKind::SUM;
+}
+
 } // namespace detail
 
 /**
@@ -126,56 +201,37 @@ inline Status reduce_last_axis(
     (void)stream;  // Spec 003: parameter committed for GPU; CPU ignores.
     if (Status s = detail::validate_reduce_last(input, output, DType::F32); s.is_error())
         return s;
-
-    const float* in_ptr = static_cast<const float*>(input.data);
-    float* out_ptr = static_cast<float*>(output.data);
-
-    int64_t reduction_size = input.shape[input.ndim - 1];
-    int64_t outer_size = (reduction_size > 0) ? input.numel() / reduction_size : 0;
-
-    for (int64_t outer = 0; outer < outer_size; ++outer) {
-        const float* row = in_ptr + outer * reduction_size;
-
-        switch (op) {
-            case ReduceOp::SUM: {
-                float sum = 0.0f;
-                for (int64_t i = 0; i < reduction_size; ++i) sum += row[i];
-                out_ptr[outer] = sum;
-                break;
-            }
-            case ReduceOp::MAX: {
-                float max_val = -std::numeric_limits<float>::infinity();
-                for (int64_t i = 0; i < reduction_size; ++i) {
-                    if (row[i] > max_val) max_val = row[i];
-                }
-                out_ptr[outer] = max_val;
-                break;
-            }
-            case ReduceOp::MIN: {
-                float min_val = std::numeric_limits<float>::infinity();
-                for (int64_t i = 0; i < reduction_size; ++i) {
-                    if (row[i] < min_val) min_val = row[i];
-                }
-                out_ptr[outer] = min_val;
-                break;
-            }
-            case ReduceOp::MEAN: {
-                float sum = 0.0f;
-                for (int64_t i = 0; i < reduction_size; ++i) sum += row[i];
-                out_ptr[outer] = sum / static_cast<float>(reduction_size);
-                break;
-            }
-            case ReduceOp::PROD: {
-                float prod = 1.0f;
-                for (int64_t i = 0; i < reduction_size; ++i) prod *= row[i];
-                out_ptr[outer] = prod;
-                break;
-            }
-        }
-    }
+    ZERO_OP_TIMER(detail::reduce_op_kind(op), input.numel());
+    ZERO_OP_PROFILE_SCOPE(detail::reduce_op_kind(op));
+    ZERO_OP_METRICS(detail::reduce_op_kind(op), input.nbytes() + output.nbytes(), input.numel());
+    detail::reduce_last_kernel(input, output, op);
     return status::OK;
 }
 
+/**
+ * @brief Reduce along last axis, rows split per par.model (spec 026).
+ *
+ * Each row goes through the same kernel as the serial entry point, so
+ * results are bit-identical for any plan.
+ */
+inline Status reduce_last_axis(
+    const Tensor& input,
+    Tensor& output,
+    ReduceOp op,
+    const exec::ParallelContext& par
+) noexcept {
+    if (Status s = detail::validate_reduce_last(input, output, DType::F32); s.is_error())
+        return s;
+    ir::OpKind kind = detail::reduce_op_kind(op);
+    ZERO_OP_TIMER(kind, input.numel());
+    ZERO_OP_PROFILE_SCOPE(kind);
+    ZERO_OP_METRICS(kind, input.nbytes() + output.nbytes(), input.numel());
+    exec::OpCost cost = exec::estimate_cost(kind, input.shape.data(), input.ndim, DType::F32);
+    return exec::run_planned(par, kind, cost, [&](int64_t b, int64_t e) {
+        detail::reduce_last_kernel(input, output, op, b, e);
+    });
+}
+
 // ─────────────────────────────────────────────────────────────────────
 // Scalar-result reductions (debug helpers, unchanged signature per spec 002 §5)
 // ─────────────────────────────────────────────────────────────────────
@@ -217,52 +273,43 @@ inline Status mean(const Tensor& input, Tensor& output, Stream* stream = nullptr
  */
 inline Status argmax(const Tensor& input, Tensor& output, Stream* stream = nullptr) noexcept {
     (void)stream;  // Spec 003: parameter committed for GPU; CPU ignores.
-    if (input.data == nullptr || output.data == nullptr)
-        return status::invalid_state("null data pointer");
-    if (input.device != Device::CPU || output.device != Device::CPU)
-        return status::invalid_argument("non-CPU device not supported");
-    if (input.dtype != DType::F32)
-        return status::type_mismatch("argmax input must be F32");
-    if (output.dtype != DType::I64 && output.dtype != DType::I32)
-        return status::type_mismatch("argmax output must be I32 or I64");
-    if (input.ndim < 1)
-        return status::invalid_argument("input must have rank >= 1");
-    if (output.ndim != input.ndim - 1)
-        return status::invalid_argument("output rank must be input rank - 1");
-    for (int8_t i = 0; i < output.ndim; ++i) {
-        if (output.shape[i] != input.shape[i])
-            return status::invalid_argument("output leading-axis shape must match input");
-    }
+    if (Status s = detail::validate_argmax(input, output); s.is_error()) return s;
+    detail::argmax_kernel(input, output);
+    return status::OK;
+}
 
-    const float* in_ptr = static_cast<const float*>(input.data);
+// ─────────────────────────────────────────────────────────────────────
+// Unchecked entry points (spec 004). Preconditions of the checked op
+// apply; debug builds assert them.
+// ─────────────────────────────────────────────────────────────────────
 
-    int64_t reduction_size = input.shape[input.ndim - 1];
-    int64_t outer_size = (reduction_size > 0) ? input.numel() / reduction_size : 0;
+inline void reduce_last_axis_unchecked(
+    const Tensor& input,
+    Tensor& output,
+    ReduceOp op,
+    Stream* stream = nullptr
+) noexcept {
+    (void)stream;
+    ZERO_UNCHECKED_PRECONDITION(detail::validate_reduce_last(input, output, DType::F32));
+    detail::reduce_last_kernel(input, output, op);
+}
 
-    if (output.dtype == DType::I64) {
-        int64_t* out_ptr = static_cast<int64_t*>(output.data);
-        for (int64_t outer = 0; outer < outer_size; ++outer) {
-            const float* row = in_ptr + outer * reduction_size;
-            float max_val = -std::numeric_limits<float>::infinity();
-            int64_t max_idx = 0;
-            for (int64_t i = 0; i < reduction_size; ++i) {
-                if (row[i] > max_val) { max_val = row[i]; max_idx = i; }
-            }
-            out_ptr[outer] = max_idx;
-        }
-    } else {  // I32
-        int32_t* out_ptr = static_cast<int32_t*>(output.data);
-        for (int64_t outer = 0; outer < outer_size; ++outer) {
-            const float* row = in_ptr + outer * reduction_size;
-            float max_val = -std::numeric_limits<float>::infinity();
-            int32_t max_idx = 0;
-            for (int64_t i = 0; i < reduction_size; ++i) {
-                if (row[i] > max_val) { max_val = row[i]; max_idx = static_cast<int32_t>(i); }
-            }
-            out_ptr[outer] = max_idx;
-        }
-    }
-    return status::OK;
+inline void sum_unchecked(const Tensor& input, Tensor& output, Stream* stream = nullptr) noexcept {
+    reduce_last_axis_unchecked(input, output, ReduceOp::SUM, stream);
+}
+
+inline void max_unchecked(const Tensor& input, Tensor& output, Stream* stream = nullptr) noexcept {
+    reduce_last_axis_unchecked(input, output, ReduceOp::MAX, stream);
+}
+
+inline void mean_unchecked(const Tensor& input, Tensor& output, Stream* stream = nullptr) noexcept {
+    reduce_last_axis_unchecked(input, output, ReduceOp::MEAN, stream);
+}
+
+inline void argmax_unchecked(const Tensor& input, Tensor& output, Stream* stream = nullptr) noexcept {
+    (void)stream;
+    ZERO_UNCHECKED_PRECONDITION(detail::validate_argmax(input, output));
+    detail::argmax_kernel(input, output);
 }
 
 } // namespace ops
@@ -182,7 +182,10 @@ inline Tensor expand(const Tensor& input, const int64_t* new_shape, int8_t new_n
 }
 
 /**
- * @brief Flatten tensor to 1D
+ * @brief Flatten tensor to 1D as a view; never copies
+ * 
+ * Returns Tensor::empty() when no stride can express it (e.g. a
+ * transposed matrix); use flatten_copy for that.
  */
 inline Tensor flatten(const Tensor& input) noexcept {
     int64_t new_shape[1] = {input.numel()};
@@ -190,12 +193,21 @@ inline Tensor flatten(const Tensor& input) noexcept {
 }
 
 /**
- * @brief View tensor with new shape (must be contiguous)
+ * @brief Flatten tensor to 1D into a new owning contiguous tensor
+ */
+inline Tensor flatten_copy(const Tensor& input) noexcept {
+    int64_t new_shape[1] = {input.numel()};
+    return input.reshape_copy(new_shape, 1);
+}
+
+/**
+ * @brief View tensor with new shape; never copies
+ * 
+ * Works on non-contiguous views whenever Tensor::view_strides() finds
+ * strides for the new shape. Returns Tensor::empty() when only a copy
+ * could produce it (use Tensor::reshape_copy for that).
  */
 inline Tensor view(const Tensor& input, const int64_t* new_shape, int8_t new_ndim) noexcept {
-    if (!input.is_contiguous()) {
-        return Tensor::empty(); // Cannot view non-contiguous tensor
-    }
     return input.reshape(new_shape, new_ndim);
 }
 
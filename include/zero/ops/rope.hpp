@@ -0,0 +1,192 @@
+#pragma once
+
+/**
+ * @file rope.hpp
+ * @brief Zero Core Runtime — Fused Rotary Positional Embedding
+ *
+ * Rotates Q and K in place using cos/sin tables computed once per model:
+ *
+ *   theta[p, i] = p * base^(-2i / rot_dim) / scale,  i in [0, rot_dim / 2)
+ *
+ * Each token looks its row up by position id, so tokens from different
+ * sequences (continuous batching) can share one call. Only the first
+ * rot_dim dims of each head rotate (partial rotary); the rest pass through.
+ */
+
+#include "../core/tensor.hpp"
+#include "../core/status.hpp"
+#include "../device/sync.hpp"
+#include "../kernels/kernels.hpp"
+#include "../telemetry/histogram.hpp"
+#include "../telemetry/profiler.hpp"
+#include "../telemetry/runtime_metrics.hpp"
+
+#include <cmath>
+
+namespace zero {
+namespace ops {
+
+/**
+ * @brief How rotated pairs are laid out within a head
+ */
+enum class RopeLayout : uint8_t {
+    HALF_SPLIT = 0,    ///< (x[i], x[i + rot_dim/2]) — GPT-NeoX / Llama
+    INTERLEAVED = 1,   ///< (x[2i], x[2i + 1]) — GPT-J
+};
+
+/**
+ * @brief Precomputed cos/sin tables, F32 [max_pos, rot_dim / 2] each
+ */
+struct RopeCache {
+    Tensor cos = Tensor::empty();
+    Tensor sin = Tensor::empty();
+    int64_t max_pos = 0;
+    int64_t rot_dim = 0;
+
+    /**
+     * @brief Build tables for positions [0, max_pos); angles in double
+     */
+    Status init(int64_t positions, int64_t rotary_dim, double base = 10000.0,
+                double scale = 1.0) noexcept {
+        if (positions <= 0 || rotary_dim <= 0 || rotary_dim % 2 != 0)
+            return status::invalid_argument("rope needs positions > 0 and an even rotary dim");
+        if (!(base > 0.0) || !(scale > 0.0))
+            return status::invalid_argument("rope base and scale must be positive");
+        int64_t half = rotary_dim / 2;
+        int64_t shape[2] = {positions, half};
+        Tensor c = Tensor::alloc(shape, 2, DType::F32);
+        Tensor s = Tensor::alloc(shape, 2, DType::F32);
+        if (c.data == nullptr || s.data == nullptr) {
+            c.free();
+            s.free();
+            return status::allocation_failed("rope tables");
+        }
+        float* cp = static_cast<float*>(c.data);
+        float* sp = static_cast<float*>(s.data);
+        for (int64_t i = 0; i < half; ++i) {
+            double inv_freq = std::pow(base, -2.0 * static_cast<double>(i) / static_cast<double>(rotary_dim));
+            for (int64_t p = 0; p < positions; ++p) {
+                double theta = static_cast<double>(p) / scale * inv_freq;
+                cp[p * half + i] = static_cast<float>(std::cos(theta));
+                sp[p * half + i] = static_cast<float>(std::sin(theta));
+            }
+        }
+        free();
+        cos = c;
+        sin = s;
+        max_pos = positions;
+        rot_dim = rotary_dim;
+        return status::OK;
+    }
+
+    bool valid() const noexcept { return cos.data != nullptr && sin.data != nullptr; }
+
+    void free() noexcept {
+        cos.free();
+        sin.free();
+        max_pos = 0;
+        rot_dim = 0;
+    }
+};
+
+namespace detail {
+
+// [tokens, ..., head_dim] contiguous F32 on the CPU.
+inline Status validate_rope_operand(const Tensor& x, int64_t tokens, int64_t rot_dim) noexcept {
+    if (x.data == nullptr) return status::invalid_state("null data pointer");
+    if (x.device != Device::CPU) return status::invalid_argument("non-CPU device not supported");
+    if (x.dtype != DType::F32) return status::type_mismatch("only F32 supported on CPU");
+    if (x.ndim < 2) return status::invalid_argument("rope operand must be [tokens, ..., head_dim]");
+    if (!x.is_contiguous()) return status::invalid_argument("rope operand must be contiguous");
+    if (x.shape[0] != tokens) return status::invalid_argument("token count disagrees with position ids");
+    if (x.shape[x.ndim - 1] < rot_dim) return status::invalid_argument("head dim smaller than rotary dim");
+    return status::OK;
+}
+
+inline int64_t rope_position(const Tensor& positions, int64_t t) noexcept {
+    return positions.dtype == DType::I64 ? static_cast<const int64_t*>(positions.data)[t]
+                                         : static_cast<const int32_t*>(positions.data)[t];
+}
+
+inline void rope_token(float* x, int64_t heads, int64_t head_dim, const float* c, const float* s,
+                       int64_t half, RopeLayout layout) noexcept {
+    if (layout == RopeLayout::HALF_SPLIT) kernels::rope_half_f32(x, heads, head_dim, c, s, half);
+    else kernels::rope_interleaved_f32(x, heads, head_dim, c, s, half);
+}
+
+} // namespace detail
+
+/**
+ * @brief Rotate q and k in place by their tokens' positions
+ *
+ * @param q          F32 [T, ..., head_dim], contiguous
+ * @param k          F32 [T, ..., head_dim] (may have fewer heads, e.g. GQA);
+ *                   an empty tensor rotates q only
+ * @param positions  I64 or I32 [T], each in [0, cache.max_pos)
+ *
+ * One pass over the tokens: each token's cos/sin row is loaded once and
+ * applied to all of its q and k heads. Nothing is modified on failure.
+ */
+inline Status rope(
+    Tensor& q,
+    Tensor& k,
+    const Tensor& positions,
+    const RopeCache& cache,
+    RopeLayout layout = RopeLayout::HALF_SPLIT,
+    Stream* stream = nullptr
+) noexcept {
+    (void)stream;  // Spec 003: parameter committed for GPU; CPU ignores.
+    if (!cache.valid()) return status::invalid_state("rope cache not initialized");
+    if (positions.data == nullptr) return status::invalid_state("null data pointer");
+    if (positions.dtype != DType::I64 && positions.dtype != DType::I32)
+        return status::type_mismatch("position ids must be I64 or I32");
+    if (positions.ndim != 1 || !positions.is_contiguous() || positions.device != Device::CPU)
+        return status::invalid_argument("position ids must be contiguous [tokens]");
+    int64_t tokens = positions.shape[0];
+    if (Status s = detail::validate_rope_operand(q, tokens, cache.rot_dim); s.is_error()) return s;
+    bool has_k = k.data != nullptr;
+    if (has_k) {
+        if (Status s = detail::validate_rope_operand(k, tokens, cache.rot_dim); s.is_error()) return s;
+        if (k.data == q.data) return status::invalid_argument("q and k must not alias");
+    }
+    for (int64_t t = 0; t < tokens; ++t) {
+        int64_t p = detail::rope_position(positions, t);
+        if (p < 0 || p >= cache.max_pos) return status::out_of_bounds("position id outside rope cache");
+    }
+
+    int64_t half = cache.rot_dim / 2;
+    int64_t q_dim = q.shape[q.ndim - 1];
+    int64_t q_heads = tokens > 0 ? q.numel() / tokens / q_dim : 0;
+    int64_t k_dim = has_k ? k.shape[k.ndim - 1] : 0;
+    int64_t k_heads = has_k && tokens > 0 ? k.numel() / tokens / k_dim : 0;
+    ZERO_OP_TIMER(ir::OpKind::ROPE, tokens * (q_heads + k_heads) * cache.rot_dim);
+    ZERO_OP_PROFILE_SCOPE(ir::OpKind::ROPE);
+    // Each rotated pair: 4 multiplies + 2 adds, read and written in place.
+    ZERO_OP_METRICS(ir::OpKind::ROPE, 2 * (q.nbytes() + (has_k ? k.nbytes() : 0)),
+                    3 * tokens * (q_heads + k_heads) * cache.rot_dim);
+
+    float* qp = static_cast<float*>(q.data);
+    float* kp = static_cast<float*>(k.data);
+    const float* cos = static_cast<const float*>(cache.cos.data);
+    const float* sin = static_cast<const float*>(cache.sin.data);
+    for (int64_t t = 0; t < tokens; ++t) {
+        int64_t p = detail::rope_position(positions, t);
+        const float* c = cos + p * half;
+        const float* s = sin + p * half;
+        detail::rope_token(qp + t * q_heads * q_dim, q_heads, q_dim, c, s, half, layout);
+        if (has_k) detail::rope_token(kp + t * k_heads * k_dim, k_heads, k_dim, c, s, half, layout);
+    }
+    return status::OK;
+}
+
+/**
+ * @brief Rotate q only
+ */
+inline Status rope(Tensor& q, const Tensor& positions, const RopeCache& cache,
+                   RopeLayout layout = RopeLayout::HALF_SPLIT, Stream* stream = nullptr) noexcept {
+    Tensor none = Tensor::empty();
+    return rope(q, none, positions, cache, layout, stream);
+}
+
+} // namespace ops
+} // namespace zero
@@ -0,0 +1,404 @@
+#pragma once
+
+/**
+ * @file histogram.hpp
+ * @brief Zero Core Runtime — HDR Latency Histograms
+ *
+ * Log-linear histograms for tail latency (p50 / p99 / p999):
+ *
+ *   values < 32          one bucket per value (exact)
+ *   [2^e, 2^(e+1))       32 linear sub-buckets per octave (<= 3.1% error)
+ *
+ * Values are nanoseconds, clamped to [0, 2^44) (about 4.9 hours), which
+ * gives HIST_BUCKETS fixed buckets and no allocation while recording.
+ * OpLatencyTable keeps per-thread histograms per (OpKind, shape bucket)
+ * and merges them on snapshot; with ZERO_OP_HISTOGRAMS defined the
+ * Status-returning ops record into it.
+ */
+
+#include "../core/allocator.hpp"
+#include "../core/status.hpp"
+#include "../ir/op_kind.hpp"
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <new>
+
+namespace zero {
+namespace telemetry {
+
+constexpr int32_t HIST_SUB_BITS = 5;
+constexpr int32_t HIST_SUB = 1 << HIST_SUB_BITS;   ///< Sub-buckets per octave
+constexpr int32_t HIST_MAX_MSB = 43;               ///< Highest tracked bit
+constexpr int64_t HIST_MAX_VALUE = (int64_t{1} << (HIST_MAX_MSB + 1)) - 1;
+constexpr int32_t HIST_BUCKETS = HIST_SUB + (HIST_MAX_MSB - HIST_SUB_BITS + 1) * HIST_SUB;
+
+/**
+ * @brief Bucket holding value v (clamped)
+ */
+inline int32_t hist_bucket(int64_t v) noexcept {
+    if (v < HIST_SUB) return v < 0 ? 0 : static_cast<int32_t>(v);
+    if (v > HIST_MAX_VALUE) v = HIST_MAX_VALUE;
+    // v >= 2^HIST_SUB_BITS, so shift = msb - HIST_SUB_BITS is the bit width
+    // of v >> (HIST_SUB_BITS + 1); written this way it is visibly >= 0.
+    uint64_t u = static_cast<uint64_t>(v);
+    int32_t shift = static_cast<int32_t>(std::bit_width(u >> (HIST_SUB_BITS + 1)));
+    int32_t mant = static_cast<int32_t>(u >> shift) & (HIST_SUB - 1);
+    return HIST_SUB + shift * HIST_SUB + mant;
+}
+
+/**
+ * @brief Smallest value in bucket b
+ */
+inline int64_t hist_bucket_low(int32_t b) noexcept {
+    if (b < HIST_SUB) return b;
+    int32_t shift = (b - HIST_SUB) / HIST_SUB;
+    int64_t mant = (b - HIST_SUB) % HIST_SUB;
+    return (HIST_SUB + mant) << shift;
+}
+
+/**
+ * @brief Largest value in bucket b (HDR "highest equivalent value")
+ */
+inline int64_t hist_bucket_high(int32_t b) noexcept {
+    if (b < HIST_SUB) return b;
+    int32_t shift = (b - HIST_SUB) / HIST_SUB;
+    return hist_bucket_low(b) + (int64_t{1} << shift) - 1;
+}
+
+/**
+ * @brief Plain, mergeable copy of a histogram
+ */
+struct HistogramSnapshot {
+    int64_t counts[HIST_BUCKETS] = {};
+    int64_t count = 0;   ///< Recorded values
+    int64_t sum = 0;     ///< Sum of recorded (unclamped) values
+
+    void clear() noexcept {
+        for (int32_t b = 0; b < HIST_BUCKETS; ++b) counts[b] = 0;
+        count = 0;
+        sum = 0;
+    }
+
+    void merge(const HistogramSnapshot& other) noexcept {
+        for (int32_t b = 0; b < HIST_BUCKETS; ++b) counts[b] += other.counts[b];
+        count += other.count;
+        sum += other.sum;
+    }
+
+    /**
+     * @brief Value at percentile p in [0, 100]; 0 when empty
+     *
+     * Returns the highest value of the bucket holding rank ceil(p% * count),
+     * so the result never under-reports the tail.
+     */
+    int64_t percentile(double p) const noexcept {
+        if (count == 0) return 0;
+        if (p < 0.0) p = 0.0;
+        if (p > 100.0) p = 100.0;
+        int64_t rank = static_cast<int64_t>(p / 100.0 * static_cast<double>(count) + 0.999999999);
+        if (rank < 1) rank = 1;
+        int64_t seen = 0;
+        for (int32_t b = 0; b < HIST_BUCKETS; ++b) {
+            seen += counts[b];
+            if (seen >= rank) return hist_bucket_high(b);
+        }
+        return hist_bucket_high(HIST_BUCKETS - 1);
+    }
+
+    int64_t min() const noexcept {
+        for (int32_t b = 0; b < HIST_BUCKETS; ++b)
+            if (counts[b] != 0) return hist_bucket_low(b);
+        return 0;
+    }
+
+    int64_t max() const noexcept {
+        for (int32_t b = HIST_BUCKETS - 1; b >= 0; --b)
+            if (counts[b] != 0) return hist_bucket_high(b);
+        return 0;
+    }
+
+    double mean() const noexcept {
+        return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+    }
+};
+
+/**
+ * @brief Recording histogram: record() is two relaxed atomic adds
+ *
+ * Any thread may record. Give each hot thread its own instance and
+ * merge their snapshots to avoid sharing bucket cache lines.
+ */
+struct LatencyHistogram {
+    LatencyHistogram() noexcept = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void record(int64_t value) noexcept {
+        counts_[hist_bucket(value)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copy the current counts into out (overwrites it)
+     */
+    void snapshot(HistogramSnapshot& out) const noexcept {
+        out.clear();
+        merge_into(out);
+    }
+
+    /**
+     * @brief Snapshot and reset in one pass; no concurrent record is lost
+     */
+    void drain(HistogramSnapshot& out) noexcept {
+        out.clear();
+        drain_into(out);
+    }
+
+    /**
+     * @brief Add the current counts to out (merge without a temporary)
+     */
+    void merge_into(HistogramSnapshot& out) const noexcept {
+        for (int32_t b = 0; b < HIST_BUCKETS; ++b) {
+            int64_t n = counts_[b].load(std::memory_order_relaxed);
+            out.counts[b] += n;
+            out.count += n;
+        }
+        out.sum += sum_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Add the current counts to out and reset them
+     */
+    void drain_into(HistogramSnapshot& out) noexcept {
+        for (int32_t b = 0; b < HIST_BUCKETS; ++b) {
+            int64_t n = counts_[b].exchange(0, std::memory_order_relaxed);
+            out.counts[b] += n;
+            out.count += n;
+        }
+        out.sum += sum_.exchange(0, std::memory_order_relaxed);
+    }
+
+    void reset() noexcept {
+        for (int32_t b = 0; b < HIST_BUCKETS; ++b) counts_[b].store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> counts_[HIST_BUCKETS] = {};
+    std::atomic<int64_t> sum_{0};
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// Per-op latency table
+// ─────────────────────────────────────────────────────────────────────
+
+constexpr int32_t OP_KIND_SLOTS = 64;   ///< OpKind values are < 64
+constexpr int32_t SHAPE_BUCKETS = 48;   ///< floor(log2(work)), clamped
+constexpr int32_t HIST_SHARDS = 16;     ///< Recording shards (threads share modulo)
+
+/**
+ * @brief Shape bucket for an op's work size (elements, or M*N*K for gemm)
+ */
+inline int32_t shape_bucket(int64_t work) noexcept {
+    if (work <= 1) return 0;
+    int32_t b = static_cast<int32_t>(std::bit_width(static_cast<uint64_t>(work))) - 1;
+    return b < SHAPE_BUCKETS ? b : SHAPE_BUCKETS - 1;
+}
+
+inline int64_t hist_now_ns() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+namespace impl {
+
+/// This thread's latency shard, assigned round-robin on first record.
+inline int32_t hist_shard() noexcept {
+    static std::atomic<int32_t> next{0};
+    thread_local int32_t shard = next.fetch_add(1, std::memory_order_relaxed) % HIST_SHARDS;
+    return shard;
+}
+
+} // namespace impl
+
+/**
+ * @brief Latency histograms keyed by (OpKind, shape bucket)
+ *
+ * Each recording thread owns one of HIST_SHARDS shards (round-robin on
+ * its first record, shared modulo beyond that), so hot threads never
+ * contend on bucket cache lines; snapshot() and drain() merge a key's
+ * histograms across shards. A shard's key table and each histogram are
+ * allocated on first use, so the table costs a pointer per shard until
+ * used. They come from SystemAllocator, not the global allocator, so
+ * enabling them does not show up in a user allocator's counts.
+ */
+struct OpLatencyTable {
+    OpLatencyTable() noexcept = default;
+    OpLatencyTable(const OpLatencyTable&) = delete;
+    OpLatencyTable& operator=(const OpLatencyTable&) = delete;
+
+    ~OpLatencyTable() {
+        for (auto& slot : shards_) {
+            Shard* s = slot.load(std::memory_order_relaxed);
+            if (s == nullptr) continue;
+            for (auto& row : s->cells) {
+                for (auto& cell : row) {
+                    LatencyHistogram* h = cell.load(std::memory_order_relaxed);
+                    if (h == nullptr) continue;
+                    h->~LatencyHistogram();
+                    SystemAllocator::instance()->free(h, Device::CPU);
+                }
+            }
+            s->~Shard();
+            SystemAllocator::instance()->free(s, Device::CPU);
+        }
+    }
+
+    /**
+     * @brief Record every n-th op per thread; 1 = always-on, 0 = off
+     */
+    void set_sample_every(uint32_t n) noexcept { sample_every_.store(n, std::memory_order_relaxed); }
+    uint32_t sample_every() const noexcept { return sample_every_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Whether the calling thread should time its next op
+     */
+    bool sample() const noexcept {
+        uint32_t n = sample_every();
+        if (n <= 1) return n == 1;
+        thread_local uint32_t tick = 0;
+        if (++tick < n) return false;
+        tick = 0;
+        return true;
+    }
+
+    /**
+     * @brief Record into the calling thread's histogram for the key
+     */
+    Status record(ir::OpKind kind, int64_t work, int64_t ns) noexcept {
+        int32_t k = static_cast<int32_t>(kind);
+        if (k >= OP_KIND_SLOTS) return status::out_of_bounds("op kind outside latency table");
+        Shard* s = lazy(shards_[impl::hist_shard()]);
+        if (s == nullptr) return status::allocation_failed("latency shard");
+        LatencyHistogram* h = lazy(s->cells[k][shape_bucket(work)]);
+        if (h == nullptr) return status::allocation_failed("latency histogram");
+        h->record(ns);
+        return status::OK;
+    }
+
+    /**
+     * @brief Merge a key's per-thread histograms into out (overwrites it)
+     *
+     * @return false if nothing was ever recorded for the key
+     */
+    bool snapshot(ir::OpKind kind, int32_t bucket, HistogramSnapshot& out) const noexcept {
+        out.clear();
+        bool any = false;
+        for (const auto& slot : shards_) {
+            if (LatencyHistogram* h = find(slot, kind, bucket)) {
+                h->merge_into(out);
+                any = true;
+            }
+        }
+        return any;
+    }
+
+    /**
+     * @brief snapshot() and reset the key's histograms in one pass
+     */
+    bool drain(ir::OpKind kind, int32_t bucket, HistogramSnapshot& out) noexcept {
+        out.clear();
+        bool any = false;
+        for (const auto& slot : shards_) {
+            if (LatencyHistogram* h = find(slot, kind, bucket)) {
+                h->drain_into(out);
+                any = true;
+            }
+        }
+        return any;
+    }
+
+    /**
+     * @brief Zero every histogram (allocations are kept)
+     */
+    void reset() noexcept {
+        for (auto& slot : shards_) {
+            Shard* s = slot.load(std::memory_order_acquire);
+            if (s == nullptr) continue;
+            for (auto& row : s->cells)
+                for (auto& cell : row)
+                    if (LatencyHistogram* h = cell.load(std::memory_order_acquire)) h->reset();
+        }
+    }
+
+private:
+    struct Shard {
+        std::atomic<LatencyHistogram*> cells[OP_KIND_SLOTS][SHAPE_BUCKETS] = {};
+    };
+
+    // Load slot, allocating its object on first use; a racing loser frees its copy.
+    template <typename T>
+    static T* lazy(std::atomic<T*>& slot) noexcept {
+        T* p = slot.load(std::memory_order_acquire);
+        if (p != nullptr) return p;
+        void* mem = SystemAllocator::instance()->alloc(sizeof(T), alignof(T), Device::CPU);
+        if (mem == nullptr) return nullptr;
+        T* fresh = new (mem) T;
+        if (slot.compare_exchange_strong(p, fresh, std::memory_order_acq_rel)) return fresh;
+        fresh->~T();
+        SystemAllocator::instance()->free(fresh, Device::CPU);
+        return p;
+    }
+
+    static LatencyHistogram* find(const std::atomic<Shard*>& slot, ir::OpKind kind, int32_t bucket) noexcept {
+        int32_t k = static_cast<int32_t>(kind);
+        if (k >= OP_KIND_SLOTS || bucket < 0 || bucket >= SHAPE_BUCKETS) return nullptr;
+        const Shard* s = slot.load(std::memory_order_acquire);
+        return s == nullptr ? nullptr : s->cells[k][bucket].load(std::memory_order_acquire);
+    }
+
+    std::atomic<Shard*> shards_[HIST_SHARDS] = {};
+    std::atomic<uint32_t> sample_every_{1};
+};
+
+/**
+ * @brief Process-wide table the ops record into
+ */
+inline OpLatencyTable& op_latency() noexcept {
+    static OpLatencyTable table;
+    return table;
+}
+
+/**
+ * @brief Scope timer: records the scope's latency if this op is sampled
+ */
+struct OpTimer {
+    OpTimer(ir::OpKind kind, int64_t work, OpLatencyTable& table = op_latency()) noexcept
+        : table_(table), kind_(kind), work_(work), start_(table.sample() ? hist_now_ns() : -1) {}
+    OpTimer(const OpTimer&) = delete;
+    OpTimer& operator=(const OpTimer&) = delete;
+
+    ~OpTimer() {
+        if (start_ >= 0) (void)table_.record(kind_, work_, hist_now_ns() - start_);
+    }
+
+private:
+    OpLatencyTable& table_;
+    ir::OpKind kind_;
+    int64_t work_;
+    int64_t start_;
+};
+
+} // namespace telemetry
+} // namespace zero
+
+// Op-layer hook: times the rest of the enclosing scope. Compiles to
+// nothing unless ZERO_OP_HISTOGRAMS is defined.
+#ifdef ZERO_OP_HISTOGRAMS
+#define ZERO_OP_TIMER(kind, work) ::zero::telemetry::OpTimer zero_op_timer_((kind), (work))
+#else
+#define ZERO_OP_TIMER(kind, work) ((void)0)
+#endif
@@ -0,0 +1,289 @@
+#pragma once
+
+/**
+ * @file metrics.hpp
+ * @brief Zero Core Runtime — Metrics Registry
+ *
+ * Cumulative counters and gauges for the serving stack (ops per OpKind,
+ * bytes moved, FLOPs, allocator hits, queue depths, idle time):
+ *
+ *   Counter::add() ─relaxed fetch_add─▶ this thread's shard
+ *   snapshot: value(i) = Σ shards ─▶ render() / write() Prometheus text
+ *
+ * Each thread is assigned one of METRICS_SHARDS shards on first use, so
+ * concurrent increments of one counter land on different cache lines.
+ * Registration is the only locked path.
+ */
+
+#include "../core/status.hpp"
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+namespace zero {
+namespace telemetry {
+
+constexpr int32_t METRICS_MAX = 256;      ///< Metrics per registry
+constexpr int32_t METRICS_SHARDS = 16;    ///< Counter shards (threads share modulo)
+constexpr int32_t METRIC_NAME_MAX = 64;   ///< Incl. NUL
+constexpr int32_t METRIC_LABELS_MAX = 128;
+constexpr int32_t METRIC_HELP_MAX = 128;
+
+enum class MetricKind : uint8_t {
+    COUNTER = 0,  ///< Monotonic, sharded, summed at snapshot
+    GAUGE = 1,    ///< Last value, one cell
+};
+
+inline const char* metric_kind_name(MetricKind kind) noexcept {
+    return kind == MetricKind::COUNTER ? "counter" : "gauge";
+}
+
+namespace impl {
+
+/// This thread's shard, assigned round-robin on first use.
+inline int32_t metrics_shard() noexcept {
+    static std::atomic<int32_t> next{0};
+    thread_local int32_t shard = next.fetch_add(1, std::memory_order_relaxed) % METRICS_SHARDS;
+    return shard;
+}
+
+} // namespace impl
+
+/**
+ * @brief Counter handle: add() is one relaxed atomic add on this thread's shard
+ *
+ * Trivially copyable; valid for the lifetime of its registry.
+ */
+struct Counter {
+    std::atomic<int64_t>* cell = nullptr;  ///< Shard 0 cell; shard s is cell + s * METRICS_MAX
+
+    void add(int64_t n = 1) const noexcept {
+        (cell + impl::metrics_shard() * METRICS_MAX)->fetch_add(n, std::memory_order_relaxed);
+    }
+
+    bool valid() const noexcept { return cell != nullptr; }
+};
+
+/**
+ * @brief Gauge handle: one shared cell, relaxed set / add
+ */
+struct Gauge {
+    std::atomic<int64_t>* cell = nullptr;
+
+    void set(int64_t v) const noexcept { cell->store(v, std::memory_order_relaxed); }
+    void add(int64_t n) const noexcept { cell->fetch_add(n, std::memory_order_relaxed); }
+    int64_t value() const noexcept { return cell->load(std::memory_order_relaxed); }
+
+    bool valid() const noexcept { return cell != nullptr; }
+};
+
+/**
+ * @brief Registered metric identity
+ */
+struct MetricDesc {
+    char name[METRIC_NAME_MAX];      ///< Prometheus family name
+    char labels[METRIC_LABELS_MAX];  ///< Label pairs without braces, e.g. op="add"; may be empty
+    char help[METRIC_HELP_MAX];
+    MetricKind kind;
+};
+
+/**
+ * @brief Fixed-capacity registry of counters and gauges
+ *
+ * Registering the same name + labels twice returns the same cell, so
+ * call sites may register lazily. Metrics sharing a name form one
+ * family and must share its kind.
+ */
+struct MetricsRegistry {
+    MetricsRegistry() noexcept = default;
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    Status counter(const char* name, const char* help, Counter* out,
+                   const char* labels = nullptr) noexcept {
+        if (out == nullptr) return status::invalid_argument("null counter handle");
+        int32_t id = -1;
+        Status s = find_or_add(name, help, labels, MetricKind::COUNTER, &id);
+        if (s.is_ok()) out->cell = &shards_[0].v[id];
+        return s;
+    }
+
+    Status gauge(const char* name, const char* help, Gauge* out,
+                 const char* labels = nullptr) noexcept {
+        if (out == nullptr) return status::invalid_argument("null gauge handle");
+        int32_t id = -1;
+        Status s = find_or_add(name, help, labels, MetricKind::GAUGE, &id);
+        if (s.is_ok()) out->cell = &shards_[0].v[id];
+        return s;
+    }
+
+    int32_t size() const noexcept { return count_.load(std::memory_order_acquire); }
+    const MetricDesc& desc(int32_t i) const noexcept { return desc_[i]; }
+
+    /**
+     * @brief Current value of metric i (counters: sum over shards)
+     */
+    int64_t value(int32_t i) const noexcept {
+        if (desc_[i].kind == MetricKind::GAUGE) return shards_[0].v[i].load(std::memory_order_relaxed);
+        int64_t sum = 0;
+        for (int32_t s = 0; s < METRICS_SHARDS; ++s) sum += shards_[s].v[i].load(std::memory_order_relaxed);
+        return sum;
+    }
+
+    /**
+     * @brief Zero every counter and gauge (registrations are kept)
+     */
+    void reset() noexcept {
+        int32_t n = size();
+        for (int32_t s = 0; s < METRICS_SHARDS; ++s)
+            for (int32_t i = 0; i < n; ++i) shards_[s].v[i].store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Render Prometheus exposition text (format 0.0.4)
+     *
+     * snprintf contract: writes at most cap bytes including the NUL and
+     * returns the full length, so render(nullptr, 0) sizes the buffer.
+     */
+    size_t render(char* buf, size_t cap) const noexcept {
+        Sink sink{buf, cap, 0, nullptr};
+        emit(sink);
+        return sink.len;
+    }
+
+    /**
+     * @brief Write the exposition text to path (temp file + rename)
+     *
+     * Suitable for the node_exporter textfile collector.
+     */
+    Status write(const char* path) const noexcept {
+        if (path == nullptr) return status::invalid_argument("null path");
+        char tmp[4096];
+        if (std::snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= static_cast<int>(sizeof(tmp)))
+            return status::invalid_argument("path too long");
+        std::FILE* f = std::fopen(tmp, "w");
+        if (f == nullptr) return status::invalid_argument("cannot open metrics file for writing");
+        Sink sink{nullptr, 0, 0, f};
+        emit(sink);
+        bool ok = std::fflush(f) == 0;
+        ok = (std::fclose(f) == 0) && ok;
+        if (!ok || std::rename(tmp, path) != 0) {
+            std::remove(tmp);
+            return status::invalid_state("failed to write metrics file");
+        }
+        return status::OK;
+    }
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<int64_t> v[METRICS_MAX];
+    };
+    static_assert(sizeof(Shard) == METRICS_MAX * sizeof(std::atomic<int64_t>),
+                  "Counter indexes shards with a fixed stride");
+
+    // Text destination: caller buffer (snprintf contract) or FILE*.
+    struct Sink {
+        char* buf;
+        size_t cap;
+        size_t len;
+        std::FILE* file;
+
+        void put(const char* fmt, ...) noexcept {
+            va_list ap;
+            va_start(ap, fmt);
+            if (file != nullptr) {
+                int n = std::vfprintf(file, fmt, ap);
+                if (n > 0) len += static_cast<size_t>(n);
+            } else {
+                char* at = (buf != nullptr && len < cap) ? buf + len : nullptr;
+                size_t room = (at != nullptr) ? cap - len : 0;
+                int n = std::vsnprintf(at, room, fmt, ap);
+                if (n > 0) len += static_cast<size_t>(n);
+            }
+            va_end(ap);
+        }
+    };
+
+    static bool valid_name(const char* name) noexcept {
+        if (name == nullptr || name[0] == '\0') return false;
+        if (std::strlen(name) >= static_cast<size_t>(METRIC_NAME_MAX)) return false;
+        for (const char* p = name; *p != '\0'; ++p) {
+            char c = *p;
+            bool alpha = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':';
+            bool digit = c >= '0' && c <= '9';
+            if (!alpha && !(digit && p != name)) return false;
+        }
+        return true;
+    }
+
+    Status find_or_add(const char* name, const char* help, const char* labels,
+                       MetricKind kind, int32_t* id) noexcept {
+        if (!valid_name(name)) return status::invalid_argument("invalid metric name");
+        if (labels == nullptr) labels = "";
+        if (help == nullptr) help = "";
+        if (std::strlen(labels) >= static_cast<size_t>(METRIC_LABELS_MAX) ||
+            std::strchr(labels, '\n') != nullptr || std::strchr(labels, '}') != nullptr)
+            return status::invalid_argument("invalid metric labels");
+        if (std::strlen(help) >= static_cast<size_t>(METRIC_HELP_MAX) || std::strchr(help, '\n') != nullptr)
+            return status::invalid_argument("invalid metric help");
+
+        std::lock_guard<std::mutex> lock(mu_);
+        int32_t n = count_.load(std::memory_order_relaxed);
+        for (int32_t i = 0; i < n; ++i) {
+            if (std::strcmp(desc_[i].name, name) != 0) continue;
+            if (desc_[i].kind != kind) return status::type_mismatch("metric family registered with another kind");
+            if (std::strcmp(desc_[i].labels, labels) == 0) {
+                *id = i;
+                return status::OK;
+            }
+        }
+        if (n == METRICS_MAX) return status::out_of_bounds("metrics registry full");
+        MetricDesc& d = desc_[n];
+        std::snprintf(d.name, sizeof(d.name), "%s", name);
+        std::snprintf(d.labels, sizeof(d.labels), "%s", labels);
+        std::snprintf(d.help, sizeof(d.help), "%s", help);
+        d.kind = kind;
+        *id = n;
+        count_.store(n + 1, std::memory_order_release);
+        return status::OK;
+    }
+
+    // One HELP/TYPE header per family, in first-registration order.
+    void emit(Sink& sink) const noexcept {
+        int32_t n = size();
+        for (int32_t i = 0; i < n; ++i) {
+            bool seen = false;
+            for (int32_t j = 0; j < i && !seen; ++j) seen = std::strcmp(desc_[j].name, desc_[i].name) == 0;
+            if (seen) continue;
+            if (desc_[i].help[0] != '\0') sink.put("# HELP %s %s\n", desc_[i].name, desc_[i].help);
+            sink.put("# TYPE %s %s\n", desc_[i].name, metric_kind_name(desc_[i].kind));
+            for (int32_t j = i; j < n; ++j) {
+                const MetricDesc& d = desc_[j];
+                if (std::strcmp(d.name, desc_[i].name) != 0) continue;
+                long long v = static_cast<long long>(value(j));
+                if (d.labels[0] != '\0') sink.put("%s{%s} %lld\n", d.name, d.labels, v);
+                else sink.put("%s %lld\n", d.name, v);
+            }
+        }
+    }
+
+    Shard shards_[METRICS_SHARDS] = {};
+    MetricDesc desc_[METRICS_MAX] = {};
+    std::atomic<int32_t> count_{0};
+    std::mutex mu_;
+};
+
+/**
+ * @brief Process-wide registry
+ */
+inline MetricsRegistry& metrics() noexcept {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+} // namespace telemetry
+} // namespace zero
@@ -0,0 +1,208 @@
+#pragma once
+
+/**
+ * @file runtime_metrics.hpp
+ * @brief Zero Core Runtime — Runtime Instrumentation
+ *
+ * The runtime's own series in metrics(), registered on first use:
+ *
+ *   zero_ops_total{op}                  ops executed, per OpKind
+ *   zero_op_bytes_total{op}             operand bytes read + written
+ *   zero_op_flops_total{op}             arithmetic operations
+ *   zero_alloc_total{result}            mem_alloc calls, "ok" / "failed"
+ *   zero_alloc_bytes_total              bytes handed out by mem_alloc
+ *   zero_cache_lookups_total{cache,result}  runtime caches, "hit" / "miss"
+ *   zero_queue_depth{queue}             requests waiting for a driver (gauge)
+ *   zero_idle_nanoseconds_total{site}   time workers spent asleep
+ *
+ * With ZERO_RUNTIME_METRICS defined the ops, mem_alloc, the memo cache,
+ * the schedulers and the pools report through the macros at the bottom;
+ * otherwise the macros compile to nothing. After the first call for a
+ * series, each report is one relaxed atomic add.
+ */
+
+#include "metrics.hpp"
+#include "../ir/op_kind.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace zero {
+namespace telemetry {
+
+/**
+ * @brief Runtime component a queue, cache or idle series belongs to
+ */
+enum class RuntimeSite : uint8_t {
+    BATCHER = 0,
+    DECODE_SCHEDULER = 1,
+    THREAD_POOL = 2,
+    EXECUTOR = 3,
+    MEMO = 4,
+};
+
+constexpr int32_t RUNTIME_SITES = 5;
+constexpr int32_t RUNTIME_OP_SLOTS = 64;   ///< OpKind values are < 64
+
+inline const char* runtime_site_name(RuntimeSite site) noexcept {
+    switch (site) {
+        case RuntimeSite::BATCHER:          return "batcher";
+        case RuntimeSite::DECODE_SCHEDULER: return "decode_scheduler";
+        case RuntimeSite::THREAD_POOL:      return "thread_pool";
+        case RuntimeSite::EXECUTOR:         return "executor";
+        case RuntimeSite::MEMO:             return "memo";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Lazily registered handles for the runtime series
+ *
+ * Each series resolves its registry cell once; concurrent first calls
+ * register the same name + labels and so agree on the cell. A full
+ * registry drops the report rather than failing the caller.
+ */
+struct RuntimeMetrics {
+    explicit RuntimeMetrics(MetricsRegistry& registry = metrics()) noexcept : reg_(registry) {}
+    RuntimeMetrics(const RuntimeMetrics&) = delete;
+    RuntimeMetrics& operator=(const RuntimeMetrics&) = delete;
+
+    void op(ir::OpKind kind, int64_t bytes, int64_t flops) noexcept {
+        int32_t k = static_cast<int32_t>(kind);
+        if (k >= RUNTIME_OP_SLOTS) return;
+        char labels[METRIC_LABELS_MAX];
+        const char* name = ir::op_kind_name(kind);
+        if (Counter c = counter(op_calls_[k], "zero_ops_total", "Ops executed", labels, "op=\"%s\"", name);
+            c.valid())
+            c.add(1);
+        if (Counter c = counter(op_bytes_[k], "zero_op_bytes_total", "Operand bytes read and written",
+                                labels, "op=\"%s\"", name); c.valid())
+            c.add(bytes);
+        if (Counter c = counter(op_flops_[k], "zero_op_flops_total", "Arithmetic operations",
+                                labels, "op=\"%s\"", name); c.valid())
+            c.add(flops);
+    }
+
+    void alloc(size_t bytes, bool ok) noexcept {
+        char labels[METRIC_LABELS_MAX];
+        if (Counter c = counter(alloc_[ok ? 0 : 1], "zero_alloc_total", "mem_alloc calls",
+                                labels, "result=\"%s\"", ok ? "ok" : "failed"); c.valid())
+            c.add(1);
+        if (!ok) return;
+        if (Counter c = counter(alloc_bytes_, "zero_alloc_bytes_total", "Bytes returned by mem_alloc",
+                                labels, ""); c.valid())
+            c.add(static_cast<int64_t>(bytes));
+    }
+
+    void cache(RuntimeSite site, bool hit) noexcept {
+        char labels[METRIC_LABELS_MAX];
+        int32_t s = static_cast<int32_t>(site);
+        if (Counter c = counter(cache_[s][hit ? 0 : 1], "zero_cache_lookups_total", "Runtime cache lookups",
+                                labels, "cache=\"%s\",result=\"%s\"", runtime_site_name(site),
+                                hit ? "hit" : "miss"); c.valid())
+            c.add(1);
+    }
+
+    void queue(RuntimeSite site, int64_t delta) noexcept {
+        char labels[METRIC_LABELS_MAX];
+        std::atomic<int64_t>* cell = resolve(queue_[static_cast<int32_t>(site)], MetricKind::GAUGE,
+                                             "zero_queue_depth", "Requests waiting for a driver",
+                                             labels, "queue=\"%s\"", runtime_site_name(site));
+        if (cell != nullptr) Gauge{cell}.add(delta);
+    }
+
+    void idle(RuntimeSite site, int64_t ns) noexcept {
+        char labels[METRIC_LABELS_MAX];
+        if (Counter c = counter(idle_[static_cast<int32_t>(site)], "zero_idle_nanoseconds_total",
+                                "Time workers spent asleep", labels, "site=\"%s\"",
+                                runtime_site_name(site)); c.valid())
+            c.add(ns);
+    }
+
+private:
+    using Slot = std::atomic<std::atomic<int64_t>*>;
+
+    template <typename... Args>
+    std::atomic<int64_t>* resolve(Slot& slot, MetricKind kind, const char* name, const char* help,
+                                  char* labels, const char* fmt, Args... args) noexcept {
+        std::atomic<int64_t>* cell = slot.load(std::memory_order_acquire);
+        if (cell != nullptr) return cell;
+        if constexpr (sizeof...(Args) == 0) labels[0] = '\0';
+        else std::snprintf(labels, METRIC_LABELS_MAX, fmt, args...);
+        if (kind == MetricKind::COUNTER) {
+            Counter c;
+            if (reg_.counter(name, help, &c, labels).is_error()) return nullptr;
+            cell = c.cell;
+        } else {
+            Gauge g;
+            if (reg_.gauge(name, help, &g, labels).is_error()) return nullptr;
+            cell = g.cell;
+        }
+        slot.store(cell, std::memory_order_release);
+        return cell;
+    }
+
+    template <typename... Args>
+    Counter counter(Slot& slot, const char* name, const char* help, char* labels,
+                    const char* fmt, Args... args) noexcept {
+        return Counter{resolve(slot, MetricKind::COUNTER, name, help, labels, fmt, args...)};
+    }
+
+    MetricsRegistry& reg_;
+    Slot op_calls_[RUNTIME_OP_SLOTS] = {};
+    Slot op_bytes_[RUNTIME_OP_SLOTS] = {};
+    Slot op_flops_[RUNTIME_OP_SLOTS] = {};
+    Slot alloc_[2] = {};
+    Slot alloc_bytes_{nullptr};
+    Slot cache_[RUNTIME_SITES][2] = {};
+    Slot queue_[RUNTIME_SITES] = {};
+    Slot idle_[RUNTIME_SITES] = {};
+};
+
+/**
+ * @brief Process-wide instrumentation, reporting into metrics()
+ */
+inline RuntimeMetrics& runtime_metrics() noexcept {
+    static RuntimeMetrics rm;
+    return rm;
+}
+
+/**
+ * @brief Scope timer: adds the scope's duration to a site's idle time
+ */
+struct IdleTimer {
+    explicit IdleTimer(RuntimeSite site) noexcept : site_(site), start_(now_ns()) {}
+    IdleTimer(const IdleTimer&) = delete;
+    IdleTimer& operator=(const IdleTimer&) = delete;
+    ~IdleTimer() { runtime_metrics().idle(site_, now_ns() - start_); }
+
+private:
+    static int64_t now_ns() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    RuntimeSite site_;
+    int64_t start_;
+};
+
+} // namespace telemetry
+} // namespace zero
+
+// Runtime hooks. Compile to nothing unless ZERO_RUNTIME_METRICS is defined.
+#ifdef ZERO_RUNTIME_METRICS
+#define ZERO_OP_METRICS(kind, bytes, flops) \
+    ::zero::telemetry::runtime_metrics().op((kind), (bytes), (flops))
+#define ZERO_ALLOC_METRICS(bytes, ok) ::zero::telemetry::runtime_metrics().alloc((bytes), (ok))
+#define ZERO_CACHE_METRICS(site, hit) ::zero::telemetry::runtime_metrics().cache((site), (hit))
+#define ZERO_QUEUE_METRICS(site, delta) ::zero::telemetry::runtime_metrics().queue((site), (delta))
+#define ZERO_IDLE_METRICS_SCOPE(site) ::zero::telemetry::IdleTimer zero_idle_timer_((site))
+#else
+#define ZERO_OP_METRICS(kind, bytes, flops) ((void)0)
+#define ZERO_ALLOC_METRICS(bytes, ok) ((void)0)
+#define ZERO_CACHE_METRICS(site, hit) ((void)0)
+#define ZERO_QUEUE_METRICS(site, delta) ((void)0)
+#define ZERO_IDLE_METRICS_SCOPE(site) ((void)0)
+#endif
@@ -12,6 +12,7 @@
 #include "core/status.hpp"
 #include "core/allocator.hpp"
 #include "core/memory.hpp"
+#include "core/storage.hpp"
 #include "core/runtime.hpp"
 #include "core/tensor.hpp"
 #include "core/scalar.hpp"
@@ -22,11 +23,45 @@
 #include "ops/matmul.hpp"
 #include "ops/reduce.hpp"
 #include "ops/reshape.hpp"
+#include "ops/embedding_bag.hpp"
+#include "ops/rope.hpp"
+#include "ops/grouped_gemm.hpp"
+#include "ops/moe.hpp"
+#include "ops/gemm_tune.hpp"
+
+// Execution
+#include "exec/completion.hpp"
+#include "exec/topology.hpp"
+#include "exec/thread_pool.hpp"
+#include "exec/cost_model.hpp"
+#include "exec/coro.hpp"
+#include "exec/batcher.hpp"
+#include "exec/decode_scheduler.hpp"
+#include "exec/pipeline.hpp"
+
+// Inter-process
+#include "ipc/futex.hpp"
+#include "ipc/collectives.hpp"
+#include "ipc/transport.hpp"
+
+// Storage I/O
+#include "io/async_reader.hpp"
+#include "io/codec.hpp"
+#include "io/file_tensor.hpp"
+#include "io/out_of_core.hpp"
+
+// Telemetry
+#include "telemetry/metrics.hpp"
+#include "telemetry/runtime_metrics.hpp"
+#include "telemetry/histogram.hpp"
+#include "telemetry/profiler.hpp"
 
 // IR primitives
 #include "ir/function.hpp"
 #include "ir/control_flow.hpp"
 #include "ir/op_kind.hpp"
+#include "ir/fold_affine.hpp"
+#include "ir/memo.hpp"
 
 // Device model
 #include "device/device.hpp"
@@ -0,0 +1,175 @@
+/**
+ * @file dispatch.cpp
+ * @brief zero-core-kernels — Runtime ISA selection
+ *
+ * Defines the thin entry points declared in zero/kernels/kernels.hpp
+ * under ZERO_USE_COMPILED_KERNELS. Each call is one indirect jump
+ * through the active KernelTable.
+ */
+
+#include <zero/kernels/kernels.hpp>
+
+#include "kernel_table.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace zero {
+namespace kernels {
+
+namespace {
+
+const detail::KernelTable* table_for(Isa isa) noexcept {
+    switch (isa) {
+        case Isa::GENERIC:
+            return detail::generic_table();
+        case Isa::AVX2:
+#if defined(ZERO_KERNELS_HAVE_AVX2)
+            return detail::avx2_table();
+#else
+            return nullptr;
+#endif
+        case Isa::AVX512:
+#if defined(ZERO_KERNELS_HAVE_AVX512)
+            return detail::avx512_table();
+#else
+            return nullptr;
+#endif
+    }
+    return nullptr;
+}
+
+bool host_supports(Isa isa) noexcept {
+    switch (isa) {
+        case Isa::GENERIC:
+            return true;
+        case Isa::AVX2:
+#if defined(ZERO_KERNELS_HAVE_AVX2)
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+            return false;
+#endif
+        case Isa::AVX512:
+#if defined(ZERO_KERNELS_HAVE_AVX512)
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                   __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl");
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+// Upper bound from ZERO_KERNEL_ISA; AVX512 (no cap) when unset or unknown.
+Isa isa_cap_from_env() noexcept {
+    const char* env = std::getenv("ZERO_KERNEL_ISA");
+    if (env == nullptr) return Isa::AVX512;
+    if (std::strcmp(env, "generic") == 0) return Isa::GENERIC;
+    if (std::strcmp(env, "avx2") == 0) return Isa::AVX2;
+    return Isa::AVX512;
+}
+
+const detail::KernelTable* best_table() noexcept {
+    Isa cap = isa_cap_from_env();
+    const Isa order[] = {Isa::AVX512, Isa::AVX2, Isa::GENERIC};
+    for (Isa isa : order) {
+        if (static_cast<uint8_t>(isa) > static_cast<uint8_t>(cap)) continue;
+        if (isa_supported(isa)) return table_for(isa);
+    }
+    return detail::generic_table();
+}
+
+std::atomic<const detail::KernelTable*> g_active{nullptr};
+
+inline const detail::KernelTable& active() noexcept {
+    const detail::KernelTable* t = g_active.load(std::memory_order_acquire);
+    if (t == nullptr) {
+        // Racing first callers compute the same answer; last store wins.
+        t = best_table();
+        g_active.store(t, std::memory_order_release);
+    }
+    return *t;
+}
+
+} // namespace
+
+Isa active_isa() noexcept {
+    return active().isa;
+}
+
+bool isa_supported(Isa isa) noexcept {
+    return table_for(isa) != nullptr && host_supports(isa);
+}
+
+bool select_isa(Isa isa) noexcept {
+    if (!isa_supported(isa)) return false;
+    g_active.store(table_for(isa), std::memory_order_release);
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// Entry points
+// ─────────────────────────────────────────────────────────────────────
+
+void neg_f32(const float* x, float* y, int64_t n) noexcept { active().neg(x, y, n); }
+void abs_f32(const float* x, float* y, int64_t n) noexcept { active().abs(x, y, n); }
+void exp_f32(const float* x, float* y, int64_t n) noexcept { active().exp(x, y, n); }
+void log_f32(const float* x, float* y, int64_t n) noexcept { active().log(x, y, n); }
+void sqrt_f32(const float* x, float* y, int64_t n) noexcept { active().sqrt(x, y, n); }
+void sin_f32(const float* x, float* y, int64_t n) noexcept { active().sin(x, y, n); }
+void cos_f32(const float* x, float* y, int64_t n) noexcept { active().cos(x, y, n); }
+void tanh_f32(const float* x, float* y, int64_t n) noexcept { active().tanh(x, y, n); }
+void relu_f32(const float* x, float* y, int64_t n) noexcept { active().relu(x, y, n); }
+void sigmoid_f32(const float* x, float* y, int64_t n) noexcept { active().sigmoid(x, y, n); }
+
+void add_f32(const float* a, const float* b, float* y, int64_t n) noexcept { active().add(a, b, y, n); }
+void sub_f32(const float* a, const float* b, float* y, int64_t n) noexcept { active().sub(a, b, y, n); }
+void mul_f32(const float* a, const float* b, float* y, int64_t n) noexcept { active().mul(a, b, y, n); }
+void div_f32(const float* a, const float* b, float* y, int64_t n) noexcept { active().div(a, b, y, n); }
+
+void add_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept { active().add_scalar(a, s, y, n); }
+void sub_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept { active().sub_scalar(a, s, y, n); }
+void mul_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept { active().mul_scalar(a, s, y, n); }
+void div_scalar_f32(const float* a, float s, float* y, int64_t n) noexcept { active().div_scalar(a, s, y, n); }
+
+void gemm_f32(const float* a, const float* b, float* c,
+              int64_t M, int64_t N, int64_t K, float alpha, float beta) noexcept {
+    active().gemm(a, b, c, M, N, K, alpha, beta);
+}
+
+void sum_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { active().sum_rows(x, y, rows, len); }
+void max_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { active().max_rows(x, y, rows, len); }
+void min_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { active().min_rows(x, y, rows, len); }
+void mean_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { active().mean_rows(x, y, rows, len); }
+void prod_rows_f32(const float* x, float* y, int64_t rows, int64_t len) noexcept { active().prod_rows(x, y, rows, len); }
+void argmax_rows_f32_i64(const float* x, int64_t* y, int64_t rows, int64_t len) noexcept { active().argmax_rows_i64(x, y, rows, len); }
+void argmax_rows_f32_i32(const float* x, int32_t* y, int64_t rows, int64_t len) noexcept { active().argmax_rows_i32(x, y, rows, len); }
+
+void embedding_bag_f32_i64(const float* table, int64_t dim, const int64_t* idx, const int64_t* offsets,
+                           const float* weights, float* out, int64_t bag_begin, int64_t bag_end,
+                           int32_t mean) noexcept {
+    active().embedding_bag_i64(table, dim, idx, offsets, weights, out, bag_begin, bag_end, mean);
+}
+void embedding_bag_f32_i32(const float* table, int64_t dim, const int32_t* idx, const int32_t* offsets,
+                           const float* weights, float* out, int64_t bag_begin, int64_t bag_end,
+                           int32_t mean) noexcept {
+    active().embedding_bag_i32(table, dim, idx, offsets, weights, out, bag_begin, bag_end, mean);
+}
+
+void rope_half_f32(float* x, int64_t heads, int64_t head_dim, const float* cos, const float* sin,
+                   int64_t half) noexcept {
+    active().rope_half(x, heads, head_dim, cos, sin, half);
+}
+void rope_interleaved_f32(float* x, int64_t heads, int64_t head_dim, const float* cos, const float* sin,
+                          int64_t half) noexcept {
+    active().rope_interleaved(x, heads, head_dim, cos, sin, half);
+}
+
+void shuffle_bytes(const uint8_t* x, uint8_t* y, int64_t n, int64_t width) noexcept { active().shuffle_bytes(x, y, n, width); }
+void unshuffle_bytes(const uint8_t* x, uint8_t* y, int64_t n, int64_t width) noexcept { active().unshuffle_bytes(x, y, n, width); }
+
+uint64_t hash_bytes(const uint8_t* x, int64_t n, uint64_t seed) noexcept { return active().hash_bytes(x, n, seed); }
+
+} // namespace kernels
+} // namespace zero
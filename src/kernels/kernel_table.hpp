@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * @file kernel_table.hpp
+ * @brief zero-core-kernels — Per-ISA function table (private)
+ *
+ * Each ISA translation unit builds one KernelTable from its own explicit
+ * instantiation of impl::Cpu<I>. dispatch.cpp only ever sees the table
+ * pointers, so no ISA-specific code is instantiated at baseline flags.
+ */
+
+#include <zero/kernels/cpu_kernels.hpp>
+
+namespace zero {
+namespace kernels {
+namespace detail {
+
+using UnaryFn     = void (*)(const float*, float*, int64_t) noexcept;
+using BinaryFn    = void (*)(const float*, const float*, float*, int64_t) noexcept;
+using ScalarRhsFn = void (*)(const float*, float, float*, int64_t) noexcept;
+using GemmFn      = void (*)(const float*, const float*, float*,
+                             int64_t, int64_t, int64_t, float, float) noexcept;
+using RowsFn      = void (*)(const float*, float*, int64_t, int64_t) noexcept;
+using ArgmaxI64Fn = void (*)(const float*, int64_t*, int64_t, int64_t) noexcept;
+using ArgmaxI32Fn = void (*)(const float*, int32_t*, int64_t, int64_t) noexcept;
+using BagI64Fn    = void (*)(const float*, int64_t, const int64_t*, const int64_t*,
+                             const float*, float*, int64_t, int64_t, int32_t) noexcept;
+using BagI32Fn    = void (*)(const float*, int64_t, const int32_t*, const int32_t*,
+                             const float*, float*, int64_t, int64_t, int32_t) noexcept;
+using RopeFn      = void (*)(float*, int64_t, int64_t, const float*, const float*, int64_t) noexcept;
+using ShuffleFn   = void (*)(const uint8_t*, uint8_t*, int64_t, int64_t) noexcept;
+using HashFn      = uint64_t (*)(const uint8_t*, int64_t, uint64_t) noexcept;
+
+struct KernelTable {
+    Isa isa;
+    UnaryFn neg, abs, exp, log, sqrt, sin, cos, tanh, relu, sigmoid;
+    BinaryFn add, sub, mul, div;
+    ScalarRhsFn add_scalar, sub_scalar, mul_scalar, div_scalar;
+    GemmFn gemm;
+    RowsFn sum_rows, max_rows, min_rows, mean_rows, prod_rows;
+    ArgmaxI64Fn argmax_rows_i64;
+    ArgmaxI32Fn argmax_rows_i32;
+    BagI64Fn embedding_bag_i64;
+    BagI32Fn embedding_bag_i32;
+    RopeFn rope_half, rope_interleaved;
+    ShuffleFn shuffle_bytes, unshuffle_bytes;
+    HashFn hash_bytes;
+};
+
+template <Isa I>
+constexpr KernelTable make_table() noexcept {
+    using K = impl::Cpu<I>;
+    return KernelTable{
+        I,
+        &K::neg, &K::abs, &K::exp, &K::log, &K::sqrt,
+        &K::sin, &K::cos, &K::tanh, &K::relu, &K::sigmoid,
+        &K::add, &K::sub, &K::mul, &K::div,
+        &K::add_scalar, &K::sub_scalar, &K::mul_scalar, &K::div_scalar,
+        &K::gemm,
+        &K::sum_rows, &K::max_rows, &K::min_rows, &K::mean_rows, &K::prod_rows,
+        &K::argmax_rows_i64,
+        &K::argmax_rows_i32,
+        &K::embedding_bag_i64,
+        &K::embedding_bag_i32,
+        &K::rope_half, &K::rope_interleaved,
+        &K::shuffle_bytes, &K::unshuffle_bytes,
+        &K::hash_bytes,
+    };
+}
+
+// Defined in the per-ISA translation units that CMake enabled.
+const KernelTable* generic_table() noexcept;
+const KernelTable* avx2_table() noexcept;
+const KernelTable* avx512_table() noexcept;
+
+} // namespace detail
+} // namespace kernels
+} // namespace zero
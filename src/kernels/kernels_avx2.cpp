@@ -0,0 +1,25 @@
+/**
+ * @file kernels_avx2.cpp
+ * @brief zero-core-kernels — AVX2 instantiation
+ *
+ * Compiled with -mavx2 -mfma -ffp-contract=off (see src/CMakeLists.txt).
+ * Only reached after dispatch.cpp has confirmed host support.
+ */
+
+#include "kernel_table.hpp"
+
+namespace zero {
+namespace kernels {
+
+template struct impl::Cpu<Isa::AVX2>;
+
+namespace detail {
+
+const KernelTable* avx2_table() noexcept {
+    static constexpr KernelTable table = make_table<Isa::AVX2>();
+    return &table;
+}
+
+} // namespace detail
+} // namespace kernels
+} // namespace zero
@@ -0,0 +1,25 @@
+/**
+ * @file kernels_avx512.cpp
+ * @brief zero-core-kernels — AVX512 instantiation
+ *
+ * Compiled with -mavx512f -mavx512bw -mavx512dq -mavx512vl -ffp-contract=off (see src/CMakeLists.txt).
+ * Only reached after dispatch.cpp has confirmed host support.
+ */
+
+#include "kernel_table.hpp"
+
+namespace zero {
+namespace kernels {
+
+template struct impl::Cpu<Isa::AVX512>;
+
+namespace detail {
+
+const KernelTable* avx512_table() noexcept {
+    static constexpr KernelTable table = make_table<Isa::AVX512>();
+    return &table;
+}
+
+} // namespace detail
+} // namespace kernels
+} // namespace zero
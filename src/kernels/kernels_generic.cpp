@@ -0,0 +1,25 @@
+/**
+ * @file kernels_generic.cpp
+ * @brief zero-core-kernels — Baseline instantiation
+ *
+ * Built with the project's default flags. Always present; the fallback
+ * when no wider variant is built or supported.
+ */
+
+#include "kernel_table.hpp"
+
+namespace zero {
+namespace kernels {
+
+template struct impl::Cpu<Isa::GENERIC>;
+
+namespace detail {
+
+const KernelTable* generic_table() noexcept {
+    static constexpr KernelTable table = make_table<Isa::GENERIC>();
+    return &table;
+}
+
+} // namespace detail
+} // namespace kernels
+} // namespace zero
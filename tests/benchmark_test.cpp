@@ -233,6 +233,19 @@ void benchmark_matmul() {
         
         printf("MatMul %dx%d: %.2f ms (%.2f GFLOPS)\n", n, n, ms, gflops);
         
+        // Blocked gemm with the tuner's tiles (heuristic unless cached)
+        int64_t ws_floats = gemm_tuned_workspace_floats(A, B);
+        float* ws = static_cast<float*>(mem_alloc(static_cast<size_t>(ws_floats) * sizeof(float), 64, Device::CPU));
+        gemm_tuned(A, B, C, ws, ws_floats);
+        timer.start();
+        for (int i = 0; i < iterations; ++i) {
+            gemm_tuned(A, B, C, ws, ws_floats);
+        }
+        ms = timer.elapsed_ms() / iterations;
+        gflops = (2.0 * n * n * n) / (ms * 1e6);
+        printf("MatMul %dx%d blocked: %.2f ms (%.2f GFLOPS)\n", n, n, ms, gflops);
+        
+        mem_free(ws, Device::CPU);
         A.free(); B.free(); C.free();
     }
 }
@@ -253,10 +266,19 @@ void benchmark_elementwise() {
     
     int iterations = 100;
     
-    // Add
+    // Add (per-call latency too: the average hides the tail)
+    static telemetry::LatencyHistogram add_lat;
+    static telemetry::HistogramSnapshot add_snap;
     timer.start();
-    for (int i = 0; i < iterations; ++i) add(a, b, c);
+    for (int i = 0; i < iterations; ++i) {
+        int64_t t0 = telemetry::hist_now_ns();
+        add(a, b, c);
+        add_lat.record(telemetry::hist_now_ns() - t0);
+    }
     printf("Add 1M elements: %.2f ms\n", timer.elapsed_ms() / iterations);
+    add_lat.drain(add_snap);
+    printf("  p50 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+           add_snap.percentile(50.0) / 1e6, add_snap.percentile(99.0) / 1e6, add_snap.max() / 1e6);
     
     // Mul
     timer.start();
@@ -297,6 +319,33 @@ void benchmark_reduce() {
     a.free();
 }
 
+void benchmark_unchecked_small() {
+    printf("\n=== Checked vs Unchecked (small tensors) ===\n");
+    
+    std::mt19937 rng(42);
+    Timer timer;
+    
+    int64_t shape[] = {8};
+    Tensor a = Tensor::alloc(shape, 1, DType::F32);
+    Tensor b = Tensor::alloc(shape, 1, DType::F32);
+    Tensor c = Tensor::alloc(shape, 1, DType::F32);
+    
+    fill_random(a, rng);
+    fill_random(b, rng);
+    
+    int iterations = 1000000;
+    
+    timer.start();
+    for (int i = 0; i < iterations; ++i) add(a, b, c);
+    printf("Add [8] checked:   %.1f ns/call\n", timer.elapsed_ms() * 1e6 / iterations);
+    
+    timer.start();
+    for (int i = 0; i < iterations; ++i) add_unchecked(a, b, c);
+    printf("Add [8] unchecked: %.1f ns/call\n", timer.elapsed_ms() * 1e6 / iterations);
+    
+    a.free(); b.free(); c.free();
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Main
 // ─────────────────────────────────────────────────────────────────────────────
@@ -315,6 +364,7 @@ int main() {
     benchmark_matmul();
     benchmark_elementwise();
     benchmark_reduce();
+    benchmark_unchecked_small();
     
     // Summary
     printf("\n══════════════════════════════════════════════════════════════\n");
@@ -0,0 +1,336 @@
+/**
+ * @file test_async_reader.cpp
+ * @brief Acceptance tests for spec 022 — asynchronous bulk file reader.
+ *
+ * Tests derived from docs/specs/022-async-reader.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static uint32_t rng_state = 11u;
+
+static uint32_t next_rand() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+static void temp_path(char* buf, size_t n, const char* tag) {
+    std::snprintf(buf, n, "/tmp/zero-reader-%d-%s.bin", static_cast<int>(getpid()), tag);
+}
+
+// A file of `bytes` pseudo-random bytes; its contents are also returned.
+static unsigned char* make_file(const char* tag, int64_t bytes) {
+    char path[128];
+    temp_path(path, sizeof(path), tag);
+    auto* data = static_cast<unsigned char*>(std::malloc(static_cast<size_t>(bytes)));
+    for (int64_t i = 0; i < bytes; ++i) data[i] = static_cast<unsigned char>(next_rand());
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    int64_t done = 0;
+    while (done < bytes) {
+        ssize_t n = ::write(fd, data + done, static_cast<size_t>(bytes - done));
+        if (n <= 0) break;
+        done += n;
+    }
+    ::close(fd);
+    return data;
+}
+
+static void cleanup(const char* tag) {
+    char path[128];
+    temp_path(path, sizeof(path), tag);
+    std::remove(path);
+}
+
+static const char* backend_name(io::ReadBackend b) {
+    return b == io::ReadBackend::IO_URING ? "io_uring" : "threads";
+}
+
+// 300 "weight tensors" of assorted sizes at assorted offsets.
+static void test_batch(io::ReadBackend backend, const unsigned char* data, int64_t size) {
+    const int32_t n = 300;
+    io::ReaderOptions opt;
+    opt.backend = backend;
+    opt.queue_depth = 32;
+    opt.chunk_bytes = 16 << 10;   // small chunks: large tensors span many reads
+    io::AsyncReader reader;
+    Status s = reader.init(opt);
+    if (backend == io::ReadBackend::IO_URING && s.code == StatusCode::NOT_IMPLEMENTED) {
+        std::printf("INFO: io_uring unavailable here, skipping its batch test\n");
+        return;
+    }
+    char msg[160];
+    std::snprintf(msg, sizeof(msg), "reader initialized (%s)", backend_name(reader.backend()));
+    ASSERT(s.is_ok() && reader.backend() == (backend == io::ReadBackend::AUTO ? reader.backend() : backend), msg);
+
+    char path[128];
+    temp_path(path, sizeof(path), "weights");
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    io::ReadRequest reqs[n];
+    unsigned char* dst[n];
+    int64_t total = 0;
+    for (int32_t i = 0; i < n; ++i) {
+        int64_t bytes = i % 10 == 0 ? 100000 + next_rand() % 60000 : 1 + next_rand() % 5000;
+        if (i == 7) bytes = 0;
+        int64_t off = static_cast<int64_t>(next_rand()) % (size - bytes);
+        dst[i] = static_cast<unsigned char*>(std::malloc(static_cast<size_t>(bytes) + 1));
+        reqs[i] = {fd, off, dst[i], bytes};
+        total += bytes;
+    }
+    io::ReadStats st;
+    s = reader.read(reqs, n, &st);
+    bool same = true;
+    for (int32_t i = 0; i < n; ++i)
+        same = same && std::memcmp(dst[i], data + reqs[i].offset, static_cast<size_t>(reqs[i].bytes)) == 0;
+    std::snprintf(msg, sizeof(msg), "%s: 300 tensors read correctly (%lld reads, %d in flight at peak)",
+                  backend_name(reader.backend()), static_cast<long long>(st.reads), st.max_in_flight);
+    ASSERT(s.is_ok() && same && st.bytes == total, msg);
+    ASSERT(st.reads >= n - 1 + 30 * 6, "large tensors split into chunk-sized reads");
+    if (reader.backend() == io::ReadBackend::IO_URING)
+        ASSERT(st.max_in_flight == opt.queue_depth, "io_uring keeps the queue full");
+    else
+        ASSERT(st.max_in_flight >= 1 && st.max_in_flight <= opt.threads, "thread backend bounded by pool size");
+
+    // Registered destinations: READ_FIXED under io_uring, accepted and ignored otherwise.
+    void* bufs[2] = {dst[0], dst[10]};
+    int64_t sizes[2] = {reqs[0].bytes, reqs[10].bytes};
+    std::memset(dst[0], 0, static_cast<size_t>(reqs[0].bytes));
+    std::memset(dst[10], 0, static_cast<size_t>(reqs[10].bytes));
+    Status rs = reader.register_buffers(bufs, sizes, 2);
+    if (rs.is_ok()) {
+        io::ReadRequest again[2] = {reqs[0], reqs[10]};
+        s = reader.read(again, 2, &st);
+        same = std::memcmp(dst[0], data + reqs[0].offset, static_cast<size_t>(reqs[0].bytes)) == 0 &&
+               std::memcmp(dst[10], data + reqs[10].offset, static_cast<size_t>(reqs[10].bytes)) == 0;
+        ASSERT(s.is_ok() && same, "reads into registered buffers land");
+        if (reader.backend() == io::ReadBackend::IO_URING)
+            ASSERT(st.fixed_reads == st.reads && st.fixed_reads > 0, "registered buffers use READ_FIXED");
+        reader.unregister_buffers();
+    } else {
+        std::printf("INFO: buffer registration refused (memlock limit), skipping READ_FIXED\n");
+    }
+
+    // Submitted batches run on the reader's driver and complete their own `done`.
+    for (int32_t i = 0; i < n; ++i) std::memset(dst[i], 0, static_cast<size_t>(reqs[i].bytes));
+    io::ReadBatch parts[4];
+    int64_t part_bytes[3] = {0, 0, 0};
+    for (int32_t b = 0; b < 3; ++b) {
+        parts[b].reqs = reqs + b * (n / 3);
+        parts[b].n = n / 3;
+        for (int32_t i = 0; i < n / 3; ++i) part_bytes[b] += reqs[b * (n / 3) + i].bytes;
+    }
+    unsigned char scratch[200];
+    io::ReadRequest beyond = {fd, size - 100, scratch, 200};
+    parts[3].reqs = &beyond;
+    parts[3].n = 1;
+    bool queued = true;
+    for (int32_t b = 0; b < 4; ++b) queued = queued && reader.submit(&parts[b]).is_ok();
+    bool landed = true;
+    for (int32_t b = 0; b < 3; ++b) landed = landed && parts[b].done.wait().is_ok() && parts[b].stats.bytes == part_bytes[b];
+    same = true;
+    for (int32_t i = 0; i < n; ++i)
+        same = same && std::memcmp(dst[i], data + reqs[i].offset, static_cast<size_t>(reqs[i].bytes)) == 0;
+    ASSERT(queued && landed && same, "submitted batches land with per-batch stats");
+    ASSERT(parts[3].done.wait().code == StatusCode::OUT_OF_BOUNDS, "a failing batch fails alone");
+
+    // Failures: past EOF, bad request, and the reader stays usable.
+    io::ReadRequest past = {fd, size - 100, dst[0], 200};
+    ASSERT(reader.read(&past, 1).code == StatusCode::OUT_OF_BOUNDS, "read past end of file reported");
+    io::ReadRequest bad = {fd, 0, nullptr, 10};
+    ASSERT(reader.read(&bad, 1).code == StatusCode::INVALID_ARGUMENT, "null destination rejected");
+    s = reader.read(reqs, 5);
+    same = true;
+    for (int32_t i = 0; i < 5; ++i)
+        same = same && std::memcmp(dst[i], data + reqs[i].offset, static_cast<size_t>(reqs[i].bytes)) == 0;
+    ASSERT(s.is_ok() && same, "reader usable after a failed batch");
+
+    for (int32_t i = 0; i < n; ++i) std::free(dst[i]);
+    ::close(fd);
+}
+
+static void test_direct(const unsigned char* data) {
+    std::printf("\n--- O_DIRECT into aligned tensors ---\n");
+    char path[128];
+    temp_path(path, sizeof(path), "weights");
+    int fd = -1;
+    bool direct = false;
+    ASSERT(io::open_read(path, true, fd, &direct).is_ok(), "open_read with O_DIRECT request");
+    std::printf("INFO: O_DIRECT %s on this filesystem\n", direct ? "in use" : "unsupported, buffered");
+
+    io::AsyncReader reader;
+    io::ReaderOptions opt;
+    opt.chunk_bytes = 64 << 10;
+    (void)reader.init(opt);
+    // Sizes that are not multiples of the block: the tail goes through a bounce block.
+    const int64_t shapes[3][2] = {{37, 1001}, {1, 3}, {256, 512}};
+    const int64_t offsets[3] = {0, 8 * io::DIRECT_IO_ALIGN, 64 * io::DIRECT_IO_ALIGN};
+    Tensor t[3];
+    io::ReadRequest reqs[3];
+    for (int i = 0; i < 3; ++i) {
+        t[i] = io::alloc_direct(shapes[i], 2, DType::F32);
+        reqs[i] = {fd, offsets[i], t[i].data, static_cast<int64_t>(t[i].nbytes())};
+    }
+    bool aligned = reinterpret_cast<uintptr_t>(t[0].data) % io::DIRECT_IO_ALIGN == 0;
+    io::ReadStats st;
+    Status s = reader.read(reqs, 3, &st);
+    bool same = true;
+    for (int i = 0; i < 3; ++i)
+        same = same && std::memcmp(t[i].data, data + offsets[i], static_cast<size_t>(t[i].nbytes())) == 0;
+    ASSERT(aligned && s.is_ok() && same, "unaligned-length tensors load through O_DIRECT");
+    if (direct) {
+        io::ReadRequest off = {fd, 100, t[0].data, 4096};
+        ASSERT(reader.read(&off, 1).code == StatusCode::INVALID_ARGUMENT, "misaligned O_DIRECT offset rejected");
+        io::ReadRequest mis = {fd, 0, static_cast<char*>(t[0].data) + 4, 4096};
+        ASSERT(reader.read(&mis, 1).code == StatusCode::INVALID_ARGUMENT, "misaligned O_DIRECT buffer rejected");
+    }
+    for (int i = 0; i < 3; ++i) t[i].free();
+    ::close(fd);
+}
+
+static void test_validation() {
+    std::printf("\n--- validation ---\n");
+    io::AsyncReader reader;
+    io::ReadRequest none;
+    ASSERT(reader.read(&none, 1).code == StatusCode::INVALID_STATE, "read before init rejected");
+    io::ReadBatch early;
+    ASSERT(reader.submit(&early).code == StatusCode::INVALID_STATE, "submit before init rejected");
+    io::ReaderOptions opt;
+    opt.queue_depth = 0;
+    ASSERT(reader.init(opt).code == StatusCode::INVALID_ARGUMENT, "queue depth 0 rejected");
+    opt.queue_depth = 8;
+    opt.chunk_bytes = 0;
+    ASSERT(reader.init(opt).code == StatusCode::INVALID_ARGUMENT, "chunk size 0 rejected");
+    opt.chunk_bytes = 4096;
+    ASSERT(reader.init(opt).is_ok() && reader.init(opt).code == StatusCode::INVALID_STATE,
+           "double init rejected");
+    ASSERT(reader.read(nullptr, 0).is_ok(), "empty batch succeeds");
+    int fd = ::open("/dev/null", O_RDONLY);
+    char buf[4];
+    io::ReadRequest neg = {fd, -1, buf, 4};
+    ASSERT(reader.read(&neg, 1).code == StatusCode::INVALID_ARGUMENT, "negative offset rejected");
+    io::ReadBatch batch;
+    batch.reqs = &neg;
+    batch.n = 1;
+    ASSERT(reader.submit(&batch).code == StatusCode::INVALID_ARGUMENT && !batch.done.ready() &&
+           reader.submit(nullptr).code == StatusCode::INVALID_ARGUMENT, "bad submits rejected without queuing");
+    io::ReadBatch empty;
+    ASSERT(reader.submit(&empty).is_ok() && empty.done.wait().is_ok(), "empty submitted batch completes");
+    reader.close();
+    ASSERT(reader.submit(&empty).code == StatusCode::INVALID_STATE, "submit after close rejected");
+    ::close(fd);
+}
+
+static void test_out_of_core() {
+    std::printf("\n--- out-of-core gemm through the reader ---\n");
+    const int64_t M = 200, K = 64, N = 150;
+    int64_t as[2] = {M, K}, bs[2] = {K, N}, cs[2] = {M, N};
+    Tensor a = Tensor::alloc(as, 2, DType::F32), b = Tensor::alloc(bs, 2, DType::F32);
+    Tensor ref = Tensor::alloc(cs, 2, DType::F32), got = Tensor::alloc(cs, 2, DType::F32);
+    for (int64_t i = 0; i < a.numel(); ++i) static_cast<float*>(a.data)[i] = static_cast<float>(next_rand() % 200) / 100.0f - 1.0f;
+    for (int64_t i = 0; i < b.numel(); ++i) static_cast<float*>(b.data)[i] = static_cast<float>(next_rand() % 200) / 100.0f - 1.0f;
+    (void)ops::gemm(a, b, ref);
+    char pa[128], pb[128], pc[128];
+    temp_path(pa, sizeof(pa), "a");
+    temp_path(pb, sizeof(pb), "b");
+    temp_path(pc, sizeof(pc), "c");
+    io::FileTensor fa, fb, fc;
+    (void)io::FileTensor::create(pa, as, 2, DType::F32, fa);
+    (void)io::FileTensor::create(pb, bs, 2, DType::F32, fb);
+    (void)io::FileTensor::create(pc, cs, 2, DType::F32, fc);
+    (void)fa.write(0, a.data, a.nbytes());
+    (void)fb.write(0, b.data, b.nbytes());
+
+    io::AsyncReader reader;
+    (void)reader.init();
+    io::OocOptions opt;
+    opt.memory_budget = 48 << 10;   // sub-blocks: one request per row
+    opt.reader = &reader;
+    io::OocStats st;
+    Status s = io::gemm(fa, fb, fc, opt, &st);
+    (void)fc.read(0, got.data, got.nbytes());
+    float err = 0.0f;
+    for (int64_t i = 0; i < got.numel(); ++i)
+        err = std::fmax(err, std::fabs(static_cast<float*>(got.data)[i] - static_cast<float*>(ref.data)[i]));
+    ASSERT(s.is_ok() && err < 1e-3f && st.tile_n < N, "gemm with tiles read through the reader matches");
+
+    fa.close(); fb.close(); fc.close();
+    cleanup("a"); cleanup("b"); cleanup("c");
+    a.free(); b.free(); ref.free(); got.free();
+}
+
+static void test_timing(const unsigned char* data, int64_t size) {
+    std::printf("\n--- bulk load throughput (informational) ---\n");
+    (void)data;
+    char path[128];
+    temp_path(path, sizeof(path), "weights");
+    const int32_t n = 64;
+    const int64_t each = size / n;
+    unsigned char* dst = static_cast<unsigned char*>(std::malloc(static_cast<size_t>(size)));
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < n; ++i) {
+        int64_t done = 0;
+        while (done < each) {
+            ssize_t r = ::pread(fd, dst + i * each + done, static_cast<size_t>(each - done), i * each + done);
+            if (r <= 0) break;
+            done += r;
+        }
+    }
+    double serial = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    io::AsyncReader reader;
+    (void)reader.init();
+    io::ReadRequest reqs[n];
+    for (int32_t i = 0; i < n; ++i) reqs[i] = {fd, i * each, dst + i * each, each};
+    t0 = std::chrono::steady_clock::now();
+    (void)reader.read(reqs, n);
+    double batched = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    double mib = static_cast<double>(size) / (1 << 20);
+    std::printf("INFO: %.0f MiB in %d tensors: read() loop %.0f MiB/s, %s %.0f MiB/s (page cache warm)\n", mib, n,
+                mib / serial, backend_name(reader.backend()), mib / batched);
+    ::close(fd);
+    std::free(dst);
+}
+
+int main() {
+    std::printf("=== Spec 022 — Asynchronous Bulk File Reader ===\n");
+
+    const int64_t size = int64_t{8} << 20;
+    unsigned char* data = make_file("weights", size);
+
+    std::printf("\n--- io_uring backend ---\n");
+    test_batch(io::ReadBackend::IO_URING, data, size);
+    std::printf("\n--- thread backend ---\n");
+    test_batch(io::ReadBackend::THREADS, data, size);
+    test_direct(data);
+    test_validation();
+    test_out_of_core();
+    test_timing(data, size);
+
+    cleanup("weights");
+    std::free(data);
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
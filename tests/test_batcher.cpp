@@ -0,0 +1,363 @@
+/**
+ * @file test_batcher.cpp
+ * @brief Acceptance tests for spec 006 — dynamic request batching.
+ *
+ * Tests derived from docs/specs/006-dynamic-request-batching.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+using namespace zero;
+using namespace zero::exec;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+// Step under test: out[n, 2] = in[n, 4] @ W[4, 2]. Records batch sizes.
+struct Model {
+    Tensor W;
+    int64_t max_seen_batch = 0;
+    int64_t step_calls = 0;
+};
+
+static Status model_step(const Tensor& batch_in, Tensor& batch_out, void* user) noexcept {
+    Model* m = static_cast<Model*>(user);
+    m->step_calls++;
+    if (batch_in.shape[0] > m->max_seen_batch) m->max_seen_batch = batch_in.shape[0];
+    return ops::matmul(batch_in, m->W, batch_out);
+}
+
+static Status failing_step(const Tensor&, Tensor&, void*) noexcept {
+    return status::invalid_state("model exploded");
+}
+
+static const int64_t kIn[] = {4};
+static const int64_t kOut[] = {2};
+
+static Model make_model() {
+    Model m;
+    int64_t w_shape[] = {4, 2};
+    m.W = Tensor::alloc(w_shape, 2, DType::F32);
+    float* w = static_cast<float*>(m.W.data);
+    for (int i = 0; i < 8; ++i) w[i] = static_cast<float>(i % 3) - 0.5f;
+    return m;
+}
+
+static void make_request(BatchRequest& r, float seed) {
+    int64_t row_in[] = {1, 4};
+    int64_t row_out[] = {1, 2};
+    r.input = Tensor::alloc(row_in, 2, DType::F32);
+    r.output = Tensor::alloc(row_out, 2, DType::F32);
+    float* p = static_cast<float*>(r.input.data);
+    for (int i = 0; i < 4; ++i) p[i] = seed + static_cast<float>(i);
+    std::memset(r.output.data, 0, r.output.nbytes());
+}
+
+// Reference: the same matmul on the single sample.
+static bool output_matches(const BatchRequest& r, const Model& m) {
+    int64_t row_out[] = {1, 2};
+    Tensor ref = Tensor::alloc(row_out, 2, DType::F32);
+    bool ok = ops::matmul(r.input, m.W, ref).is_ok() &&
+              std::memcmp(ref.data, r.output.data, ref.nbytes()) == 0;
+    ref.free();
+    return ok;
+}
+
+static void free_request(BatchRequest& r) {
+    r.input.free();
+    r.output.free();
+}
+
+static void test_init_and_submit_validation() {
+    std::printf("\n--- init / submit validation ---\n");
+    Model m = make_model();
+    Batcher b;
+
+    BatcherConfig bad;
+    bad.max_batch = 0;
+    ASSERT(b.init(bad, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32),
+                  model_step, &m).code == StatusCode::INVALID_ARGUMENT,
+           "init rejects max_batch == 0");
+    ASSERT(b.init(BatcherConfig{}, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32),
+                  nullptr, &m).code == StatusCode::INVALID_ARGUMENT,
+           "init rejects null step");
+
+    BatchRequest r;
+    make_request(r, 0.0f);
+    ASSERT(b.submit(&r).code == StatusCode::INVALID_STATE, "submit before init fails");
+
+    ASSERT(b.init(BatcherConfig{}, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32),
+                  model_step, &m).is_ok(), "init ok");
+    ASSERT(b.init(BatcherConfig{}, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32),
+                  model_step, &m).code == StatusCode::INVALID_STATE,
+           "second init is rejected");
+
+    BatchRequest wrong;
+    int64_t bad_in[] = {1, 3};
+    int64_t row_out[] = {1, 2};
+    wrong.input = Tensor::alloc(bad_in, 2, DType::F32);
+    wrong.output = Tensor::alloc(row_out, 2, DType::F32);
+    ASSERT(b.submit(&wrong).code == StatusCode::INVALID_ARGUMENT, "submit rejects wrong sample size");
+    free_request(wrong);
+
+    b.destroy();
+    free_request(r);
+    m.W.free();
+}
+
+static void test_manual_drive_fills_batches() {
+    std::printf("\n--- run_once: batch fills to max_batch ---\n");
+    Model m = make_model();
+    Batcher b;
+    BatcherConfig cfg;
+    cfg.max_batch = 4;
+    cfg.max_wait_us = 1000000;  // Long budget: only a full batch closes early
+    ASSERT(b.init(cfg, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32),
+                  model_step, &m).is_ok(), "init ok");
+
+    BatchRequest reqs[6];
+    for (int i = 0; i < 6; ++i) {
+        make_request(reqs[i], static_cast<float>(i));
+        ASSERT(b.submit(&reqs[i]).is_ok(), "submit ok");
+    }
+
+    ASSERT(b.run_once() == 4, "first batch is full (4)");
+    ASSERT(m.max_seen_batch == 4, "step saw a batch of 4");
+    bool first_four = true;
+    for (int i = 0; i < 4; ++i) first_four = first_four && reqs[i].done.ready();
+    ASSERT(first_four && !reqs[4].done.ready(), "oldest four completed in FIFO order");
+
+    // Remaining two close on stop() instead of waiting out the budget.
+    b.stop();
+    ASSERT(reqs[4].done.ready() && reqs[5].done.ready(), "stop flushes the partial batch");
+
+    bool all_ok = true;
+    for (int i = 0; i < 6; ++i) {
+        all_ok = all_ok && reqs[i].done.wait().is_ok() && output_matches(reqs[i], m);
+    }
+    ASSERT(all_ok, "every output equals the unbatched matmul");
+    ASSERT(b.batches_run() == 2 && b.requests_served() == 6, "stats: 2 batches, 6 requests");
+
+    b.destroy();
+    for (auto& r : reqs) free_request(r);
+    m.W.free();
+}
+
+static void test_deadline_closes_partial_batch() {
+    std::printf("\n--- run_once: deadline closes a partial batch ---\n");
+    Model m = make_model();
+    Batcher b;
+    BatcherConfig cfg;
+    cfg.max_batch = 8;
+    cfg.max_wait_us = 2000;
+    ASSERT(b.init(cfg, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32),
+                  model_step, &m).is_ok(), "init ok");
+
+    BatchRequest r;
+    make_request(r, 3.0f);
+    ASSERT(b.submit(&r).is_ok(), "submit ok");
+    auto t0 = std::chrono::steady_clock::now();
+    ASSERT(b.run_once() == 1, "lone request served after its deadline");
+    auto waited = std::chrono::steady_clock::now() - t0;
+    ASSERT(waited >= std::chrono::microseconds(1500), "driver waited for the latency budget");
+    ASSERT(r.done.wait().is_ok() && output_matches(r, m), "lone request output correct");
+
+    b.destroy();
+    free_request(r);
+    m.W.free();
+}
+
+static double thread_cpu_ms() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e3 + static_cast<double>(ts.tv_nsec) * 1e-6;
+}
+
+static void test_driver_sleeps_through_budget() {
+    std::printf("\n--- run_once: driver sleeps, not spins, until the deadline ---\n");
+    Model m = make_model();
+    Batcher b;
+    BatcherConfig cfg;
+    cfg.max_batch = 8;
+    cfg.max_wait_us = 50000;
+    ASSERT(b.init(cfg, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32),
+                  model_step, &m).is_ok(), "init ok");
+
+    BatchRequest r;
+    make_request(r, 1.0f);
+    ASSERT(b.submit(&r).is_ok(), "submit ok");
+    double cpu0 = thread_cpu_ms();
+    ASSERT(b.run_once() == 1, "request served at its deadline");
+    double cpu = thread_cpu_ms() - cpu0;
+    std::printf("INFO: driver used %.2f ms CPU over a 50 ms budget\n", cpu);
+    ASSERT(cpu < 25.0, "driver used well under the budget in CPU time");
+
+    b.destroy();
+    free_request(r);
+    m.W.free();
+}
+
+static void test_step_error_propagates() {
+    std::printf("\n--- step error reaches every completion ---\n");
+    Batcher b;
+    BatcherConfig cfg;
+    cfg.max_batch = 2;
+    cfg.max_wait_us = 0;
+    ASSERT(b.init(cfg, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32),
+                  failing_step, nullptr).is_ok(), "init ok");
+    BatchRequest a, c;
+    make_request(a, 0.0f);
+    make_request(c, 1.0f);
+    ASSERT(b.submit(&a).is_ok() && b.submit(&c).is_ok(), "submits ok");
+    ASSERT(b.run_once() == 2, "batch of 2 ran");
+    ASSERT(a.done.wait().code == StatusCode::INVALID_STATE &&
+           c.done.wait().code == StatusCode::INVALID_STATE, "both requests see step error");
+    b.destroy();
+    free_request(a);
+    free_request(c);
+}
+
+static void test_worker_with_concurrent_producers() {
+    std::printf("\n--- worker thread + 4 producer threads ---\n");
+    Model m = make_model();
+    Batcher b;
+    BatcherConfig cfg;
+    cfg.max_batch = 8;
+    cfg.max_wait_us = 500;
+    ASSERT(b.init(cfg, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32),
+                  model_step, &m).is_ok(), "init ok");
+    ASSERT(b.start().is_ok(), "start ok");
+
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 50;
+    std::vector<BatchRequest> reqs(kThreads * kPerThread);
+    for (size_t i = 0; i < reqs.size(); ++i) make_request(reqs[i], static_cast<float>(i) * 0.01f);
+
+    std::atomic<int> submit_errors{0};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t) {
+        producers.emplace_back([&, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                BatchRequest& r = reqs[static_cast<size_t>(t * kPerThread + i)];
+                if (b.submit(&r).is_error()) submit_errors++;
+                if (i % 10 == 9) r.done.wait();  // Closed-loop clients
+            }
+        });
+    }
+    for (auto& th : producers) th.join();
+
+    bool all_ok = true;
+    for (auto& r : reqs) all_ok = all_ok && r.done.wait().is_ok() && output_matches(r, m);
+    b.stop();
+
+    ASSERT(submit_errors.load() == 0, "no submit errors");
+    ASSERT(all_ok, "all 200 outputs equal the unbatched matmul");
+    ASSERT(b.requests_served() == reqs.size(), "every request served exactly once");
+    ASSERT(m.max_seen_batch <= cfg.max_batch, "no batch exceeds max_batch");
+    std::printf("INFO: %llu batches for %zu requests\n",
+                static_cast<unsigned long long>(b.batches_run()), reqs.size());
+
+    b.destroy();
+    for (auto& r : reqs) free_request(r);
+    m.W.free();
+}
+
+static void test_submit_racing_stop() {
+    std::printf("\n--- submit() racing stop() ---\n");
+    Model m = make_model();
+    constexpr int kRounds = 20;
+    constexpr int kThreads = 3;
+    constexpr int kPerThread = 16;
+    std::vector<BatchRequest> reqs(kThreads * kPerThread);
+    for (size_t i = 0; i < reqs.size(); ++i) make_request(reqs[i], static_cast<float>(i) * 0.01f);
+
+    std::atomic<int> bad_rejects{0};
+    bool all_settled = true;
+    bool all_ok = true;
+    for (int round = 0; round < kRounds; ++round) {
+        Batcher b;
+        BatcherConfig cfg;
+        cfg.max_batch = 4;
+        cfg.max_wait_us = 100;
+        b.init(cfg, TensorMeta(1, kIn, DType::F32), TensorMeta(1, kOut, DType::F32), model_step, &m);
+        b.start();
+
+        std::atomic<bool> go{false};
+        std::vector<char> accepted(reqs.size(), 0);
+        std::vector<std::thread> producers;
+        for (int t = 0; t < kThreads; ++t) {
+            producers.emplace_back([&, t] {
+                while (!go.load()) std::this_thread::yield();
+                for (int i = 0; i < kPerThread; ++i) {
+                    size_t k = static_cast<size_t>(t * kPerThread + i);
+                    Status s = b.submit(&reqs[k]);
+                    if (s.is_ok()) accepted[k] = 1;
+                    else if (s.code != StatusCode::INVALID_STATE) bad_rejects++;
+                }
+            });
+        }
+        go.store(true);
+        std::this_thread::yield();
+        b.stop();
+        for (auto& th : producers) th.join();
+
+        for (size_t k = 0; k < reqs.size(); ++k) {
+            if (!accepted[k]) continue;
+            if (!reqs[k].done.ready()) all_settled = false;
+            else all_ok = all_ok && reqs[k].done.wait().is_ok() && output_matches(reqs[k], m);
+        }
+        b.destroy();
+    }
+    ASSERT(all_settled && bad_rejects.load() == 0, "every accepted request completed by stop(); the rest were rejected");
+    ASSERT(all_ok, "accepted requests produced correct outputs");
+
+    for (auto& r : reqs) free_request(r);
+    m.W.free();
+}
+
+static void test_completion_freed_after_wait() {
+    std::printf("\n--- Completion freed as soon as wait() returns ---\n");
+    constexpr int kIters = 2000;
+    bool all_ok = true;
+    for (int i = 0; i < kIters; ++i) {
+        Completion* c = new Completion();
+        std::thread producer([c] { c->complete(Status::ok()); });
+        all_ok = all_ok && c->wait().is_ok();
+        delete c;  // producer may still be inside complete()
+        producer.join();
+    }
+    ASSERT(all_ok, "2000 complete/wait/free rounds (checked under ASAN/TSAN)");
+}
+
+int main() {
+    std::printf("=== Spec 006 — Dynamic request batching ===\n");
+
+    test_init_and_submit_validation();
+    test_manual_drive_fills_batches();
+    test_deadline_closes_partial_batch();
+    test_driver_sleeps_through_budget();
+    test_step_error_propagates();
+    test_worker_with_concurrent_producers();
+    test_submit_racing_stop();
+    test_completion_freed_after_wait();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
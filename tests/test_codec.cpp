@@ -0,0 +1,256 @@
+/**
+ * @file test_codec.cpp
+ * @brief Acceptance tests for spec 023 — compressed tensor container.
+ *
+ * Tests derived from docs/specs/023-tensor-codec.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static uint32_t rng_state = 3u;
+
+static uint32_t next_rand() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+// Weight-like F32: small normal-ish values with 16 significant bits (BF16-trained).
+static Tensor weights_f32(int64_t rows, int64_t cols) {
+    int64_t shape[2] = {rows, cols};
+    Tensor t = Tensor::alloc(shape, 2, DType::F32);
+    auto* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) {
+        float u = static_cast<float>(static_cast<int32_t>(next_rand() % 2001) - 1000) / 1000.0f;
+        float v = 0.02f * u * u * u;
+        uint32_t bits;
+        std::memcpy(&bits, &v, 4);
+        bits &= 0xFFFF0000u;
+        std::memcpy(&p[i], &bits, 4);
+    }
+    return t;
+}
+
+static bool round_trip(const Tensor& t, const io::CodecOptions& opt, io::CodecStats* st, exec::ThreadPool* dpool) {
+    int64_t cap = io::compressed_bound(t, opt);
+    auto* buf = static_cast<uint8_t*>(std::malloc(static_cast<size_t>(cap)));
+    int64_t n = 0;
+    bool ok = io::compress(t, buf, cap, n, opt, st).is_ok();
+    Tensor back = Tensor::alloc(t.shape.data(), t.ndim, t.dtype);
+    ok = ok && io::decompress(buf, n, back, dpool).is_ok();
+    ok = ok && (t.nbytes() == 0 || std::memcmp(back.data, t.data, t.nbytes()) == 0);
+    back.free();
+    std::free(buf);
+    return ok;
+}
+
+static void test_lz() {
+    std::printf("\n--- LZ stage ---\n");
+    const int64_t n = 100000;
+    auto* src = static_cast<uint8_t*>(std::malloc(n));
+    auto* comp = static_cast<uint8_t*>(std::malloc(io::lz_bound(n)));
+    auto* back = static_cast<uint8_t*>(std::malloc(n));
+
+    struct Case { const char* name; int kind; };
+    const Case cases[] = {{"zeros", 0}, {"random bytes", 1}, {"period-3 pattern", 2}, {"text-like mix", 3}};
+    for (const Case& c : cases) {
+        for (int64_t i = 0; i < n; ++i) {
+            if (c.kind == 0) src[i] = 0;
+            else if (c.kind == 1) src[i] = static_cast<uint8_t>(next_rand());
+            else if (c.kind == 2) src[i] = static_cast<uint8_t>("abc"[i % 3]);
+            else src[i] = static_cast<uint8_t>(i % 97 < 60 ? 'a' + (i / 97) % 7 : next_rand() % 4);
+        }
+        int64_t m = io::lz_compress(src, n, comp, io::lz_bound(n));
+        bool ok = m > 0 && io::lz_decompress(comp, m, back, n) && std::memcmp(src, back, n) == 0;
+        char msg[128];
+        std::snprintf(msg, sizeof(msg), "%s round-trips (%lld -> %lld bytes)", c.name, static_cast<long long>(n),
+                      static_cast<long long>(m));
+        ASSERT(ok && m <= io::lz_bound(n), msg);
+        if (c.kind == 0 || c.kind == 2) ASSERT(m < n / 100, "runs collapse to a few sequences");
+    }
+    ASSERT(io::lz_compress(src, 0, comp, 16) == 1 && io::lz_decompress(comp, 1, back, 0), "empty input round-trips");
+    ASSERT(io::lz_compress(src, 3, comp, 16) > 0 && io::lz_decompress(comp, 4, back, 3) &&
+           std::memcmp(src, back, 3) == 0, "input shorter than a match round-trips");
+    ASSERT(io::lz_compress(src, n, comp, 100) == -1, "small output buffer reported");
+
+    for (int64_t i = 0; i < n; ++i) src[i] = static_cast<uint8_t>(i % 13);
+    int64_t m = io::lz_compress(src, n, comp, io::lz_bound(n));
+    ASSERT(!io::lz_decompress(comp, m - 1, back, n), "truncated stream rejected");
+    ASSERT(!io::lz_decompress(comp, m, back, n - 1), "stream longer than output rejected");
+    // Flip bytes throughout; every decode must stay in bounds (checked under ASAN).
+    int32_t rejected = 0;
+    for (int64_t k = 0; k < m; k += 7) {
+        comp[k] ^= 0x5A;
+        rejected += io::lz_decompress(comp, m, back, n) ? 0 : 1;
+        comp[k] ^= 0x5A;
+    }
+    ASSERT(rejected > 0, "corrupted streams rejected without overrun");
+
+    std::free(src);
+    std::free(comp);
+    std::free(back);
+}
+
+static void test_container() {
+    std::printf("\n--- container round trips ---\n");
+    Tensor w = weights_f32(333, 1001);
+    io::CodecStats plain_st, shuf_st;
+    io::CodecOptions plain;
+    plain.shuffle = false;
+    plain.chunk_bytes = 64 << 10;
+    io::CodecOptions shuf;
+    shuf.chunk_bytes = 64 << 10;
+    ASSERT(round_trip(w, plain, &plain_st, nullptr), "F32 weights round-trip without shuffle");
+    ASSERT(round_trip(w, shuf, &shuf_st, nullptr), "F32 weights round-trip with shuffle");
+    char msg[160];
+    double r_plain = static_cast<double>(plain_st.stored_bytes) / static_cast<double>(plain_st.raw_bytes);
+    double r_shuf = static_cast<double>(shuf_st.stored_bytes) / static_cast<double>(shuf_st.raw_bytes);
+    std::snprintf(msg, sizeof(msg), "shuffle improves the ratio (%.3f -> %.3f over %lld chunks)", r_plain, r_shuf,
+                  static_cast<long long>(shuf_st.chunks));
+    ASSERT(r_shuf < 0.75 && r_shuf < r_plain, msg);
+
+    exec::ThreadPool pool;
+    (void)pool.start(4);
+    io::CodecOptions par = shuf;
+    par.pool = &pool;
+    int64_t cap = io::compressed_bound(w, shuf);
+    auto* a = static_cast<uint8_t*>(std::malloc(static_cast<size_t>(cap)));
+    auto* b = static_cast<uint8_t*>(std::malloc(static_cast<size_t>(cap)));
+    int64_t na = 0, nb = 0;
+    (void)io::compress(w, a, cap, na, shuf);
+    (void)io::compress(w, b, cap, nb, par);
+    ASSERT(na == nb && std::memcmp(a, b, static_cast<size_t>(na)) == 0, "pooled compression is byte-identical");
+    ASSERT(round_trip(w, par, nullptr, &pool), "pooled compress and decompress round-trip");
+
+    // Other widths, a ragged last chunk and an empty tensor.
+    int64_t s1[1] = {100003};
+    const DType types[] = {DType::BF16, DType::I64, DType::U8, DType::F64};
+    const char* names[] = {"BF16", "I64", "U8", "F64"};
+    for (int k = 0; k < 4; ++k) {
+        Tensor t = Tensor::alloc(s1, 1, types[k]);
+        auto* p = static_cast<uint8_t*>(t.data);
+        for (size_t i = 0; i < t.nbytes(); ++i) p[i] = static_cast<uint8_t>(i % 7 == 0 ? next_rand() : i / 4096);
+        io::CodecOptions o;
+        o.chunk_bytes = 10000;
+        std::snprintf(msg, sizeof(msg), "%s tensor with a ragged last chunk round-trips", names[k]);
+        ASSERT(round_trip(t, o, nullptr, &pool), msg);
+        t.free();
+    }
+    int64_t s0[2] = {0, 5};
+    Tensor e = Tensor::alloc(s0, 2, DType::F32);
+    ASSERT(round_trip(e, shuf, nullptr, nullptr), "empty tensor round-trips");
+
+    // Incompressible data is stored raw.
+    Tensor r = Tensor::alloc(s1, 1, DType::F32);
+    for (size_t i = 0; i < r.nbytes(); ++i) static_cast<uint8_t*>(r.data)[i] = static_cast<uint8_t>(next_rand());
+    io::CodecStats rst;
+    ASSERT(round_trip(r, shuf, &rst, nullptr) && rst.stored_raw == rst.chunks &&
+           rst.stored_bytes == static_cast<int64_t>(sizeof(io::CodecHeader)) + rst.chunks * 8 + rst.raw_bytes,
+           "random bytes stored raw with only the chunk table as overhead");
+    r.free();
+
+    // Validation.
+    io::CodecHeader h;
+    ASSERT(io::read_header(a, na, h).is_ok() && h.ndim == 2 && h.shape[1] == 1001, "header describes the tensor");
+    ASSERT(io::read_header(a, 10, h).code == StatusCode::INVALID_ARGUMENT, "truncated header rejected");
+    ASSERT(io::read_header(a, na - 1, h).code == StatusCode::INVALID_ARGUMENT, "truncated payload rejected");
+    Tensor wrong = Tensor::alloc(s1, 1, DType::F32);
+    ASSERT(io::decompress(a, na, wrong).code == StatusCode::TYPE_MISMATCH, "mismatched output rejected");
+    wrong.free();
+    Tensor unbacked = Tensor::alloc(w.shape.data(), 2, DType::F32);
+    void* owned = unbacked.data;
+    unbacked.data = nullptr;
+    ASSERT(io::decompress(a, na, unbacked).code == StatusCode::INVALID_STATE, "output without storage rejected");
+    unbacked.data = owned;
+    unbacked.free();
+    a[sizeof(io::CodecHeader) + shuf_st.chunks * 8 + 5] ^= 0xFF;
+    Tensor back = Tensor::alloc(w.shape.data(), 2, DType::F32);
+    Status s = io::decompress(a, na, back);
+    ASSERT(s.is_error() || std::memcmp(back.data, w.data, w.nbytes()) != 0, "corrupted chunk does not pass silently");
+    int64_t small = 0;
+    ASSERT(io::compress(w, b, 64, small, shuf).code == StatusCode::OUT_OF_BOUNDS, "small output buffer rejected");
+    Tensor tr = w;
+    std::swap(tr.strides[0], tr.strides[1]);
+    std::swap(tr.shape[0], tr.shape[1]);
+    ASSERT(io::compress(tr, b, cap, small, shuf).code == StatusCode::INVALID_ARGUMENT, "non-contiguous input rejected");
+
+    back.free();
+    std::free(a);
+    std::free(b);
+    e.free();
+    w.free();
+}
+
+static void test_files() {
+    std::printf("\n--- checkpoint files ---\n");
+    char path[128];
+    std::snprintf(path, sizeof(path), "/tmp/zero-codec-%d.ztc", static_cast<int>(getpid()));
+    Tensor w = weights_f32(64, 4097);
+    io::CodecStats st;
+    ASSERT(io::save_compressed(path, w, {}, &st).is_ok(), "save_compressed writes a file");
+    Tensor back;
+    ASSERT(io::load_compressed(path, back).is_ok() && back.ndim == 2 && back.shape[1] == 4097 &&
+           std::memcmp(back.data, w.data, w.nbytes()) == 0, "load_compressed restores the tensor");
+    back.free();
+    std::remove(path);
+    Tensor none;
+    ASSERT(io::load_compressed(path, none).code == StatusCode::INVALID_ARGUMENT, "missing file reported");
+    w.free();
+}
+
+static void test_timing() {
+    std::printf("\n--- throughput (informational) ---\n");
+    Tensor w = weights_f32(4096, 2048);   // 32 MiB
+    exec::ThreadPool pool;
+    (void)pool.start(4);
+    io::CodecOptions opt;
+    opt.pool = &pool;
+    int64_t cap = io::compressed_bound(w, opt);
+    auto* buf = static_cast<uint8_t*>(std::malloc(static_cast<size_t>(cap)));
+    int64_t n = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    (void)io::compress(w, buf, cap, n, opt);
+    double c = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    Tensor back = Tensor::alloc(w.shape.data(), 2, DType::F32);
+    t0 = std::chrono::steady_clock::now();
+    (void)io::decompress(buf, n, back, &pool);
+    double d = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    double mib = static_cast<double>(w.nbytes()) / (1 << 20);
+    std::printf("INFO: 32 MiB of weights -> %.1f%%, compress %.0f MiB/s, decompress %.0f MiB/s (raw bytes)\n",
+                100.0 * static_cast<double>(n) / static_cast<double>(w.nbytes()), mib / c, mib / d);
+    back.free();
+    std::free(buf);
+    w.free();
+}
+
+int main() {
+    std::printf("=== Spec 023 — Compressed Tensor Container ===\n");
+
+    test_lz();
+    test_container();
+    test_files();
+    test_timing();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file test_collectives.cpp
+ * @brief Acceptance tests for spec 019 — shared-memory collectives.
+ *
+ * Tests derived from docs/specs/019-shm-collectives.md §4.
+ *
+ * Each scenario forks one process per rank. Children report failed
+ * checks through their exit status and their results through an
+ * anonymous shared page mapped before the fork.
+ */
+
+#include <zero/zero.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+// Child-side check: print only on failure, count for the exit status.
+#define CHECK(cond, msg)                                                        \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("  rank %d: %s\n", rank, msg);                          \
+            ++bad;                                                              \
+        }                                                                       \
+    } while (0)
+
+// Results the children publish for cross-rank comparison.
+struct Shared {
+    uint64_t ring_hash[ipc::COLL_MAX_RANKS];
+    uint64_t tree_hash[ipc::COLL_MAX_RANKS];
+    double seconds[ipc::COLL_MAX_RANKS][2];
+};
+
+static Shared* shared = nullptr;
+
+static uint64_t hash_bytes(const void* p, size_t n) {
+    const unsigned char* b = static_cast<const unsigned char*>(p);
+    uint64_t h = 1469598103934665603ull;
+    for (size_t i = 0; i < n; ++i) h = (h ^ b[i]) * 1099511628211ull;
+    return h;
+}
+
+static Tensor vec(int64_t n) {
+    int64_t shape[1] = {n};
+    return Tensor::alloc(shape, 1, DType::F32);
+}
+
+// Small integers: every reduction order gives the same exact result.
+static float value(int32_t rank, int64_t i) { return static_cast<float>((i * 7 + rank * 13) % 17 - 8); }
+
+static float reduce_ref(int32_t world, int64_t i, ops::ReduceOp op) {
+    float acc = value(0, i);
+    for (int32_t r = 1; r < world; ++r) {
+        float v = value(r, i);
+        if (op == ops::ReduceOp::MAX) acc = v > acc ? v : acc;
+        else if (op == ops::ReduceOp::MIN) acc = v < acc ? v : acc;
+        else acc += v;
+    }
+    return op == ops::ReduceOp::MEAN ? acc / static_cast<float>(world) : acc;
+}
+
+static int rank_main(const char* name, int32_t rank, int32_t world) {
+    int bad = 0;
+    ipc::CollectiveOptions opt;
+    opt.chunk_bytes = 4096;   // 1024 floats: forces many chunks and uneven segments
+    opt.timeout_ms = 20000;
+    ipc::Communicator comm;
+    Status s = comm.init(name, rank, world, opt);
+    CHECK(s.is_ok(), "init");
+    if (s.is_error()) return 1;
+
+    const int64_t n = 10007;
+    const ops::ReduceOp ops_list[4] = {ops::ReduceOp::SUM, ops::ReduceOp::MAX, ops::ReduceOp::MIN,
+                                       ops::ReduceOp::MEAN};
+    for (int algo = 0; algo < 2; ++algo) {
+        for (ops::ReduceOp op : ops_list) {
+            Tensor x = vec(n);
+            float* p = static_cast<float*>(x.data);
+            for (int64_t i = 0; i < n; ++i) p[i] = value(rank, i);
+            CHECK(comm.all_reduce(x, op, static_cast<ipc::AllReduceAlgo>(algo)).is_ok(), "all_reduce status");
+            bool exact = true;
+            for (int64_t i = 0; i < n; ++i) exact = exact && p[i] == reduce_ref(world, i, op);
+            CHECK(exact, algo == 0 ? "ring all_reduce result" : "tree all_reduce result");
+            x.free();
+        }
+    }
+
+    // Non-integer data: every rank must still get the same bits.
+    Tensor r = vec(n), t = vec(n);
+    for (int64_t i = 0; i < n; ++i) {
+        static_cast<float*>(r.data)[i] = std::sin(static_cast<float>(i + 1) * 0.37f * (rank + 1));
+        static_cast<float*>(t.data)[i] = static_cast<float*>(r.data)[i];
+    }
+    CHECK(comm.all_reduce(r).is_ok() && comm.all_reduce(t, ops::ReduceOp::SUM, ipc::AllReduceAlgo::TREE).is_ok(),
+          "float all_reduce status");
+    shared->ring_hash[rank] = hash_bytes(r.data, r.nbytes());
+    shared->tree_hash[rank] = hash_bytes(t.data, t.nbytes());
+    r.free(); t.free();
+
+    const int64_t m = 3001;
+    Tensor in = vec(m), all = vec(m * world);
+    for (int64_t i = 0; i < m; ++i) static_cast<float*>(in.data)[i] = value(rank, i);
+    CHECK(comm.all_gather(in, all).is_ok(), "all_gather status");
+    bool gathered = true;
+    for (int32_t q = 0; q < world; ++q)
+        for (int64_t i = 0; i < m; ++i) gathered = gathered && static_cast<float*>(all.data)[q * m + i] == value(q, i);
+    CHECK(gathered, "all_gather result");
+
+    Tensor full = vec(m * world), part = vec(m);
+    for (int64_t i = 0; i < m * world; ++i) static_cast<float*>(full.data)[i] = value(rank, i);
+    CHECK(comm.reduce_scatter(full, part).is_ok(), "reduce_scatter status");
+    bool scattered = true;
+    for (int64_t i = 0; i < m; ++i)
+        scattered = scattered && static_cast<float*>(part.data)[i] == reduce_ref(world, rank * m + i, ops::ReduceOp::SUM);
+    CHECK(scattered, "reduce_scatter result");
+    CHECK(comm.all_gather(in, in).code == StatusCode::INVALID_ARGUMENT || world == 1, "all_gather size mismatch rejected");
+    in.free(); all.free(); full.free(); part.free();
+
+    for (int i = 0; i < 20; ++i) CHECK(comm.barrier().is_ok(), "barrier");
+    return bad;
+}
+
+static int bench_main(const char* name, int32_t rank, int32_t world) {
+    ipc::Communicator comm;
+    if (comm.init(name, rank, world).is_error()) return 1;
+    Tensor x = vec(int64_t{1} << 20);
+    std::memset(x.data, 0, x.nbytes());
+    for (int algo = 0; algo < 2; ++algo) {
+        (void)comm.barrier();
+        auto t0 = std::chrono::steady_clock::now();
+        for (int it = 0; it < 5; ++it) (void)comm.all_reduce(x, ops::ReduceOp::SUM, static_cast<ipc::AllReduceAlgo>(algo));
+        shared->seconds[rank][algo] = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() / 5;
+    }
+    x.free();
+    return 0;
+}
+
+// Fork `world` ranks running fn; returns the total of their exit codes.
+static int run_ranks(int32_t world, int (*fn)(const char*, int32_t, int32_t)) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "/zero-coll-test-%d-%d", static_cast<int>(getpid()), world);
+    pid_t pids[ipc::COLL_MAX_RANKS];
+    for (int32_t r = 0; r < world; ++r) {
+        pids[r] = fork();
+        if (pids[r] == 0) {
+            std::fflush(stdout);
+            int code = fn(name, r, world);
+            std::fflush(stdout);
+            _exit(code > 255 ? 255 : code);
+        }
+    }
+    int total = 0;
+    for (int32_t r = 0; r < world; ++r) {
+        int st = 0;
+        waitpid(pids[r], &st, 0);
+        total += WIFEXITED(st) ? WEXITSTATUS(st) : 1;
+    }
+    return total;
+}
+
+static void test_validation() {
+    std::printf("\n--- validation ---\n");
+    ipc::Communicator c;
+    ASSERT(c.init("no-slash", 0, 2).code == StatusCode::INVALID_ARGUMENT, "name without '/' rejected");
+    ASSERT(c.init("/zero-coll-v", 2, 2).code == StatusCode::INVALID_ARGUMENT, "rank >= world rejected");
+    ASSERT(c.init("/zero-coll-v", 0, ipc::COLL_MAX_RANKS + 1).code == StatusCode::INVALID_ARGUMENT, "world too large rejected");
+    Tensor x = vec(4);
+    ASSERT(c.barrier().code == StatusCode::INVALID_STATE, "uninitialized use rejected");
+    ipc::CollectiveOptions opt;
+    opt.timeout_ms = 200;
+    char name[64];
+    std::snprintf(name, sizeof(name), "/zero-coll-test-%d-alone", static_cast<int>(getpid()));
+    ASSERT(c.init(name, 0, 2, opt).code == StatusCode::INVALID_STATE, "missing peer times out");
+    ASSERT(c.init(name, 0, 1).is_ok() && c.all_reduce(x).is_ok() && c.barrier().is_ok(), "world of one is a no-op");
+    int64_t shape[1] = {4};
+    Tensor i32 = Tensor::alloc(shape, 1, DType::I32);
+    ASSERT(c.all_reduce(i32).code == StatusCode::TYPE_MISMATCH, "non-F32 rejected");
+    ASSERT(c.init(name, 0, 1).code == StatusCode::INVALID_STATE, "double init rejected");
+    c.close();
+    x.free(); i32.free();
+}
+
+int main() {
+    std::printf("=== Spec 019 — Shared-Memory Collectives ===\n");
+    std::setvbuf(stdout, nullptr, _IOLBF, 0);
+    void* page = mmap(nullptr, sizeof(Shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (page == MAP_FAILED) return 1;
+    shared = static_cast<Shared*>(page);
+
+    test_validation();
+
+    for (int32_t world = 1; world <= 5; ++world) {
+        std::printf("\n--- %d rank(s) ---\n", world);
+        std::memset(shared, 0, sizeof(Shared));
+        char msg[96];
+        std::snprintf(msg, sizeof(msg), "ring/tree all_reduce, all_gather, reduce_scatter, barrier with %d rank(s)", world);
+        ASSERT(run_ranks(world, rank_main) == 0, msg);
+        bool same = true;
+        for (int32_t r = 1; r < world; ++r)
+            same = same && shared->ring_hash[r] == shared->ring_hash[0] && shared->tree_hash[r] == shared->tree_hash[0];
+        std::snprintf(msg, sizeof(msg), "float results bit-identical across %d rank(s)", world);
+        ASSERT(same, msg);
+    }
+
+    std::printf("\n--- 4-rank all_reduce of 4 MiB (informational) ---\n");
+    std::memset(shared, 0, sizeof(Shared));
+    if (run_ranks(4, bench_main) == 0)
+        std::printf("INFO: ring %.2f ms, tree %.2f ms\n", shared->seconds[0][0] * 1e3, shared->seconds[0][1] * 1e3);
+
+    munmap(page, sizeof(Shared));
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
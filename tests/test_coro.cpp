@@ -0,0 +1,363 @@
+/**
+ * @file test_coro.cpp
+ * @brief Acceptance tests for spec 027 — C++20 coroutine interface.
+ *
+ * Tests derived from docs/specs/027-coroutines.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <unistd.h>
+
+using namespace zero;
+using exec::Task;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+// Wait (bounded) until every spawned task of `ex` has finished
+static bool settle(const exec::Executor& ex) {
+    for (int i = 0; i < 20000 && ex.in_flight() != 0; ++i) std::this_thread::sleep_for(std::chrono::microseconds(500));
+    return ex.in_flight() == 0;
+}
+
+struct FailingAllocator : Allocator {
+    void* alloc(size_t, size_t, Device) noexcept override { return nullptr; }
+    void free(void* ptr, Device device) noexcept override { SystemAllocator::instance()->free(ptr, device); }
+    const char* name() const noexcept override { return "failing"; }
+};
+
+static FailingAllocator g_fail;
+
+// ─── Tasks ───
+
+static Task leaf(int64_t x, int64_t* out) {
+    *out = x * 2;
+    if (x < 0) co_return status::invalid_argument("negative");
+    co_return status::OK;
+}
+
+static Task chain(int64_t x, int64_t* out, bool* on_worker) {
+    int64_t a = 0, b = 0;
+    Status s = co_await leaf(x, &a);
+    if (s.is_error()) co_return s;
+    Task next = leaf(a, &b);
+    s = co_await next;
+    *out = b;
+    *on_worker = exec::Executor::current() != nullptr;
+    co_return s;
+}
+
+static void test_tasks() {
+    exec::Executor ex;
+    exec::Completion done;
+    int64_t out = 0;
+    bool on_worker = false;
+    ASSERT(ex.spawn(chain(3, &out, &on_worker), &done).code == StatusCode::INVALID_STATE,
+           "spawn before start is rejected");
+
+    exec::ExecutorOptions bad;
+    bad.threads = 0;
+    ASSERT(ex.start(bad).code == StatusCode::INVALID_ARGUMENT, "zero workers rejected");
+    ASSERT(ex.start().is_ok() && ex.start().code == StatusCode::INVALID_STATE, "start once");
+
+    done.reset();
+    ASSERT(ex.spawn(chain(3, &out, &on_worker), &done).is_ok() && done.wait().is_ok() && out == 12 && on_worker,
+           "nested tasks run on a worker and return their Status");
+    done.reset();
+    ASSERT(ex.spawn(chain(-1, &out, &on_worker), &done).is_ok() && done.wait().code == StatusCode::INVALID_ARGUMENT,
+           "an error propagates through co_await");
+    ASSERT(settle(ex), "spawned frames are released");
+
+    {
+        int64_t unused = 0;
+        Task never = leaf(1, &unused);
+        ASSERT(never.valid() && unused == 0, "tasks start lazily");
+    }
+
+    set_allocator(&g_fail);
+    Task t = leaf(1, &out);
+    set_allocator(SystemAllocator::instance());
+    ASSERT(!t.valid() && ex.spawn(std::move(t)).code == StatusCode::ALLOCATION_FAILED,
+           "frame allocation failure is a Status");
+}
+
+// ─── Event ───
+
+static Task wait_event(exec::Event& ev, std::atomic<int32_t>& resumed, std::atomic<int32_t>& off_worker) {
+    co_await ev;
+    if (exec::Executor::current() == nullptr) off_worker.fetch_add(1);
+    resumed.fetch_add(1);
+    co_return status::OK;
+}
+
+static void test_event() {
+    exec::Executor ex;
+    (void)ex.start();
+    exec::Event ev;
+    std::atomic<int32_t> resumed{0}, off_worker{0};
+    bool spawned = true;
+    for (int i = 0; i < 1000; ++i) spawned = spawned && ex.spawn(wait_event(ev, resumed, off_worker)).is_ok();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT(spawned && resumed == 0 && ex.in_flight() == 1000, "1000 waiters suspend without holding threads");
+    ev.set();  // from a non-executor thread
+    ASSERT(settle(ex) && resumed == 1000 && off_worker == 0, "set() resumes every waiter on a worker");
+
+    exec::Completion done;
+    ASSERT(ex.spawn(wait_event(ev, resumed, off_worker), &done).is_ok() && done.wait().is_ok() && resumed == 1001,
+           "awaiting a set event does not suspend");
+    ev.reset();
+    ASSERT(!ev.is_set(), "reset clears the event");
+}
+
+// ─── CoStream ───
+
+struct StreamLog {
+    std::atomic<int32_t> busy{0};
+    std::atomic<int32_t> overlaps{0};
+    int32_t order[4][100];
+    std::atomic<int32_t> counter{0};
+};
+
+static Task submit_ops(exec::CoStream& s, StreamLog& log, int32_t who, bool* ordered) {
+    int32_t last = -1;
+    bool ok = true;
+    for (int32_t k = 0; k < 100; ++k) {
+        Status st = co_await s.enqueue([&log, who, k]() noexcept {
+            if (log.busy.fetch_add(1) != 0) log.overlaps.fetch_add(1);
+            log.order[who][k] = log.counter.fetch_add(1);
+            log.busy.fetch_sub(1);
+            return k == 99 && who == 0 ? status::out_of_bounds("last op of task 0") : status::OK;
+        });
+        ok = ok && log.order[who][k] > last;
+        last = log.order[who][k];
+        if (k == 99 && who == 0) ok = ok && st.code == StatusCode::OUT_OF_BOUNDS;
+        else ok = ok && st.is_ok();
+    }
+    *ordered = ok;
+    co_return status::OK;
+}
+
+static Task slow_op(exec::CoStream& s, exec::Event& started, std::atomic<int32_t>& slow_done) {
+    co_return co_await s.enqueue([&started, &slow_done]() noexcept {
+        started.set();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        slow_done.store(1);
+        return status::OK;
+    });
+}
+
+static Task sync_after(exec::CoStream& s, exec::Event& started, std::atomic<int32_t>& slow_done, bool* saw) {
+    co_await started;
+    Status st = co_await s.sync();
+    *saw = st.is_ok() && slow_done.load() == 1;
+    co_return status::OK;
+}
+
+static void test_stream() {
+    exec::Executor ex;
+    exec::ExecutorOptions opt;
+    opt.threads = 4;
+    (void)ex.start(opt);
+    exec::CoStream s(ex, Stream::create(Device::CPU));
+    StreamLog log;
+    bool ordered[4] = {false, false, false, false};
+    for (int32_t w = 0; w < 4; ++w) (void)ex.spawn(submit_ops(s, log, w, &ordered[w]));
+    ASSERT(settle(ex) && s.completed() == 400 && log.counter == 400, "400 ops from 4 tasks all run");
+    ASSERT(log.overlaps == 0, "stream ops never overlap");
+    ASSERT(ordered[0] && ordered[1] && ordered[2] && ordered[3], "each task's ops run in order and return their Status");
+
+    std::atomic<int32_t> slow{0};
+    exec::Event started;
+    bool saw = false;
+    (void)ex.spawn(sync_after(s, started, slow, &saw));
+    (void)ex.spawn(slow_op(s, started, slow));
+    ASSERT(settle(ex) && saw, "sync() resumes after earlier ops");
+}
+
+// ─── Blocking lane ───
+
+static Task read_file(io::AsyncReader& r, const io::ReadRequest* req, int32_t n, Status* out) {
+    *out = co_await exec::read_async(r, req, n);
+    co_return *out;
+}
+
+static Task spin_until(std::atomic<int32_t>& flag) {
+    co_return co_await exec::offload([&flag]() noexcept {
+        for (int i = 0; i < 20000 && flag.load() == 0; ++i) std::this_thread::sleep_for(std::chrono::microseconds(100));
+        return flag.load() == 1 ? status::OK : status::invalid_state("flag never set");
+    });
+}
+
+static Task set_flag(std::atomic<int32_t>& flag) {
+    co_await exec::yield();
+    flag.store(1);
+    co_return status::OK;
+}
+
+static Task await_completion(const exec::Completion& c) {
+    co_return co_await exec::wait_async(c);
+}
+
+static Task read_then_complete(io::AsyncReader& r, const io::ReadRequest* req, exec::Completion& c) {
+    Status st = co_await exec::read_async(r, req, 1);
+    c.complete(st);
+    co_return st;
+}
+
+static Task read_slice(io::AsyncReader& r, const io::ReadRequest* req, io::ReadStats* stats) {
+    co_return co_await exec::read_async(r, req, 1, stats);
+}
+
+// Bounded wait: a deadlocked await must fail the test, not hang it
+static bool finishes(const exec::Completion& c) {
+    for (int i = 0; i < 20000 && !c.ready(); ++i) std::this_thread::sleep_for(std::chrono::microseconds(500));
+    return c.ready();
+}
+
+static void test_blocking() {
+    char path[128];
+    std::snprintf(path, sizeof(path), "/tmp/zero-coro-%d.bin", static_cast<int>(getpid()));
+    const int64_t n = 1 << 20;
+    auto* src = static_cast<uint8_t*>(mem_alloc(n, 64, Device::CPU));
+    auto* dst = static_cast<uint8_t*>(mem_alloc(n, 64, Device::CPU));
+    for (int64_t i = 0; i < n; ++i) src[i] = static_cast<uint8_t>(i * 31 + 7);
+    std::FILE* f = std::fopen(path, "wb");
+    bool wrote = f != nullptr && std::fwrite(src, 1, n, f) == static_cast<size_t>(n);
+    if (f != nullptr) std::fclose(f);
+
+    exec::Executor ex;
+    exec::ExecutorOptions opt;
+    opt.threads = 1;
+    (void)ex.start(opt);
+    io::AsyncReader reader;
+    int fd = -1;
+    bool opened = wrote && reader.init().is_ok() && io::open_read(path, false, fd).is_ok();
+    std::memset(dst, 0, n);
+    io::ReadRequest req{fd, 0, dst, n};
+    Status got = status::invalid_state("not run");
+    exec::Completion done;
+    (void)ex.spawn(read_file(reader, &req, 1, &got), &done);
+    ASSERT(opened && done.wait().is_ok() && got.is_ok() && std::memcmp(src, dst, n) == 0,
+           "co_await read_async lands the file");
+    io::ReadRequest past{fd, n - 16, dst, 64};
+    done.reset();
+    (void)ex.spawn(read_file(reader, &past, 1, &got), &done);
+    ASSERT(done.wait().code == StatusCode::OUT_OF_BOUNDS, "a failed read resumes with its Status");
+
+    // One worker: the blocking op waits for a task that needs that worker
+    std::atomic<int32_t> flag{0};
+    exec::Completion spun;
+    (void)ex.spawn(spin_until(flag), &spun);
+    (void)ex.spawn(set_flag(flag));
+    ASSERT(spun.wait().is_ok(), "blocking work does not stall the workers");
+
+    exec::Completion producer, awaited;
+    (void)ex.spawn(await_completion(producer), &awaited);
+    std::thread t([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        producer.complete(status::type_mismatch("from producer"));
+    });
+    ASSERT(awaited.wait().code == StatusCode::TYPE_MISMATCH, "wait_async resumes with the Completion's Status");
+    t.join();
+
+    // Park the only blocking-lane thread; reads and Completion awaits
+    // resume from their completions, so they must not queue behind it.
+    std::atomic<int32_t> lane{0};
+    exec::Completion parked;
+    (void)ex.spawn(spin_until(lane), &parked);
+    exec::Completion gates[8], waiters[8];
+    for (int i = 0; i < 8; ++i) (void)ex.spawn(await_completion(gates[i]), &waiters[i]);
+    gates[7].complete(status::OK);
+    ASSERT(finishes(waiters[7]) && !waiters[0].ready(), "wait_async awaits resume independently");
+
+    std::memset(dst, 0, n);
+    exec::Completion gate, gated, fed;
+    (void)ex.spawn(await_completion(gate), &gated);
+    (void)ex.spawn(read_then_complete(reader, &req, gate), &fed);
+    ASSERT(finishes(gated) && finishes(fed) && gated.result.is_ok() && std::memcmp(src, dst, n) == 0,
+           "a Completion fed by a read queued after its waiter does not deadlock");
+
+    std::memset(dst, 0, n);
+    io::ReadRequest slices[8];
+    io::ReadStats stats[8];
+    exec::Completion sliced[8];
+    for (int i = 0; i < 8; ++i) {
+        slices[i] = io::ReadRequest{fd, i * (n / 8), dst + i * (n / 8), n / 8};
+        (void)ex.spawn(read_slice(reader, &slices[i], &stats[i]), &sliced[i]);
+    }
+    bool all = true;
+    for (int i = 0; i < 8; ++i)
+        all = all && finishes(sliced[i]) && sliced[i].result.is_ok() && stats[i].bytes == n / 8;
+    ASSERT(all && std::memcmp(src, dst, n) == 0, "concurrent read_async batches land with their own stats");
+
+    for (int i = 0; i < 7; ++i) gates[i].complete(status::OK);
+    lane.store(1);
+    all = parked.wait().is_ok();
+    for (int i = 0; i < 8; ++i) all = all && waiters[i].wait().is_ok();
+    ASSERT(all, "the parked lane and remaining awaits finish");
+    ASSERT(settle(ex), "no task is left behind");
+
+    if (fd >= 0) ::close(fd);
+    reader.close();
+    ::unlink(path);
+    mem_free(src, Device::CPU);
+    mem_free(dst, Device::CPU);
+}
+
+// ─── Multiplexing ───
+
+static Task handler(exec::Event& gate, exec::CoStream& s, std::atomic<int64_t>& sum, int64_t id) {
+    co_await gate;
+    int64_t v = 0;
+    Status st = co_await s.enqueue([&v, id]() noexcept {
+        v = id;
+        return status::OK;
+    });
+    sum.fetch_add(v);
+    co_return st;
+}
+
+static void test_many() {
+    exec::Executor ex;
+    (void)ex.start();
+    exec::CoStream s(ex);
+    exec::Event gate;
+    std::atomic<int64_t> sum{0};
+    const int64_t n = 5000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < n; ++i) (void)ex.spawn(handler(gate, s, sum, i));
+    int64_t parked = ex.in_flight();
+    gate.set();
+    bool ok = settle(ex);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    ASSERT(parked == n && ok && sum == n * (n - 1) / 2, "5000 in-flight handlers multiplex over 2 workers");
+    std::printf("INFO: %lld handlers in %.1f ms (%.2f us each)\n", static_cast<long long>(n), ms, 1000.0 * ms / n);
+}
+
+int main() {
+    std::printf("=== Spec 027 — Coroutine Interface ===\n");
+
+    test_tasks();
+    test_event();
+    test_stream();
+    test_blocking();
+    test_many();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
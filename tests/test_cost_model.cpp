@@ -0,0 +1,249 @@
+/**
+ * @file test_cost_model.cpp
+ * @brief Acceptance tests for spec 026 — adaptive parallelism cost model.
+ *
+ * Tests derived from docs/specs/026-cost-model.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static bool near(double a, double b, double rel) {
+    return std::fabs(a - b) <= rel * std::fabs(b);
+}
+
+static Tensor filled(const int64_t* shape, int8_t ndim, float base) {
+    Tensor t = Tensor::alloc(shape, ndim, DType::F32);
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) p[i] = base + 0.001f * static_cast<float>(i % 997);
+    return t;
+}
+
+static void test_estimates() {
+    int64_t big[2] = {8192, 8192};
+    exec::OpCost add = exec::estimate_cost(ir::OpKind::ADD, big, 2, DType::F32);
+    double n = 8192.0 * 8192.0;
+    ASSERT(add.flops == n && add.bytes == 12.0 * n && add.items == 8192 * 8192 && add.granule == 16,
+           "binary op: one flop and three F32 streams per element");
+    exec::OpCost e = exec::estimate_cost(ir::OpKind::EXP, big, 2, DType::F32);
+    ASSERT(e.flops == 20.0 * n && e.bytes == 8.0 * n, "transcendental unary op costs more flops");
+    exec::OpCost r = exec::estimate_cost(ir::OpKind::SUM, big, 2, DType::F32);
+    ASSERT(r.items == 8192 && r.bytes == 4.0 * (n + 8192.0), "reductions split by rows");
+    exec::OpCost g = exec::estimate_gemm(64, 32, 16, DType::F32);
+    int64_t mnk[3] = {64, 32, 16};
+    exec::OpCost g2 = exec::estimate_cost(ir::OpKind::MATMUL, mnk, 3, DType::F32);
+    ASSERT(g.flops == 2.0 * 64 * 32 * 16 && g.items == 64 && g2.bytes == g.bytes, "gemm is 2MNK flops over M rows");
+}
+
+static void test_plans() {
+    exec::CostModel model;
+    int32_t prev = 1;
+    bool monotone = true, covered = true;
+    int64_t sizes[6][2] = {{1, 8}, {1, 4096}, {64, 1024}, {512, 1024}, {2048, 2048}, {8192, 8192}};
+    int32_t chosen[6];
+    for (int i = 0; i < 6; ++i) {
+        exec::OpCost c = exec::estimate_cost(ir::OpKind::ADD, sizes[i], 2, DType::F32);
+        exec::ParallelPlan p = model.plan(ir::OpKind::ADD, c, 16);
+        chosen[i] = p.threads;
+        monotone = monotone && p.threads >= prev;
+        prev = p.threads;
+        covered = covered && p.grain % c.granule == 0 && p.tasks * p.grain >= c.items &&
+                  (p.tasks - 1) * p.grain < c.items && p.tasks >= p.threads;
+    }
+    ASSERT(chosen[0] == 1 && chosen[1] == 1, "tiny ops run on one thread");
+    ASSERT(chosen[5] > 1 && chosen[5] <= 8, "large streaming op uses threads up to the bandwidth limit");
+    ASSERT(monotone, "thread count grows with op size");
+    ASSERT(covered, "tasks cover the items in cache-line multiples");
+
+    int64_t big[2] = {8192, 8192};
+    exec::OpCost ex = exec::estimate_cost(ir::OpKind::EXP, big, 2, DType::F32);
+    ASSERT(model.plan(ir::OpKind::EXP, ex, 16).threads == 16, "compute-bound op uses the whole pool");
+
+    exec::CostModelOptions o;
+    o.min_task_ns = 1e9;
+    exec::CostModel coarse(o);
+    exec::ParallelPlan cp = coarse.plan(ir::OpKind::EXP, ex, 16);
+    ASSERT(cp.tasks == cp.threads, "min_task_ns limits over-decomposition");
+}
+
+static void test_learning() {
+    exec::CostModel model;
+    // Synthetic machine: 0.5 ns/byte for ADD, 40 us per extra participant
+    auto truth = [](const exec::OpCost& c, int32_t t, int32_t pool) {
+        int32_t bw = pool / 2;
+        double mem = c.bytes * 0.5 / (t < bw ? t : bw);
+        double cpu = c.flops * 0.1 / t;
+        return (mem > cpu ? mem : cpu) + (t > 1 ? 40000.0 * (t - 1) : 0.0);
+    };
+    int64_t shapes[3][2] = {{1, 4096}, {256, 1024}, {4096, 4096}};
+    for (int round = 0; round < 200; ++round) {
+        for (auto& s : shapes) {
+            exec::OpCost c = exec::estimate_cost(ir::OpKind::ADD, s, 2, DType::F32);
+            for (int32_t t : {1, 4}) model.record(ir::OpKind::ADD, c, t, truth(c, t, 8), 8);
+        }
+    }
+    exec::KindCoefficients k = model.coefficients(ir::OpKind::ADD);
+    ASSERT(near(k.ns_per_byte, 0.5, 0.1) && k.samples == 1200, "per-byte coefficient converges");
+    ASSERT(near(model.sync_ns(), 40000.0, 0.15), "fork-join overhead converges");
+    ASSERT(model.coefficients(ir::OpKind::MUL).samples == 0, "other kinds are untouched");
+
+    int64_t mid[2] = {256, 1024};
+    exec::OpCost c = exec::estimate_cost(ir::OpKind::ADD, mid, 2, DType::F32);
+    int32_t best = 1;
+    double best_ns = truth(c, 1, 8);
+    for (int32_t t = 2; t <= 8; ++t) {
+        if (truth(c, t, 8) < best_ns) {
+            best_ns = truth(c, t, 8);
+            best = t;
+        }
+    }
+    ASSERT(model.plan(ir::OpKind::ADD, c, 8).threads == best, "learned plan matches the synthetic optimum");
+
+    model.record(ir::OpKind::ADD, c, 1, -1.0);
+    model.record(ir::OpKind::ADD, c, 0, 100.0);
+    ASSERT(model.coefficients(ir::OpKind::ADD).samples == 1200, "invalid measurements are ignored");
+}
+
+static void test_ops() {
+    exec::ThreadPool pool;
+    (void)pool.start(4);
+    exec::CostModel model;
+    exec::ParallelContext par;
+    par.pool = &pool;
+    par.model = &model;
+
+    bool same = true;
+    int64_t shapes[3][2] = {{1, 8}, {3, 1000}, {1024, 1024}};
+    for (auto& s : shapes) {
+        Tensor a = filled(s, 2, 1.0f), b = filled(s, 2, 2.0f);
+        Tensor o1 = Tensor::alloc(s, 2, DType::F32), o2 = Tensor::alloc(s, 2, DType::F32);
+        size_t bytes = o1.nbytes();
+        for (auto op : {ops::ElementwiseOp::ADD, ops::ElementwiseOp::DIV}) {
+            (void)ops::binary_op(a, b, o1, op);
+            same = same && ops::binary_op(a, b, o2, op, par).is_ok() && std::memcmp(o1.data, o2.data, bytes) == 0;
+        }
+        for (auto op : {ops::ElementwiseOp::EXP, ops::ElementwiseOp::SIGMOID}) {
+            (void)ops::unary_op(a, o1, op);
+            same = same && ops::unary_op(a, o2, op, par).is_ok() && std::memcmp(o1.data, o2.data, bytes) == 0;
+        }
+        (void)ops::scalar_op(a, Scalar(3.0f), o1, ops::ElementwiseOp::MUL);
+        same = same && ops::scalar_op(a, Scalar(3.0f), o2, ops::ElementwiseOp::MUL, par).is_ok() &&
+               std::memcmp(o1.data, o2.data, bytes) == 0;
+        int64_t one = 1;
+        Tensor sc = Tensor::alloc(&one, 1, DType::F32);
+        *static_cast<float*>(sc.data) = 0.5f;
+        (void)ops::binary_op(a, sc, o1, ops::ElementwiseOp::SUB);
+        same = same && ops::binary_op(a, sc, o2, ops::ElementwiseOp::SUB, par).is_ok() &&
+               std::memcmp(o1.data, o2.data, bytes) == 0;
+
+        Tensor r1 = Tensor::alloc(s, 1, DType::F32), r2 = Tensor::alloc(s, 1, DType::F32);
+        for (auto op : {ops::ReduceOp::SUM, ops::ReduceOp::MAX, ops::ReduceOp::MEAN}) {
+            (void)ops::reduce_last_axis(a, r1, op);
+            same = same && ops::reduce_last_axis(a, r2, op, par).is_ok() &&
+                   std::memcmp(r1.data, r2.data, r1.nbytes()) == 0;
+        }
+        for (Tensor* t : {&a, &b, &o1, &o2, &sc, &r1, &r2}) t->free();
+    }
+    ASSERT(same, "parallel entry points are bit-identical to serial ones");
+    ASSERT(model.coefficients(ir::OpKind::ADD).samples == 3 && model.coefficients(ir::OpKind::SUM).samples == 3,
+           "each call feeds the model once");
+
+    int64_t s[1] = {100};
+    Tensor a = filled(s, 1, 1.0f), o = Tensor::alloc(s, 1, DType::F32);
+    std::memset(o.data, 0, o.nbytes());
+    ASSERT(ops::unary_op(a, o, ops::ElementwiseOp::ADD, par).code == StatusCode::INVALID_ARGUMENT &&
+           static_cast<float*>(o.data)[0] == 0.0f, "unsupported op is rejected before any write");
+    int64_t s2[1] = {50};
+    Tensor bad = Tensor::alloc(s2, 1, DType::F32);
+    ASSERT(ops::binary_op(a, bad, o, ops::ElementwiseOp::ADD, par).is_error(), "validation still applies");
+
+    exec::ParallelContext none;
+    ASSERT(ops::unary_op(a, o, ops::ElementwiseOp::NEG, none).is_ok() &&
+           static_cast<float*>(o.data)[1] == -static_cast<float*>(a.data)[1], "no pool runs inline");
+    exec::ParallelContext no_model;
+    no_model.pool = &pool;
+    ASSERT(ops::unary_op(a, o, ops::ElementwiseOp::RELU, no_model).is_ok() &&
+           static_cast<float*>(o.data)[7] == static_cast<float*>(a.data)[7], "no model splits over the pool");
+    a.free();
+    o.free();
+    bad.free();
+}
+
+static void test_capped_pool() {
+    exec::ThreadPool pool;
+    (void)pool.start(4);
+    std::atomic<int32_t> seen_mask{0};
+    std::atomic<int32_t> count{0};
+    (void)pool.parallel_for(4000, [&](int64_t) {
+        seen_mask.fetch_or(1 << exec::ThreadPool::participant());
+        count.fetch_add(1);
+    }, -1, 2);
+    ASSERT(count == 4000 && (seen_mask & ~3) == 0, "a capped job runs on the caller and one worker");
+    std::atomic<int32_t> elsewhere{0};
+    std::thread::id caller = std::this_thread::get_id();
+    (void)pool.parallel_for(100, [&](int64_t) {
+        if (std::this_thread::get_id() != caller) elsewhere.fetch_add(1);
+    }, -1, 1);
+    ASSERT(elsewhere == 0, "a cap of one runs on the caller");
+}
+
+static void test_timing() {
+    exec::ThreadPool pool;
+    (void)pool.start(4);
+    exec::CostModel model;
+    exec::ParallelContext par;
+    par.pool = &pool;
+    par.model = &model;
+    int64_t sizes[4][2] = {{1, 8}, {64, 1024}, {1024, 1024}, {4096, 4096}};
+    for (auto& s : sizes) {
+        Tensor a = filled(s, 2, 1.0f), b = filled(s, 2, 2.0f), o = Tensor::alloc(s, 2, DType::F32);
+        for (int i = 0; i < 3; ++i) (void)ops::binary_op(a, b, o, ops::ElementwiseOp::ADD, par);
+        auto t0 = std::chrono::steady_clock::now();
+        (void)ops::binary_op(a, b, o, ops::ElementwiseOp::ADD, par);
+        double pt = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+        t0 = std::chrono::steady_clock::now();
+        (void)ops::binary_op(a, b, o, ops::ElementwiseOp::ADD);
+        double st = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+        exec::OpCost c = exec::estimate_cost(ir::OpKind::ADD, s, 2, DType::F32);
+        std::printf("INFO: add [%lld, %lld]: %d thread(s), %.1f us (serial %.1f us)\n",
+                    static_cast<long long>(s[0]), static_cast<long long>(s[1]),
+                    model.plan(ir::OpKind::ADD, c, pool.size()).threads, pt, st);
+        a.free();
+        b.free();
+        o.free();
+    }
+}
+
+int main() {
+    std::printf("=== Spec 026 — Adaptive Parallelism Cost Model ===\n");
+
+    test_estimates();
+    test_plans();
+    test_learning();
+    test_ops();
+    test_capped_pool();
+    test_timing();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,314 @@
+/**
+ * @file test_decode_scheduler.cpp
+ * @brief Acceptance tests for spec 007 — continuous decode batching.
+ *
+ * Tests derived from docs/specs/007-continuous-decode-batching.md §4.
+ *
+ * The toy model writes each fed token into its KV slot at its position and
+ * samples next = (sum of the slot's KV history * 31 + position) % 97, so any
+ * cross-sequence KV leakage or position slip changes the output.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace zero;
+using namespace zero::exec;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+struct ToyModel {
+    int64_t max_seen_rows = 0;
+};
+
+static int64_t sample(float history_sum, int64_t pos) noexcept {
+    return (static_cast<int64_t>(history_sum) * 31 + pos) % 97;
+}
+
+static Status toy_step(const DecodeBatch& b, void* user) noexcept {
+    ToyModel* m = static_cast<ToyModel*>(user);
+    if (b.size > m->max_seen_rows) m->max_seen_rows = b.size;
+    const int64_t* tok = static_cast<const int64_t*>(b.tokens.data);
+    const int64_t* pos = static_cast<const int64_t*>(b.positions.data);
+    const int64_t* slot = static_cast<const int64_t*>(b.slots.data);
+    int64_t* next = static_cast<int64_t*>(b.next_tokens.data);
+    for (int64_t r = 0; r < b.size; ++r) {
+        Tensor kv = b.kv.slice(0, slot[r], slot[r] + 1);
+        float* hist = static_cast<float*>(kv.data);   // [1, max_seq_len, 1]
+        hist[pos[r]] = static_cast<float>(tok[r]);
+        float sum = 0.0f;
+        for (int64_t p = 0; p <= pos[r]; ++p) sum += hist[p];
+        next[r] = sample(sum, pos[r]);
+    }
+    return status::OK;
+}
+
+static Status failing_step(const DecodeBatch&, void*) noexcept {
+    return status::invalid_state("decode failed");
+}
+
+// Unbatched reference for one sequence.
+static int64_t reference(const int64_t* prompt, int64_t prompt_len, int64_t max_new,
+                         int64_t eos, int64_t max_seq_len, int64_t* out) {
+    std::vector<float> hist(static_cast<size_t>(max_seq_len), 0.0f);
+    int64_t token = prompt[0];
+    int64_t n = 0;
+    for (int64_t pos = 0;; ++pos) {
+        hist[static_cast<size_t>(pos)] = static_cast<float>(token);
+        float sum = 0.0f;
+        for (int64_t p = 0; p <= pos; ++p) sum += hist[static_cast<size_t>(p)];
+        int64_t next = sample(sum, pos);
+        if (pos + 1 < prompt_len) { token = prompt[pos + 1]; continue; }
+        out[n++] = next;
+        if (next == eos || n >= max_new || pos + 1 >= max_seq_len) return n;
+        token = next;
+    }
+}
+
+struct Seq {
+    std::vector<int64_t> prompt;
+    std::vector<int64_t> out;
+    DecodeSequence s;
+
+    void setup(int64_t prompt_len, int64_t seed, int64_t max_new, int64_t eos = -1) {
+        prompt.resize(static_cast<size_t>(prompt_len));
+        for (int64_t i = 0; i < prompt_len; ++i) prompt[static_cast<size_t>(i)] = (seed * 7 + i * 3) % 50;
+        out.assign(static_cast<size_t>(max_new), -1);
+        s.prompt = prompt.data();
+        s.prompt_len = prompt_len;
+        s.output = out.data();
+        s.max_new_tokens = max_new;
+        s.eos_token = eos;
+    }
+
+    bool matches(int64_t max_seq_len) const {
+        std::vector<int64_t> ref(static_cast<size_t>(s.max_new_tokens), -1);
+        int64_t n = reference(prompt.data(), s.prompt_len, s.max_new_tokens, s.eos_token,
+                              max_seq_len, ref.data());
+        return n == s.generated && std::memcmp(ref.data(), out.data(), static_cast<size_t>(n) * 8) == 0;
+    }
+};
+
+static DecodeConfig config(int64_t max_active, int64_t max_seq_len) {
+    DecodeConfig c;
+    c.max_active = max_active;
+    c.max_seq_len = max_seq_len;
+    c.kv_dim = 1;
+    return c;
+}
+
+static void test_validation() {
+    std::printf("\n--- init / submit validation ---\n");
+    ToyModel m;
+    DecodeScheduler d;
+    ASSERT(d.init(config(0, 16), toy_step, &m).code == StatusCode::INVALID_ARGUMENT,
+           "init rejects max_active == 0");
+    ASSERT(d.init(config(2, 16), nullptr, &m).code == StatusCode::INVALID_ARGUMENT,
+           "init rejects null step");
+
+    Seq s;
+    s.setup(4, 1, 4);
+    ASSERT(d.submit(&s.s).code == StatusCode::INVALID_STATE, "submit before init fails");
+    ASSERT(d.init(config(2, 16), toy_step, &m).is_ok(), "init ok");
+
+    Seq long_prompt;
+    long_prompt.setup(17, 1, 4);
+    ASSERT(d.submit(&long_prompt.s).code == StatusCode::INVALID_ARGUMENT,
+           "submit rejects prompt longer than max_seq_len");
+    Seq no_budget;
+    no_budget.setup(3, 1, 1);
+    no_budget.s.max_new_tokens = 0;
+    ASSERT(d.submit(&no_budget.s).code == StatusCode::INVALID_ARGUMENT,
+           "submit rejects max_new_tokens == 0");
+    d.destroy();
+}
+
+static void test_iteration_level_admission() {
+    std::printf("\n--- short sequences leave, queued ones join mid-flight ---\n");
+    ToyModel m;
+    DecodeScheduler d;
+    ASSERT(d.init(config(2, 64), toy_step, &m).is_ok(), "init ok");
+
+    Seq s[3];
+    s[0].setup(2, 1, 3);    // Short: done after 4 steps
+    s[1].setup(5, 2, 20);   // Long: 24 steps
+    s[2].setup(3, 3, 5);    // Queued behind the first two
+    for (auto& q : s) ASSERT(d.submit(&q.s).is_ok(), "submit ok");
+
+    ASSERT(d.step() == 2 && d.active() == 2, "first step runs 2 rows; third waits");
+    for (int i = 0; i < 3; ++i) d.step();
+    ASSERT(s[0].s.done.ready() && !s[2].s.done.ready(), "short sequence finished after 4 steps");
+    ASSERT(d.active() == 1, "short sequence evicted");
+    ASSERT(d.step() == 2, "queued sequence admitted on the very next step");
+
+    while (d.step() > 0) {}
+    bool ok = true;
+    for (auto& q : s) ok = ok && q.s.done.wait().is_ok() && q.matches(64);
+    ASSERT(ok, "all outputs equal the unbatched reference");
+    ASSERT(d.steps_run() == 24, "total steps == longest sequence (no static-batch stall)");
+    ASSERT(d.tokens_generated() == 28, "tokens_generated counts only decode tokens");
+    ASSERT(m.max_seen_rows == 2, "batch never exceeds max_active");
+    d.destroy();
+}
+
+static void test_stop_conditions() {
+    std::printf("\n--- eos and max_seq_len stop a sequence ---\n");
+    ToyModel m;
+    DecodeScheduler d;
+    ASSERT(d.init(config(4, 8), toy_step, &m).is_ok(), "init ok");
+
+    // Find the reference's 3rd token and use it as eos.
+    Seq probe;
+    probe.setup(2, 5, 10);
+    std::vector<int64_t> ref(10);
+    reference(probe.prompt.data(), 2, 10, -1, 8, ref.data());
+
+    Seq eos;
+    eos.setup(2, 5, 10, ref[2]);
+    Seq capped;
+    capped.setup(6, 9, 10);  // Only 8 - 6 + 1 = 3 tokens fit
+    ASSERT(d.submit(&eos.s).is_ok() && d.submit(&capped.s).is_ok(), "submits ok");
+    while (d.step() > 0) {}
+
+    ASSERT(eos.s.generated == 3 && eos.out[2] == ref[2], "eos stops generation (eos kept)");
+    ASSERT(capped.s.generated == 3, "max_seq_len caps prompt + generated");
+    ASSERT(eos.matches(8) && capped.matches(8), "outputs equal the reference");
+    d.destroy();
+}
+
+static void test_step_error() {
+    std::printf("\n--- step error completes every active sequence ---\n");
+    DecodeScheduler d;
+    ASSERT(d.init(config(2, 8), failing_step, nullptr).is_ok(), "init ok");
+    Seq a, b;
+    a.setup(2, 1, 2);
+    b.setup(2, 2, 2);
+    ASSERT(d.submit(&a.s).is_ok() && d.submit(&b.s).is_ok(), "submits ok");
+    ASSERT(d.step() == 2, "step ran 2 rows");
+    ASSERT(a.s.done.wait().code == StatusCode::INVALID_STATE &&
+           b.s.done.wait().code == StatusCode::INVALID_STATE, "both see the step error");
+    ASSERT(d.active() == 0, "failed sequences evicted; slots reusable");
+    d.destroy();
+}
+
+static void test_worker_concurrent_producers() {
+    std::printf("\n--- worker thread + 4 producer threads ---\n");
+    ToyModel m;
+    DecodeScheduler d;
+    constexpr int64_t kMaxSeq = 48;
+    ASSERT(d.init(config(6, kMaxSeq), toy_step, &m).is_ok(), "init ok");
+    ASSERT(d.start().is_ok(), "start ok");
+
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 16;
+    std::vector<Seq> seqs(kThreads * kPerThread);
+    for (size_t i = 0; i < seqs.size(); ++i) {
+        int64_t k = static_cast<int64_t>(i);
+        seqs[i].setup(1 + k % 7, k, 1 + (k * 5) % 23);
+    }
+
+    std::atomic<int> submit_errors{0};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t) {
+        producers.emplace_back([&, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                Seq& q = seqs[static_cast<size_t>(t * kPerThread + i)];
+                if (d.submit(&q.s).is_error()) submit_errors++;
+                if (i % 4 == 3) q.s.done.wait();
+            }
+        });
+    }
+    for (auto& th : producers) th.join();
+
+    bool ok = true;
+    for (auto& q : seqs) ok = ok && q.s.done.wait().is_ok() && q.matches(kMaxSeq);
+    d.stop();
+
+    ASSERT(submit_errors.load() == 0, "no submit errors");
+    ASSERT(ok, "all 64 outputs equal the unbatched reference");
+    ASSERT(m.max_seen_rows <= 6, "batch never exceeds max_active");
+    std::printf("INFO: %llu steps, %llu tokens\n",
+                static_cast<unsigned long long>(d.steps_run()),
+                static_cast<unsigned long long>(d.tokens_generated()));
+    d.destroy();
+}
+
+static void test_submit_racing_stop() {
+    std::printf("\n--- submit() racing stop() ---\n");
+    constexpr int64_t kMaxSeq = 32;
+    constexpr int kRounds = 20;
+    constexpr int kThreads = 3;
+    constexpr int kPerThread = 16;
+    std::vector<Seq> seqs(kThreads * kPerThread);
+    for (size_t i = 0; i < seqs.size(); ++i) {
+        int64_t k = static_cast<int64_t>(i);
+        seqs[i].setup(1 + k % 5, k, 1 + k % 9);
+    }
+
+    std::atomic<int> bad_rejects{0};
+    bool all_settled = true;
+    bool all_ok = true;
+    for (int round = 0; round < kRounds; ++round) {
+        ToyModel m;
+        DecodeScheduler d;
+        d.init(config(4, kMaxSeq), toy_step, &m);
+        d.start();
+
+        std::atomic<bool> go{false};
+        std::vector<char> accepted(seqs.size(), 0);
+        std::vector<std::thread> producers;
+        for (int t = 0; t < kThreads; ++t) {
+            producers.emplace_back([&, t] {
+                while (!go.load()) std::this_thread::yield();
+                for (int i = 0; i < kPerThread; ++i) {
+                    size_t k = static_cast<size_t>(t * kPerThread + i);
+                    Status s = d.submit(&seqs[k].s);
+                    if (s.is_ok()) accepted[k] = 1;
+                    else if (s.code != StatusCode::INVALID_STATE) bad_rejects++;
+                }
+            });
+        }
+        go.store(true);
+        std::this_thread::yield();
+        d.stop();
+        for (auto& th : producers) th.join();
+
+        for (size_t k = 0; k < seqs.size(); ++k) {
+            if (!accepted[k]) continue;
+            if (!seqs[k].s.done.ready()) all_settled = false;
+            else all_ok = all_ok && seqs[k].s.done.wait().is_ok() && seqs[k].matches(kMaxSeq);
+        }
+        d.destroy();
+    }
+    ASSERT(all_settled && bad_rejects.load() == 0, "every accepted sequence completed by stop(); the rest were rejected");
+    ASSERT(all_ok, "accepted sequences decoded correctly");
+}
+
+int main() {
+    std::printf("=== Spec 007 — Continuous decode batching ===\n");
+
+    test_validation();
+    test_iteration_level_admission();
+    test_stop_conditions();
+    test_step_error();
+    test_worker_concurrent_producers();
+    test_submit_racing_stop();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
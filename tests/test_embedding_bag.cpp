@@ -0,0 +1,235 @@
+/**
+ * @file test_embedding_bag.cpp
+ * @brief Acceptance tests for spec 015 — fused embedding bag.
+ *
+ * Tests derived from docs/specs/015-embedding-bag.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+struct CountingAllocator : Allocator {
+    std::atomic<int64_t> allocs{0};
+    void* alloc(size_t size, size_t alignment, Device device) noexcept override {
+        allocs.fetch_add(1, std::memory_order_relaxed);
+        return SystemAllocator::instance()->alloc(size, alignment, device);
+    }
+    void free(void* ptr, Device device) noexcept override {
+        SystemAllocator::instance()->free(ptr, device);
+    }
+    const char* name() const noexcept override { return "counting"; }
+};
+
+static CountingAllocator g_alloc;
+static uint32_t rng_state = 777u;
+
+static uint32_t rnd() {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+static Tensor table_f32(int64_t rows, int64_t dim) {
+    int64_t shape[2] = {rows, dim};
+    Tensor t = Tensor::alloc(shape, 2, DType::F32);
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) p[i] = static_cast<float>(rnd() % 2001) / 1000.0f - 1.0f;
+    return t;
+}
+
+static Tensor vec(const int64_t* v, int64_t n, DType dtype) {
+    int64_t shape[1] = {n};
+    Tensor t = Tensor::alloc(shape, 1, dtype);
+    for (int64_t i = 0; i < n; ++i) {
+        if (dtype == DType::I64) static_cast<int64_t*>(t.data)[i] = v[i];
+        else static_cast<int32_t*>(t.data)[i] = static_cast<int32_t>(v[i]);
+    }
+    return t;
+}
+
+static Tensor out_f32(int64_t bags, int64_t dim) {
+    int64_t shape[2] = {bags, dim};
+    Tensor t = Tensor::alloc(shape, 2, DType::F32);
+    std::memset(t.data, 0xFF, t.nbytes());   // NaN garbage
+    return t;
+}
+
+// Gather-then-pool reference in double.
+static float max_err(const Tensor& table, const int64_t* idx, const int64_t* off, int64_t bags,
+                     const float* w, bool mean, const Tensor& out) {
+    int64_t dim = table.shape[1];
+    const float* t = static_cast<const float*>(table.data);
+    const float* y = static_cast<const float*>(out.data);
+    float err = 0.0f;
+    for (int64_t b = 0; b < bags; ++b) {
+        for (int64_t j = 0; j < dim; ++j) {
+            double acc = 0.0;
+            for (int64_t p = off[b]; p < off[b + 1]; ++p)
+                acc += static_cast<double>(w ? w[p] : 1.0f) * t[idx[p] * dim + j];
+            if (mean && off[b + 1] > off[b]) acc /= static_cast<double>(off[b + 1] - off[b]);
+            float e = std::fabs(static_cast<float>(acc) - y[b * dim + j]);
+            if (!(e <= err)) err = e;
+        }
+    }
+    return err;
+}
+
+static void test_sum_mean() {
+    std::printf("\n--- sum / mean pooling over CSR bags ---\n");
+    Tensor table = table_f32(50, 24);
+    int64_t idx[] = {3, 7, 7, 49, 0, 12, 5, 5, 5, 18};
+    int64_t off[] = {0, 3, 3, 4, 10};          // bag 1 is empty
+    Tensor ids = vec(idx, 10, DType::I64);
+    Tensor offs = vec(off, 5, DType::I64);
+    Tensor out = out_f32(4, 24);
+
+    set_allocator(&g_alloc);
+    int64_t before = g_alloc.allocs.load();
+    ASSERT(ops::embedding_bag(table, ids, offs, out).is_ok(), "sum succeeds");
+    ASSERT(g_alloc.allocs.load() == before, "no intermediate allocation");
+    set_allocator(SystemAllocator::instance());
+    ASSERT(max_err(table, idx, off, 4, nullptr, false, out) < 1e-5f, "sum matches gather + reduce");
+    float* y = static_cast<float*>(out.data);
+    bool empty_zero = true;
+    for (int64_t j = 0; j < 24; ++j) empty_zero = empty_zero && y[24 + j] == 0.0f;
+    ASSERT(empty_zero, "empty bag pools to zero");
+
+    ASSERT(ops::embedding_bag(table, ids, offs, out, ops::BagMode::MEAN).is_ok(), "mean succeeds");
+    ASSERT(max_err(table, idx, off, 4, nullptr, true, out) < 1e-5f, "mean matches gather + reduce");
+    table.free(); ids.free(); offs.free(); out.free();
+}
+
+static void test_weighted_i32() {
+    std::printf("\n--- per-sample weights, I32 indices ---\n");
+    Tensor table = table_f32(1000, 33);        // odd width exercises the vector tail
+    const int64_t n = 200, bags = 16;
+    int64_t idx[n], off[bags + 1];
+    float wv[n];
+    for (int64_t p = 0; p < n; ++p) { idx[p] = rnd() % 1000; wv[p] = static_cast<float>(rnd() % 100) / 50.0f; }
+    for (int64_t b = 0; b <= bags; ++b) off[b] = n * b / bags;
+    Tensor ids = vec(idx, n, DType::I32);
+    Tensor offs = vec(off, bags + 1, DType::I32);
+    int64_t wshape[1] = {n};
+    Tensor w = Tensor::alloc(wshape, 1, DType::F32);
+    std::memcpy(w.data, wv, sizeof(wv));
+    Tensor out = out_f32(bags, 33);
+    ASSERT(ops::embedding_bag(table, ids, offs, out, ops::BagMode::SUM, w).is_ok(), "weighted sum succeeds");
+    ASSERT(max_err(table, idx, off, bags, wv, false, out) < 1e-4f, "weighted sum matches reference");
+    table.free(); ids.free(); offs.free(); w.free(); out.free();
+}
+
+static void test_threads() {
+    std::printf("\n--- bag-parallel split, skewed bags ---\n");
+    const int64_t rows = 20000, dim = 64, bags = 512;
+    Tensor table = table_f32(rows, dim);
+    static int64_t off[bags + 1];
+    off[0] = 0;
+    for (int64_t b = 0; b < bags; ++b) off[b + 1] = off[b] + (b % 64 == 0 ? 400 : 1 + rnd() % 40);
+    int64_t n = off[bags];
+    static int64_t idx[bags * 400];
+    for (int64_t p = 0; p < n; ++p) idx[p] = rnd() % rows;
+    Tensor ids = vec(idx, n, DType::I64);
+    Tensor offs = vec(off, bags + 1, DType::I64);
+    Tensor one = out_f32(bags, dim), many = out_f32(bags, dim), many2 = out_f32(bags, dim);
+    Tensor serial = out_f32(bags, dim);
+    exec::ThreadPool pool;
+    ASSERT(pool.start(4).is_ok(), "pool started");
+    ASSERT(ops::embedding_bag(table, ids, offs, one, ops::BagMode::SUM, Tensor::empty(), 1, &pool).is_ok(),
+           "1 range");
+    ASSERT(ops::embedding_bag(table, ids, offs, many, ops::BagMode::SUM, Tensor::empty(), 4, &pool).is_ok(),
+           "4 ranges on the pool");
+    ASSERT(ops::embedding_bag(table, ids, offs, many2, ops::BagMode::SUM, Tensor::empty(), 0, &pool).is_ok(),
+           "auto ranges on the pool");
+    ASSERT(ops::embedding_bag(table, ids, offs, serial, ops::BagMode::SUM, Tensor::empty(), 4).is_ok(),
+           "no pool: caller runs every bag");
+    ASSERT(std::memcmp(one.data, many.data, one.nbytes()) == 0 &&
+           std::memcmp(one.data, many2.data, one.nbytes()) == 0 &&
+           std::memcmp(one.data, serial.data, one.nbytes()) == 0, "bit-identical across thread counts");
+    ASSERT(max_err(table, idx, off, bags, nullptr, false, one) < 1e-4f, "matches reference");
+
+    // Informational: fused vs gather into a temporary then pool.
+    int64_t gshape[2] = {n, dim};
+    Tensor tmp = Tensor::alloc(gshape, 2, DType::F32);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < 20; ++r) {
+        float* g = static_cast<float*>(tmp.data);
+        const float* t = static_cast<const float*>(table.data);
+        for (int64_t p = 0; p < n; ++p) std::memcpy(g + p * dim, t + idx[p] * dim, dim * sizeof(float));
+        float* y = static_cast<float*>(one.data);
+        for (int64_t b = 0; b < bags; ++b) {
+            for (int64_t j = 0; j < dim; ++j) y[b * dim + j] = 0.0f;
+            for (int64_t p = off[b]; p < off[b + 1]; ++p)
+                for (int64_t j = 0; j < dim; ++j) y[b * dim + j] += g[p * dim + j];
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < 20; ++r) (void)ops::embedding_bag(table, ids, offs, one, ops::BagMode::SUM, Tensor::empty(), 1);
+    auto t2 = std::chrono::steady_clock::now();
+    std::printf("INFO: %lld ids x %lld: gather+pool %.1f us, fused %.1f us\n",
+                static_cast<long long>(n), static_cast<long long>(dim),
+                std::chrono::duration<double, std::micro>(t1 - t0).count() / 20.0,
+                std::chrono::duration<double, std::micro>(t2 - t1).count() / 20.0);
+    tmp.free();
+    table.free(); ids.free(); offs.free(); one.free(); many.free(); many2.free(); serial.free();
+}
+
+static void test_validation() {
+    std::printf("\n--- validation ---\n");
+    Tensor table = table_f32(10, 4);
+    int64_t idx[] = {1, 2, 3};
+    int64_t off[] = {0, 2, 3};
+    int64_t bad_idx[] = {1, 10, 3};
+    int64_t bad_off[] = {0, 3, 2};
+    Tensor ids = vec(idx, 3, DType::I64), offs = vec(off, 3, DType::I64);
+    Tensor oob = vec(bad_idx, 3, DType::I64), unsorted = vec(bad_off, 3, DType::I64);
+    Tensor offs32 = vec(off, 3, DType::I32);
+    Tensor out = out_f32(2, 4), wrong = out_f32(3, 4);
+    int64_t wshape[1] = {3};
+    Tensor w = Tensor::alloc(wshape, 1, DType::F32);
+    uint32_t sentinel;
+    std::memcpy(&sentinel, out.data, sizeof(sentinel));
+
+    ASSERT(ops::embedding_bag(table, oob, offs, out).code == StatusCode::OUT_OF_BOUNDS, "index outside table");
+    ASSERT(ops::embedding_bag(table, ids, unsorted, out).code == StatusCode::INVALID_ARGUMENT, "decreasing offsets");
+    ASSERT(ops::embedding_bag(table, ids, offs32, out).code == StatusCode::TYPE_MISMATCH, "offsets dtype mismatch");
+    ASSERT(ops::embedding_bag(table, ids, offs, wrong).code == StatusCode::INVALID_ARGUMENT, "output shape");
+    ASSERT(ops::embedding_bag(table, ids, offs, out, ops::BagMode::MEAN, w).code == StatusCode::INVALID_ARGUMENT,
+           "weights need SUM");
+    ASSERT(ops::embedding_bag(table, ids, offs, out, ops::BagMode::SUM, Tensor::empty(), -1).code ==
+           StatusCode::INVALID_ARGUMENT, "negative thread count");
+    uint32_t now;
+    std::memcpy(&now, out.data, sizeof(now));
+    ASSERT(now == sentinel, "output untouched on failure");
+    table.free(); ids.free(); offs.free(); oob.free(); unsorted.free(); offs32.free();
+    out.free(); wrong.free(); w.free();
+}
+
+int main() {
+    std::printf("=== Spec 015 — Fused embedding bag ===\n");
+
+    test_sum_mean();
+    test_weighted_i32();
+    test_threads();
+    test_validation();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
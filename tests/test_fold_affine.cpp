@@ -0,0 +1,231 @@
+/**
+ * @file test_fold_affine.cpp
+ * @brief Acceptance tests for spec 014 — affine / batch-norm folding pass.
+ *
+ * Tests derived from docs/specs/014-fold-affine.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+
+using namespace zero;
+using namespace zero::ir;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static uint32_t rng_state = 12345u;
+
+static float rnd(float lo, float hi) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return lo + (hi - lo) * static_cast<float>((rng_state >> 8) & 0xFFFF) / 65535.0f;
+}
+
+static Tensor filled(const int64_t* shape, int8_t ndim, float lo, float hi) {
+    Tensor t = Tensor::alloc(shape, ndim, DType::F32);
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) p[i] = rnd(lo, hi);
+    return t;
+}
+
+static Tensor channels(int64_t n, float lo, float hi) {
+    int64_t shape[1] = {n};
+    return filled(shape, 1, lo, hi);
+}
+
+static Tensor input(int64_t m, int64_t k) {
+    int64_t shape[2] = {m, k};
+    return filled(shape, 2, -2.0f, 2.0f);
+}
+
+static LayerNode bn(int64_t n) {
+    return LayerNode::batch_norm(channels(n, 0.5f, 1.5f), channels(n, -0.5f, 0.5f),
+                                 channels(n, -1.0f, 1.0f), channels(n, 0.1f, 2.0f), 1e-5f);
+}
+
+// Copy a graph, deep-copying every tensor.
+static void clone_graph(const LayerGraph& src, LayerGraph& dst) {
+    dst.count = src.count;
+    for (int32_t i = 0; i < src.count; ++i) {
+        const LayerNode& s = src.nodes[i];
+        LayerNode& d = dst.nodes[i];
+        d = s;
+        const Tensor* from[6] = {&s.weight, &s.bias, &s.scale, &s.shift, &s.mean, &s.var};
+        Tensor* to[6] = {&d.weight, &d.bias, &d.scale, &d.shift, &d.mean, &d.var};
+        for (int j = 0; j < 6; ++j) *to[j] = from[j]->data ? from[j]->clone() : Tensor::empty();
+    }
+}
+
+static float max_rel_diff(const Tensor& a, const Tensor& b) {
+    if (a.numel() != b.numel()) return 1e30f;
+    const float* pa = static_cast<const float*>(a.data);
+    const float* pb = static_cast<const float*>(b.data);
+    float m = 0.0f;
+    for (int64_t i = 0; i < a.numel(); ++i)
+        m = std::fmax(m, std::fabs(pa[i] - pb[i]) / (1.0f + std::fabs(pa[i])));
+    return m;
+}
+
+static void test_linear_batch_norm() {
+    std::printf("\n--- linear + batch norm folds into one gemm ---\n");
+    int64_t wshape[2] = {16, 8};
+    LayerGraph g;
+    (void)g.push(LayerNode::linear(filled(wshape, 2, -1.0f, 1.0f), channels(8, -1.0f, 1.0f)));
+    (void)g.push(bn(8));
+    LayerGraph ref;
+    clone_graph(g, ref);
+
+    FoldReport rep;
+    ASSERT(fold_affine(g, &rep).is_ok(), "pass succeeds");
+    ASSERT(g.count == 1 && g.nodes[0].kind == LayerKind::LINEAR, "batch norm node removed");
+    ASSERT(rep.folded_layers == 1 && rep.removed_nodes == 1, "report counts the fold");
+    ASSERT(rep.max_error <= 1e-4f, "verified error within tolerance");
+
+    Tensor x = input(32, 16);
+    Tensor y0 = Tensor::empty(), y1 = Tensor::empty();
+    ASSERT(run_layers(ref, x, y0).is_ok() && run_layers(g, x, y1).is_ok(), "both graphs run");
+    std::printf("INFO: max rel diff %.3g\n", static_cast<double>(max_rel_diff(y0, y1)));
+    ASSERT(max_rel_diff(y0, y1) < 1e-5f, "folded graph matches original on fresh input");
+    x.free(); y0.free(); y1.free();
+    g.free(); ref.free();
+}
+
+static void test_chain() {
+    std::printf("\n--- affine chains fold; activations end the match ---\n");
+    int64_t w1[2] = {12, 6}, w2[2] = {6, 4};
+    LayerGraph g;
+    (void)g.push(LayerNode::linear(filled(w1, 2, -1.0f, 1.0f)));          // no bias
+    (void)g.push(LayerNode::affine(channels(6, 0.5f, 2.0f), Tensor::empty()));
+    (void)g.push(bn(6));
+    (void)g.push(LayerNode::activation(OpKind::RELU));
+    (void)g.push(LayerNode::affine(channels(6, 0.5f, 2.0f), channels(6, -1.0f, 1.0f)));  // after relu: stays
+    (void)g.push(LayerNode::linear(filled(w2, 2, -1.0f, 1.0f), channels(4, -1.0f, 1.0f)));
+    (void)g.push(LayerNode::affine(Tensor::empty(), channels(4, -1.0f, 1.0f)));
+    LayerGraph ref;
+    clone_graph(g, ref);
+
+    FoldReport rep;
+    ASSERT(fold_affine(g, &rep).is_ok(), "pass succeeds");
+    ASSERT(g.count == 4, "7 nodes -> 4");
+    ASSERT(g.nodes[0].kind == LayerKind::LINEAR && g.nodes[0].bias.data != nullptr,
+           "bias created for a bias-less linear");
+    ASSERT(g.nodes[1].kind == LayerKind::ACTIVATION && g.nodes[2].kind == LayerKind::AFFINE &&
+           g.nodes[3].kind == LayerKind::LINEAR, "affine after activation is kept");
+    ASSERT(rep.folded_layers == 2 && rep.removed_nodes == 3, "report counts both folds");
+
+    Tensor x = input(10, 12);
+    Tensor y0 = Tensor::empty(), y1 = Tensor::empty();
+    ASSERT(run_layers(ref, x, y0).is_ok() && run_layers(g, x, y1).is_ok(), "both graphs run");
+    ASSERT(max_rel_diff(y0, y1) < 1e-5f, "folded chain matches original");
+    x.free(); y0.free(); y1.free();
+
+    FoldReport again;
+    ASSERT(fold_affine(g, &again).is_ok() && again.folded_layers == 0 && g.count == 4,
+           "second run is a no-op");
+    g.free(); ref.free();
+}
+
+static void test_conv_filter() {
+    std::printf("\n--- HWIO conv filter folds on its output channel ---\n");
+    int64_t fshape[4] = {3, 3, 4, 8};
+    LayerGraph g;
+    (void)g.push(LayerNode::linear(filled(fshape, 4, -1.0f, 1.0f), channels(8, -1.0f, 1.0f)));
+    (void)g.push(bn(8));
+    LayerGraph ref;
+    clone_graph(g, ref);
+    ASSERT(fold_affine(g).is_ok() && g.count == 1, "conv + batch norm folded");
+    ASSERT(g.nodes[0].weight.ndim == 4 && g.nodes[0].weight.shape[3] == 8, "filter layout kept");
+
+    Tensor patches = input(20, 36);   // im2col rows: 3*3*4
+    Tensor y0 = Tensor::empty(), y1 = Tensor::empty();
+    ASSERT(run_layers(ref, patches, y0).is_ok() && run_layers(g, patches, y1).is_ok(), "both graphs run");
+    ASSERT(max_rel_diff(y0, y1) < 1e-5f, "folded conv matches original");
+
+    // A filter stored HOWI and permuted to HWIO has no [36, 8] view and is gathered
+    int64_t howi[4] = {3, 8, 3, 4};
+    int8_t perm[4] = {0, 2, 3, 1};
+    Tensor stored = filled(howi, 4, -1.0f, 1.0f);
+    Tensor hwio = ops::permute(stored, perm);
+    int64_t w2[2] = {36, 8};
+    LayerGraph strided, dense;
+    (void)strided.push(LayerNode::linear(hwio));
+    (void)dense.push(LayerNode::linear(hwio.reshape_copy(fshape, 4)));
+    Tensor y2 = Tensor::empty(), y3 = Tensor::empty();
+    ASSERT(hwio.reshape(w2, 2).data == nullptr && run_layers(strided, patches, y2).is_ok() &&
+           run_layers(dense, patches, y3).is_ok() && max_rel_diff(y2, y3) == 0.0f,
+           "strided filter runs through a gathered copy");
+    strided.free(); dense.free(); stored.free();
+    y2.free(); y3.free();
+    patches.free(); y0.free(); y1.free();
+    g.free(); ref.free();
+}
+
+static void test_rejects() {
+    std::printf("\n--- malformed parameters, skipped patterns, failed checks ---\n");
+    int64_t wshape[2] = {4, 3};
+
+    LayerGraph lone;
+    (void)lone.push(bn(4));
+    (void)lone.push(LayerNode::activation(OpKind::TANH));
+    ASSERT(fold_affine(lone).is_ok() && lone.count == 2, "transform without a linear is kept");
+    lone.free();
+
+    LayerGraph bad;
+    (void)bad.push(LayerNode::linear(filled(wshape, 2, -1.0f, 1.0f)));
+    (void)bad.push(LayerNode::affine(channels(5, 1.0f, 2.0f), Tensor::empty()));
+    float before = static_cast<float*>(bad.nodes[0].weight.data)[0];
+    ASSERT(fold_affine(bad).code == StatusCode::INVALID_ARGUMENT, "channel count mismatch rejected");
+    ASSERT(bad.count == 2 && static_cast<float*>(bad.nodes[0].weight.data)[0] == before,
+           "rejected segment left unchanged");
+    bad.free();
+
+    LayerGraph neg;
+    (void)neg.push(LayerNode::linear(filled(wshape, 2, -1.0f, 1.0f)));
+    (void)neg.push(LayerNode::batch_norm(channels(3, 1.0f, 1.0f), channels(3, 0.0f, 0.0f),
+                                         channels(3, 0.0f, 0.0f), channels(3, -2.0f, -1.0f), 1e-5f));
+    ASSERT(fold_affine(neg).code == StatusCode::INVALID_ARGUMENT, "negative variance rejected");
+    neg.free();
+
+    LayerGraph half;
+    (void)half.push(LayerNode::linear(Tensor::alloc(wshape, 2, DType::F16)));
+    (void)half.push(LayerNode::affine(channels(3, 1.0f, 2.0f), Tensor::empty()));
+    ASSERT(fold_affine(half).is_ok() && half.count == 2, "non-F32 weights are skipped");
+    half.free();
+
+    // bias and mean of 1e6 cancel exactly in double but not in the F32
+    // reference chain, so the two disagree and the check refuses the fold.
+    LayerGraph drift;
+    Tensor b = channels(3, 1e6f, 1e6f);
+    (void)drift.push(LayerNode::linear(filled(wshape, 2, -1.0f, 1.0f), b));
+    (void)drift.push(LayerNode::batch_norm(channels(3, 1.0f, 1.0f), channels(3, 0.0f, 0.0f),
+                                           channels(3, 1e6f, 1e6f), channels(3, 1e-6f, 1e-6f), 0.0f));
+    ASSERT(fold_affine(drift).code == StatusCode::INVALID_STATE && drift.count == 2,
+           "numerical check refuses a diverging fold");
+    FoldOptions off;
+    off.verify = false;
+    ASSERT(fold_affine(drift, nullptr, off).is_ok() && drift.count == 1, "check can be disabled");
+    drift.free();
+}
+
+int main() {
+    std::printf("=== Spec 014 — Affine / batch-norm folding ===\n");
+
+    test_linear_batch_norm();
+    test_chain();
+    test_conv_filter();
+    test_rejects();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,257 @@
+/**
+ * @file test_gemm_tune.cpp
+ * @brief Acceptance tests for spec 009 — blocked GEMM autotuning.
+ *
+ * Tests derived from docs/specs/009-gemm-autotuning.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+
+using namespace zero;
+using namespace zero::ops;
+using kernels::GemmTiles;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static const char* kCachePath = "zero_gemm_tune_test.cache";
+
+static void fill(Tensor& t, float scale) {
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) p[i] = scale * static_cast<float>((i * 29) % 83 - 41) / 17.0f;
+}
+
+static GemmTiles tiles(int32_t mc, int32_t kc, int32_t nc, int32_t mr, int32_t nr, int32_t threads) {
+    GemmTiles t;
+    t.mc = mc; t.kc = kc; t.nc = nc; t.mr = mr; t.nr = nr; t.threads = threads;
+    return t;
+}
+
+// Blocked result must equal gemm byte for byte, for any tiles and pool.
+static bool blocked_matches(int64_t M, int64_t N, int64_t K, const GemmTiles& t,
+                            exec::ThreadPool* pool = nullptr) {
+    int64_t a_shape[] = {M, K};
+    int64_t b_shape[] = {K, N};
+    int64_t c_shape[] = {M, N};
+    Tensor A = Tensor::alloc(a_shape, 2, DType::F32);
+    Tensor B = Tensor::alloc(b_shape, 2, DType::F32);
+    Tensor C0 = Tensor::alloc(c_shape, 2, DType::F32);
+    Tensor C1 = Tensor::alloc(c_shape, 2, DType::F32);
+    fill(A, 0.5f);
+    fill(B, -0.25f);
+    fill(C0, 1.0f);
+    std::memcpy(C1.data, C0.data, C0.nbytes());
+    int64_t ws_floats = gemm_blocked_workspace_floats(A, B, t);
+    float* ws = static_cast<float*>(mem_alloc(static_cast<size_t>(ws_floats) * sizeof(float), 64, Device::CPU));
+    bool ok = gemm(A, B, C0, 1.25f, -0.75f).is_ok() &&
+              gemm_blocked(A, B, C1, t, ws, ws_floats, 1.25f, -0.75f, pool).is_ok() &&
+              std::memcmp(C0.data, C1.data, C0.nbytes()) == 0;
+    mem_free(ws, Device::CPU);
+    A.free(); B.free(); C0.free(); C1.free();
+    return ok;
+}
+
+static void test_blocked_gemm_exact() {
+    std::printf("\n--- blocked gemm is bit-identical to gemm ---\n");
+    ASSERT(blocked_matches(37, 53, 71, tiles(16, 32, 24, 4, 8, 1)), "ragged tiles, 4x8");
+    ASSERT(blocked_matches(37, 53, 71, tiles(12, 16, 32, 6, 16, 1)), "ragged tiles, 6x16");
+    ASSERT(blocked_matches(64, 96, 128, tiles(32, 64, 64, 8, 8, 1)), "exact multiples, 8x8");
+    ASSERT(blocked_matches(101, 67, 45, tiles(32, 64, 128, 4, 16, 3)), "3-thread row split");
+    ASSERT(blocked_matches(3, 5, 2, tiles(64, 256, 512, 4, 16, 8)), "tiny problem, threads > M");
+
+    exec::ThreadPool pool;
+    ASSERT(pool.start(3).is_ok(), "pool started");
+    uint64_t jobs = pool.jobs();
+    ASSERT(blocked_matches(101, 67, 45, tiles(32, 64, 128, 4, 16, 3), &pool), "3-way split on a pool");
+    ASSERT(blocked_matches(97, 33, 20, tiles(16, 16, 32, 6, 16, 5), &pool), "5 chunks on a 3-thread pool");
+    ASSERT(pool.jobs() == jobs + 2, "chunks ran as pool jobs, no threads spawned");
+    pool.stop();
+}
+
+static void test_blocked_gemm_contract() {
+    std::printf("\n--- gemm_blocked validation ---\n");
+    int64_t a_shape[] = {4, 3};
+    int64_t b_shape[] = {5, 2};
+    int64_t c_shape[] = {4, 2};
+    Tensor A = Tensor::alloc(a_shape, 2, DType::F32);
+    Tensor B = Tensor::alloc(b_shape, 2, DType::F32);
+    Tensor C = Tensor::alloc(c_shape, 2, DType::F32);
+    float ws[4096];
+    ASSERT(gemm_blocked(A, B, C, GemmTiles{}, ws, 4096).code == StatusCode::INVALID_ARGUMENT,
+           "inner dimension mismatch rejected");
+    int64_t b_ok[] = {3, 2};
+    Tensor B2 = Tensor::alloc(b_ok, 2, DType::F32);
+    ASSERT(gemm_blocked(A, B2, C, tiles(8, 8, 8, 5, 5, 1), ws, 4096).code == StatusCode::INVALID_ARGUMENT,
+           "unsupported micro-kernel shape rejected");
+    ASSERT(gemm_blocked(A, B2, C, tiles(8, 8, 8, 4, 8, 0), ws, 4096).code == StatusCode::INVALID_ARGUMENT,
+           "zero threads rejected");
+    int64_t need = gemm_blocked_workspace_floats(A, B2, tiles(8, 8, 8, 4, 8, 1));
+    ASSERT(need > 0 && need <= 4096, "workspace size clipped to the problem");
+    ASSERT(gemm_blocked(A, B2, C, tiles(8, 8, 8, 4, 8, 1), ws, need - 1).code == StatusCode::INVALID_ARGUMENT,
+           "short workspace rejected");
+    ASSERT(gemm_blocked(A, B2, C, tiles(8, 8, 8, 4, 8, 1), ws, need).is_ok(), "exact workspace accepted");
+    A.free(); B.free(); B2.free(); C.free();
+}
+
+static void test_select_and_tune() {
+    std::printf("\n--- heuristic fallback, tune, select ---\n");
+    GemmTuner tuner;
+    GemmKey key{48, 40, 36, DType::F32, 1};
+    GemmTiles h = gemm_heuristic(key);
+    ASSERT(kernels::gemm_tiles_valid(h), "heuristic tiles valid");
+    ASSERT(!tuner.find(key, nullptr), "uncached key not found");
+    GemmTiles s = tuner.select(key);
+    ASSERT(s.mc == h.mc && s.kc == h.kc && s.nc == h.nc, "uncached select falls back to heuristic");
+
+    GemmTuneOptions opts;
+    opts.reps = 1;
+    opts.max_candidates = 12;
+    GemmTiles best;
+    ASSERT(tuner.tune(key, opts, &best).is_ok(), "tune ok");
+    ASSERT(kernels::gemm_tiles_valid(best) && best.mc <= 48 && best.kc <= 36 && best.nc <= 40,
+           "winner valid and clipped to problem");
+    GemmTiles found;
+    ASSERT(tuner.find(key, &found) && found.mc == best.mc && found.nr == best.nr, "winner cached");
+    ASSERT(tuner.size() == 1 && tuner.entry(0).gflops > 0.0, "one entry with measured gflops");
+    ASSERT(blocked_matches(48, 40, 36, best), "winner computes the same result");
+
+    GemmKey bad_dtype{8, 8, 8, DType::F64, 1};
+    ASSERT(tuner.tune(bad_dtype, opts).code == StatusCode::TYPE_MISMATCH, "non-F32 tune rejected");
+    GemmKey bad_shape{0, 8, 8, DType::F32, 1};
+    ASSERT(tuner.tune(bad_shape, opts).code == StatusCode::INVALID_ARGUMENT, "empty shape rejected");
+}
+
+static void test_tune_thread_split() {
+    std::printf("\n--- tune() searches the thread split ---\n");
+    GemmTuner tuner;
+    GemmTuneOptions opts;
+    opts.reps = 1;
+    opts.max_candidates = 4;
+
+    GemmKey no_pool{64, 32, 32, DType::F32, 4};
+    GemmTiles best;
+    ASSERT(tuner.tune(no_pool, opts, &best).is_ok() && best.threads == 1,
+           "without a pool the split settles on one chunk");
+
+    exec::ThreadPool pool;
+    ASSERT(pool.start(4).is_ok(), "pool started");
+    opts.pool = &pool;
+    GemmKey key{96, 64, 48, DType::F32, 4};
+    uint64_t jobs = pool.jobs();
+    ASSERT(tuner.tune(key, opts, &best).is_ok(), "tune with a pool ok");
+    ASSERT(best.threads >= 1 && best.threads <= 4, "winning split within the pool");
+    ASSERT(pool.jobs() > jobs, "wide splits were timed on the pool");
+    ASSERT(blocked_matches(96, 64, 48, best, &pool), "winning split computes the same result");
+    GemmTiles found;
+    ASSERT(tuner.find(key, &found) && found.threads == best.threads, "split cached with the tiles");
+    pool.stop();
+
+    GemmKey narrow{8, 8, 8, DType::F32, 2};
+    ASSERT(tuner.insert(narrow, tiles(8, 8, 8, 4, 8, 3), 1.0).code == StatusCode::INVALID_ARGUMENT,
+           "split above the key's threads rejected");
+}
+
+static void test_cache_persistence() {
+    std::printf("\n--- versioned on-disk cache ---\n");
+    GemmTuner a;
+    GemmKey k1{128, 256, 64, DType::F32, 1};
+    GemmKey k2{7, 9, 11, DType::F32, 4};
+    ASSERT(a.insert(k1, tiles(64, 64, 256, 6, 16, 1), 12.5).is_ok() &&
+           a.insert(k2, tiles(7, 11, 9, 4, 8, 2), 0.5).is_ok(), "insert ok");
+    ASSERT(a.save(kCachePath).is_ok(), "save ok");
+
+    GemmTuner b;
+    ASSERT(b.load(kCachePath).is_ok() && b.size() == 2, "load restores both entries");
+    GemmTiles t;
+    ASSERT(b.find(k2, &t) && t.mc == 7 && t.kc == 11 && t.nc == 9 && t.mr == 4 && t.nr == 8 &&
+           t.threads == 2, "entry round-trips exactly, split included");
+
+    // Foreign CPU and stale version are rejected and leave the table as is.
+    std::FILE* f = std::fopen(kCachePath, "w");
+    std::fprintf(f, "zero-gemm-tune %d\ncpu Some Other CPU @ 1.00GHz\n1 1 1 1 1 1 1 1 4 8 1 1.0\n",
+                 GEMM_TUNE_CACHE_VERSION);
+    std::fclose(f);
+    ASSERT(b.load(kCachePath).code == StatusCode::INVALID_STATE, "foreign CPU model rejected");
+    ASSERT(b.size() == 2, "table unchanged after rejected load");
+
+    f = std::fopen(kCachePath, "w");
+    std::fprintf(f, "zero-gemm-tune %d\ncpu %s\n", GEMM_TUNE_CACHE_VERSION + 1, host_cpu_model());
+    std::fclose(f);
+    ASSERT(b.load(kCachePath).code == StatusCode::INVALID_STATE, "other cache version rejected");
+
+    f = std::fopen(kCachePath, "w");
+    std::fprintf(f, "zero-gemm-tune %d\ncpu %s\n1 2 3\n", GEMM_TUNE_CACHE_VERSION, host_cpu_model());
+    std::fclose(f);
+    ASSERT(b.load(kCachePath).code == StatusCode::INVALID_ARGUMENT && b.size() == 2,
+           "malformed entry rejected");
+
+    f = std::fopen(kCachePath, "w");
+    std::fprintf(f, "zero-gemm-tune %d\ncpu %s\n8 8 8 %d 1 8 8 8 4 8 1 1.0\n",
+                 GEMM_TUNE_CACHE_VERSION, host_cpu_model(), static_cast<int>(DType::F16));
+    std::fclose(f);
+    ASSERT(b.load(kCachePath).code == StatusCode::TYPE_MISMATCH && b.size() == 2,
+           "entry with an untunable dtype rejected");
+    ASSERT(b.load("does/not/exist.cache").is_error(), "missing file rejected");
+    std::remove(kCachePath);
+}
+
+static void test_global_tuner_env() {
+    std::printf("\n--- gemm_tuner() loads $ZERO_GEMM_TUNE_CACHE at startup ---\n");
+    GemmTuner a;
+    GemmKey key{33, 17, 29, DType::F32, 1};
+    ASSERT(a.insert(key, tiles(8, 16, 8, 8, 8, 1), 1.0).is_ok() && a.save(kCachePath).is_ok(),
+           "cache written");
+#if defined(_WIN32)
+    _putenv_s("ZERO_GEMM_TUNE_CACHE", kCachePath);
+#else
+    setenv("ZERO_GEMM_TUNE_CACHE", kCachePath, 1);
+#endif
+    GemmTiles t;
+    ASSERT(gemm_tuner().find(key, &t) && t.mc == 8 && t.nc == 8, "global tuner picked up the cache");
+
+    int64_t a_shape[] = {33, 29};
+    int64_t b_shape[] = {29, 17};
+    int64_t c_shape[] = {33, 17};
+    Tensor A = Tensor::alloc(a_shape, 2, DType::F32);
+    Tensor B = Tensor::alloc(b_shape, 2, DType::F32);
+    Tensor C0 = Tensor::alloc(c_shape, 2, DType::F32);
+    Tensor C1 = Tensor::alloc(c_shape, 2, DType::F32);
+    fill(A, 1.0f);
+    fill(B, 2.0f);
+    int64_t ws_floats = gemm_tuned_workspace_floats(A, B);
+    float* ws = static_cast<float*>(mem_alloc(static_cast<size_t>(ws_floats) * sizeof(float), 64, Device::CPU));
+    bool ok = matmul(A, B, C0).is_ok() && gemm_tuned(A, B, C1, ws, ws_floats).is_ok() &&
+              std::memcmp(C0.data, C1.data, C0.nbytes()) == 0;
+    ASSERT(ok, "gemm_tuned with cached tiles equals matmul");
+    mem_free(ws, Device::CPU);
+    A.free(); B.free(); C0.free(); C1.free();
+    std::remove(kCachePath);
+}
+
+int main() {
+    std::printf("=== Spec 009 — Blocked GEMM autotuning ===\n");
+    std::printf("INFO: host CPU model: %s\n", host_cpu_model());
+
+    test_blocked_gemm_exact();
+    test_blocked_gemm_contract();
+    test_select_and_tune();
+    test_tune_thread_split();
+    test_cache_persistence();
+    test_global_tuner_env();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file test_grouped_gemm.cpp
+ * @brief Acceptance tests for spec 017 — work-stealing pool and grouped GEMM.
+ *
+ * Tests derived from docs/specs/017-grouped-gemm.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static uint32_t rng_state = 99u;
+
+static Tensor random_f32(int64_t rows, int64_t cols) {
+    int64_t shape[2] = {rows, cols};
+    Tensor t = Tensor::alloc(shape, 2, DType::F32);
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) {
+        rng_state = rng_state * 1103515245u + 12345u;
+        p[i] = static_cast<float>((rng_state >> 8) % 2001) / 1000.0f - 1.0f;
+    }
+    return t;
+}
+
+static void test_pool() {
+    std::printf("\n--- work-stealing pool ---\n");
+    exec::ThreadPool pool;
+    ASSERT(pool.start(0).code == StatusCode::INVALID_ARGUMENT, "zero participants rejected");
+    ASSERT(pool.start(exec::POOL_MAX_THREADS + 1).code == StatusCode::INVALID_ARGUMENT, "too many rejected");
+    ASSERT(pool.start(4).is_ok() && pool.size() == 4, "started with 4 participants");
+    ASSERT(pool.start(2).code == StatusCode::INVALID_STATE, "second start rejected");
+
+    static std::atomic<int32_t> hits[10000];
+    for (auto& h : hits) h.store(0);
+    ASSERT(pool.parallel_for(10000, [](int64_t i) { hits[i].fetch_add(1); }).is_ok(), "parallel_for runs");
+    bool once = true;
+    for (auto& h : hits) once = once && h.load() == 1;
+    ASSERT(once, "every index runs exactly once");
+
+    // Skew: the first participant's span is all heavy items.
+    uint64_t steals0 = pool.steals();
+    std::atomic<int64_t> sum{0};
+    ASSERT(pool.parallel_for(64, [&](int64_t i) {
+        if (i < 16) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        sum.fetch_add(i);
+    }).is_ok(), "skewed job runs");
+    ASSERT(sum.load() == 64 * 63 / 2, "skewed job complete");
+    std::printf("INFO: steals %llu\n", static_cast<unsigned long long>(pool.steals() - steals0));
+    ASSERT(pool.steals() > steals0, "idle participants steal from the loaded span");
+
+    std::atomic<int64_t> nested{0};
+    ASSERT(pool.parallel_for(8, [&](int64_t) {
+        (void)pool.parallel_for(8, [&](int64_t) { nested.fetch_add(1); });
+    }).is_ok() && nested.load() == 64, "nested parallel_for runs inline");
+
+    std::atomic<int64_t> a{0}, b{0};
+    std::thread other([&] { for (int r = 0; r < 50; ++r) (void)pool.parallel_for(100, [&](int64_t) { a.fetch_add(1); }); });
+    for (int r = 0; r < 50; ++r) (void)pool.parallel_for(100, [&](int64_t) { b.fetch_add(1); });
+    other.join();
+    ASSERT(a.load() == 5000 && b.load() == 5000, "concurrent callers are serialized");
+
+    ASSERT(pool.parallel_for(0, [](int64_t) {}).is_ok(), "empty job");
+    ASSERT(pool.parallel_for(-1, [](int64_t) {}).code == StatusCode::INVALID_ARGUMENT, "negative count rejected");
+    pool.stop();
+    pool.stop();
+    ASSERT(pool.size() == 0 && pool.start(2).is_ok(), "restart after stop");
+    pool.stop();
+}
+
+static void test_grouped() {
+    std::printf("\n--- grouped gemm matches one gemm per group ---\n");
+    const int32_t G = 8;
+    const int64_t K = 64, N = 96;
+    int64_t ms[G] = {0, 1, 3, 64, 200, 7, 0, 33};
+    ops::GemmGroup groups[G];
+    Tensor ref[G];
+    for (int32_t g = 0; g < G; ++g) {
+        groups[g].A = random_f32(ms[g], K);
+        groups[g].B = random_f32(K, N);
+        groups[g].C = random_f32(ms[g], N);
+        ref[g] = groups[g].C.clone();
+        if (ms[g] > 0) (void)ops::gemm(groups[g].A, groups[g].B, ref[g], 0.5f, 0.25f);
+    }
+    Tensor init[G];
+    for (int32_t g = 0; g < G; ++g) init[g] = groups[g].C.clone();
+
+    for (int32_t threads = 0; threads <= 4; ++threads) {
+        for (int32_t g = 0; g < G; ++g) std::memcpy(groups[g].C.data, init[g].data, init[g].nbytes());
+        exec::ThreadPool pool;
+        if (threads > 0) (void)pool.start(threads);
+        Status s = ops::grouped_gemm(groups, G, threads > 0 ? &pool : nullptr, 0.5f, 0.25f);
+        bool same = s.is_ok();
+        for (int32_t g = 0; g < G; ++g)
+            same = same && std::memcmp(groups[g].C.data, ref[g].data, ref[g].nbytes()) == 0;
+        char msg[96];
+        std::snprintf(msg, sizeof(msg), "bit-identical to per-group gemm (pool of %d)", threads);
+        ASSERT(same, msg);
+    }
+
+    std::printf("\n--- validation ---\n");
+    ops::GemmGroup bad[2] = {groups[3], groups[4]};
+    bad[1].B = random_f32(K, N + 1);
+    float c0 = static_cast<float*>(bad[0].C.data)[0];
+    ASSERT(ops::grouped_gemm(bad, 2).code == StatusCode::INVALID_ARGUMENT, "differing N rejected");
+    ASSERT(static_cast<float*>(bad[0].C.data)[0] == c0, "no group written on failure");
+    bad[1].B.free();
+    ASSERT(ops::grouped_gemm(groups, -1).code == StatusCode::INVALID_ARGUMENT, "negative count rejected");
+    ASSERT(ops::grouped_gemm(groups, 0).is_ok(), "empty list is a no-op");
+
+    for (int32_t g = 0; g < G; ++g) {
+        groups[g].A.free(); groups[g].B.free(); groups[g].C.free(); ref[g].free(); init[g].free();
+    }
+}
+
+static void test_timing() {
+    std::printf("\n--- per-expert gemm vs grouped (informational) ---\n");
+    const int32_t G = 16;
+    const int64_t K = 256, N = 256;
+    int64_t ms[G] = {512, 4, 8, 2, 16, 1, 3, 64, 5, 9, 2, 6, 1, 32, 7, 4};
+    ops::GemmGroup groups[G];
+    for (int32_t g = 0; g < G; ++g) {
+        groups[g].A = random_f32(ms[g], K);
+        groups[g].B = random_f32(K, N);
+        groups[g].C = random_f32(ms[g], N);
+    }
+    int32_t hw = static_cast<int32_t>(std::thread::hardware_concurrency());
+    exec::ThreadPool pool;
+    (void)pool.start(hw > 0 ? (hw < exec::POOL_MAX_THREADS ? hw : exec::POOL_MAX_THREADS) : 1);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int32_t g = 0; g < G; ++g) (void)ops::gemm(groups[g].A, groups[g].B, groups[g].C);
+    auto t1 = std::chrono::steady_clock::now();
+    (void)ops::grouped_gemm(groups, G, &pool);
+    auto t2 = std::chrono::steady_clock::now();
+    std::printf("INFO: %d experts, pool of %d: per-expert %.1f us, grouped %.1f us\n", G, pool.size(),
+                std::chrono::duration<double, std::micro>(t1 - t0).count(),
+                std::chrono::duration<double, std::micro>(t2 - t1).count());
+    for (int32_t g = 0; g < G; ++g) { groups[g].A.free(); groups[g].B.free(); groups[g].C.free(); }
+}
+
+int main() {
+    std::printf("=== Spec 017 — Grouped GEMM ===\n");
+
+    test_pool();
+    test_grouped();
+    test_timing();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
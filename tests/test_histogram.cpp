@@ -0,0 +1,211 @@
+/**
+ * @file test_histogram.cpp
+ * @brief Acceptance tests for spec 012 — HDR latency histograms.
+ *
+ * Tests derived from docs/specs/012-hdr-latency-histograms.md §4.
+ * Built with ZERO_OP_HISTOGRAMS so the ops record into op_latency().
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <cstdio>
+#include <cstdint>
+#include <thread>
+
+using namespace zero;
+using namespace zero::telemetry;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static HistogramSnapshot g_snap;   // 10 KB each; keep them off the stack
+static HistogramSnapshot g_merged;
+
+static void test_bucket_math() {
+    std::printf("\n--- log-linear buckets ---\n");
+    bool exact = true;
+    for (int64_t v = 0; v < HIST_SUB; ++v)
+        exact = exact && hist_bucket_low(hist_bucket(v)) == v && hist_bucket_high(hist_bucket(v)) == v;
+    ASSERT(exact, "values below 32 are exact");
+
+    bool bounded = true;
+    bool monotonic = true;
+    int32_t prev = 0;
+    for (int64_t v = 1; v < (int64_t{1} << 40); v = v * 5 / 4 + 1) {
+        int32_t b = hist_bucket(v);
+        int64_t lo = hist_bucket_low(b);
+        int64_t hi = hist_bucket_high(b);
+        bounded = bounded && lo <= v && v <= hi && (hi - lo) * HIST_SUB <= lo;
+        monotonic = monotonic && b >= prev;
+        prev = b;
+    }
+    ASSERT(bounded, "bucket width <= 1/32 of its value");
+    ASSERT(monotonic, "bucket index monotonic in value");
+    ASSERT(hist_bucket(-5) == 0 && hist_bucket(INT64_MAX) == HIST_BUCKETS - 1, "out-of-range values clamp");
+    ASSERT(hist_bucket_high(HIST_BUCKETS - 1) == HIST_MAX_VALUE, "last bucket ends at HIST_MAX_VALUE");
+}
+
+static void test_percentiles() {
+    std::printf("\n--- percentiles ---\n");
+    static LatencyHistogram h;
+    for (int64_t v = 1; v <= 10000; ++v) h.record(v);
+    h.snapshot(g_snap);
+    ASSERT(g_snap.count == 10000 && g_snap.mean() == 5000.5, "count and exact mean");
+    int64_t p50 = g_snap.percentile(50.0);
+    int64_t p99 = g_snap.percentile(99.0);
+    int64_t p999 = g_snap.percentile(99.9);
+    std::printf("INFO: p50=%lld p99=%lld p999=%lld max=%lld\n", static_cast<long long>(p50),
+                static_cast<long long>(p99), static_cast<long long>(p999),
+                static_cast<long long>(g_snap.max()));
+    ASSERT(p50 >= 5000 && p50 <= 5000 + 5000 / 32, "p50 within one bucket, never under");
+    ASSERT(p99 >= 9900 && p99 <= 9900 + 9900 / 32, "p99 within one bucket, never under");
+    ASSERT(p999 >= 9990 && p999 <= 9990 + 9990 / 32, "p999 within one bucket, never under");
+    ASSERT(g_snap.min() == 1 && g_snap.max() >= 10000 && g_snap.percentile(100.0) == g_snap.max(),
+           "min and max");
+
+    HistogramSnapshot* empty = &g_merged;
+    empty->clear();
+    ASSERT(empty->percentile(99.0) == 0 && empty->max() == 0, "empty snapshot reports 0");
+
+    h.drain(g_snap);
+    ASSERT(g_snap.count == 10000, "drain returns the counts");
+    h.snapshot(g_snap);
+    ASSERT(g_snap.count == 0 && g_snap.sum == 0, "drain resets");
+}
+
+static void test_merge_and_concurrency() {
+    std::printf("\n--- per-thread instances merge; drain loses nothing ---\n");
+    constexpr int kThreads = 4;
+    constexpr int64_t kPer = 50000;
+    static LatencyHistogram per_thread[kThreads];
+    static LatencyHistogram all;
+    std::thread pool[kThreads];
+    for (int t = 0; t < kThreads; ++t) {
+        pool[t] = std::thread([t] {
+            for (int64_t i = 0; i < kPer; ++i) {
+                int64_t v = (t + 1) * 1000 + (i % 997);
+                per_thread[t].record(v);
+                all.record(v);
+            }
+        });
+    }
+    // Drain the shared histogram while the writers run.
+    int64_t drained = 0;
+    for (int i = 0; i < 50; ++i) {
+        all.drain(g_snap);
+        drained += g_snap.count;
+        std::this_thread::yield();
+    }
+    for (auto& t : pool) t.join();
+    all.drain(g_snap);
+    drained += g_snap.count;
+    ASSERT(drained == kThreads * kPer, "concurrent drain loses no records");
+
+    g_merged.clear();
+    for (auto& h : per_thread) {
+        h.snapshot(g_snap);
+        g_merged.merge(g_snap);
+    }
+    ASSERT(g_merged.count == kThreads * kPer, "merged count");
+    ASSERT(g_merged.min() <= 1000 && g_merged.min() >= 1000 - 1000 / 32 && g_merged.max() >= 4996,
+           "merged range spans every thread");
+    ASSERT(g_merged.percentile(50.0) >= 2000 && g_merged.percentile(50.0) < 3100, "merged median");
+}
+
+static int64_t recorded(ir::OpKind kind, int64_t work) {
+    op_latency().snapshot(kind, shape_bucket(work), g_snap);
+    return g_snap.count;
+}
+
+static void test_op_table() {
+    std::printf("\n--- ops record into op_latency() by (OpKind, shape bucket) ---\n");
+    ASSERT(shape_bucket(0) == 0 && shape_bucket(1024) == 10 && shape_bucket(1025) == 10 &&
+           shape_bucket(INT64_MAX) == SHAPE_BUCKETS - 1, "shape buckets are floor(log2(work))");
+
+    int64_t vec[] = {1024};
+    int64_t sq[] = {16, 16};
+    Tensor a = Tensor::alloc(vec, 1, DType::F32);
+    Tensor b = Tensor::alloc(vec, 1, DType::F32);
+    Tensor c = Tensor::alloc(vec, 1, DType::F32);
+    Tensor m = Tensor::alloc(sq, 2, DType::F32);
+    Tensor n = Tensor::alloc(sq, 2, DType::F32);
+    Tensor o = Tensor::alloc(sq, 2, DType::F32);
+    int64_t red[] = {16};
+    Tensor r = Tensor::alloc(red, 1, DType::F32);
+
+    op_latency().set_sample_every(1);
+    for (int i = 0; i < 10; ++i) (void)ops::add(a, b, c);
+    for (int i = 0; i < 3; ++i) (void)ops::matmul(m, n, o);
+    (void)ops::relu(a, c);
+    (void)ops::sum(m, r);
+    (void)ops::reduce_last_axis(m, r, ops::ReduceOp::PROD);
+    ASSERT(recorded(ir::OpKind::ADD, 1024) == 10, "always-on: every add recorded");
+    ASSERT(recorded(ir::OpKind::MATMUL, 16 * 16 * 16) == 3, "matmul keyed by M*N*K");
+    ASSERT(recorded(ir::OpKind::RELU, 1024) == 1 && recorded(ir::OpKind::SUM, 256) == 1,
+           "unary and reduce ops recorded");
+    ASSERT(recorded(ir::OpKind::PROD, 256) == 1, "prod has its own key, not sum's");
+    ASSERT(recorded(ir::OpKind::ADD, 16) == 0, "other shape buckets untouched");
+
+    (void)ops::add(a, m, c);  // shape mismatch
+    ASSERT(recorded(ir::OpKind::ADD, 1024) == 10, "failed validation not recorded");
+
+    op_latency().reset();
+    op_latency().set_sample_every(4);
+    for (int i = 0; i < 40; ++i) (void)ops::add(a, b, c);
+    ASSERT(recorded(ir::OpKind::ADD, 1024) == 10, "sampled: every 4th op recorded");
+    op_latency().set_sample_every(0);
+    for (int i = 0; i < 40; ++i) (void)ops::add(a, b, c);
+    ASSERT(recorded(ir::OpKind::ADD, 1024) == 10, "sampling off records nothing");
+    op_latency().set_sample_every(1);
+
+    std::printf("\n--- threads record into their own shards; snapshot merges them ---\n");
+    op_latency().reset();
+    constexpr int kThreads = 4;
+    constexpr int kAdds = 250;
+    std::thread pool[kThreads];
+    for (auto& t : pool) {
+        t = std::thread([&a, &b] {
+            int64_t shape[] = {1024};
+            Tensor out = Tensor::alloc(shape, 1, DType::F32);
+            for (int i = 0; i < kAdds; ++i) (void)ops::add(a, b, out);
+            out.free();
+        });
+    }
+    // Snapshot while the writers run: never more than was recorded.
+    bool bounded = true;
+    for (int i = 0; i < 20; ++i) {
+        bounded = bounded && recorded(ir::OpKind::ADD, 1024) <= kThreads * kAdds;
+        std::this_thread::yield();
+    }
+    for (auto& t : pool) t.join();
+    ASSERT(bounded, "concurrent snapshots stay within the recorded total");
+    ASSERT(recorded(ir::OpKind::ADD, 1024) == kThreads * kAdds, "snapshot merges every thread's records");
+    ASSERT(op_latency().drain(ir::OpKind::ADD, shape_bucket(1024), g_snap) &&
+           g_snap.count == kThreads * kAdds && recorded(ir::OpKind::ADD, 1024) == 0,
+           "drain returns the merged counts and resets every shard");
+    ASSERT(!op_latency().snapshot(ir::OpKind::MATVEC, 3, g_snap) && g_snap.count == 0,
+           "unrecorded key reports false and an empty snapshot");
+
+    a.free(); b.free(); c.free(); m.free(); n.free(); o.free(); r.free();
+}
+
+int main() {
+    std::printf("=== Spec 012 — HDR latency histograms ===\n");
+
+    test_bucket_math();
+    test_percentiles();
+    test_merge_and_concurrency();
+    test_op_table();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file test_kernels.cpp
+ * @brief Acceptance tests for spec 005 — compiled zero-core-kernels library.
+ *
+ * Tests derived from docs/specs/005-compiled-kernels-library.md §4.
+ *
+ * Linked against zero-core-kernels, so ops dispatch through the library.
+ * For every ISA variant the host supports, op outputs must be
+ * byte-identical to the GENERIC reference bodies instantiated here.
+ */
+
+#include <zero/zero.hpp>
+#include <zero/kernels/cpu_kernels.hpp>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+using namespace zero;
+using namespace zero::ops;
+using Ref = zero::kernels::impl::Cpu<zero::kernels::Isa::GENERIC>;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static bool bytes_equal(const void* a, const void* b, size_t n) noexcept {
+    return std::memcmp(a, b, n) == 0;
+}
+
+static void fill_pattern(float* p, int64_t n, float scale) noexcept {
+    for (int64_t i = 0; i < n; ++i) {
+        p[i] = scale * static_cast<float>((i * 37) % 101 - 50) / 25.0f;
+    }
+}
+
+// Runs every op family under the currently selected ISA and compares
+// against Ref. Sizes are odd so vector tails are exercised.
+static void check_active_isa() {
+    const char* isa = kernels::isa_name(kernels::active_isa());
+    char msg[128];
+
+    constexpr int64_t N = 1027;
+    int64_t shape[] = {N};
+    Tensor a = Tensor::alloc(shape, 1, DType::F32);
+    Tensor b = Tensor::alloc(shape, 1, DType::F32);
+    Tensor out = Tensor::alloc(shape, 1, DType::F32);
+    float ref[N];
+    fill_pattern(static_cast<float*>(a.data), N, 1.0f);
+    fill_pattern(static_cast<float*>(b.data), N, -0.5f);
+    const float* ap = static_cast<const float*>(a.data);
+    const float* bp = static_cast<const float*>(b.data);
+
+    bool ok = relu(a, out).is_ok();
+    Ref::relu(ap, ref, N);
+    ok = ok && bytes_equal(out.data, ref, sizeof(ref));
+    ok = ok && sigmoid(a, out).is_ok();
+    Ref::sigmoid(ap, ref, N);
+    ok = ok && bytes_equal(out.data, ref, sizeof(ref));
+    ok = ok && tanh(a, out).is_ok();
+    Ref::tanh(ap, ref, N);
+    ok = ok && bytes_equal(out.data, ref, sizeof(ref));
+    std::snprintf(msg, sizeof(msg), "[%s] unary ops match generic", isa);
+    ASSERT(ok, msg);
+
+    ok = add(a, b, out).is_ok();
+    Ref::add(ap, bp, ref, N);
+    ok = ok && bytes_equal(out.data, ref, sizeof(ref));
+    ok = ok && div(a, b, out).is_ok();
+    Ref::div(ap, bp, ref, N);
+    ok = ok && bytes_equal(out.data, ref, sizeof(ref));
+    ok = ok && scalar_op(a, Scalar(0.75f), out, ElementwiseOp::MUL).is_ok();
+    Ref::mul_scalar(ap, 0.75f, ref, N);
+    ok = ok && bytes_equal(out.data, ref, sizeof(ref));
+    std::snprintf(msg, sizeof(msg), "[%s] binary/scalar ops match generic", isa);
+    ASSERT(ok, msg);
+
+    // GEMM with N > GEMM_NB so the column blocking has a ragged tail.
+    constexpr int64_t M = 7, K = 33, NN = 75;
+    int64_t A_shape[] = {M, K};
+    int64_t B_shape[] = {K, NN};
+    int64_t C_shape[] = {M, NN};
+    Tensor A = Tensor::alloc(A_shape, 2, DType::F32);
+    Tensor B = Tensor::alloc(B_shape, 2, DType::F32);
+    Tensor C = Tensor::alloc(C_shape, 2, DType::F32);
+    float c_ref[M * NN];
+    fill_pattern(static_cast<float*>(A.data), M * K, 0.5f);
+    fill_pattern(static_cast<float*>(B.data), K * NN, 0.25f);
+    fill_pattern(static_cast<float*>(C.data), M * NN, 1.0f);
+    std::memcpy(c_ref, C.data, sizeof(c_ref));
+    ok = gemm(A, B, C, 1.5f, -0.5f).is_ok();
+    Ref::gemm(static_cast<const float*>(A.data), static_cast<const float*>(B.data),
+              c_ref, M, NN, K, 1.5f, -0.5f);
+    ok = ok && bytes_equal(C.data, c_ref, sizeof(c_ref));
+    std::snprintf(msg, sizeof(msg), "[%s] gemm matches generic", isa);
+    ASSERT(ok, msg);
+
+    int64_t in_shape[] = {M, K};
+    int64_t red_shape[] = {M};
+    Tensor red = Tensor::alloc(red_shape, 1, DType::F32);
+    Tensor idx = Tensor::alloc(red_shape, 1, DType::I64);
+    float r_ref[M];
+    int64_t i_ref[M];
+    Tensor in = A.reshape(in_shape, 2);
+    ok = sum(in, red).is_ok();
+    Ref::sum_rows(static_cast<const float*>(A.data), r_ref, M, K);
+    ok = ok && bytes_equal(red.data, r_ref, sizeof(r_ref));
+    ok = ok && max(in, red).is_ok();
+    Ref::max_rows(static_cast<const float*>(A.data), r_ref, M, K);
+    ok = ok && bytes_equal(red.data, r_ref, sizeof(r_ref));
+    ok = ok && argmax(in, idx).is_ok();
+    Ref::argmax_rows_i64(static_cast<const float*>(A.data), i_ref, M, K);
+    ok = ok && bytes_equal(idx.data, i_ref, sizeof(i_ref));
+    std::snprintf(msg, sizeof(msg), "[%s] reductions match generic", isa);
+    ASSERT(ok, msg);
+
+    // Byte shuffle at the specialised widths and one generic width.
+    uint8_t planes[N * 8], round[N * 8], shuf_ref[N * 8];
+    const uint8_t* raw = static_cast<const uint8_t*>(a.data);
+    ok = true;
+    for (int64_t width : {2, 3, 4, 8}) {
+        int64_t n = N * 4 / width;
+        kernels::shuffle_bytes(raw, planes, n, width);
+        Ref::shuffle_bytes(raw, shuf_ref, n, width);
+        kernels::unshuffle_bytes(planes, round, n, width);
+        ok = ok && bytes_equal(planes, shuf_ref, static_cast<size_t>(n * width)) &&
+             bytes_equal(round, raw, static_cast<size_t>(n * width));
+    }
+    std::snprintf(msg, sizeof(msg), "[%s] byte shuffle matches generic and round-trips", isa);
+    ASSERT(ok, msg);
+
+    ok = true;
+    for (int64_t len : {int64_t{0}, int64_t{7}, int64_t{31}, int64_t{32}, int64_t{33}, int64_t{1000}, int64_t{N} * 4})
+        ok = ok && kernels::hash_bytes(raw, len, 42) == Ref::hash_bytes(raw, len, 42);
+    std::snprintf(msg, sizeof(msg), "[%s] content hash matches generic", isa);
+    ASSERT(ok, msg);
+
+    a.free(); b.free(); out.free();
+    A.free(); B.free(); C.free(); red.free(); idx.free();
+}
+
+int main() {
+    std::printf("=== Spec 005 — Compiled kernels library ===\n\n");
+
+    using kernels::Isa;
+
+    ASSERT(kernels::isa_supported(Isa::GENERIC), "generic variant always supported");
+    ASSERT(kernels::isa_supported(kernels::active_isa()), "active ISA is supported");
+    std::printf("INFO: default ISA is %s\n", kernels::isa_name(kernels::active_isa()));
+
+    const Isa all[] = {Isa::GENERIC, Isa::AVX2, Isa::AVX512};
+    for (Isa isa : all) {
+        if (!kernels::isa_supported(isa)) {
+            ASSERT(!kernels::select_isa(isa), "select_isa rejects unsupported variant");
+            std::printf("INFO: %s not available on this host/build\n", kernels::isa_name(isa));
+            continue;
+        }
+        ASSERT(kernels::select_isa(isa), "select_isa accepts supported variant");
+        ASSERT(kernels::active_isa() == isa, "active_isa reflects selection");
+        check_active_isa();
+    }
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
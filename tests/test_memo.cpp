@@ -0,0 +1,334 @@
+/**
+ * @file test_memo.cpp
+ * @brief Acceptance tests for spec 024 — memoization cache for pure functions.
+ *
+ * Tests derived from docs/specs/024-memo-cache.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static std::atomic<int> runs{0};
+
+// y = x * s (allocated on shared storage if the slot is empty), total = sum(y)
+static void scale_sum(ir::FunctionCall* c) {
+    runs.fetch_add(1);
+    const Tensor* x = c->get_tensor(0);
+    float s = c->get_scalar(1)->value.f32;
+    Tensor* y = c->get_tensor(2);
+    if (y->data == nullptr) *y = Tensor::alloc_shared(x->shape.data(), x->ndim, DType::F32);
+    const float* xp = static_cast<const float*>(x->data);
+    float* yp = static_cast<float*>(y->data);
+    double total = 0.0;
+    for (int64_t i = 0; i < x->numel(); ++i) {
+        yp[i] = xp[i] * s;
+        total += yp[i];
+    }
+    *c->get_scalar(3) = Scalar(total);
+}
+
+static ir::Function make_fn(bool pure) {
+    ir::Function f;
+    f.signature = ir::FunctionSig("scale_sum");
+    f.signature.add_input("x", true, DType::F32);
+    f.signature.add_input("s", false, DType::F32);
+    f.signature.add_output("y", true, DType::F32);
+    f.signature.add_output("total", false, DType::F64);
+    f.signature.is_pure = pure;
+    f.entry_point = scale_sum;
+    return f;
+}
+
+static Tensor ramp(int64_t n, float base) {
+    int64_t shape[1] = {n};
+    Tensor t = Tensor::alloc(shape, 1, DType::F32);
+    for (int64_t i = 0; i < n; ++i) static_cast<float*>(t.data)[i] = base + static_cast<float>(i);
+    return t;
+}
+
+// Run one call through the cache with a fresh, empty output slot.
+struct Call {
+    Tensor y = Tensor::empty();
+    Scalar s, total;
+    ir::FunctionCall fc;
+
+    Call(const ir::Function& f, Tensor* x, float scale) : s(scale), fc(&f.signature) {
+        fc.set_tensor(0, x);
+        fc.set_scalar(1, &s);
+        fc.set_tensor(2, &y);
+        fc.set_scalar(3, &total);
+    }
+    ~Call() { y.free(); }
+};
+
+static void test_hit_and_miss() {
+    ir::Function f = make_fn(true);
+    ir::MemoCache cache;
+    ASSERT(cache.init().is_ok(), "init succeeds");
+    ASSERT(cache.init().code == StatusCode::INVALID_STATE, "second init is rejected");
+
+    Tensor x = ramp(1000, 1.0f);
+    runs = 0;
+    bool hit = true;
+    Call a(f, &x, 2.0f);
+    ASSERT(cache.call(f, &a.fc, &hit).is_ok() && !hit && runs == 1, "first call misses and runs");
+
+    Call b(f, &x, 2.0f);
+    ASSERT(cache.call(f, &b.fc, &hit).is_ok() && hit && runs == 1, "identical call hits without running");
+    ASSERT(b.total.value.f64 == a.total.value.f64, "cached scalar output matches");
+    ASSERT(std::memcmp(a.y.data, b.y.data, a.y.nbytes()) == 0, "cached tensor output matches");
+
+    Call c(f, &x, 2.0f);
+    (void)cache.call(f, &c.fc, &hit);
+    ASSERT(hit && c.y.data == b.y.data && c.y.is_shared(), "hits return shared views of one buffer");
+
+    Tensor x2 = ramp(1000, 1.0f);
+    Call d(f, &x2, 2.0f);
+    (void)cache.call(f, &d.fc, &hit);
+    ASSERT(hit, "equal content in a different buffer hits");
+
+    static_cast<float*>(x2.data)[999] += 1.0f;
+    Call e(f, &x2, 2.0f);
+    (void)cache.call(f, &e.fc, &hit);
+    ASSERT(!hit && runs == 2, "one changed element misses");
+
+    Call g(f, &x, 3.0f);
+    (void)cache.call(f, &g.fc, &hit);
+    ASSERT(!hit && runs == 3, "a different scalar misses");
+
+    int64_t shape2[2] = {10, 100};
+    Tensor x3 = Tensor::wrap(x.data, shape2, 2, DType::F32);
+    Call h(f, &x3, 2.0f);
+    (void)cache.call(f, &h.fc, &hit);
+    ASSERT(!hit && runs == 4, "same bytes with another shape misses");
+
+    ir::Function f2 = make_fn(true);
+    f2.signature.name = "scale_sum_v2";
+    Call k(f2, &x, 2.0f);
+    (void)cache.call(f2, &k.fc, &hit);
+    ASSERT(!hit && runs == 5, "another signature misses");
+
+    ir::MemoStats st = cache.stats();
+    ASSERT(st.hits == 3 && st.misses == 5 && st.entries == 5 && st.collisions == 0, "stats count hits and misses");
+
+    // COW: the caller writes its own copy, the cached result is untouched
+    ASSERT(c.y.make_writable().is_ok() && c.y.data != b.y.data, "make_writable detaches a hit");
+    static_cast<float*>(c.y.data)[0] = -1.0f;
+    Call m(f, &x, 2.0f);
+    (void)cache.call(f, &m.fc, &hit);
+    ASSERT(hit && static_cast<float*>(m.y.data)[0] == 2.0f, "writes through make_writable do not reach the cache");
+
+    // Reusing a shared hit as the output of a miss must not overwrite the cache
+    Scalar s4(4.0f), total;
+    ir::FunctionCall fc(&f.signature);
+    fc.set_tensor(0, &x);
+    fc.set_scalar(1, &s4);
+    fc.set_tensor(2, &m.y);
+    fc.set_scalar(3, &total);
+    (void)cache.call(f, &fc, &hit);
+    Call n(f, &x, 2.0f);
+    (void)cache.call(f, &n.fc, &hit);
+    ASSERT(hit && static_cast<float*>(m.y.data)[0] == 4.0f && static_cast<float*>(n.y.data)[0] == 2.0f,
+           "a miss into a shared output slot copies first");
+
+    x.free();
+    x2.free();
+}
+
+static void test_output_slots() {
+    ir::Function f = make_fn(true);
+    ir::MemoCache cache;
+    (void)cache.init();
+    Tensor x = ramp(64, 0.5f);
+    Call a(f, &x, 2.0f);
+    (void)cache.call(f, &a.fc, nullptr);
+
+    // Plain caller buffer receives a copy
+    int64_t shape[1] = {64};
+    Tensor buf = Tensor::alloc(shape, 1, DType::F32);
+    Scalar s(2.0f), total;
+    ir::FunctionCall fc(&f.signature);
+    fc.set_tensor(0, &x);
+    fc.set_scalar(1, &s);
+    fc.set_tensor(2, &buf);
+    fc.set_scalar(3, &total);
+    bool hit = false;
+    Status st = cache.call(f, &fc, &hit);
+    ASSERT(st.is_ok() && hit && buf.data != a.y.data &&
+           std::memcmp(buf.data, a.y.data, buf.nbytes()) == 0, "plain output buffer receives a copy");
+
+    int64_t bad_shape[1] = {32};
+    Tensor bad = Tensor::alloc(bad_shape, 1, DType::F32);
+    fc.set_tensor(2, &bad);
+    total = Scalar(0.0);
+    st = cache.call(f, &fc, &hit);
+    ASSERT(st.code == StatusCode::TYPE_MISMATCH && total.value.f64 == 0.0,
+           "mismatched output buffer is rejected before any slot is written");
+
+    fc.set_tensor(2, nullptr);
+    ASSERT(cache.call(f, &fc, &hit).code == StatusCode::INVALID_ARGUMENT, "missing output is rejected");
+
+    ir::MemoCache cold;
+    ASSERT(cold.call(f, &a.fc, &hit).code == StatusCode::INVALID_STATE, "uninitialized cache is rejected");
+
+    buf.free();
+    bad.free();
+    x.free();
+}
+
+static void test_uncacheable() {
+    ir::Function f = make_fn(false);
+    ir::MemoCache cache;
+    (void)cache.init();
+    Tensor x = ramp(16, 1.0f);
+    runs = 0;
+    bool hit = true;
+    for (int i = 0; i < 3; ++i) {
+        Call a(f, &x, 2.0f);
+        (void)cache.call(f, &a.fc, &hit);
+    }
+    ASSERT(!hit && runs == 3 && cache.stats().uncacheable == 3 && cache.stats().entries == 0,
+           "impure functions always run");
+
+    ir::Function p = make_fn(true);
+    int64_t shape[1] = {8};
+    int64_t strides[1] = {8};
+    Tensor strided = Tensor::view(x.data, shape, strides, 1, DType::F32);
+    Call b(p, &strided, 2.0f);
+    (void)cache.call(p, &b.fc, &hit);
+    ASSERT(!hit && runs == 4 && cache.stats().uncacheable == 4, "strided inputs run uncached");
+    x.free();
+}
+
+static void test_eviction() {
+    ir::Function f = make_fn(true);
+    Tensor xa = ramp(1024, 1.0f), xb = ramp(1024, 2.0f), xc = ramp(1024, 3.0f);
+    ir::MemoOptions opt;
+    opt.memory_budget = 2 * (2 * 4096 + 4096);  // about two entries of 4 KiB output + 4 KiB inputs
+    ir::MemoCache cache;
+    (void)cache.init(opt);
+
+    bool hit = false;
+    auto run = [&](Tensor& x) {
+        Call c(f, &x, 1.0f);
+        (void)cache.call(f, &c.fc, &hit);
+        return hit;
+    };
+    run(xa);
+    run(xb);
+    ASSERT(run(xa), "A hits before eviction");
+    run(xc);  // evicts B, the least recently used
+    ir::MemoStats st = cache.stats();
+    ASSERT(st.evictions == 1 && st.entries == 2 && st.bytes <= opt.memory_budget, "budget evicts one entry");
+    ASSERT(run(xa) && run(xc), "recently used entries survive");
+    ASSERT(!run(xb), "least recently used entry was evicted");
+
+    ir::MemoOptions few;
+    few.max_entries = 2;
+    ir::MemoCache small;
+    (void)small.init(few);
+    hit = false;
+    for (Tensor* x : {&xa, &xb, &xc}) {
+        Call c(f, x, 1.0f);
+        (void)small.call(f, &c.fc, &hit);
+    }
+    st = small.stats();
+    ASSERT(st.entries == 2 && st.evictions == 1, "entry limit evicts");
+
+    few.max_entries = 0;
+    ir::MemoCache bad;
+    ASSERT(bad.init(few).code == StatusCode::INVALID_ARGUMENT, "zero max_entries is rejected");
+
+    ir::MemoOptions tiny;
+    tiny.memory_budget = 1024;
+    ir::MemoCache none;
+    (void)none.init(tiny);
+    run(xa);
+    Call c(f, &xa, 1.0f);
+    (void)none.call(f, &c.fc, &hit);
+    ASSERT(!hit && none.stats().entries == 0, "results larger than the budget are not stored");
+
+    // Views handed out before clear() stay valid
+    Call keep(f, &xa, 1.0f);
+    (void)cache.call(f, &keep.fc, &hit);
+    cache.clear();
+    ASSERT(cache.stats().entries == 0 && cache.stats().bytes == 0 &&
+           static_cast<float*>(keep.y.data)[5] == 6.0f, "clear drops entries, outstanding views survive");
+
+    xa.free();
+    xb.free();
+    xc.free();
+}
+
+static void test_threads() {
+    ir::Function f = make_fn(true);
+    ir::MemoOptions opt;
+    opt.max_entries = 4;
+    ir::MemoCache cache;
+    (void)cache.init(opt);
+    Tensor xs[6];
+    for (int i = 0; i < 6; ++i) xs[i] = ramp(256, static_cast<float>(i));
+
+    std::atomic<int> wrong{0};
+    std::thread th[4];
+    for (int t = 0; t < 4; ++t) {
+        th[t] = std::thread([&, t] {
+            for (int i = 0; i < 500; ++i) {
+                int k = (i * 7 + t) % 6;
+                Call c(f, &xs[k], 2.0f);
+                if (cache.call(f, &c.fc, nullptr).is_error() ||
+                    static_cast<float*>(c.y.data)[255] != 2.0f * (static_cast<float>(k) + 255.0f))
+                    wrong.fetch_add(1);
+            }
+        });
+    }
+    for (auto& t : th) t.join();
+    ir::MemoStats st = cache.stats();
+    ASSERT(wrong == 0 && st.hits + st.misses == 2000 && st.entries <= 4, "concurrent calls stay correct");
+    for (auto& x : xs) x.free();
+}
+
+static void test_timing() {
+    int64_t n = int64_t{64} << 20;
+    auto* buf = static_cast<uint8_t*>(mem_alloc(static_cast<size_t>(n), 64, Device::CPU));
+    std::memset(buf, 0x5a, static_cast<size_t>(n));
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t h = kernels::hash_bytes(buf, n, 0);
+    double dt = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("INFO: content hash of 64 MiB: %.0f MiB/s (h=%016llx)\n", 64.0 / dt,
+                static_cast<unsigned long long>(h));
+    mem_free(buf, Device::CPU);
+}
+
+int main() {
+    std::printf("=== Spec 024 — Memoization Cache ===\n");
+
+    test_hit_and_miss();
+    test_output_slots();
+    test_uncacheable();
+    test_eviction();
+    test_threads();
+    test_timing();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
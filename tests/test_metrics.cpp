@@ -0,0 +1,249 @@
+/**
+ * @file test_metrics.cpp
+ * @brief Acceptance tests for spec 011 — metrics registry.
+ *
+ * Tests derived from docs/specs/011-metrics-registry.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <thread>
+
+using namespace zero;
+using namespace zero::telemetry;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static const char* kMetricsPath = "zero_metrics_test.prom";
+
+static void test_registration() {
+    std::printf("\n--- registration ---\n");
+    static MetricsRegistry reg;
+    Counter a, b;
+    ASSERT(reg.counter("zero_ops_total", "Ops executed", &a, "op=\"add\"").is_ok(), "counter registered");
+    ASSERT(reg.counter("zero_ops_total", "Ops executed", &b, "op=\"add\"").is_ok() && a.cell == b.cell,
+           "same name and labels return the same counter");
+    Counter c;
+    ASSERT(reg.counter("zero_ops_total", "Ops executed", &c, "op=\"mul\"").is_ok() && c.cell != a.cell,
+           "new labels make a new series");
+    Gauge g;
+    ASSERT(reg.gauge("zero_ops_total", "", &g).code == StatusCode::TYPE_MISMATCH,
+           "family kind mismatch rejected");
+    ASSERT(reg.counter("9bad", "", &a).code == StatusCode::INVALID_ARGUMENT, "invalid name rejected");
+    ASSERT(reg.counter("bad-name", "", &a).code == StatusCode::INVALID_ARGUMENT, "dash in name rejected");
+    ASSERT(reg.counter("ok", "", &a, "x=\"}\"").code == StatusCode::INVALID_ARGUMENT,
+           "brace in labels rejected");
+    ASSERT(reg.size() == 2, "only valid series registered");
+
+    static MetricsRegistry full;
+    char name[32];
+    bool ok = true;
+    for (int32_t i = 0; i < METRICS_MAX; ++i) {
+        std::snprintf(name, sizeof(name), "m%d", i);
+        ok = ok && full.counter(name, "", &a).is_ok();
+    }
+    ASSERT(ok && full.counter("overflow", "", &a).code == StatusCode::OUT_OF_BOUNDS,
+           "registry full reported");
+}
+
+static void test_exposition_text() {
+    std::printf("\n--- Prometheus exposition text ---\n");
+    static MetricsRegistry reg;
+    Counter add_ops, mul_ops, bytes;
+    Gauge depth;
+    ASSERT(reg.counter("zero_ops_total", "Ops executed", &add_ops, "op=\"add\"").is_ok(), "add series");
+    ASSERT(reg.gauge("zero_queue_depth", "Requests waiting", &depth).is_ok(), "gauge");
+    char labels[64];
+    std::snprintf(labels, sizeof(labels), "op=\"%s\"", ir::op_kind_name(ir::OpKind::MATMUL));
+    ASSERT(reg.counter("zero_ops_total", "Ops executed", &mul_ops, labels).is_ok(), "matmul series");
+    ASSERT(reg.counter("zero_bytes_moved_total", "", &bytes).is_ok(), "unlabelled counter");
+
+    add_ops.add();
+    add_ops.add(2);
+    mul_ops.add(5);
+    bytes.add(4096);
+    depth.set(7);
+    depth.add(-3);
+
+    const char* expect =
+        "# HELP zero_ops_total Ops executed\n"
+        "# TYPE zero_ops_total counter\n"
+        "zero_ops_total{op=\"add\"} 3\n"
+        "zero_ops_total{op=\"matmul\"} 5\n"
+        "# HELP zero_queue_depth Requests waiting\n"
+        "# TYPE zero_queue_depth gauge\n"
+        "zero_queue_depth 4\n"
+        "# TYPE zero_bytes_moved_total counter\n"
+        "zero_bytes_moved_total 4096\n";
+    char buf[1024];
+    size_t n = reg.render(buf, sizeof(buf));
+    ASSERT(n == std::strlen(expect) && std::strcmp(buf, expect) == 0,
+           "families grouped in registration order");
+    if (std::strcmp(buf, expect) != 0) std::printf("%s", buf);
+
+    ASSERT(reg.render(nullptr, 0) == n, "render(nullptr, 0) sizes the text");
+    char small[16];
+    ASSERT(reg.render(small, sizeof(small)) == n && std::strlen(small) == sizeof(small) - 1 &&
+           std::strncmp(small, expect, sizeof(small) - 1) == 0, "short buffer truncated, NUL-terminated");
+
+    ASSERT(reg.write(kMetricsPath).is_ok(), "write ok");
+    char file_buf[1024] = {};
+    std::FILE* f = std::fopen(kMetricsPath, "r");
+    size_t got = f != nullptr ? std::fread(file_buf, 1, sizeof(file_buf) - 1, f) : 0;
+    if (f != nullptr) std::fclose(f);
+    ASSERT(got == n && std::strcmp(file_buf, expect) == 0, "file holds the same text");
+    std::remove(kMetricsPath);
+    ASSERT(reg.write("does/not/exist/metrics.prom").is_error(), "unwritable path rejected");
+
+    reg.reset();
+    ASSERT(reg.value(0) == 0 && reg.value(1) == 0 && reg.size() == 4, "reset zeroes values, keeps series");
+}
+
+static void test_concurrent_increments() {
+    std::printf("\n--- sharded increments from many threads ---\n");
+    static MetricsRegistry reg;
+    Counter c;
+    ASSERT(reg.counter("zero_flops_total", "", &c).is_ok(), "registered");
+    constexpr int kThreads = 8;
+    constexpr int64_t kIters = 200000;
+    std::thread pool[kThreads];
+    for (auto& t : pool) {
+        t = std::thread([c] {
+            for (int64_t i = 0; i < kIters; ++i) c.add();
+        });
+    }
+    for (auto& t : pool) t.join();
+    ASSERT(reg.value(0) == kThreads * kIters, "no increment lost");
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < 10000000; ++i) c.add();
+    auto t1 = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / 1e7;
+    std::printf("INFO: Counter::add %.2f ns/op (single thread)\n", ns);
+    ASSERT(reg.value(0) == kThreads * kIters + 10000000, "single-thread increments counted");
+}
+
+// Value of the runtime series name{labels} in metrics(); 0 before it is registered.
+static int64_t runtime_value(const char* name, const char* labels) {
+    MetricsRegistry& reg = metrics();
+    for (int32_t i = 0; i < reg.size(); ++i) {
+        if (std::strcmp(reg.desc(i).name, name) == 0 && std::strcmp(reg.desc(i).labels, labels) == 0)
+            return reg.value(i);
+    }
+    return 0;
+}
+
+static Status copy_step(const Tensor& batch_in, Tensor& batch_out, void*) noexcept {
+    std::memcpy(batch_out.data, batch_in.data, batch_out.nbytes());
+    return status::OK;
+}
+
+static void test_runtime_instrumentation() {
+    std::printf("\n--- runtime instrumentation moves the counters ---\n");
+    int64_t shape[] = {4, 8};
+    int64_t ok_allocs = runtime_value("zero_alloc_total", "result=\"ok\"");
+    int64_t alloc_bytes = runtime_value("zero_alloc_bytes_total", "");
+    Tensor a = Tensor::alloc(shape, 2, DType::F32);
+    Tensor b = Tensor::alloc(shape, 2, DType::F32);
+    Tensor out = Tensor::alloc(shape, 2, DType::F32);
+    ASSERT(runtime_value("zero_alloc_total", "result=\"ok\"") == ok_allocs + 3, "mem_alloc calls counted");
+    ASSERT(runtime_value("zero_alloc_bytes_total", "") >= alloc_bytes + 3 * static_cast<int64_t>(a.nbytes()),
+           "mem_alloc bytes counted");
+
+    int64_t adds = runtime_value("zero_ops_total", "op=\"add\"");
+    int64_t add_bytes = runtime_value("zero_op_bytes_total", "op=\"add\"");
+    int64_t add_flops = runtime_value("zero_op_flops_total", "op=\"add\"");
+    ASSERT(ops::add(a, b, out).is_ok() && ops::add(a, b, out).is_ok(), "add ok");
+    ASSERT(runtime_value("zero_ops_total", "op=\"add\"") == adds + 2, "add calls counted");
+    ASSERT(runtime_value("zero_op_bytes_total", "op=\"add\"") ==
+               add_bytes + 2 * 3 * static_cast<int64_t>(a.nbytes()),
+           "add bytes = inputs + output per call");
+    ASSERT(runtime_value("zero_op_flops_total", "op=\"add\"") == add_flops + 2 * a.numel(),
+           "add flops = one per element");
+
+    int64_t w_shape[] = {8, 3};
+    int64_t c_shape[] = {4, 3};
+    Tensor w = Tensor::alloc(w_shape, 2, DType::F32);
+    Tensor c = Tensor::alloc(c_shape, 2, DType::F32);
+    int64_t matmul_flops = runtime_value("zero_op_flops_total", "op=\"matmul\"");
+    ASSERT(ops::matmul(a, w, c).is_ok(), "matmul ok");
+    ASSERT(runtime_value("zero_op_flops_total", "op=\"matmul\"") == matmul_flops + 2 * 4 * 3 * 8,
+           "matmul flops = 2MNK");
+
+    // MoE routing reports under its own kinds
+    int64_t pick_shape[] = {4, 2}, off_shape[] = {9};
+    Tensor ids = Tensor::alloc(pick_shape, 2, DType::I32);
+    Tensor gates = Tensor::alloc(pick_shape, 2, DType::F32);
+    Tensor offsets = Tensor::alloc(off_shape, 1, DType::I64);
+    std::memset(a.data, 0, a.nbytes());
+    int64_t gate_ops = runtime_value("zero_ops_total", "op=\"moe_gate\"");
+    int64_t route_ops = runtime_value("zero_ops_total", "op=\"moe_route\"");
+    ASSERT(ops::moe_gate_topk(a, ids, gates).is_ok() && ops::moe_expert_offsets(ids, 8, offsets).is_ok(),
+           "moe routing ok");
+    ASSERT(runtime_value("zero_ops_total", "op=\"moe_gate\"") == gate_ops + 1 &&
+               runtime_value("zero_ops_total", "op=\"moe_route\"") == route_ops + 1,
+           "moe gate and route calls counted");
+    ids.free();
+    gates.free();
+    offsets.free();
+
+    int64_t sample_shape[] = {8};
+    exec::Batcher batcher;
+    ASSERT(batcher.init(exec::BatcherConfig{}, TensorMeta(1, sample_shape, DType::F32),
+                        TensorMeta(1, sample_shape, DType::F32), copy_step, nullptr).is_ok(), "batcher init");
+    int64_t row[] = {1, 8};
+    exec::BatchRequest req;
+    req.input = Tensor::alloc(row, 2, DType::F32);
+    req.output = Tensor::alloc(row, 2, DType::F32);
+    std::memset(req.input.data, 0, req.input.nbytes());
+    int64_t depth = runtime_value("zero_queue_depth", "queue=\"batcher\"");
+    ASSERT(batcher.submit(&req).is_ok(), "submit ok");
+    ASSERT(runtime_value("zero_queue_depth", "queue=\"batcher\"") == depth + 1, "queued request raises depth");
+    ASSERT(batcher.run_once() == 1 && req.done.wait().is_ok(), "batch served");
+    ASSERT(runtime_value("zero_queue_depth", "queue=\"batcher\"") == depth, "served request lowers depth");
+
+    int64_t idle = runtime_value("zero_idle_nanoseconds_total", "site=\"thread_pool\"");
+    exec::ThreadPool pool;
+    ASSERT(pool.start(2).is_ok(), "pool started");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::atomic<int64_t> sum{0};
+    ASSERT(pool.parallel_for(64, [&](int64_t) { sum.fetch_add(1, std::memory_order_relaxed); }).is_ok() && sum.load() == 64, "parallel_for ran");
+    pool.stop();
+    ASSERT(runtime_value("zero_idle_nanoseconds_total", "site=\"thread_pool\"") >= idle + 10000000,
+           "parked worker time counted as idle");
+
+    req.input.free();
+    req.output.free();
+    a.free();
+    b.free();
+    out.free();
+    w.free();
+    c.free();
+}
+
+int main() {
+    std::printf("=== Spec 011 — Metrics registry ===\n");
+
+    test_registration();
+    test_exposition_text();
+    test_concurrent_increments();
+    ASSERT(&metrics() == &metrics(), "metrics() is one process-wide registry");
+    test_runtime_instrumentation();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,241 @@
+/**
+ * @file test_moe.cpp
+ * @brief Acceptance tests for spec 018 — MoE token routing.
+ *
+ * Tests derived from docs/specs/018-moe-routing.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static uint32_t rng_state = 7u;
+
+static Tensor random_f32(int64_t rows, int64_t cols) {
+    int64_t shape[2] = {rows, cols};
+    Tensor t = Tensor::alloc(shape, 2, DType::F32);
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) {
+        rng_state = rng_state * 1103515245u + 12345u;
+        p[i] = static_cast<float>((rng_state >> 8) % 2001) / 500.0f - 2.0f;
+    }
+    return t;
+}
+
+static Tensor alloc2(int64_t rows, int64_t cols, DType dtype) {
+    int64_t shape[2] = {rows, cols};
+    return Tensor::alloc(shape, 2, dtype);
+}
+
+static Tensor alloc1(int64_t n, DType dtype) {
+    int64_t shape[1] = {n};
+    return Tensor::alloc(shape, 1, dtype);
+}
+
+static void test_gating() {
+    std::printf("\n--- top-k gating ---\n");
+    const int64_t T = 200, E = 16, k = 2;
+    Tensor logits = random_f32(T, E);
+    float* lg = static_cast<float*>(logits.data);
+    for (int64_t e = 0; e < E; ++e) lg[e] = 1.0f;   // token 0: all tied
+    Tensor ids = alloc2(T, k, DType::I32), gates = alloc2(T, k, DType::F32);
+    Tensor raw_ids = alloc2(T, k, DType::I32), raw = alloc2(T, k, DType::F32);
+    exec::ThreadPool pool;
+    (void)pool.start(3);
+    ASSERT(ops::moe_gate_topk(logits, ids, gates, true, &pool).is_ok(), "gating runs on a pool");
+    ASSERT(ops::moe_gate_topk(logits, raw_ids, raw, false).is_ok(), "gating runs inline");
+
+    const int32_t* id = static_cast<const int32_t*>(ids.data);
+    const float* g = static_cast<const float*>(gates.data);
+    const float* p = static_cast<const float*>(raw.data);
+    bool order = true, probs = true, renorm = true;
+    for (int64_t t = 0; t < T; ++t) {
+        const float* row = lg + t * E;
+        double mx = row[0], denom = 0.0;
+        for (int64_t e = 1; e < E; ++e) mx = row[e] > mx ? row[e] : mx;
+        for (int64_t e = 0; e < E; ++e) denom += std::exp(row[e] - mx);
+        // Reference: repeatedly take the largest unused logit, lowest id on ties.
+        bool used[E] = {};
+        for (int64_t s = 0; s < k; ++s) {
+            int64_t best = -1;
+            for (int64_t e = 0; e < E; ++e)
+                if (!used[e] && (best < 0 || row[e] > row[best])) best = e;
+            used[best] = true;
+            order = order && id[t * k + s] == best &&
+                    static_cast<const int32_t*>(raw_ids.data)[t * k + s] == best;
+            probs = probs && std::fabs(p[t * k + s] - std::exp(row[best] - mx) / denom) < 1e-5;
+        }
+        float sum = 0.0f;
+        for (int64_t s = 0; s < k; ++s) sum += g[t * k + s];
+        renorm = renorm && std::fabs(sum - 1.0f) < 1e-5f;
+    }
+    ASSERT(order, "top-k ids match reference, highest first");
+    ASSERT(id[0] == 0 && id[1] == 1, "ties go to the lower expert id");
+    ASSERT(probs, "unnormalized gates are softmax probabilities");
+    ASSERT(renorm, "renormalized gates sum to 1");
+
+    Tensor wide = alloc2(T, 9, DType::I32), wide_g = alloc2(T, 9, DType::F32);
+    ASSERT(ops::moe_gate_topk(logits, wide, wide_g).code == StatusCode::INVALID_ARGUMENT, "k > MOE_MAX_TOPK rejected");
+    Tensor short_g = alloc2(T - 1, k, DType::F32);
+    ASSERT(ops::moe_gate_topk(logits, ids, short_g).code == StatusCode::INVALID_ARGUMENT, "shape mismatch rejected");
+
+    logits.free(); ids.free(); gates.free(); raw_ids.free(); raw.free();
+    wide.free(); wide_g.free(); short_g.free();
+}
+
+static void test_permute() {
+    std::printf("\n--- histogram, permute, unpermute ---\n");
+    const int64_t T = 333, E = 8, k = 2, D = 24;
+    Tensor logits = random_f32(T, E);
+    Tensor x = random_f32(T, D);
+    Tensor ids = alloc2(T, k, DType::I32), gates = alloc2(T, k, DType::F32);
+    (void)ops::moe_gate_topk(logits, ids, gates);
+    const int32_t* id = static_cast<const int32_t*>(ids.data);
+
+    int64_t ref_off[E + 1] = {};
+    for (int64_t i = 0; i < T * k; ++i) ++ref_off[id[i] + 1];
+    for (int64_t e = 0; e < E; ++e) ref_off[e + 1] += ref_off[e];
+
+    Tensor off0 = alloc1(E + 1, DType::I64), rows0 = alloc2(T, k, DType::I32), xp0 = alloc2(T * k, D, DType::F32);
+    ASSERT(ops::moe_permute(x, ids, E, xp0, off0, rows0).is_ok(), "permute runs inline");
+    ASSERT(std::memcmp(off0.data, ref_off, sizeof(ref_off)) == 0, "offsets match the reference histogram");
+
+    const int32_t* rows = static_cast<const int32_t*>(rows0.data);
+    const float* xp = static_cast<const float*>(xp0.data);
+    bool placed = true, ordered = true;
+    int32_t last[E];
+    for (int64_t e = 0; e < E; ++e) last[e] = -1;
+    for (int64_t t = 0; t < T; ++t) {
+        for (int64_t s = 0; s < k; ++s) {
+            int32_t r = rows[t * k + s], e = id[t * k + s];
+            placed = placed && r >= ref_off[e] && r < ref_off[e + 1] &&
+                     std::memcmp(xp + r * D, static_cast<const float*>(x.data) + t * D, D * sizeof(float)) == 0;
+            ordered = ordered && r > last[e];
+            last[e] = r;
+        }
+    }
+    ASSERT(placed, "every (token, slot) row lands in its expert's slice");
+    ASSERT(ordered, "rows keep token order within an expert");
+
+    for (int32_t threads = 1; threads <= 4; ++threads) {
+        exec::ThreadPool pool;
+        (void)pool.start(threads);
+        Tensor off = alloc1(E + 1, DType::I64), rws = alloc2(T, k, DType::I32), xpp = alloc2(T * k, D, DType::F32);
+        Tensor hist = alloc1(E + 1, DType::I64);
+        bool same = ops::moe_permute(x, ids, E, xpp, off, rws, &pool).is_ok() &&
+                    ops::moe_expert_offsets(ids, E, hist, &pool).is_ok() &&
+                    std::memcmp(off.data, off0.data, off0.nbytes()) == 0 &&
+                    std::memcmp(hist.data, off0.data, off0.nbytes()) == 0 &&
+                    std::memcmp(rws.data, rows0.data, rows0.nbytes()) == 0 &&
+                    std::memcmp(xpp.data, xp0.data, xp0.nbytes()) == 0;
+        char msg[96];
+        std::snprintf(msg, sizeof(msg), "identical layout with a pool of %d", threads);
+        ASSERT(same, msg);
+        off.free(); rws.free(); xpp.free(); hist.free();
+    }
+
+    // Expert e scales its rows by (e + 1).
+    Tensor yp = xp0.clone();
+    float* ypp = static_cast<float*>(yp.data);
+    for (int64_t e = 0; e < E; ++e)
+        for (int64_t r = ref_off[e]; r < ref_off[e + 1]; ++r)
+            for (int64_t j = 0; j < D; ++j) ypp[r * D + j] *= static_cast<float>(e + 1);
+    Tensor y = alloc2(T, D, DType::F32), y_id = alloc2(T, D, DType::F32);
+    exec::ThreadPool pool;
+    (void)pool.start(3);
+    ASSERT(ops::moe_unpermute(yp, rows0, gates, y, &pool).is_ok(), "unpermute runs");
+    ASSERT(ops::moe_unpermute(xp0, rows0, gates, y_id).is_ok(), "unpermute of identity experts runs");
+    const float* g = static_cast<const float*>(gates.data);
+    const float* xs = static_cast<const float*>(x.data);
+    double err = 0.0, err_id = 0.0;
+    for (int64_t t = 0; t < T; ++t) {
+        for (int64_t j = 0; j < D; ++j) {
+            double want = 0.0;
+            for (int64_t s = 0; s < k; ++s) want += g[t * k + s] * (id[t * k + s] + 1) * xs[t * D + j];
+            err = std::fmax(err, std::fabs(want - static_cast<float*>(y.data)[t * D + j]));
+            err_id = std::fmax(err_id, std::fabs(xs[t * D + j] - static_cast<float*>(y_id.data)[t * D + j]));
+        }
+    }
+    ASSERT(err < 1e-4, "unpermute combines expert outputs by gate weight");
+    ASSERT(err_id < 1e-5, "identity experts round-trip x");
+
+    std::printf("\n--- validation ---\n");
+    static_cast<int32_t*>(ids.data)[5] = E;
+    ASSERT(ops::moe_permute(x, ids, E, xp0, off0, rows0).code == StatusCode::OUT_OF_BOUNDS, "expert id out of range rejected");
+    ASSERT(ops::moe_expert_offsets(ids, E, off0).code == StatusCode::OUT_OF_BOUNDS, "histogram rejects bad id");
+    static_cast<int32_t*>(ids.data)[5] = 0;
+    Tensor small = alloc2(T, D, DType::F32);
+    ASSERT(ops::moe_permute(x, ids, E, small, off0, rows0).code == StatusCode::INVALID_ARGUMENT, "undersized buffer rejected");
+    ASSERT(ops::moe_expert_offsets(ids, 0, off0).code == StatusCode::INVALID_ARGUMENT, "zero experts rejected");
+
+    logits.free(); x.free(); ids.free(); gates.free(); off0.free(); rows0.free(); xp0.free();
+    yp.free(); y.free(); y_id.free(); small.free();
+}
+
+static void test_timing() {
+    std::printf("\n--- routing vs expert compute (informational) ---\n");
+    const int32_t E = 16;
+    const int64_t T = 2048, k = 2, D = 256, H = 256;
+    Tensor logits = random_f32(T, E), x = random_f32(T, D);
+    Tensor ids = alloc2(T, k, DType::I32), gates = alloc2(T, k, DType::F32);
+    Tensor off = alloc1(E + 1, DType::I64), rows = alloc2(T, k, DType::I32);
+    Tensor xp = alloc2(T * k, D, DType::F32), yp = alloc2(T * k, H, DType::F32), y = alloc2(T, H, DType::F32);
+    Tensor w[E];
+    for (int32_t e = 0; e < E; ++e) w[e] = random_f32(D, H);
+    int32_t hw = static_cast<int32_t>(std::thread::hardware_concurrency());
+    exec::ThreadPool pool;
+    (void)pool.start(hw > 0 ? (hw < exec::POOL_MAX_THREADS ? hw : exec::POOL_MAX_THREADS) : 1);
+
+    auto t0 = std::chrono::steady_clock::now();
+    (void)ops::moe_gate_topk(logits, ids, gates, true, &pool);
+    (void)ops::moe_permute(x, ids, E, xp, off, rows, &pool);
+    auto t1 = std::chrono::steady_clock::now();
+    const int64_t* o = static_cast<const int64_t*>(off.data);
+    ops::GemmGroup groups[E];
+    for (int32_t e = 0; e < E; ++e) {
+        int64_t a_shape[2] = {o[e + 1] - o[e], D}, c_shape[2] = {o[e + 1] - o[e], H};
+        groups[e].A = Tensor::wrap(static_cast<float*>(xp.data) + o[e] * D, a_shape, 2, DType::F32);
+        groups[e].B = w[e];
+        groups[e].C = Tensor::wrap(static_cast<float*>(yp.data) + o[e] * H, c_shape, 2, DType::F32);
+    }
+    Status s = ops::grouped_gemm(groups, E, &pool);
+    auto t2 = std::chrono::steady_clock::now();
+    (void)ops::moe_unpermute(yp, rows, gates, y, &pool);
+    auto t3 = std::chrono::steady_clock::now();
+    ASSERT(s.is_ok(), "expert slices feed grouped_gemm");
+    auto us = [](auto a, auto b) { return std::chrono::duration<double, std::micro>(b - a).count(); };
+    std::printf("INFO: T=%lld E=%d k=%lld: gate+permute %.1f us, experts %.1f us, unpermute %.1f us\n",
+                static_cast<long long>(T), E, static_cast<long long>(k), us(t0, t1), us(t1, t2), us(t2, t3));
+
+    for (int32_t e = 0; e < E; ++e) w[e].free();
+    logits.free(); x.free(); ids.free(); gates.free(); off.free(); rows.free(); xp.free(); yp.free(); y.free();
+}
+
+int main() {
+    std::printf("=== Spec 018 — MoE Routing ===\n");
+
+    test_gating();
+    test_permute();
+    test_timing();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
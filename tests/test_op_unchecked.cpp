@@ -0,0 +1,194 @@
+/**
+ * @file test_op_unchecked.cpp
+ * @brief Acceptance tests for spec 004 — unchecked op entry points.
+ *
+ * Tests derived from docs/specs/004-unchecked-op-entry-points.md §4.
+ *
+ * Every *_unchecked op must write bytes identical to its checked twin
+ * on well-formed inputs. Precondition failures abort in debug builds and
+ * are not exercised here (they would terminate the test binary).
+ */
+
+#include <zero/zero.hpp>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+using namespace zero;
+using namespace zero::ops;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static bool tensors_byte_equal(const Tensor& a, const Tensor& b) noexcept {
+    if (a.dtype != b.dtype || a.ndim != b.ndim) return false;
+    if (a.nbytes() != b.nbytes()) return false;
+    return std::memcmp(a.data, b.data, a.nbytes()) == 0;
+}
+
+static void fill_ramp(Tensor& t, float start, float step) noexcept {
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) p[i] = start + step * static_cast<float>(i);
+}
+
+static void test_elementwise() {
+    std::printf("\n--- elementwise ---\n");
+    int64_t shape[] = {2, 4};
+    Tensor a   = Tensor::alloc(shape, 2, DType::F32);
+    Tensor b   = Tensor::alloc(shape, 2, DType::F32);
+    Tensor chk = Tensor::alloc(shape, 2, DType::F32);
+    Tensor unc = Tensor::alloc(shape, 2, DType::F32);
+    fill_ramp(a, -2.0f, 0.5f);
+    fill_ramp(b, 0.25f, 0.75f);
+
+    const ElementwiseOp unary[] = {
+        ElementwiseOp::NEG, ElementwiseOp::ABS, ElementwiseOp::EXP,
+        ElementwiseOp::SIN, ElementwiseOp::COS, ElementwiseOp::TANH,
+        ElementwiseOp::RELU, ElementwiseOp::SIGMOID,
+    };
+    bool all_equal = true;
+    for (ElementwiseOp op : unary) {
+        if (!unary_op(a, chk, op).is_ok()) all_equal = false;
+        unary_op_unchecked(a, unc, op);
+        if (!tensors_byte_equal(chk, unc)) all_equal = false;
+    }
+    ASSERT(all_equal, "unary_op_unchecked == unary_op for every unary op");
+
+    const ElementwiseOp binary[] = {
+        ElementwiseOp::ADD, ElementwiseOp::SUB, ElementwiseOp::MUL, ElementwiseOp::DIV,
+    };
+    all_equal = true;
+    for (ElementwiseOp op : binary) {
+        if (!binary_op(a, b, chk, op).is_ok()) all_equal = false;
+        binary_op_unchecked(a, b, unc, op);
+        if (!tensors_byte_equal(chk, unc)) all_equal = false;
+    }
+    ASSERT(all_equal, "binary_op_unchecked == binary_op for every binary op");
+
+    // RHS scalar broadcast (b.numel() == 1) follows the same kernel path.
+    int64_t one[] = {1};
+    Tensor s1 = Tensor::alloc(one, 1, DType::F32);
+    static_cast<float*>(s1.data)[0] = 3.0f;
+    ASSERT(mul(a, s1, chk).is_ok(), "mul with broadcast scalar ok");
+    mul_unchecked(a, s1, unc);
+    ASSERT(tensors_byte_equal(chk, unc), "mul_unchecked broadcast == mul");
+
+    ASSERT(scalar_op(a, Scalar(1.5f), chk, ElementwiseOp::SUB).is_ok(), "scalar_op ok");
+    scalar_op_unchecked(a, Scalar(1.5f), unc, ElementwiseOp::SUB);
+    ASSERT(tensors_byte_equal(chk, unc), "scalar_op_unchecked == scalar_op");
+
+    ASSERT(relu(a, chk).is_ok(), "relu ok");
+    relu_unchecked(a, unc);
+    ASSERT(tensors_byte_equal(chk, unc), "relu_unchecked == relu");
+
+    ASSERT(add(a, b, chk).is_ok(), "add ok");
+    add_unchecked(a, b, unc);
+    ASSERT(tensors_byte_equal(chk, unc), "add_unchecked == add");
+
+    a.free(); b.free(); chk.free(); unc.free(); s1.free();
+}
+
+static void test_matmul() {
+    std::printf("\n--- matmul / gemm ---\n");
+    int64_t A_shape[] = {3, 4};
+    int64_t B_shape[] = {4, 5};
+    int64_t C_shape[] = {3, 5};
+    Tensor A   = Tensor::alloc(A_shape, 2, DType::F32);
+    Tensor B   = Tensor::alloc(B_shape, 2, DType::F32);
+    Tensor chk = Tensor::alloc(C_shape, 2, DType::F32);
+    Tensor unc = Tensor::alloc(C_shape, 2, DType::F32);
+    fill_ramp(A, -1.0f, 0.125f);
+    fill_ramp(B, 0.5f, -0.0625f);
+
+    ASSERT(matmul(A, B, chk).is_ok(), "matmul ok");
+    matmul_unchecked(A, B, unc);
+    ASSERT(tensors_byte_equal(chk, unc), "matmul_unchecked == matmul");
+
+    // beta != 0 reads C, so both outputs must start from the same bytes.
+    fill_ramp(chk, 1.0f, 1.0f);
+    fill_ramp(unc, 1.0f, 1.0f);
+    ASSERT(gemm(A, B, chk, 2.0f, 0.5f).is_ok(), "gemm alpha/beta ok");
+    gemm_unchecked(A, B, unc, 2.0f, 0.5f);
+    ASSERT(tensors_byte_equal(chk, unc), "gemm_unchecked alpha/beta == gemm");
+
+    A.free(); B.free(); chk.free(); unc.free();
+}
+
+static void test_reduce() {
+    std::printf("\n--- reduce ---\n");
+    int64_t in_shape[]  = {3, 7};
+    int64_t out_shape[] = {3};
+    Tensor in  = Tensor::alloc(in_shape, 2, DType::F32);
+    Tensor chk = Tensor::alloc(out_shape, 1, DType::F32);
+    Tensor unc = Tensor::alloc(out_shape, 1, DType::F32);
+    fill_ramp(in, 4.0f, -0.375f);
+
+    const ReduceOp ops_list[] = {
+        ReduceOp::SUM, ReduceOp::MAX, ReduceOp::MIN, ReduceOp::MEAN, ReduceOp::PROD,
+    };
+    bool all_equal = true;
+    for (ReduceOp op : ops_list) {
+        if (!reduce_last_axis(in, chk, op).is_ok()) all_equal = false;
+        reduce_last_axis_unchecked(in, unc, op);
+        if (!tensors_byte_equal(chk, unc)) all_equal = false;
+    }
+    ASSERT(all_equal, "reduce_last_axis_unchecked == reduce_last_axis for every op");
+
+    ASSERT(mean(in, chk).is_ok(), "mean ok");
+    mean_unchecked(in, unc);
+    ASSERT(tensors_byte_equal(chk, unc), "mean_unchecked == mean");
+
+    Tensor idx_chk = Tensor::alloc(out_shape, 1, DType::I64);
+    Tensor idx_unc = Tensor::alloc(out_shape, 1, DType::I64);
+    ASSERT(argmax(in, idx_chk).is_ok(), "argmax I64 ok");
+    argmax_unchecked(in, idx_unc);
+    ASSERT(tensors_byte_equal(idx_chk, idx_unc), "argmax_unchecked I64 == argmax");
+
+    Tensor i32_chk = Tensor::alloc(out_shape, 1, DType::I32);
+    Tensor i32_unc = Tensor::alloc(out_shape, 1, DType::I32);
+    ASSERT(argmax(in, i32_chk).is_ok(), "argmax I32 ok");
+    argmax_unchecked(in, i32_unc);
+    ASSERT(tensors_byte_equal(i32_chk, i32_unc), "argmax_unchecked I32 == argmax");
+
+    in.free(); chk.free(); unc.free();
+    idx_chk.free(); idx_unc.free(); i32_chk.free(); i32_unc.free();
+}
+
+static void test_checked_contract_unchanged() {
+    std::printf("\n--- checked API unchanged ---\n");
+    int64_t shape3[] = {3};
+    int64_t shape4[] = {4};
+    Tensor a   = Tensor::alloc(shape3, 1, DType::F32);
+    Tensor out = Tensor::alloc(shape4, 1, DType::F32);
+    fill_ramp(a, 0.0f, 1.0f);
+
+    Status s = relu(a, out);
+    ASSERT(s.code == StatusCode::INVALID_ARGUMENT, "checked relu still rejects shape mismatch");
+
+    Tensor empty = Tensor::empty();
+    s = relu(a, empty);
+    ASSERT(s.code == StatusCode::INVALID_STATE, "checked relu still rejects null data");
+
+    a.free(); out.free();
+}
+
+int main() {
+    std::printf("=== Spec 004 — Unchecked op entry points ===\n");
+
+    test_elementwise();
+    test_matmul();
+    test_reduce();
+    test_checked_contract_unchanged();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+/**
+ * @file test_pipeline.cpp
+ * @brief Acceptance tests for spec 008 — buffered pipeline stages.
+ *
+ * Tests derived from docs/specs/008-buffered-pipeline-stages.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <thread>
+
+using namespace zero;
+using namespace zero::exec;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+// Counts allocations so steady state can be checked for zero allocs.
+struct CountingAllocator : Allocator {
+    std::atomic<int64_t> allocs{0};
+    void* alloc(size_t size, size_t alignment, Device device) noexcept override {
+        allocs.fetch_add(1, std::memory_order_relaxed);
+        return SystemAllocator::instance()->alloc(size, alignment, device);
+    }
+    void free(void* ptr, Device device) noexcept override {
+        SystemAllocator::instance()->free(ptr, device);
+    }
+    const char* name() const noexcept override { return "counting"; }
+};
+
+static CountingAllocator g_alloc;
+
+constexpr int64_t kRow = 16;
+
+// Source: item k is a [4, kRow] batch filled with k; the last batch is short.
+struct Source {
+    int64_t count;
+    int64_t next = 0;
+    int64_t max_in_flight = 0;
+    TensorRing* ring = nullptr;
+    Status fail_at_status = status::OK;
+    int64_t fail_at = -1;
+};
+
+static Status source_fn(const Tensor*, Tensor& out, bool& end, void* user) noexcept {
+    Source* s = static_cast<Source*>(user);
+    if (s->ring != nullptr && s->ring->size() > s->max_in_flight) s->max_in_flight = s->ring->size();
+    if (s->next == s->count) {
+        end = true;
+        return status::OK;
+    }
+    if (s->next == s->fail_at) return status::invalid_state("read failed");
+    int64_t rows = (s->next == s->count - 1) ? 2 : 4;
+    out = out.slice(0, 0, rows);
+    float* p = static_cast<float*>(out.data);
+    for (int64_t i = 0; i < rows * kRow; ++i) p[i] = static_cast<float>(s->next);
+    s->next++;
+    return status::OK;
+}
+
+// Transform: out = in * 2 + 1, preserving the short batch extent.
+static Status normalize_fn(const Tensor* in, Tensor& out, bool&, void*) noexcept {
+    out = out.slice(0, 0, in->shape[0]);
+    return ops::scalar_op(*in, Scalar(2.0f), out, ops::ElementwiseOp::MUL).is_ok()
+               ? ops::scalar_op(out, Scalar(1.0f), out, ops::ElementwiseOp::ADD)
+               : status::invalid_state("normalize failed");
+}
+
+static void test_ring_basics() {
+    std::printf("\n--- ring: init, ordering, slot reuse ---\n");
+    TensorRing bad;
+    int64_t shape[] = {4, kRow};
+    ASSERT(bad.init(0, shape, 2, DType::F32).code == StatusCode::INVALID_ARGUMENT, "depth 0 rejected");
+
+    TensorRing r;
+    ASSERT(r.init(2, shape, 2, DType::F32).is_ok(), "init depth 2");
+    void* slot_data[2];
+    for (int i = 0; i < 2; ++i) {
+        Tensor* w = r.acquire_write();
+        slot_data[i] = w->data;
+        static_cast<float*>(w->data)[0] = static_cast<float>(i);
+        r.publish();
+    }
+    ASSERT(r.size() == 2 && slot_data[0] != slot_data[1], "two distinct slots in flight");
+    const Tensor* rd = r.acquire_read();
+    ASSERT(static_cast<const float*>(rd->data)[0] == 0.0f, "FIFO order");
+    r.release();
+    Tensor* w = r.acquire_write();
+    ASSERT(w->data == slot_data[0] && w->shape[0] == 4, "released slot reused at full size");
+    r.publish();
+    r.close();
+    int drained = 0;
+    while ((rd = r.acquire_read()) != nullptr) {
+        r.release();
+        ++drained;
+    }
+    ASSERT(drained == 2 && r.status().is_ok(), "close drains remaining slots, then nullptr");
+    ASSERT(r.acquire_write() == nullptr, "acquire_write after close returns nullptr");
+}
+
+static void test_three_stage_pipeline() {
+    std::printf("\n--- source -> normalize -> consumer, double-buffered ---\n");
+    int64_t shape[] = {4, kRow};
+    TensorRing raw, norm;
+    ASSERT(raw.init(2, shape, 2, DType::F32).is_ok() && norm.init(2, shape, 2, DType::F32).is_ok(),
+           "rings ok");
+
+    Source src{200};
+    src.ring = &raw;
+    PipelineStage read_stage, norm_stage;
+
+    set_allocator(&g_alloc);
+    g_alloc.allocs.store(0);
+    ASSERT(read_stage.start(nullptr, &raw, source_fn, &src).is_ok(), "source stage started");
+    ASSERT(norm_stage.start(&raw, &norm, normalize_fn, nullptr).is_ok(), "normalize stage started");
+
+    bool ok = true;
+    int64_t k = 0;
+    int64_t rows_seen = 0;
+    while (const Tensor* t = norm.acquire_read()) {
+        const float* p = static_cast<const float*>(t->data);
+        float expect = static_cast<float>(k) * 2.0f + 1.0f;
+        for (int64_t i = 0; i < t->shape[0] * kRow; ++i) ok = ok && p[i] == expect;
+        rows_seen += t->shape[0];
+        norm.release();
+        ++k;
+    }
+    read_stage.join();
+    norm_stage.join();
+    int64_t allocs = g_alloc.allocs.load();
+    set_allocator(SystemAllocator::instance());
+
+    ASSERT(ok && k == 200, "200 batches arrive in order with normalized values");
+    ASSERT(rows_seen == 199 * 4 + 2, "short final batch keeps its extent");
+    ASSERT(norm.status().is_ok(), "end of data closes with OK");
+    ASSERT(read_stage.items() == 200 && norm_stage.items() == 200, "stage item counts");
+    ASSERT(allocs == 0, "steady state performs no allocation");
+    ASSERT(src.max_in_flight <= 2, "producer never more than depth ahead");
+}
+
+static void test_backpressure() {
+    std::printf("\n--- slow consumer: producer blocks on a full ring ---\n");
+    int64_t shape[] = {4, kRow};
+    TensorRing raw;
+    ASSERT(raw.init(2, shape, 2, DType::F32).is_ok(), "ring ok");
+    Source src{12};
+    src.ring = &raw;
+    PipelineStage stage;
+    ASSERT(stage.start(nullptr, &raw, source_fn, &src).is_ok(), "started");
+    int64_t n = 0;
+    while (raw.acquire_read() != nullptr) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        ASSERT(raw.size() <= 2, "in-flight bounded by depth");
+        raw.release();
+        ++n;
+    }
+    stage.join();
+    ASSERT(n == 12, "all items consumed");
+    ASSERT(raw.producer_stalls() > 0, "producer stalled on backpressure");
+}
+
+static void test_error_and_cancel() {
+    std::printf("\n--- errors propagate downstream, cancel propagates upstream ---\n");
+    int64_t shape[] = {4, kRow};
+    {
+        TensorRing raw, norm;
+        ASSERT(raw.init(2, shape, 2, DType::F32).is_ok() && norm.init(2, shape, 2, DType::F32).is_ok(),
+               "rings ok");
+        Source src{50};
+        src.fail_at = 7;
+        PipelineStage a, b;
+        ASSERT(a.start(nullptr, &raw, source_fn, &src).is_ok() &&
+               b.start(&raw, &norm, normalize_fn, nullptr).is_ok(), "stages started");
+        int64_t n = 0;
+        while (norm.acquire_read() != nullptr) {
+            norm.release();
+            ++n;
+        }
+        a.join();
+        b.join();
+        ASSERT(n == 7, "items before the failure are delivered");
+        ASSERT(norm.status().code == StatusCode::INVALID_STATE, "source error reaches the consumer");
+    }
+    {
+        TensorRing raw, norm;
+        ASSERT(raw.init(2, shape, 2, DType::F32).is_ok() && norm.init(2, shape, 2, DType::F32).is_ok(),
+               "rings ok");
+        Source src{1000000};
+        PipelineStage a, b;
+        ASSERT(a.start(nullptr, &raw, source_fn, &src).is_ok() &&
+               b.start(&raw, &norm, normalize_fn, nullptr).is_ok(), "stages started");
+        for (int i = 0; i < 3; ++i) {
+            norm.acquire_read();
+            norm.release();
+        }
+        norm.close();
+        a.join();
+        b.join();
+        ASSERT(raw.closed() && src.next < 1000000, "consumer cancel stops every stage");
+    }
+}
+
+int main() {
+    std::printf("=== Spec 008 — Buffered pipeline stages ===\n");
+
+    test_ring_basics();
+    test_three_stage_pipeline();
+    test_backpressure();
+    test_error_and_cancel();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,223 @@
+/**
+ * @file test_profiler.cpp
+ * @brief Acceptance tests for spec 013 — sampling profiler.
+ *
+ * Tests derived from docs/specs/013-sampling-profiler.md §4.
+ * Built with ZERO_OP_PROFILE so the ops publish their OpKind.
+ */
+
+#include <zero/zero.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <time.h>
+
+using namespace zero;
+using namespace zero::telemetry;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static void test_scopes() {
+    std::printf("\n--- thread-local op slot and nested scopes ---\n");
+    ProfileSlot& s = profile_slot();
+    ASSERT(s.kind.load() == PROFILE_NO_OP && s.node.load() == PROFILE_NO_NODE, "slot starts empty");
+    {
+        ProfileScope node(ir::OpKind::CALL, 7);
+        ASSERT(s.kind.load() == static_cast<int32_t>(ir::OpKind::CALL) && s.node.load() == 7,
+               "scope publishes kind and node");
+        {
+            ProfileScope op(ir::OpKind::ADD);
+            ASSERT(s.kind.load() == static_cast<int32_t>(ir::OpKind::ADD) && s.node.load() == 7,
+                   "inner op scope keeps the node id");
+        }
+        ASSERT(s.kind.load() == static_cast<int32_t>(ir::OpKind::CALL), "inner scope restores kind");
+    }
+    ASSERT(s.kind.load() == PROFILE_NO_OP && s.node.load() == PROFILE_NO_NODE, "outer scope restores empty slot");
+
+    int32_t other_kind = -2;
+    std::thread t([&] { other_kind = profile_slot().kind.load(); });
+    {
+        ProfileScope op(ir::OpKind::MUL);
+        t.join();
+    }
+    ASSERT(other_kind == PROFILE_NO_OP, "slots are per thread");
+}
+
+#ifdef ZERO_HAS_SIGPROF
+
+static double thread_cpu_ms() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e3 + static_cast<double>(ts.tv_nsec) / 1e6;
+}
+
+// Burn CPU on this thread for ms milliseconds.
+static double spin(double ms) {
+    volatile double acc = 0.0;
+    double end = thread_cpu_ms() + ms;
+    while (thread_cpu_ms() < end) {
+        for (int i = 0; i < 1000; ++i) acc = acc + static_cast<double>(i) * 0.5;
+    }
+    return acc;
+}
+
+static void test_start_stop() {
+    std::printf("\n--- start / stop ---\n");
+    Profiler& p = profiler();
+    ASSERT(!std::is_default_constructible_v<Profiler> && !std::is_copy_constructible_v<Profiler>,
+           "profiler() is the only instance the SIGPROF handler reports to");
+    ASSERT(p.start(0).code == StatusCode::INVALID_ARGUMENT, "zero rate rejected");
+    ASSERT(p.start(PROFILE_MAX_HZ + 1).code == StatusCode::INVALID_ARGUMENT, "rate above max rejected");
+    ASSERT(p.start(1000).is_ok() && p.running() && p.hz() == 1000, "started at 1 kHz");
+    ASSERT(p.start(1000).code == StatusCode::INVALID_STATE, "second start rejected");
+    p.stop();
+    ASSERT(!p.running(), "stopped");
+    p.stop();  // idempotent
+}
+
+// Ratio checks need this many samples; a loaded host may deliver fewer.
+constexpr int64_t MIN_RATIO_SAMPLES = 100;
+
+static void test_attribution() {
+    std::printf("\n--- samples attribute to the published op and node ---\n");
+    Profiler& p = profiler();
+    p.reset();
+    ASSERT(p.start(1000).is_ok(), "started");
+    // Alternate 30 ms under EXP with 10 ms unattributed until enough samples
+    // arrive (or 5 s pass), so a descheduled run still sees both phases.
+    double exp_measured = 0.0;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    do {
+        double t0 = thread_cpu_ms();
+        {
+            ProfileScope op(ir::OpKind::EXP, 3);
+            spin(30.0);
+        }
+        exp_measured += thread_cpu_ms() - t0;
+        spin(10.0);
+    } while (p.samples() < MIN_RATIO_SAMPLES && std::chrono::steady_clock::now() < deadline);
+    p.stop();
+
+    // The kernel may deliver fewer than hz samples (one per scheduler tick at
+    // most), so bound the count by the measured CPU time rather than the rate.
+    int64_t exp_s = p.op_samples(ir::OpKind::EXP);
+    int64_t idle = p.idle_samples();
+    double cpu_ms = static_cast<double>(p.cpu_ns()) / 1e6;
+    std::printf("INFO: total=%lld exp=%lld idle=%lld\n", static_cast<long long>(p.samples()),
+                static_cast<long long>(exp_s), static_cast<long long>(idle));
+    ASSERT(p.samples() > 0 && static_cast<double>(p.samples()) <= cpu_ms * 1.1 + 5.0,
+           "samples arrive, never faster than 1 per ms of CPU");
+    ASSERT(p.node_samples(3) == exp_s && p.node_samples(4) == 0, "node table matches its op");
+    double exp_ms = static_cast<double>(p.op_cpu_ns(ir::OpKind::EXP)) / 1e6;
+    std::printf("INFO: exp cpu %.1f ms apportioned, %.1f ms measured, of %.1f ms sampled\n", exp_ms,
+                exp_measured, cpu_ms);
+    if (p.samples() >= MIN_RATIO_SAMPLES) {
+        ASSERT(exp_s > idle && idle > 0, "samples split by published op (~3:1)");
+        ASSERT(exp_ms > exp_measured - 0.25 * cpu_ms && exp_ms < exp_measured + 0.25 * cpu_ms,
+               "op CPU time apportioned from measured CPU (within 25% of the sampled span)");
+    } else {
+        std::printf("INFO: only %lld samples in 5 s (host busy), skipping ratio checks\n",
+                    static_cast<long long>(p.samples()));
+    }
+
+    ProfileNodeEntry entries[4];
+    ASSERT(p.nodes(entries, 4) == 1 && entries[0].node == 3 && entries[0].samples == exp_s,
+           "node listing");
+    char text[512];
+    size_t n = p.render(text, sizeof(text));
+    ASSERT(n < sizeof(text) && std::strstr(text, "exp") != nullptr && std::strstr(text, "(none)") != nullptr,
+           "render lists sampled ops");
+    std::printf("%s", text);
+}
+
+static void test_ops_publish() {
+    std::printf("\n--- ops publish their kind under the executor's node ---\n");
+    Profiler& p = profiler();
+    p.reset();
+    int64_t shape[] = {96, 96};
+    Tensor a = Tensor::alloc(shape, 2, DType::F32);
+    Tensor b = Tensor::alloc(shape, 2, DType::F32);
+    Tensor c = Tensor::alloc(shape, 2, DType::F32);
+    std::memset(a.data, 0, a.nbytes());
+    std::memset(b.data, 0, b.nbytes());
+    ASSERT(p.start(1000).is_ok(), "started");
+    {
+        ProfileScope node(ir::OpKind::CALL, 42);
+        double end = thread_cpu_ms() + 250.0;
+        while (thread_cpu_ms() < end) (void)ops::matmul(a, b, c);
+    }
+    p.stop();
+    int64_t mm = p.op_samples(ir::OpKind::MATMUL);
+    std::printf("INFO: matmul=%lld call=%lld node42=%lld\n", static_cast<long long>(mm),
+                static_cast<long long>(p.op_samples(ir::OpKind::CALL)), static_cast<long long>(p.node_samples(42)));
+    ASSERT(mm > 0 && mm >= p.op_samples(ir::OpKind::CALL), "matmul kernel time attributed to MATMUL");
+    ASSERT(p.node_samples(42) >= mm, "op samples land on the enclosing node");
+    a.free(); b.free(); c.free();
+}
+
+static void test_threads_and_overhead() {
+    std::printf("\n--- per-thread attribution; overhead ---\n");
+    Profiler& p = profiler();
+    p.reset();
+    ASSERT(p.start(1000).is_ok(), "started");
+    std::thread ta([] { ProfileScope op(ir::OpKind::ADD, 1); spin(150.0); });
+    std::thread tb([] { ProfileScope op(ir::OpKind::MUL, 2); spin(150.0); });
+    ta.join();
+    tb.join();
+    p.stop();
+    ASSERT(p.op_samples(ir::OpKind::ADD) > 0 && p.op_samples(ir::OpKind::MUL) > 0,
+           "each thread's samples use its own slot");
+    ASSERT(p.node_samples(1) == p.op_samples(ir::OpKind::ADD) && p.node_samples(2) == p.op_samples(ir::OpKind::MUL),
+           "nodes follow their threads");
+
+    // Fixed work with and without sampling (informational; noisy on shared hosts).
+    auto work = [] {
+        volatile double acc = 0.0;
+        for (int64_t i = 0; i < 60000000; ++i) acc = acc + 1e-9;
+        return acc;
+    };
+    double t0 = thread_cpu_ms();
+    work();
+    double base = thread_cpu_ms() - t0;
+    p.reset();
+    ASSERT(p.start(1000).is_ok(), "restarted");
+    t0 = thread_cpu_ms();
+    work();
+    double profiled = thread_cpu_ms() - t0;
+    p.stop();
+    std::printf("INFO: work %.1f ms, profiled %.1f ms (%+.2f%%), %lld samples\n", base, profiled,
+                100.0 * (profiled - base) / base, static_cast<long long>(p.samples()));
+}
+
+#endif
+
+int main() {
+    std::printf("=== Spec 013 — Sampling profiler ===\n");
+
+    test_scopes();
+#ifdef ZERO_HAS_SIGPROF
+    test_start_stop();
+    test_attribution();
+    test_ops_publish();
+    test_threads_and_overhead();
+#else
+    std::printf("INFO: no SIGPROF on this platform; start() returns NOT_IMPLEMENTED\n");
+    ASSERT(profiler().start(1000).code == StatusCode::NOT_IMPLEMENTED, "start reports NOT_IMPLEMENTED");
+#endif
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,300 @@
+/**
+ * @file test_reshape_view.cpp
+ * @brief Acceptance tests for spec 028 — stride-preserving reshape.
+ *
+ * Tests derived from docs/specs/028-stride-reshape.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+// Byte offset of element k (row-major order) of a strided tensor
+static int64_t offset_of(const Tensor& t, int64_t k) {
+    int64_t off = 0;
+    for (int8_t d = t.ndim - 1; d >= 0; --d) {
+        off += (k % t.shape[d]) * t.strides[d];
+        k /= t.shape[d];
+    }
+    return off;
+}
+
+// Element k (row-major order) of a strided F32 tensor
+static float at(const Tensor& t, int64_t k) {
+    float v;
+    std::memcpy(&v, static_cast<const uint8_t*>(t.data) + offset_of(t, k), sizeof(v));
+    return v;
+}
+
+static bool same_elements(const Tensor& a, const Tensor& b) {
+    if (a.numel() != b.numel()) return false;
+    for (int64_t k = 0; k < a.numel(); ++k)
+        if (at(a, k) != at(b, k)) return false;
+    return true;
+}
+
+// Brute force: does any stride vector give `ns` the same element offsets?
+static bool view_exists(const Tensor& v, const int64_t* ns, int8_t nn) {
+    int64_t st[MAX_DIMS] = {};
+    int64_t unit = 1;
+    for (int8_t d = nn - 1; d >= 0; --d) {
+        if (ns[d] > 1) st[d] = offset_of(v, unit);  // element with index 1 in dim d only
+        unit *= ns[d];
+    }
+    for (int64_t k = 0; k < v.numel(); ++k) {
+        int64_t off = 0, rem = k;
+        for (int8_t d = nn - 1; d >= 0; --d) {
+            off += (rem % ns[d]) * st[d];
+            rem /= ns[d];
+        }
+        if (off != offset_of(v, k)) return false;
+    }
+    return true;
+}
+
+static Tensor iota(const int64_t* shape, int8_t ndim) {
+    Tensor t = Tensor::alloc(shape, ndim, DType::F32);
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) p[i] = static_cast<float>(i);
+    return t;
+}
+
+// A view reshape shares data and keeps the element order
+static bool is_view_of(const Tensor& r, const Tensor& src) {
+    return r.data == src.data && !r.owns_data && same_elements(r, src);
+}
+
+static void test_contiguous() {
+    int64_t s[3] = {2, 3, 4};
+    Tensor t = iota(s, 3);
+    int64_t n[2] = {6, 4};
+    Tensor r = t.reshape(n, 2);
+    ASSERT(is_view_of(r, t) && r.is_contiguous(), "contiguous reshape is a contiguous view");
+    int64_t bad[2] = {5, 5};
+    ASSERT(t.reshape(bad, 2).data == nullptr && !t.can_reshape(bad, 2) && t.reshape_copy(bad, 2).data == nullptr,
+           "element count mismatch is rejected");
+    Tensor c = t.reshape_copy(n, 2);
+    ASSERT(c.owns_data && c.data != t.data && c.is_contiguous() && same_elements(c, t),
+           "reshape_copy always copies");
+    c.free();
+    int64_t neg[2] = {-2, -12};
+    ASSERT(!t.can_reshape(neg, 2), "negative dims are rejected");
+    t.free();
+}
+
+static void test_sliced() {
+    int64_t s[2] = {4, 6};
+    Tensor t = iota(s, 2);
+    Tensor cols = t.slice(1, 1, 4);  // [4, 3], strides [24, 4]
+    int64_t split[3] = {2, 2, 3};
+    Tensor r = cols.reshape(split, 3);
+    ASSERT(is_view_of(r, cols) && r.strides[0] == 48 && r.strides[1] == 24 && r.strides[2] == 4,
+           "splitting the outer dim of a column slice is a view");
+    int64_t ones[5] = {1, 4, 1, 3, 1};
+    r = cols.reshape(ones, 5);
+    ASSERT(is_view_of(r, cols), "inserting size-1 dims is a view");
+    int64_t flat[1] = {12};
+    ASSERT(!cols.can_reshape(flat, 1) && ops::view(cols, flat, 1).data == nullptr,
+           "merging across the slice gap needs a copy");
+    ASSERT(cols.reshape(flat, 1).data == nullptr && ops::flatten(cols).data == nullptr,
+           "reshape never copies");
+    Tensor c = cols.reshape_copy(flat, 1);
+    ASSERT(c.owns_data && c.data != cols.data && c.is_contiguous() && same_elements(c, cols),
+           "reshape_copy gathers a strided view");
+    c.free();
+
+    Tensor rows = t.slice(0, 1, 3);  // [2, 6], still contiguous
+    int64_t m[3] = {3, 2, 2};
+    ASSERT(is_view_of(rows.reshape(m, 3), rows), "row slices reshape freely");
+    t.free();
+}
+
+static void test_permuted() {
+    int64_t s[3] = {2, 3, 4};
+    Tensor t = iota(s, 3);
+    int8_t perm[3] = {2, 0, 1};
+    Tensor p = ops::permute(t, perm);  // [4, 2, 3], strides [4, 48, 16]
+    int64_t merged[2] = {4, 6};
+    Tensor r = ops::view(p, merged, 2);
+    ASSERT(r.data != nullptr && is_view_of(r, p) && r.strides[0] == 4 && r.strides[1] == 16,
+           "merging dims contiguous among themselves is a view");
+    int64_t split[4] = {2, 2, 2, 3};
+    ASSERT(is_view_of(p.reshape(split, 4), p), "splitting a permuted dim is a view");
+    int64_t both[3] = {2, 2, 6};
+    ASSERT(is_view_of(ops::view(p, both, 3), p), "split and merge in one reshape");
+
+    Tensor tr = t.reshape(merged, 2).transpose();  // [4, 6] -> [6, 4]
+    int64_t flat[1] = {24};
+    ASSERT(tr.reshape(flat, 1).data == nullptr, "flattening a transpose is not a view");
+    Tensor c = ops::flatten_copy(tr);
+    ASSERT(c.owns_data && c.ndim == 1 && same_elements(c, tr), "flatten_copy gathers a transpose");
+    int64_t wrong[2] = {4, 6};
+    ASSERT(!tr.can_reshape(wrong, 2), "regrouping a transpose is not a view");
+    c.free();
+    t.free();
+}
+
+// Ops index dense memory, so strided views must be rejected, not misread
+static void test_ops_reject_strided() {
+    int64_t s[3] = {2, 3, 4};
+    Tensor t = iota(s, 3);
+    int8_t perm[3] = {2, 0, 1};
+    int64_t merged[2] = {4, 6};
+    Tensor r = ops::view(ops::permute(t, perm), merged, 2);  // [4, 6], strides [4, 16]
+    ASSERT(r.data != nullptr && !r.is_contiguous(), "reshaped permute is a strided view");
+
+    int64_t w_shape[2] = {6, 2}, c_shape[2] = {4, 2}, row_shape[1] = {4};
+    Tensor out = Tensor::alloc(merged, 2, DType::F32);
+    Tensor w = iota(w_shape, 2);
+    Tensor c = Tensor::alloc(c_shape, 2, DType::F32);
+    Tensor rows = Tensor::alloc(row_shape, 1, DType::F32);
+    Tensor idx = Tensor::alloc(row_shape, 1, DType::I64);
+    ASSERT(ops::relu(r, out).code == StatusCode::INVALID_ARGUMENT, "unary op rejects a strided input");
+    ASSERT(ops::add(out, r, out).code == StatusCode::INVALID_ARGUMENT, "binary op rejects a strided operand");
+    ASSERT(ops::sum(r, rows).code == StatusCode::INVALID_ARGUMENT, "reduce rejects a strided input");
+    ASSERT(ops::argmax(r, idx).code == StatusCode::INVALID_ARGUMENT, "argmax rejects a strided input");
+    ASSERT(ops::matmul(r, w, c).code == StatusCode::INVALID_ARGUMENT, "matmul rejects a strided operand");
+    Tensor wt = w.transpose();
+    Tensor ct = Tensor::alloc(merged, 2, DType::F32);
+    int64_t a_shape[2] = {4, 2};
+    Tensor a = iota(a_shape, 2);
+    ASSERT(ops::matmul(a, wt, ct).code == StatusCode::INVALID_ARGUMENT, "matmul rejects a transposed operand");
+
+    Tensor dense = r.reshape_copy(merged, 2);
+    bool sums = ops::sum(dense, rows).is_ok();
+    for (int64_t i = 0; i < 4 && sums; ++i) {
+        float want = 0.0f;
+        for (int64_t j = 0; j < 6; ++j) want += at(r, i * 6 + j);
+        sums = static_cast<const float*>(rows.data)[i] == want;
+    }
+    ASSERT(sums, "reshape_copy of the view reduces to the view's values");
+
+    dense.free();
+    a.free();
+    ct.free();
+    idx.free();
+    rows.free();
+    c.free();
+    w.free();
+    out.free();
+    t.free();
+}
+
+static void test_broadcast_and_storage() {
+    int64_t s[2] = {1, 4};
+    Tensor t = iota(s, 2);
+    int64_t e[2] = {3, 4};
+    Tensor b = ops::expand(t, e, 2);  // strides [0, 4]
+    int64_t split[3] = {3, 2, 2};
+    Tensor r = b.reshape(split, 3);
+    ASSERT(is_view_of(r, b) && r.strides[0] == 0, "broadcast dims keep stride 0");
+    int64_t flat[1] = {12};
+    ASSERT(b.reshape(flat, 1).data == nullptr, "merging a broadcast dim is not a view");
+    Tensor c = b.reshape_copy(flat, 1);
+    ASSERT(c.owns_data && same_elements(c, b), "reshape_copy materializes a broadcast");
+    c.free();
+    t.free();
+
+    int64_t s2[2] = {4, 6};
+    Tensor sh = Tensor::alloc_shared(s2, 2, DType::F32);
+    float* p = static_cast<float*>(sh.data);
+    for (int i = 0; i < 24; ++i) p[i] = static_cast<float>(i);
+    Tensor cols = sh.slice(1, 0, 3);
+    int64_t f[1] = {12};
+    Tensor cc = cols.reshape_copy(f, 1);
+    ASSERT(cc.storage != nullptr && cc.storage != sh.storage && cc.use_count() == 1 && same_elements(cc, cols),
+           "a copy of a storage-backed view gets its own storage");
+    int64_t v[3] = {2, 2, 3};
+    Tensor vv = cols.reshape(v, 3);
+    ASSERT(vv.storage == sh.storage && !vv.owns_data && sh.use_count() == 1, "a view borrows the storage");
+    cc.free();
+    sh.free();
+
+    Tensor sc = Tensor::alloc(nullptr, 0, DType::F32);
+    *static_cast<float*>(sc.data) = 7.0f;
+    int64_t o[3] = {1, 1, 1};
+    Tensor so = sc.reshape(o, 3);
+    ASSERT(so.data == sc.data && at(so, 0) == 7.0f, "scalar to all-ones shape is a view");
+    sc.free();
+}
+
+static void test_random() {
+    std::mt19937 rng(28);
+    int64_t views = 0, copies = 0;
+    bool ok = true;
+    for (int trial = 0; trial < 2000 && ok; ++trial) {
+        int8_t nd = static_cast<int8_t>(1 + rng() % 4);
+        int64_t base[4];
+        for (int8_t d = 0; d < nd; ++d) base[d] = 1 + rng() % 4;
+        Tensor t = iota(base, nd);
+
+        // Random permutation, then a random slice
+        int8_t perm[4] = {0, 1, 2, 3};
+        for (int8_t d = nd - 1; d > 0; --d) std::swap(perm[d], perm[rng() % (d + 1)]);
+        Tensor v = ops::permute(t, perm);
+        int8_t sd = static_cast<int8_t>(rng() % nd);
+        if (v.shape[sd] > 1 && rng() % 2 == 0) v = v.slice(sd, 1, v.shape[sd]);
+
+        // Random regrouping of its elements
+        int64_t rest = v.numel();
+        int64_t ns[6];
+        int8_t nn = 0;
+        while (nn < 5) {
+            int64_t f = 1;
+            for (int64_t k = 2 + rng() % 3; k >= 2; --k)
+                if (rest % k == 0) { f = k; break; }
+            if (f == 1 && rng() % 3 != 0) break;
+            ns[nn++] = f;
+            rest /= f;
+        }
+        ns[nn++] = rest;
+
+        Tensor r = v.reshape(ns, nn);
+        bool view = v.can_reshape(ns, nn);
+        ok = ok && view == (r.data != nullptr) && view == view_exists(v, ns, nn);
+        if (view) {
+            ok = ok && !r.owns_data && same_elements(r, v);
+            ++views;
+        } else {
+            r = v.reshape_copy(ns, nn);
+            ok = ok && r.owns_data && same_elements(r, v);
+            r.free();
+            ++copies;
+        }
+        t.free();
+    }
+    char msg[160];
+    std::snprintf(msg, sizeof(msg), "random regroupings: views exactly when strides exist (%lld views, %lld copies)",
+                  static_cast<long long>(views), static_cast<long long>(copies));
+    ASSERT(ok && views > 0 && copies > 0, msg);
+}
+
+int main() {
+    std::printf("=== Spec 028 — Stride-Preserving Reshape ===\n");
+
+    test_contiguous();
+    test_sliced();
+    test_permuted();
+    test_ops_reject_strided();
+    test_broadcast_and_storage();
+    test_random();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
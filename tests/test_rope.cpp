@@ -0,0 +1,220 @@
+/**
+ * @file test_rope.cpp
+ * @brief Acceptance tests for spec 016 — fused rotary positional embedding.
+ *
+ * Tests derived from docs/specs/016-rope.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static uint32_t rng_state = 4242u;
+
+static Tensor random_f32(const int64_t* shape, int8_t ndim) {
+    Tensor t = Tensor::alloc(shape, ndim, DType::F32);
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) {
+        rng_state = rng_state * 1103515245u + 12345u;
+        p[i] = static_cast<float>((rng_state >> 8) % 2001) / 1000.0f - 1.0f;
+    }
+    return t;
+}
+
+static Tensor ids(const int64_t* v, int64_t n, DType dtype) {
+    int64_t shape[1] = {n};
+    Tensor t = Tensor::alloc(shape, 1, dtype);
+    for (int64_t i = 0; i < n; ++i) {
+        if (dtype == DType::I64) static_cast<int64_t*>(t.data)[i] = v[i];
+        else static_cast<int32_t*>(t.data)[i] = static_cast<int32_t>(v[i]);
+    }
+    return t;
+}
+
+// Direct formula in double on a copy of x (the pre-rotation values).
+static float max_err(const float* before, const Tensor& after, const int64_t* pos, int64_t tokens,
+                     int64_t rot_dim, double base, ops::RopeLayout layout) {
+    int64_t dim = after.shape[after.ndim - 1];
+    int64_t heads = after.numel() / tokens / dim;
+    int64_t half = rot_dim / 2;
+    const float* y = static_cast<const float*>(after.data);
+    float err = 0.0f;
+    for (int64_t t = 0; t < tokens; ++t) {
+        for (int64_t h = 0; h < heads; ++h) {
+            const float* x = before + (t * heads + h) * dim;
+            const float* r = y + (t * heads + h) * dim;
+            for (int64_t i = 0; i < half; ++i) {
+                double theta = static_cast<double>(pos[t]) * std::pow(base, -2.0 * i / rot_dim);
+                int64_t ia = layout == ops::RopeLayout::HALF_SPLIT ? i : 2 * i;
+                int64_t ib = layout == ops::RopeLayout::HALF_SPLIT ? i + half : 2 * i + 1;
+                double a = x[ia], b = x[ib];
+                err = std::fmax(err, std::fabs(static_cast<float>(a * std::cos(theta) - b * std::sin(theta)) - r[ia]));
+                err = std::fmax(err, std::fabs(static_cast<float>(b * std::cos(theta) + a * std::sin(theta)) - r[ib]));
+            }
+            for (int64_t i = rot_dim; i < dim; ++i) err = std::fmax(err, std::fabs(x[i] - r[i]));
+        }
+    }
+    return err;
+}
+
+static void test_cache() {
+    std::printf("\n--- cos/sin cache ---\n");
+    ops::RopeCache cache;
+    ASSERT(!cache.valid(), "empty cache is invalid");
+    ASSERT(cache.init(16, 7).code == StatusCode::INVALID_ARGUMENT, "odd rotary dim rejected");
+    ASSERT(cache.init(0, 8).code == StatusCode::INVALID_ARGUMENT, "zero positions rejected");
+    ASSERT(cache.init(4096, 64).is_ok() && cache.valid(), "cache built");
+    const float* c = static_cast<const float*>(cache.cos.data);
+    const float* s = static_cast<const float*>(cache.sin.data);
+    ASSERT(c[0] == 1.0f && s[0] == 0.0f, "position 0 is the identity");
+    ASSERT(std::fabs(c[4095 * 32 + 0] - static_cast<float>(std::cos(4095.0))) < 1e-6f,
+           "angles computed in double at large positions");
+    cache.free();
+}
+
+static void test_layouts() {
+    std::printf("\n--- half-split and interleaved, GQA, partial rotary, per-token positions ---\n");
+    ops::RopeCache cache;
+    ASSERT(cache.init(2048, 48).is_ok(), "cache built (rot_dim 48 of head_dim 64)");
+    const int64_t T = 6;
+    int64_t pos_v[T] = {0, 17, 5, 2047, 17, 300};   // tokens from several sequences
+    int64_t qshape[3] = {T, 8, 64}, kshape[3] = {T, 2, 64};
+    const ops::RopeLayout layouts[2] = {ops::RopeLayout::HALF_SPLIT, ops::RopeLayout::INTERLEAVED};
+    for (ops::RopeLayout layout : layouts) {
+        Tensor q = random_f32(qshape, 3), k = random_f32(kshape, 3);
+        float q0[T * 8 * 64], k0[T * 2 * 64];
+        std::memcpy(q0, q.data, q.nbytes());
+        std::memcpy(k0, k.data, k.nbytes());
+        Tensor pos = ids(pos_v, T, layout == ops::RopeLayout::HALF_SPLIT ? DType::I64 : DType::I32);
+        ASSERT(ops::rope(q, k, pos, cache, layout).is_ok(), "rope succeeds");
+        float eq = max_err(q0, q, pos_v, T, 48, 10000.0, layout);
+        float ek = max_err(k0, k, pos_v, T, 48, 10000.0, layout);
+        std::printf("INFO: %s max err q %.2g k %.2g\n",
+                    layout == ops::RopeLayout::HALF_SPLIT ? "half-split" : "interleaved",
+                    static_cast<double>(eq), static_cast<double>(ek));
+        ASSERT(eq < 1e-5f && ek < 1e-5f, "q and k match the rotation formula");
+        q.free(); k.free(); pos.free();
+    }
+    cache.free();
+}
+
+static void test_q_only_and_round_trip() {
+    std::printf("\n--- q-only overload; rotation preserves norms ---\n");
+    ops::RopeCache cache;
+    (void)cache.init(128, 32);
+    int64_t shape[2] = {3, 32};
+    Tensor q = random_f32(shape, 2);
+    float before[96];
+    std::memcpy(before, q.data, sizeof(before));
+    int64_t pos_v[3] = {1, 64, 127};
+    Tensor pos = ids(pos_v, 3, DType::I64);
+    ASSERT(ops::rope(q, pos, cache).is_ok(), "q-only rope");
+    const float* y = static_cast<const float*>(q.data);
+    bool norms = true;
+    for (int64_t t = 0; t < 3; ++t) {
+        double n0 = 0.0, n1 = 0.0;
+        for (int64_t i = 0; i < 32; ++i) {
+            n0 += static_cast<double>(before[t * 32 + i]) * before[t * 32 + i];
+            n1 += static_cast<double>(y[t * 32 + i]) * y[t * 32 + i];
+        }
+        norms = norms && std::fabs(n0 - n1) < 1e-4 * (1.0 + n0);
+    }
+    ASSERT(norms, "per-token norm preserved");
+    q.free(); pos.free(); cache.free();
+}
+
+static void test_validation() {
+    std::printf("\n--- validation ---\n");
+    ops::RopeCache cache;
+    int64_t shape[3] = {2, 4, 16}, small[3] = {2, 4, 8}, other[3] = {3, 4, 16};
+    Tensor q = random_f32(shape, 3), k = random_f32(shape, 3);
+    int64_t pos_v[2] = {0, 9};
+    int64_t far_v[2] = {0, 64};
+    Tensor pos = ids(pos_v, 2, DType::I64), far = ids(far_v, 2, DType::I64);
+    Tensor fpos = Tensor::alloc(shape, 1, DType::F32);
+    ASSERT(ops::rope(q, k, pos, cache).code == StatusCode::INVALID_STATE, "uninitialized cache");
+    (void)cache.init(64, 16);
+    float q0 = static_cast<float*>(q.data)[1];
+    ASSERT(ops::rope(q, k, far, cache).code == StatusCode::OUT_OF_BOUNDS, "position beyond cache");
+    ASSERT(static_cast<float*>(q.data)[1] == q0, "q untouched on failure");
+    ASSERT(ops::rope(q, k, fpos, cache).code == StatusCode::TYPE_MISMATCH, "float position ids");
+    Tensor narrow = random_f32(small, 3), longer = random_f32(other, 3);
+    ASSERT(ops::rope(q, narrow, pos, cache).code == StatusCode::INVALID_ARGUMENT, "head dim below rotary dim");
+    ASSERT(ops::rope(longer, pos, cache).code == StatusCode::INVALID_ARGUMENT, "token count mismatch");
+    ASSERT(ops::rope(q, q, pos, cache).code == StatusCode::INVALID_ARGUMENT, "aliased q and k");
+    q.free(); k.free(); pos.free(); far.free(); fpos.free(); narrow.free(); longer.free(); cache.free();
+}
+
+static void test_vs_unfused() {
+    std::printf("\n--- fused vs slice + sin/cos + 4 mul + 2 add (informational) ---\n");
+    const int64_t T = 256, H = 32, D = 128, half = D / 2;
+    ops::RopeCache cache;
+    (void)cache.init(4096, D);
+    int64_t qshape[3] = {T, H, D};
+    Tensor q = random_f32(qshape, 3);
+    int64_t pos_v[T];
+    for (int64_t t = 0; t < T; ++t) pos_v[t] = 1000 + t;
+    Tensor pos = ids(pos_v, T, DType::I64);
+
+    int64_t hshape[1] = {half};
+    Tensor theta = Tensor::alloc(hshape, 1, DType::F32), c = Tensor::alloc(hshape, 1, DType::F32);
+    Tensor s = Tensor::alloc(hshape, 1, DType::F32), t0 = Tensor::alloc(hshape, 1, DType::F32);
+    Tensor t1 = Tensor::alloc(hshape, 1, DType::F32);
+    auto a = std::chrono::steady_clock::now();
+    for (int64_t t = 0; t < T; ++t) {
+        float* th = static_cast<float*>(theta.data);
+        for (int64_t i = 0; i < half; ++i)
+            th[i] = static_cast<float>(pos_v[t]) * std::pow(10000.0f, -2.0f * i / D);
+        (void)ops::unary_op(theta, c, ops::ElementwiseOp::COS);
+        (void)ops::unary_op(theta, s, ops::ElementwiseOp::SIN);
+        for (int64_t h = 0; h < H; ++h) {
+            float* row = static_cast<float*>(q.data) + (t * H + h) * D;
+            Tensor lo = Tensor::wrap(row, hshape, 1, DType::F32);
+            Tensor hi = Tensor::wrap(row + half, hshape, 1, DType::F32);
+            (void)ops::mul(lo, c, t0);
+            (void)ops::mul(hi, s, t1);
+            (void)ops::mul(hi, c, hi);
+            (void)ops::mul(lo, s, lo);
+            (void)ops::add(hi, lo, hi);
+            (void)ops::sub(t0, t1, lo);
+        }
+    }
+    auto b = std::chrono::steady_clock::now();
+    (void)ops::rope(q, pos, cache);
+    auto e = std::chrono::steady_clock::now();
+    std::printf("INFO: %lld tokens x %lld heads x %lld: unfused %.1f us, fused %.1f us\n",
+                static_cast<long long>(T), static_cast<long long>(H), static_cast<long long>(D),
+                std::chrono::duration<double, std::micro>(b - a).count(),
+                std::chrono::duration<double, std::micro>(e - b).count());
+    theta.free(); c.free(); s.free(); t0.free(); t1.free(); q.free(); pos.free(); cache.free();
+}
+
+int main() {
+    std::printf("=== Spec 016 — Fused RoPE ===\n");
+
+    test_cache();
+    test_layouts();
+    test_q_only_and_round_trip();
+    test_validation();
+    test_vs_unfused();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file test_storage.cpp
+ * @brief Acceptance tests for spec 010 — copy-on-write tensor storage.
+ *
+ * Tests derived from docs/specs/010-cow-tensor-storage.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <thread>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+// Tracks live blocks so leaks and double frees show up as a nonzero balance.
+struct CountingAllocator : Allocator {
+    std::atomic<int64_t> allocs{0};
+    std::atomic<int64_t> live{0};
+    void* alloc(size_t size, size_t alignment, Device device) noexcept override {
+        void* p = SystemAllocator::instance()->alloc(size, alignment, device);
+        if (p != nullptr) {
+            allocs.fetch_add(1, std::memory_order_relaxed);
+            live.fetch_add(1, std::memory_order_relaxed);
+        }
+        return p;
+    }
+    void free(void* ptr, Device device) noexcept override {
+        if (ptr != nullptr) live.fetch_sub(1, std::memory_order_relaxed);
+        SystemAllocator::instance()->free(ptr, device);
+    }
+    const char* name() const noexcept override { return "counting"; }
+};
+
+static CountingAllocator g_alloc;
+
+static Tensor iota(int64_t rows, int64_t cols) {
+    int64_t shape[] = {rows, cols};
+    Tensor t = Tensor::alloc_shared(shape, 2, DType::F32);
+    float* p = static_cast<float*>(t.data);
+    for (int64_t i = 0; i < t.numel(); ++i) p[i] = static_cast<float>(i);
+    return t;
+}
+
+static void test_share_and_free() {
+    std::printf("\n--- alloc_shared, share, free ---\n");
+    set_allocator(&g_alloc);
+    g_alloc.live.store(0);
+    Tensor a = iota(4, 8);
+    ASSERT(a.owns_data && a.storage != nullptr && a.use_count() == 1, "alloc_shared holds one reference");
+    Tensor b = a.share();
+    ASSERT(b.data == a.data && a.use_count() == 2 && b.is_shared(), "share adds a reference, no copy");
+    a.free();
+    ASSERT(a.data == nullptr && b.use_count() == 1, "free drops one reference");
+    ASSERT(static_cast<float*>(b.data)[31] == 31.0f, "data survives while a handle remains");
+
+    Tensor row = b.slice(0, 2, 3);
+    ASSERT(!row.owns_data && row.use_count() == 1, "slice stays a borrowed view");
+    Tensor kept = row.share();
+    b.free();
+    ASSERT(kept.use_count() == 1 && static_cast<float*>(kept.data)[0] == 16.0f,
+           "shared slice outlives its base");
+    kept.free();
+    ASSERT(g_alloc.live.load() == 0, "last free releases buffer and header");
+
+    Tensor plain = Tensor::alloc(a.shape.data(), 2, DType::F32);
+    Tensor v = plain.share();
+    ASSERT(plain.use_count() == 0 && !v.owns_data, "without storage share() is a borrowed view");
+    plain.free();
+    set_allocator(SystemAllocator::instance());
+}
+
+static void test_copy_on_write() {
+    std::printf("\n--- make_writable copies only when shared ---\n");
+    set_allocator(&g_alloc);
+    g_alloc.live.store(0);
+    Tensor a = iota(4, 8);
+    void* original = a.data;
+    int64_t before = g_alloc.allocs.load();
+    ASSERT(a.make_writable().is_ok() && a.data == original && g_alloc.allocs.load() == before,
+           "sole owner writes in place, no allocation");
+
+    Tensor b = a.share();
+    ASSERT(b.make_writable().is_ok() && b.data != original, "shared handle copies on write");
+    ASSERT(a.use_count() == 1 && b.use_count() == 1, "each handle now owns its storage");
+    static_cast<float*>(b.data)[0] = -1.0f;
+    ASSERT(static_cast<float*>(a.data)[0] == 0.0f && static_cast<float*>(b.data)[1] == 1.0f,
+           "writer sees a full copy, other handle unchanged");
+    b.free();
+
+    // A strided column view copies just its elements, densely.
+    Tensor c = a.share();
+    Tensor col = c.transpose().slice(0, 3, 4);
+    c.free();
+    Tensor w = col.share();
+    ASSERT(w.make_writable().is_ok(), "strided shared view made writable");
+    const float* p = static_cast<const float*>(w.data);
+    ASSERT(w.is_contiguous() && w.shape[0] == 1 && w.shape[1] == 4 &&
+           p[0] == 3.0f && p[1] == 11.0f && p[2] == 19.0f && p[3] == 27.0f,
+           "copy holds the view's elements in row-major order");
+    ASSERT(a.use_count() == 1 && w.use_count() == 1, "copy released the old reference");
+    w.free();
+    a.free();
+
+    Tensor plain = Tensor::alloc(a.shape.data(), 2, DType::F32);
+    void* pd = plain.data;
+    ASSERT(plain.make_writable().is_ok() && plain.data == pd, "tensor without storage untouched");
+    plain.free();
+    ASSERT(g_alloc.live.load() == 0, "no leaks after copy-on-write");
+    set_allocator(SystemAllocator::instance());
+}
+
+static void test_concurrent_refcount() {
+    std::printf("\n--- concurrent share / free across threads ---\n");
+    set_allocator(&g_alloc);
+    g_alloc.live.store(0);
+    Tensor a = iota(16, 16);
+    constexpr int kThreads = 4;
+    constexpr int kIters = 20000;
+    std::atomic<int64_t> bad{0};
+    std::thread pool[kThreads];
+    for (int i = 0; i < kThreads; ++i) {
+        Tensor mine = a.share();
+        pool[i] = std::thread([mine, &bad]() mutable {
+            for (int k = 0; k < kIters; ++k) {
+                Tensor h = mine.share();
+                if (static_cast<const float*>(h.data)[255] != 255.0f) bad.fetch_add(1);
+                h.free();
+            }
+            mine.free();
+        });
+    }
+    a.free();
+    for (auto& t : pool) t.join();
+    ASSERT(bad.load() == 0, "every handle reads the shared data");
+    ASSERT(g_alloc.live.load() == 0, "storage freed exactly once by the last holder");
+    set_allocator(SystemAllocator::instance());
+}
+
+int main() {
+    std::printf("=== Spec 010 — Copy-on-write tensor storage ===\n");
+
+    test_share_and_free();
+    test_copy_on_write();
+    test_concurrent_refcount();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
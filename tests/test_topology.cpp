@@ -0,0 +1,249 @@
+/**
+ * @file test_topology.cpp
+ * @brief Acceptance tests for spec 025 — topology discovery and the NUMA pool mode.
+ *
+ * Tests derived from docs/specs/025-numa-thread-pool.md §4.
+ */
+
+#include <zero/zero.hpp>
+#include <atomic>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+static void put(const std::string& path, const char* text) {
+    std::FILE* f = std::fopen(path.c_str(), "w");
+    if (f == nullptr) return;
+    std::fputs(text, f);
+    std::fclose(f);
+}
+
+static void mkdirs(const std::string& path) {
+    for (size_t i = 1; i <= path.size(); ++i)
+        if (i == path.size() || path[i] == '/') ::mkdir(path.substr(0, i).c_str(), 0755);
+}
+
+// Fake sysfs: 2 sockets x 4 cores x 2 SMT threads, Linux numbering
+// (cpu c and c + 8 are siblings). `nodes` of 0 leaves out node/.
+static std::string fake_sysfs(const char* tag, int nodes) {
+    std::string root = "/tmp/zero_topo_" + std::to_string(::getpid()) + "_" + tag;
+    mkdirs(root + "/cpu");
+    put(root + "/cpu/online", "0-15\n");
+    for (int c = 0; c < 16; ++c) {
+        std::string dir = root + "/cpu/cpu" + std::to_string(c) + "/topology";
+        mkdirs(dir);
+        put(dir + "/physical_package_id", std::to_string((c % 8) / 4).c_str());
+        put(dir + "/core_id", std::to_string(c % 4).c_str());
+    }
+    if (nodes == 2) {
+        mkdirs(root + "/node/node0");
+        mkdirs(root + "/node/node1");
+        put(root + "/node/online", "0-1\n");
+        put(root + "/node/node0/cpulist", "0-3,8-11\n");
+        put(root + "/node/node1/cpulist", "4-7,12-15\n");
+    } else if (nodes == 4) {
+        // Sub-NUMA clustering: two nodes per socket
+        mkdirs(root + "/node");
+        put(root + "/node/online", "0-3\n");
+        const char* lists[4] = {"0-1,8-9\n", "2-3,10-11\n", "4-5,12-13\n", "6-7,14-15\n"};
+        for (int k = 0; k < 4; ++k) {
+            std::string dir = root + "/node/node" + std::to_string(k);
+            mkdirs(dir);
+            put(dir + "/cpulist", lists[k]);
+        }
+    }
+    return root;
+}
+
+static void remove_tree(const std::string& root) {
+    std::string cmd = "rm -rf '" + root + "'";
+    (void)std::system(cmd.c_str());
+}
+
+static exec::Topology topo;  // 16 KiB; keep off the stack
+
+static void test_discovery() {
+    std::string root = fake_sysfs("2n", 2);
+    Status s = exec::Topology::discover(topo, root.c_str());
+    ASSERT(s.is_ok() && topo.num_cpus == 16 && topo.num_cores == 8 && topo.num_sockets == 2 &&
+           topo.num_nodes == 2, "dual-socket SMT machine: 16 CPUs, 8 cores, 2 sockets, 2 nodes");
+    const exec::CpuInfo* c0 = topo.find(0);
+    const exec::CpuInfo* c1 = topo.find(1);
+    const exec::CpuInfo* c4 = topo.find(4);
+    const exec::CpuInfo* c8 = topo.find(8);
+    ASSERT(c0 && c1 && c4 && c8 && c4->node == 1 && c8->node == 0 && c8->core == c0->core &&
+           c4->core != c0->core, "cores are unique across sockets, siblings share a core");
+    ASSERT(exec::Topology::distance(*c0, *c8) == exec::TOPO_SAME_CORE &&
+           exec::Topology::distance(*c0, *c1) == exec::TOPO_SAME_NODE &&
+           exec::Topology::distance(*c0, *c4) == exec::TOPO_REMOTE, "distance classes");
+    remove_tree(root);
+
+    exec::Topology& t = topo;
+    root = fake_sysfs("snc", 4);
+    s = exec::Topology::discover(t, root.c_str());
+    ASSERT(s.is_ok() && t.num_nodes == 4 && t.num_sockets == 2 &&
+           exec::Topology::distance(*t.find(0), *t.find(2)) == exec::TOPO_SAME_SOCKET,
+           "sub-NUMA clusters: four nodes on two sockets");
+    remove_tree(root);
+
+    root = fake_sysfs("nonode", 0);
+    s = exec::Topology::discover(t, root.c_str());
+    ASSERT(s.is_ok() && t.num_nodes == 2 && t.find(5)->node == t.find(5)->socket,
+           "without node/ each socket is a node");
+    put(root + "/cpu/online", "3-1\n");
+    ASSERT(exec::Topology::discover(t, root.c_str()).code == StatusCode::INVALID_ARGUMENT,
+           "malformed CPU list is rejected");
+    remove_tree(root);
+
+    s = exec::Topology::discover(t, "/nonexistent/zero-sysfs");
+    ASSERT(s.is_ok() && t.num_cpus >= 1 && t.num_nodes == 1, "missing sysfs falls back to one node");
+
+    s = exec::Topology::discover(t);
+    int32_t cpu = exec::current_cpu();
+    ASSERT(s.is_ok() && t.num_cpus >= 1 && (cpu < 0 || t.find(cpu) != nullptr), "host topology is discovered");
+    std::printf("INFO: host has %d CPUs, %d cores, %d sockets, %d nodes\n",
+                t.num_cpus, t.num_cores, t.num_sockets, t.num_nodes);
+}
+
+static void test_placement() {
+    std::string root = fake_sysfs("place", 2);
+    (void)exec::Topology::discover(topo, root.c_str());
+    remove_tree(root);
+
+    exec::PoolOptions opt;
+    opt.threads = 16;
+    opt.topology = &topo;
+    opt.pin = false;  // the fake CPUs need not exist here
+    exec::ThreadPool pool;
+    ASSERT(pool.start(opt).is_ok() && pool.numa() && pool.pinned() == 0, "NUMA pool starts unpinned");
+
+    bool spread = true;
+    int per_node[2] = {0, 0};
+    for (int32_t p = 1; p < 8; ++p) {
+        exec::CpuInfo a = pool.placement(p);
+        ++per_node[a.node];
+        for (int32_t q = 1; q < p; ++q) spread = spread && pool.placement(q).core != a.core;
+    }
+    ASSERT(spread && per_node[0] == 3 && per_node[1] == 4,
+           "first workers take one thread per core, alternating nodes");
+    ASSERT(pool.placement(9).cpu == 12 && pool.placement(1).cpu == 4, "SMT siblings are placed last");
+
+    const int8_t* order = pool.steal_order(9);
+    bool sorted = true;
+    for (int32_t p = 1; p < 16; ++p) {
+        const int8_t* o = pool.steal_order(p);
+        int32_t prev = 0;
+        for (int32_t k = 0; k < 15; ++k) {
+            int32_t d = exec::Topology::distance(pool.placement(p), pool.placement(o[k]));
+            sorted = sorted && d >= prev;
+            prev = d;
+        }
+    }
+    ASSERT(order[0] == 1 && pool.placement(order[1]).node == 1, "a thief tries its SMT sibling first, then its node");
+    ASSERT(sorted, "every steal order crosses sockets last");
+
+    exec::ThreadPool bad;
+    exec::Topology::flat(topo, 1);
+    topo.num_cpus = 0;
+    opt.topology = &topo;
+    ASSERT(bad.start(opt).code == StatusCode::INVALID_ARGUMENT, "empty topology is rejected");
+}
+
+static void test_jobs() {
+    std::string root = fake_sysfs("jobs", 2);
+    (void)exec::Topology::discover(topo, root.c_str());
+    remove_tree(root);
+
+    exec::PoolOptions opt;
+    opt.threads = 8;
+    opt.topology = &topo;
+    opt.pin = false;
+    exec::ThreadPool pool;
+    (void)pool.start(opt);
+
+    const int64_t n = 100000;
+    static std::atomic<int32_t> hits[100000];
+    for (auto& h : hits) h.store(0);
+    (void)pool.parallel_for(n, [&](int64_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); });
+    bool once = true;
+    for (int64_t i = 0; i < n; ++i) once = once && hits[i].load() == 1;
+    ASSERT(once && pool.remote_steals() <= pool.steals(), "unhinted NUMA job runs every index once");
+
+    for (int32_t node = 0; node < 2; ++node) {
+        std::atomic<int32_t> ran{0}, off_node{0};
+        (void)pool.parallel_for(10000, [&](int64_t) {
+            ran.fetch_add(1, std::memory_order_relaxed);
+            if (pool.placement(exec::ThreadPool::participant()).node != node)
+                off_node.fetch_add(1, std::memory_order_relaxed);
+        }, node);
+        char msg[96];
+        std::snprintf(msg, sizeof(msg), "hinted job stays on node %d", node);
+        ASSERT(ran == 10000 && off_node == 0, msg);
+    }
+
+    std::atomic<int32_t> ran{0};
+    (void)pool.parallel_for(1000, [&](int64_t) { ran.fetch_add(1); }, 7);
+    ASSERT(ran == 1000, "hint for a node without participants is ignored");
+    ASSERT(exec::ThreadPool::participant() == -1, "participant() is -1 outside tasks");
+
+    exec::ThreadPool plain;
+    (void)plain.start(4);
+    ran = 0;
+    (void)plain.parallel_for(1000, [&](int64_t) { ran.fetch_add(1); }, 0);
+    ASSERT(!plain.numa() && ran == 1000 && plain.placement(1).cpu == -1, "plain pool ignores hints");
+}
+
+static void test_host() {
+    (void)exec::Topology::discover(topo);
+    exec::PoolOptions opt;
+    opt.threads = 3;
+    opt.topology = &topo;
+    exec::ThreadPool pool;
+    Status s = pool.start(opt);
+    ASSERT(s.is_ok() && pool.pinned() >= 0 && pool.pinned() <= 2, "host NUMA pool starts and pins workers");
+    std::printf("INFO: pinned %d of %d workers\n", pool.pinned(), opt.threads - 1);
+
+    const int64_t n = 1 << 20;
+    auto* buf = static_cast<float*>(mem_alloc(n * sizeof(float), 64, Device::CPU));
+    std::memset(buf, 0, n * sizeof(float));
+    int32_t node = exec::memory_node(buf);
+    bool known = node < 0;
+    for (int32_t i = 0; i < topo.num_cpus && !known; ++i) known = topo.cpus[i].node == node;
+    ASSERT(known, "memory_node reports a host node or -1");
+    (void)pool.parallel_for(n, [&](int64_t i) { buf[i] = 1.0f; }, node);
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i) sum += buf[i];
+    ASSERT(sum == static_cast<double>(n), "job hinted with a buffer's node covers the buffer");
+    std::printf("INFO: buffer lives on node %d\n", node);
+    mem_free(buf, Device::CPU);
+}
+
+int main() {
+    std::printf("=== Spec 025 — NUMA-Aware Thread Pool ===\n");
+
+    test_discovery();
+    test_placement();
+    test_jobs();
+    test_host();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,328 @@
+/**
+ * @file test_transport.cpp
+ * @brief Acceptance tests for spec 020 — memfd tensor transport.
+ *
+ * Tests derived from docs/specs/020-memfd-transport.md §4.
+ *
+ * The receiver is a forked child on the other end of a socketpair; it
+ * reports failed checks through its exit status.
+ */
+
+#include <zero/zero.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace zero;
+
+static int failures = 0;
+
+#define ASSERT(cond, msg)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("FAIL: %s\n", msg);                                     \
+            ++failures;                                                         \
+        } else {                                                                \
+            std::printf("PASS: %s\n", msg);                                     \
+        }                                                                       \
+    } while (0)
+
+#define CHECK(cond, msg)                                                        \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::printf("  receiver: %s\n", msg);                               \
+            ++bad;                                                              \
+        }                                                                       \
+    } while (0)
+
+// Fork a receiver running fn(sock); returns the parent's socket end.
+static pid_t spawn(int type, int (*fn)(int), int& sock) {
+    int sv[2];
+    if (socketpair(AF_UNIX, type, 0, sv) != 0) return -1;
+    std::fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        ::close(sv[0]);
+        int code = fn(sv[1]);
+        std::fflush(stdout);
+        _exit(code > 255 ? 255 : code);
+    }
+    ::close(sv[1]);
+    sock = sv[0];
+    return pid;
+}
+
+static int join(pid_t pid) {
+    int st = 0;
+    waitpid(pid, &st, 0);
+    return WIFEXITED(st) ? WEXITSTATUS(st) : 255;
+}
+
+// ─── one-shot ─────────────────────────────────────────────────────────
+
+static int oneshot_receiver(int sock) {
+    int bad = 0;
+    ipc::SharedRegion region;
+    Tensor t;
+    CHECK(ipc::recv_tensor(sock, region, t).is_ok(), "recv contiguous");
+    CHECK(t.ndim == 2 && t.shape[0] == 3 && t.shape[1] == 5 && t.dtype == DType::F32, "descriptor shape");
+    float* p = static_cast<float*>(t.data);
+    bool values = true;
+    for (int i = 0; i < 15; ++i) values = values && p[i] == static_cast<float>(i);
+    CHECK(values, "payload visible");
+    p[0] = -42.0f;   // written through the shared mapping
+
+    ipc::SharedRegion r2;
+    Tensor tt;
+    CHECK(ipc::recv_tensor(sock, r2, tt).is_ok(), "recv strided");
+    CHECK(tt.shape[0] == 5 && tt.shape[1] == 3 && tt.strides[0] == 4 && tt.strides[1] == 20 &&
+          !tt.is_contiguous(), "transposed strides preserved");
+    CHECK(*reinterpret_cast<float*>(static_cast<char*>(tt.data) + 2 * tt.strides[0] + 1 * tt.strides[1]) == 7.0f,
+          "strided element");
+    char ack = 1;
+    CHECK(::write(sock, &ack, 1) == 1, "ack");
+    ipc::SharedRegion r3;
+    Tensor bad_t;
+    CHECK(ipc::recv_tensor(sock, r3, bad_t).code == StatusCode::INVALID_STATE, "peer close reported");
+    region.close();
+    r2.close();
+    return bad;
+}
+
+static void test_oneshot(int type, const char* label) {
+    std::printf("\n--- one-shot over %s ---\n", label);
+    int sock = -1;
+    pid_t pid = spawn(type, oneshot_receiver, sock);
+    int64_t shape[2] = {3, 5};
+    ipc::SharedRegion region;
+    Tensor t;
+    ASSERT(ipc::memfd_tensor(shape, 2, DType::F32, region, t).is_ok(), "memfd tensor allocated");
+    for (int i = 0; i < 15; ++i) static_cast<float*>(t.data)[i] = static_cast<float>(i);
+    ASSERT(ipc::send_tensor(sock, region, t).is_ok(), "send contiguous");
+    Tensor tr = t;
+    std::swap(tr.shape[0], tr.shape[1]);
+    std::swap(tr.strides[0], tr.strides[1]);
+    ASSERT(ipc::send_tensor(sock, region, tr).is_ok(), "send transposed view");
+
+    Tensor outside = t;
+    outside.shape[0] = 4;
+    ASSERT(ipc::send_tensor(sock, region, outside).code == StatusCode::OUT_OF_BOUNDS, "view past the region rejected");
+
+    char ack = 0;
+    ASSERT(::read(sock, &ack, 1) == 1 && static_cast<float*>(t.data)[0] == -42.0f,
+           "receiver's write visible to sender (shared, not copied)");
+    ::close(sock);
+    ASSERT(join(pid) == 0, "receiver checks pass");
+    region.close();
+}
+
+// ─── ring ─────────────────────────────────────────────────────────────
+
+constexpr int RING_MESSAGES = 500;
+
+static int ring_receiver(int sock) {
+    int bad = 0;
+    ipc::TensorReceiver rx;
+    CHECK(rx.init(sock).is_ok(), "ring handshake");
+    for (int i = 0; i < RING_MESSAGES; ++i) {
+        Tensor t;
+        if (rx.recv(t).is_error()) {
+            CHECK(false, "recv");
+            break;
+        }
+        const int32_t* p = static_cast<const int32_t*>(t.data);
+        bool ok = t.numel() == 1 + i % 13;
+        for (int64_t j = 0; ok && j < t.numel(); ++j) ok = p[j] == i;
+        CHECK(ok, "payload in order");
+        CHECK(rx.release(t).is_ok(), "release");
+        if (i == 0) CHECK(rx.release(t).code == StatusCode::INVALID_STATE, "double release rejected");
+    }
+    return bad;
+}
+
+static void test_ring() {
+    std::printf("\n--- slot ring ---\n");
+    int sock = -1;
+    pid_t pid = spawn(SOCK_SEQPACKET, ring_receiver, sock);
+    ipc::TensorSender tx;
+    ipc::TransportOptions opt;
+    opt.slots = 3;
+    opt.slot_bytes = 256;
+    ASSERT(tx.init(sock, opt).is_ok() && tx.slots() == 3 && tx.slot_bytes() == 4096, "ring created and sent");
+    bool ok = true;
+    const void* seen[3] = {};
+    int distinct = 0;
+    for (int i = 0; i < RING_MESSAGES && ok; ++i) {
+        int64_t shape[1] = {1 + i % 13};
+        Tensor t;
+        ok = tx.acquire(shape, 1, DType::I32, t).is_ok();
+        if (!ok) break;
+        for (int64_t j = 0; j < shape[0]; ++j) static_cast<int32_t*>(t.data)[j] = i;
+        bool known = false;
+        for (int k = 0; k < distinct; ++k) known = known || seen[k] == t.data;
+        if (!known && distinct < 3) seen[distinct++] = t.data;
+        else if (!known) ok = false;
+        ok = ok && tx.send(t).is_ok();
+    }
+    ASSERT(ok, "500 transfers reuse the same 3 slots");
+    ASSERT(join(pid) == 0, "receiver saw every payload in order");
+
+    int64_t big[1] = {2048};
+    Tensor t;
+    ASSERT(tx.acquire(big, 1, DType::I32, t).code == StatusCode::INVALID_ARGUMENT, "oversized tensor rejected");
+    Tensor stray = Tensor::alloc(big, 1, DType::I32);
+    ASSERT(tx.send(stray).code == StatusCode::OUT_OF_BOUNDS, "tensor outside the ring rejected");
+    stray.free();
+    ::close(sock);
+}
+
+static int idle_receiver(int sock) {
+    ipc::TensorReceiver rx;
+    if (rx.init(sock).is_error()) return 1;
+    char c;
+    return ::read(sock, &c, 1) == 0 ? 0 : 1;   // never releases; wait for close
+}
+
+static void test_exhaustion() {
+    std::printf("\n--- slot exhaustion ---\n");
+    int sock = -1;
+    pid_t pid = spawn(SOCK_SEQPACKET, idle_receiver, sock);
+    ipc::TensorSender tx;
+    ipc::TransportOptions opt;
+    opt.slots = 2;
+    opt.timeout_ms = 100;
+    (void)tx.init(sock, opt);
+    int64_t shape[1] = {4};
+    Tensor a, b, c;
+    bool two = tx.acquire(shape, 1, DType::F32, a).is_ok() && tx.acquire(shape, 1, DType::F32, b).is_ok();
+    ASSERT(two, "both slots acquired");
+    ASSERT(tx.acquire(shape, 1, DType::F32, c).code == StatusCode::INVALID_STATE, "third acquire times out");
+    ::close(sock);
+    ASSERT(join(pid) == 0, "idle receiver exits on close");
+}
+
+static void test_send_failure() {
+    std::printf("\n--- failed send keeps the slot acquired ---\n");
+    int sv[2];
+    ASSERT(socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sv) == 0, "socketpair");
+    ipc::TensorSender tx;
+    ipc::TransportOptions opt;
+    opt.slots = 1;
+    opt.timeout_ms = 100;
+    ASSERT(tx.init(sv[0], opt).is_ok(), "sender initialized");
+    ::close(sv[1]);  // peer gone: every send now fails with EPIPE
+    int64_t shape[1] = {4};
+    Tensor a, b;
+    ASSERT(tx.acquire(shape, 1, DType::F32, a).is_ok(), "only slot acquired");
+    ASSERT(tx.send(a).code == StatusCode::INVALID_STATE, "send to a closed peer fails");
+    Status retry = tx.send(a);
+    ASSERT(retry.code == StatusCode::INVALID_STATE && std::strcmp(retry.msg, "transport send failed") == 0,
+           "slot is still acquired, so send can be retried");
+    ASSERT(tx.acquire(shape, 1, DType::F32, b).code == StatusCode::INVALID_STATE, "slot still held by the sender");
+    ASSERT(tx.abandon(a).is_ok(), "abandon returns the slot");
+    ASSERT(tx.abandon(a).code == StatusCode::INVALID_STATE, "second abandon rejected");
+    ASSERT(tx.acquire(shape, 1, DType::F32, b).is_ok() && b.data == a.data, "slot reusable after abandon");
+    ::close(sv[0]);
+}
+
+static void test_bad_fd() {
+    std::printf("\n--- unsealed fd ---\n");
+    int fd = memfd_create("plain", MFD_CLOEXEC);
+    ASSERT(fd >= 0 && ftruncate(fd, 4096) == 0, "plain memfd created");
+    ipc::SharedRegion r;
+    ASSERT(ipc::SharedRegion::adopt(fd, r).code == StatusCode::INVALID_ARGUMENT, "unsealed region refused");
+}
+
+// ─── timing ───────────────────────────────────────────────────────────
+
+constexpr int64_t BENCH_BYTES = int64_t{4} << 20;
+constexpr int BENCH_ITERS = 20;
+
+static int copy_receiver(int sock) {
+    char* buf = new char[BENCH_BYTES];
+    for (int i = 0; i < BENCH_ITERS; ++i) {
+        int64_t got = 0;
+        while (got < BENCH_BYTES) {
+            ssize_t n = ::read(sock, buf + got, static_cast<size_t>(BENCH_BYTES - got));
+            if (n <= 0) return 1;
+            got += n;
+        }
+        char ack = 1;
+        if (::write(sock, &ack, 1) != 1) return 1;
+    }
+    delete[] buf;
+    return 0;
+}
+
+static int bench_receiver(int sock) {
+    ipc::TensorReceiver rx;
+    if (rx.init(sock).is_error()) return 1;
+    for (int i = 0; i < BENCH_ITERS; ++i) {
+        Tensor t;
+        if (rx.recv(t).is_error() || rx.release(t).is_error()) return 1;
+    }
+    return 0;
+}
+
+static void test_timing() {
+    std::printf("\n--- 4 MiB: socket copy vs slot ring (informational) ---\n");
+    int sock = -1;
+    pid_t pid = spawn(SOCK_STREAM, copy_receiver, sock);
+    char* buf = new char[BENCH_BYTES];
+    std::memset(buf, 1, static_cast<size_t>(BENCH_BYTES));
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_ITERS; ++i) {
+        int64_t put = 0;
+        while (put < BENCH_BYTES) {
+            ssize_t n = ::write(sock, buf + put, static_cast<size_t>(BENCH_BYTES - put));
+            if (n <= 0) break;
+            put += n;
+        }
+        char ack;
+        if (::read(sock, &ack, 1) != 1) break;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    ::close(sock);
+    join(pid);
+    delete[] buf;
+
+    pid = spawn(SOCK_SEQPACKET, bench_receiver, sock);
+    ipc::TensorSender tx;
+    ipc::TransportOptions opt;
+    opt.slots = 2;
+    opt.slot_bytes = BENCH_BYTES;
+    (void)tx.init(sock, opt);
+    int64_t shape[1] = {BENCH_BYTES / 4};
+    auto t2 = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_ITERS; ++i) {
+        Tensor t;
+        if (tx.acquire(shape, 1, DType::F32, t).is_error() || tx.send(t).is_error()) break;
+    }
+    int code = join(pid);
+    auto t3 = std::chrono::steady_clock::now();
+    ::close(sock);
+    std::printf("INFO: per transfer: socket copy %.1f us, ring %.1f us (receiver %s)\n",
+                std::chrono::duration<double, std::micro>(t1 - t0).count() / BENCH_ITERS,
+                std::chrono::duration<double, std::micro>(t3 - t2).count() / BENCH_ITERS,
+                code == 0 ? "ok" : "failed");
+}
+
+int main() {
+    std::printf("=== Spec 020 — Memfd Tensor Transport ===\n");
+    std::setvbuf(stdout, nullptr, _IOLBF, 0);
+
+    test_oneshot(SOCK_SEQPACKET, "SOCK_SEQPACKET");
+    test_oneshot(SOCK_STREAM, "SOCK_STREAM");
+    test_ring();
+    test_exhaustion();
+    test_send_failure();
+    test_bad_fd();
+    test_timing();
+
+    std::printf("\n=== Result: %d failure(s) ===\n", failures);
+    return failures == 0 ? 0 : 1;
+}